@@ -2,13 +2,18 @@ struct buf;
 struct context;
 struct file;
 struct inode;
+struct memstat;
 struct pipe;
 struct proc;
+struct procinfo;
 struct rtcdate;
+struct shm;
 struct spinlock;
 struct sleeplock;
+struct slabcache;
 struct stat;
 struct superblock;
+struct vma;
 
 // bio.c
 void            binit(void);
@@ -24,6 +29,7 @@ void            panic(char*) __attribute__((noreturn));
 
 // exec.c
 int             exec(char*, char**);
+int             execnew(struct proc*, char*, char**);
 
 // file.c
 struct file*    filealloc(void);
@@ -64,10 +70,19 @@ extern uchar    ioapicid;
 void            ioapicinit(void);
 
 // kalloc.c
+extern uint     physstop;
 char*           kalloc(void);
+char*           kalloc_pages(int);
+char*           kalloc_zeroed(void);
+char*           kdup(char*);
 void            kfree(char*);
+void            kfree_pages(char*, int);
+uint            kfreepages(void);
+int             kref(char*);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
+void            kmemstat(struct memstat*);
+int             kzeroidle(void);
 
 // kbd.c
 void            kbdintr(void);
@@ -78,6 +93,7 @@ int             lapicid(void);
 extern volatile uint*    lapic;
 void            lapiceoi(void);
 void            lapicinit(void);
+void            lapicipi(int, int);
 void            lapicstartap(uchar, uint);
 void            microdelay(int);
 
@@ -87,15 +103,27 @@ void            log_write(struct buf*);
 void            begin_op();
 void            end_op();
 
+// lz.c
+int             lzcompress(uchar*, int, uchar*, int);
+int             lzdecompress(uchar*, int, uchar*, int);
+
 // mp.c
 extern int      ismp;
 void            mpinit(void);
 
+// pcache.c
+void            pcinit(void);
+char*           pcget(struct inode*, uint, int);
+void            pcwrite(struct inode*, char*, uint, uint);
+void            pcinval(struct inode*, uint, uint);
+void            pcstat(struct memstat*);
+
 // picirq.c
 void            picenable(int);
 void            picinit(void);
 
 // pipe.c
+void            pipeinit(void);
 int             pipealloc(struct file**, struct file**);
 void            pipeclose(struct pipe*, int);
 int             piperead(struct pipe*, char*, int);
@@ -104,18 +132,26 @@ int             pipewrite(struct pipe*, char*, int);
 //PAGEBREAK: 16
 // proc.c
 int             cpuid(void);
+void            boost(void);
+int             evict(uint*, char**, int);
 void            exit(void);
 int             fork(void);
+int             getaffinity(int);
 int             growproc(int);
 int             kill(int);
 struct cpu*     mycpu(void);
 struct proc*    myproc();
 void            pinit(void);
 void            procdump(void);
+int             procinfo(uint, int);
 void            scheduler(void) __attribute__((noreturn));
 void            sched(void);
+int             setaffinity(int, uint);
+int             setpriority(int, int);
 void            setproc(struct proc*);
 void            sleep(void*, struct spinlock*);
+int             slicetick(void);
+int             spawn(char*, char**, struct file**);
 void            userinit(void);
 int             wait(void);
 void            wakeup(void*);
@@ -124,6 +160,23 @@ void            yield(void);
 // swtch.S
 void            swtch(struct context**, struct context*);
 
+// shm.c
+void            shminit(void);
+int             shmget(int, uint);
+uint            shmat(int);
+void            shmdup(struct shm*);
+void            shmput(struct shm*);
+int             shmrm(int);
+
+// slab.c
+void            slabinit(void);
+struct slabcache* slabcreate(char*, uint);
+void*           slaballoc(struct slabcache*);
+void            slabfree(struct slabcache*, void*);
+void*           kmalloc(uint);
+void            kmfree(void*);
+void            slabstat(struct memstat*);
+
 // spinlock.c
 void            acquire(struct spinlock*);
 void            getcallerpcs(void*, uint*);
@@ -148,8 +201,18 @@ int             strlen(const char*);
 int             strncmp(const char*, const char*, uint);
 char*           strncpy(char*, const char*, int);
 
+// swap.c
+void            swapinit(void);
+int             swapout(void);
+int             swapin(uint*);
+void            swapdup(uint);
+void            swapfree(uint);
+uint            swapfreepages(void);
+void            swapstat(struct memstat*);
+
 // syscall.c
 int             argint(int, int*);
+int             argout(int, char**, int);
 int             argptr(int, char**, int);
 int             argstr(int, char**);
 int             fetchint(uint, int*);
@@ -179,12 +242,19 @@ int             allocuvm(pde_t*, uint, uint);
 int             deallocuvm(pde_t*, uint, uint);
 void            freevm(pde_t*);
 void            inituvm(pde_t*, char*, uint);
-int             loaduvm(pde_t*, char*, struct inode*, uint, uint);
-pde_t*          copyuvm(pde_t*, uint);
+pde_t*          copyuvm(pde_t*);
 void            switchuvm(struct proc*);
 void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
 void            clearpteu(pde_t *pgdir, char *uva);
+int             pagefault(uint, uint);
+int             uvmprefault(uint, uint, int);
+int             uvmevict(struct proc*, uint*, char**, int);
+void            freevmas(struct vma*);
+int             uvmvalid(uint, uint);
+uint            mmapbase(struct proc*);
+uint            mmap(uint, int, struct inode*, uint, struct shm*);
+int             munmap(uint, uint);
 
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
@@ -6,18 +6,35 @@
 #include "defs.h"
 #include "x86.h"
 #include "elf.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
 
-int
-exec(char *path, char **argv)
+// A program loaded into a new address space, ready to be
+// installed in a process.
+struct image {
+  pde_t *pgdir;
+  uint sz;
+  uint entry;
+  uint sp;
+  struct vma vma[NVMA];
+};
+
+// Load the program in path, with arguments argv, into a new
+// address space. The program's segments are not read here: load
+// records them as file-backed regions and pagefault() reads each
+// page in the first time the program touches it.
+static int
+load(char *path, char **argv, struct image *im)
 {
-  char *s, *last;
-  int i, off;
+  int i, off, nvma;
   uint argc, sz, sp, ustack[3+MAXARG+1];
   struct elfhdr elf;
   struct inode *ip;
   struct proghdr ph;
-  pde_t *pgdir, *oldpgdir;
-  struct proc *curproc = myproc();
+  pde_t *pgdir;
+  struct vma *vma = im->vma;
 
   begin_op();
 
@@ -28,6 +45,8 @@ exec(char *path, char **argv)
   }
   ilock(ip);
   pgdir = 0;
+  nvma = 0;
+  memset(vma, 0, sizeof(im->vma));
 
   // Check ELF header
   if(readi(ip, (char*)&elf, 0, sizeof(elf)) != sizeof(elf))
@@ -49,30 +68,49 @@ exec(char *path, char **argv)
       goto bad;
     if(ph.vaddr + ph.memsz < ph.vaddr)
       goto bad;
-    if((sz = allocuvm(pgdir, sz, ph.vaddr + ph.memsz)) == 0)
+    if(ph.vaddr + ph.memsz >= KERNBASE)
       goto bad;
     if(ph.vaddr % PGSIZE != 0)
       goto bad;
-    if(loaduvm(pgdir, (char*)ph.vaddr, ip, ph.off, ph.filesz) < 0)
+    if(ph.off + ph.filesz < ph.off || ph.off + ph.filesz > ip->size)
       goto bad;
+    if(ph.vaddr + ph.memsz > sz)
+      sz = ph.vaddr + ph.memsz;
+    if(ph.filesz == 0)
+      continue;
+    if(nvma == NVMA)
+      goto bad;
+    vma[nvma].start = ph.vaddr;
+    vma[nvma].end = PGROUNDUP(ph.vaddr + ph.filesz);
+    vma[nvma].flags = (ph.flags & ELF_PROG_FLAG_WRITE) ? VMA_WRITE : 0;
+    vma[nvma].ip = idup(ip);
+    vma[nvma].off = ph.off;
+    vma[nvma].filesz = ph.filesz;
+    nvma++;
   }
   iunlockput(ip);
   end_op();
   ip = 0;
 
-  // Allocate two pages at the next page boundary.
-  // Make the first inaccessible.  Use the second as the user stack.
+  // Allocate an inaccessible guard page at the next page
+  // boundary, and reserve USTACKSIZE bytes above it for the user
+  // stack. Like the heap, the stack gets a page of memory the first
+  // time it is touched, so it grows on demand.
   sz = PGROUNDUP(sz);
-  if((sz = allocuvm(pgdir, sz, sz + 2*PGSIZE)) == 0)
+  if((sz = allocuvm(pgdir, sz, sz + PGSIZE)) == 0)
     goto bad;
-  clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
+  clearpteu(pgdir, (char*)(sz - PGSIZE));
+  sz += USTACKSIZE;
   sp = sz;
 
   // Push argument strings, prepare rest of stack in ustack.
+  // The arguments must fit in the top page of the stack.
   for(argc = 0; argv[argc]; argc++) {
     if(argc >= MAXARG)
       goto bad;
     sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
+    if(sp < sz - PGSIZE)
+      goto bad;
     if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
       goto bad;
     ustack[3+argc] = sp;
@@ -84,31 +122,82 @@ exec(char *path, char **argv)
   ustack[2] = sp - (argc+1)*4;  // argv pointer
 
   sp -= (3+argc+1) * 4;
-  if(copyout(pgdir, sp, ustack, (3+argc+1)*4) < 0)
+  if(sp < sz - PGSIZE || copyout(pgdir, sp, ustack, (3+argc+1)*4) < 0)
     goto bad;
 
-  // Save program name for debugging.
+  im->pgdir = pgdir;
+  im->sz = sz;
+  im->entry = elf.entry;
+  im->sp = sp;
+  return 0;
+
+ bad:
+  if(pgdir)
+    freevm(pgdir);
+  if(ip)
+    iunlockput(ip);
+  else
+    begin_op();
+  freevmas(vma);
+  end_op();
+  return -1;
+}
+
+// Save the last element of path in p as its name, for debugging.
+static void
+setname(struct proc *p, char *path)
+{
+  char *s, *last;
+
   for(last=s=path; *s; s++)
     if(*s == '/')
       last = s+1;
-  safestrcpy(curproc->name, last, sizeof(curproc->name));
+  safestrcpy(p->name, last, sizeof(p->name));
+}
+
+// Replace the current process's image with the program in path.
+int
+exec(char *path, char **argv)
+{
+  struct image im;
+  pde_t *oldpgdir;
+  struct proc *curproc = myproc();
+
+  if(load(path, argv, &im) < 0)
+    return -1;
+  setname(curproc, path);
 
   // Commit to the user image.
+  munmap(0, KERNBASE);
+  begin_op();
+  freevmas(curproc->vma);
+  end_op();
+  memmove(curproc->vma, im.vma, sizeof(im.vma));
   oldpgdir = curproc->pgdir;
-  curproc->pgdir = pgdir;
-  curproc->sz = sz;
-  curproc->tf->eip = elf.entry;  // main
-  curproc->tf->esp = sp;
+  curproc->pgdir = im.pgdir;
+  curproc->sz = im.sz;
+  curproc->tf->eip = im.entry;  // main
+  curproc->tf->esp = im.sp;
   switchuvm(curproc);
   freevm(oldpgdir);
   return 0;
+}
 
- bad:
-  if(pgdir)
-    freevm(pgdir);
-  if(ip){
-    iunlockput(ip);
-    end_op();
-  }
-  return -1;
+// Load the program in path into p, a new process that has no
+// user memory yet, for spawn(). Unlike exec, the current
+// process's image is left alone, and argv may point into it.
+int
+execnew(struct proc *p, char *path, char **argv)
+{
+  struct image im;
+
+  if(load(path, argv, &im) < 0)
+    return -1;
+  setname(p, path);
+  memmove(p->vma, im.vma, sizeof(im.vma));
+  p->pgdir = im.pgdir;
+  p->sz = im.sz;
+  p->tf->eip = im.entry;
+  p->tf->esp = im.sp;
+  return 0;
 }
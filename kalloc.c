@@ -1,6 +1,34 @@
 // Physical memory allocator, intended to allocate
 // memory for user processes, kernel stacks, page table pages,
-// and pipe buffers. Allocates 4096-byte pages.
+// and pipe buffers. Allocates 4096-byte pages, or physically
+// contiguous blocks of 2^order pages with kalloc_pages().
+//
+// Free memory is kept by a buddy allocator: a block of 2^k pages
+// starts at a multiple of 2^k pages, and when it is freed while
+// its buddy (the other half of the 2^(k+1) block) is free too,
+// the two are merged. kmem.order[] records the order of each
+// free block by its first page.
+//
+// Memory above 4MB is never walked at boot. kinit2() only records
+// it as an untouched region, and balloc() carves 2^MAXORDER-page
+// blocks off its bottom, like a bump pointer, when the buddy lists
+// run dry. A page is first written when it is handed out.
+//
+// Each CPU keeps a private cache of free single pages, so most
+// calls to kalloc() and kfree() never touch the global kmem.lock.
+// A CPU refills its cache from the buddy lists, and drains it
+// back, KBATCH pages at a time. When both its cache and the buddy
+// lists are empty it steals half of another CPU's cache.
+//
+// Every allocated page has a reference count, so that fork()
+// can share pages copy-on-write between parent and child.
+// kfree() drops a reference and frees the page with the last one.
+//
+// CPUs with nothing to run zero free pages ahead of time into a
+// pool of up to NZEROPOOL pages (see kzeroidle), from which
+// kalloc_zeroed() hands out pages without clearing them first.
+// Freed pages are filled with junk only if the kernel is built
+// with -DKJUNK.
 
 #include "types.h"
 #include "defs.h"
@@ -8,6 +36,11 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "spinlock.h"
+#include "x86.h"
+#include "memstat.h"
+
+#define KBATCH    32          // pages moved per refill or drain
+#define KCACHEMAX (4*KBATCH)  // drain a CPU cache above this size
 
 void freerange(void *vstart, void *vend);
 extern char end[]; // first address after kernel loaded from ELF file
@@ -15,31 +48,131 @@ extern char end[]; // first address after kernel loaded from ELF file
 
 struct run {
   struct run *next;
+  struct run *prev;   // buddy lists only
+};
+
+#define MAXORDER (KORDERS-1)  // largest block is 2^MAXORDER pages
+#define BFREE    0x80         // kmem.order[] flag: free buddy block
+
+// Per-CPU cache of free pages. The owning CPU takes the
+// lock with interrupts off; other CPUs take it only to steal.
+struct kcpu {
+  struct spinlock lock;
+  struct run *freelist;
+  int nfree;
+  uint nrefill;   // refills from the buddy lists
+  uint ndrain;    // drains to the buddy lists
+  uint nsteal;    // pages stolen from other CPUs
 };
 
 struct {
   struct spinlock lock;
   int use_lock;
-  struct run *freelist;
+  struct run *freelist[KORDERS];  // free blocks of 2^k pages
+  uint nblocks[KORDERS];
+  int nfree;      // pages in the buddy lists
+  char *untouched;      // next block of the never-used region
+  char *untouchedend;
+  uint nlock;     // times lock was acquired
+  struct kcpu cpu[NCPU];
+  int *ref;       // reference counts, by physical page number
+  uchar *order;   // BFREE|k at the first page of a free block
+  struct spinlock zlock;
+  struct run *zeroed;   // pool of zeroed pages
+  int nzero;
+  uint nzerohit;        // kalloc_zeroed() calls served by the pool
+  uint nzeromiss;       // kalloc_zeroed() calls that had to clear a page
 } kmem;
 
+uint physstop;  // top of physical memory, set by kinit1()
+
+// Entry of the BIOS memory map saved by bootasm.S.
+struct e820 {
+  uint addr;
+  uint addrhi;
+  uint len;
+  uint lenhi;
+  uint type;      // 1 for usable memory
+};
+
+// Find the top of the usable memory that starts at EXTMEM in
+// the BIOS memory map, rounded down to a large page since the
+// kernel maps it with large pages, and capped to the
+// KERNBASE..DEVSPACE window and to maxpages pages.
+// Without a map, assume PHYSTOP.
+static uint
+detectmem(uint maxpages)
+{
+  struct e820 *e, *last;
+  uint top, len;
+
+  top = PHYSTOP;
+  e = (struct e820*)P2V(E820MAP + 4);
+  last = (struct e820*)P2V((uint)*(ushort*)P2V(E820MAP));
+  if(last > e + 128)
+    last = e;  // not a map bootasm.S made
+  for(; e < last; e++){
+    if(e->type != 1 || e->addrhi != 0 || e->addr > EXTMEM)
+      continue;
+    len = e->lenhi ? 0xFFFFFFFF : e->len;
+    if(e->addr + len < e->addr)
+      len = -e->addr;
+    if(e->addr + len > EXTMEM){
+      top = e->addr + len;
+      break;
+    }
+  }
+  if(top > DEVSPACE - KERNBASE)
+    top = DEVSPACE - KERNBASE;
+  if(top / PGSIZE > maxpages)
+    top = maxpages * PGSIZE;
+  top = top & ~(LPGSIZE - 1);
+  if(top < 2*LPGSIZE)
+    panic("detectmem");
+  return top;
+}
+
 // Initialization happens in two phases.
 // 1. main() calls kinit1() while still using entrypgdir to place just
-// the pages mapped by entrypgdir on free list.
+// the pages mapped by entrypgdir on free list. Before that it sizes
+// physical memory and takes the per-page arrays from the start of
+// that range, leaving at least KEEPPAGES pages for the free list.
 // 2. main() calls kinit2() with the rest of the physical pages
 // after installing a full page table that maps them on all cores.
+// These are not put on the free lists yet; see balloc().
+#define KEEPPAGES 64
+
 void
 kinit1(void *vstart, void *vend)
 {
+  int i;
+  uint npages;
+
   initlock(&kmem.lock, "kmem");
+  initlock(&kmem.zlock, "kzero");
+  for(i = 0; i < NCPU; i++)
+    initlock(&kmem.cpu[i].lock, "kmemcpu");
   kmem.use_lock = 0;
+
+  vstart = (void*)PGROUNDUP((uint)vstart);
+  npages = ((char*)vend - (char*)vstart - KEEPPAGES*PGSIZE) /
+           (sizeof(kmem.ref[0]) + sizeof(kmem.order[0]));
+  physstop = detectmem(npages);
+  npages = physstop / PGSIZE;
+  kmem.ref = (int*)vstart;
+  kmem.order = (uchar*)(kmem.ref + npages);
+  vstart = kmem.order + npages;
+  memset(kmem.ref, 0, (char*)vstart - (char*)kmem.ref);
   freerange(vstart, vend);
 }
 
 void
 kinit2(void *vstart, void *vend)
 {
-  freerange(vstart, vend);
+  if(V2P(vstart) % (PGSIZE << MAXORDER) || V2P(vend) % (PGSIZE << MAXORDER))
+    panic("kinit2");
+  kmem.untouched = vstart;
+  kmem.untouchedend = vend;
   kmem.use_lock = 1;
 }
 
@@ -51,46 +184,444 @@ freerange(void *vstart, void *vend)
   for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
     kfree(p);
 }
+
+#define PFN(v) (V2P(v)/PGSIZE)
+
+// Add the free block r of 2^k pages to its buddy list.
+static void
+bpush(struct run *r, int k)
+{
+  r->prev = 0;
+  r->next = kmem.freelist[k];
+  if(r->next)
+    r->next->prev = r;
+  kmem.freelist[k] = r;
+  kmem.nblocks[k]++;
+  kmem.order[PFN(r)] = BFREE | k;
+}
+
+// Take the free block r of 2^k pages off its buddy list.
+static void
+bremove(struct run *r, int k)
+{
+  if(r->prev)
+    r->prev->next = r->next;
+  else
+    kmem.freelist[k] = r->next;
+  if(r->next)
+    r->next->prev = r->prev;
+  kmem.nblocks[k]--;
+  kmem.order[PFN(r)] = 0;
+}
+
+// Free the block of 2^k pages at v, merging it with its buddy
+// for as long as the buddy is free as well.
+// Caller holds kmem.lock.
+static void
+bfree(char *v, int k)
+{
+  uint pfn, bpfn;
+
+  kmem.nfree += 1 << k;
+  pfn = PFN(v);
+  for(; k < MAXORDER; k++){
+    bpfn = pfn ^ (1 << k);
+    if(bpfn >= physstop/PGSIZE || kmem.order[bpfn] != (BFREE | k))
+      break;
+    bremove((struct run*)P2V(bpfn*PGSIZE), k);
+    pfn &= ~(1 << k);
+  }
+  bpush((struct run*)P2V(pfn*PGSIZE), k);
+}
+
+// Allocate a block of 2^k pages, splitting a larger block
+// if there is no free one of the right size, or taking a new
+// block from the untouched region if there is none at all.
+// Caller holds kmem.lock.
+static char*
+balloc(int k)
+{
+  struct run *r;
+  int j;
+
+  for(j = k; j <= MAXORDER && kmem.freelist[j] == 0; j++)
+    ;
+  if(j > MAXORDER){
+    if(kmem.untouched == kmem.untouchedend)
+      return 0;
+    j = MAXORDER;
+    r = (struct run*)kmem.untouched;
+    kmem.untouched += PGSIZE << MAXORDER;
+    kmem.nfree += 1 << MAXORDER;
+  } else {
+    r = kmem.freelist[j];
+    bremove(r, j);
+  }
+  while(j > k){
+    j--;
+    bpush((struct run*)((char*)r + (PGSIZE << j)), j);
+  }
+  kmem.nfree -= 1 << k;
+  return (char*)r;
+}
+
+// Move up to KBATCH pages from the buddy lists
+// into kc. Caller holds kc->lock.
+static void
+refill(struct kcpu *kc)
+{
+  struct run *r;
+  int n;
+
+  acquire(&kmem.lock);
+  kmem.nlock++;
+  for(n = 0; n < KBATCH && (r = (struct run*)balloc(0)) != 0; n++){
+    r->next = kc->freelist;
+    kc->freelist = r;
+  }
+  release(&kmem.lock);
+  kc->nfree += n;
+  kc->nrefill++;
+}
+
+// Move up to max pages from kc back to the buddy lists.
+// Caller holds kc->lock.
+static void
+drain(struct kcpu *kc, int max)
+{
+  struct run *r;
+  int n;
+
+  acquire(&kmem.lock);
+  kmem.nlock++;
+  for(n = 0; n < max && (r = kc->freelist) != 0; n++){
+    kc->freelist = r->next;
+    bfree((char*)r, 0);
+  }
+  release(&kmem.lock);
+  kc->nfree -= n;
+  kc->ndrain++;
+}
+
+// Take half of the first non-empty cache of another CPU.
+// Returns one page and keeps the rest in kc.
+// Caller holds no kmem locks, so two CPUs stealing
+// from each other cannot deadlock.
+static struct run*
+steal(struct kcpu *kc)
+{
+  struct kcpu *v;
+  struct run *r, *first, *last;
+  int n;
+
+  for(v = kmem.cpu; v < &kmem.cpu[NCPU]; v++){
+    if(v == kc || v->nfree == 0)
+      continue;
+    acquire(&v->lock);
+    first = v->freelist;
+    last = 0;
+    for(n = 0; n < (v->nfree+1)/2; n++){
+      last = v->freelist;
+      v->freelist = last->next;
+    }
+    v->nfree -= n;
+    release(&v->lock);
+    if(n == 0)
+      continue;
+
+    r = first;
+    acquire(&kc->lock);
+    last->next = kc->freelist;
+    kc->freelist = r->next;
+    kc->nfree += n - 1;
+    kc->nsteal += n;
+    release(&kc->lock);
+    return r;
+  }
+  return 0;
+}
+
 //PAGEBREAK: 21
-// Free the page of physical memory pointed at by v,
-// which normally should have been returned by a
-// call to kalloc().  (The exception is when
-// initializing the allocator; see kinit above.)
+// Drop a reference to the page of physical memory pointed
+// at by v, which normally should have been returned by a
+// call to kalloc(), and free it if that was the last one.
+// (The exception is when initializing the allocator;
+// see kinit above.)
 void
 kfree(char *v)
 {
   struct run *r;
+  struct kcpu *kc;
+  int ref;
 
-  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+  if((uint)v % PGSIZE || v < end || V2P(v) >= physstop)
     panic("kfree");
 
+  if(kmem.use_lock){
+    ref = xadd(&kmem.ref[V2P(v)/PGSIZE], -1);
+    if(ref > 1)
+      return;
+    if(ref < 1)
+      panic("kfree: ref");
+  }
+
+#ifdef KJUNK
   // Fill with junk to catch dangling refs.
   memset(v, 1, PGSIZE);
+#endif
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
   r = (struct run*)v;
-  r->next = kmem.freelist;
-  kmem.freelist = r;
-  if(kmem.use_lock)
-    release(&kmem.lock);
+  if(!kmem.use_lock){
+    bfree(v, 0);
+    return;
+  }
+
+  pushcli();
+  kc = &kmem.cpu[cpuid()];
+  acquire(&kc->lock);
+  r->next = kc->freelist;
+  kc->freelist = r;
+  kc->nfree++;
+  if(kc->nfree > KCACHEMAX)
+    drain(kc, KBATCH);
+  release(&kc->lock);
+  popcli();
+}
+
+// Take a page from the zeroed pool, or return 0 if it is empty.
+// The page keeps the reference it was allocated with. Clears
+// the pool link so that the whole page is zero again.
+static char*
+zget(void)
+{
+  struct run *r;
+
+  acquire(&kmem.zlock);
+  r = kmem.zeroed;
+  if(r){
+    kmem.zeroed = r->next;
+    kmem.nzero--;
+    r->next = 0;
+  }
+  release(&kmem.zlock);
+  return (char*)r;
+}
+
+// Take a free page from this CPU's cache, the buddy lists,
+// another CPU's cache or the zeroed pool, or return 0.
+static struct run*
+kget(void)
+{
+  struct run *r;
+  struct kcpu *kc;
+
+  pushcli();
+  kc = &kmem.cpu[cpuid()];
+  acquire(&kc->lock);
+  if(kc->freelist == 0)
+    refill(kc);
+  r = kc->freelist;
+  if(r){
+    kc->freelist = r->next;
+    kc->nfree--;
+  }
+  release(&kc->lock);
+  if(r == 0)
+    r = steal(kc);
+  popcli();
+  if(r == 0)
+    r = (struct run*)zget();
+  return r;
 }
 
 // Allocate one 4096-byte page of physical memory.
 // Returns a pointer that the kernel can use.
 // Returns 0 if the memory cannot be allocated.
+// When memory runs out, user pages are swapped out
+// to make room if the caller can sleep.
 char*
 kalloc(void)
 {
   struct run *r;
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
-  r = kmem.freelist;
+  if(!kmem.use_lock){
+    r = (struct run*)balloc(0);
+    if(r)
+      kmem.ref[V2P(r)/PGSIZE] = 1;
+    return (char*)r;
+  }
+
+  while((r = kget()) == 0 && swapout() > 0)
+    ;
   if(r)
-    kmem.freelist = r->next;
-  if(kmem.use_lock)
-    release(&kmem.lock);
+    kmem.ref[V2P(r)/PGSIZE] = 1;
   return (char*)r;
 }
 
+// Allocate one page of physical memory filled with zeros.
+// Returns 0 if the memory cannot be allocated.
+char*
+kalloc_zeroed(void)
+{
+  char *v;
+
+  if(kmem.use_lock && (v = zget()) != 0){
+    kmem.nzerohit++;
+    return v;
+  }
+  kmem.nzeromiss++;
+  if((v = kalloc()) != 0)
+    memset(v, 0, PGSIZE);
+  return v;
+}
+
+// Called by scheduler() when this CPU found nothing to run:
+// zero one free page into the pool, unless the pool is full.
+// Runs with interrupts on and no locks held, so a process that
+// becomes runnable meanwhile waits for at most one page.
+// Returns 1 if it zeroed a page, 0 if there was nothing to do.
+int
+kzeroidle(void)
+{
+  struct run *r;
+
+  if(kmem.nzero >= NZEROPOOL)
+    return 0;
+  if((r = (struct run*)kalloc()) == 0)
+    return 0;
+  memset(r, 0, PGSIZE);
+  acquire(&kmem.zlock);
+  r->next = kmem.zeroed;
+  kmem.zeroed = r;
+  kmem.nzero++;
+  release(&kmem.zlock);
+  return 1;
+}
+
+// Allocate 2^order physically contiguous pages, aligned to
+// their size. Returns a pointer that the kernel can use, or 0
+// if there is no free block that large. Single pages come from
+// kalloc(); for larger blocks the zeroed pool and the per-CPU
+// caches are drained back first if that might let buddies merge.
+char*
+kalloc_pages(int order)
+{
+  struct kcpu *kc;
+  char *v;
+
+  if(order < 0 || order > MAXORDER)
+    return 0;
+  if(order == 0)
+    return kalloc();
+
+  acquire(&kmem.lock);
+  kmem.nlock++;
+  v = balloc(order);
+  release(&kmem.lock);
+  if(v == 0){
+    while((v = zget()) != 0)
+      kfree(v);
+    for(kc = kmem.cpu; kc < &kmem.cpu[NCPU]; kc++){
+      acquire(&kc->lock);
+      if(kc->nfree > 0)
+        drain(kc, kc->nfree);
+      release(&kc->lock);
+    }
+    acquire(&kmem.lock);
+    kmem.nlock++;
+    v = balloc(order);
+    release(&kmem.lock);
+  }
+  if(v)
+    kmem.ref[PFN(v)] = 1;
+  return v;
+}
+
+// Drop a reference to a block returned by kalloc_pages(order),
+// and free it if that was the last one. As with kdup() and
+// kref(), the count is that of the block's first page.
+void
+kfree_pages(char *v, int order)
+{
+  int ref;
+
+  if(order == 0){
+    kfree(v);
+    return;
+  }
+  if(order < 0 || order > MAXORDER || (V2P(v) & ((PGSIZE << order) - 1)) ||
+     v < end || V2P(v) + (PGSIZE << order) > physstop)
+    panic("kfree_pages");
+  ref = xadd(&kmem.ref[PFN(v)], -1);
+  if(ref > 1)
+    return;
+  if(ref < 1)
+    panic("kfree_pages: ref");
+
+#ifdef KJUNK
+  memset(v, 1, PGSIZE << order);
+#endif
+  acquire(&kmem.lock);
+  kmem.nlock++;
+  bfree(v, order);
+  release(&kmem.lock);
+}
+
+// Add a reference to the allocated page v.
+char*
+kdup(char *v)
+{
+  if((uint)v % PGSIZE || v < end || V2P(v) >= physstop)
+    panic("kdup");
+  xadd(&kmem.ref[V2P(v)/PGSIZE], 1);
+  return v;
+}
+
+// Return the number of references to the allocated page v.
+int
+kref(char *v)
+{
+  return kmem.ref[V2P(v)/PGSIZE];
+}
+
+// Return the number of free pages, including the zeroed pool
+// and the untouched region.
+// Like kmemstat(), it reads the counts without locks.
+uint
+kfreepages(void)
+{
+  struct kcpu *kc;
+  uint n;
+
+  n = kmem.nfree + kmem.nzero;
+  n += (kmem.untouchedend - kmem.untouched) / PGSIZE;
+  for(kc = kmem.cpu; kc < &kmem.cpu[NCPU]; kc++)
+    n += kc->nfree;
+  return n;
+}
+
+// Report allocator statistics for the memstat system call.
+// The counters are read without locks, so they are only
+// approximately consistent with each other.
+void
+kmemstat(struct memstat *ms)
+{
+  struct kcpu *kc;
+  int k;
+
+  memset(ms, 0, sizeof(*ms));
+  ms->physpages = physstop / PGSIZE;
+  ms->freepages = kfreepages();
+  ms->untouched = (kmem.untouchedend - kmem.untouched) / PGSIZE;
+  ms->globallock = kmem.nlock;
+  ms->zeropool = kmem.nzero;
+  ms->zerohits = kmem.nzerohit;
+  ms->zeromisses = kmem.nzeromiss;
+  for(k = 0; k < KORDERS; k++)
+    ms->freeblocks[k] = kmem.nblocks[k];
+  for(kc = kmem.cpu; kc < &kmem.cpu[NCPU]; kc++){
+    ms->refills += kc->nrefill;
+    ms->drains += kc->ndrain;
+    ms->steals += kc->nsteal;
+  }
+}
@@ -0,0 +1,132 @@
+// LZ77 compression for the compressed swap pool.
+//
+// The format is that of LZF. The input is a sequence of items,
+// each starting with a control byte c:
+// * c < 32: c+1 literal bytes follow.
+// * otherwise a back reference: the length-2 is c>>5, plus the
+//   next byte if c>>5 is 7, and the offset-1 is (c&31)<<8 plus
+//   the byte after that.
+// The compressor finds matches through a hash table of the last
+// position at which each 3-byte sequence was seen, so it is fast
+// rather than thorough.
+
+#include "types.h"
+#include "defs.h"
+
+#define HLOG    12
+#define MAXLIT  32
+#define MAXOFF  8192
+#define MAXLEN  (2 + 7 + 255)
+
+static ushort htab[1 << HLOG];  // position+1 of a 3-byte sequence
+
+static uint
+hash(uchar *p)
+{
+  return ((p[0] << 16 | p[1] << 8 | p[2]) * 2654435761U) >> (32 - HLOG);
+}
+
+// Copy the literals in [lit, end) to *op as runs of at most
+// MAXLIT bytes. Returns -1 if they do not fit before oe.
+static int
+literals(uchar **op, uchar *oe, uchar *lit, uchar *end)
+{
+  int k;
+
+  while(lit < end){
+    k = end - lit > MAXLIT ? MAXLIT : end - lit;
+    if(*op + 1 + k > oe)
+      return -1;
+    *(*op)++ = k - 1;
+    memmove(*op, lit, k);
+    *op += k;
+    lit += k;
+  }
+  return 0;
+}
+
+// Compress the n bytes at in (n < 65535) into out. Returns the
+// compressed length, or 0 if it would exceed max. Not reentrant:
+// callers must serialize.
+int
+lzcompress(uchar *in, int n, uchar *out, int max)
+{
+  uchar *ip, *ie, *op, *oe, *lit, *ref;
+  uint h, off;
+  int len, maxlen;
+
+  memset(htab, 0, sizeof(htab));
+  ip = lit = in;
+  ie = in + n;
+  op = out;
+  oe = out + max;
+  while(ip + 2 < ie){
+    h = hash(ip);
+    ref = htab[h] ? in + htab[h] - 1 : 0;
+    htab[h] = ip - in + 1;
+    if(ref == 0 || ip - ref > MAXOFF ||
+       ref[0] != ip[0] || ref[1] != ip[1] || ref[2] != ip[2]){
+      ip++;
+      continue;
+    }
+    maxlen = ie - ip > MAXLEN ? MAXLEN : ie - ip;
+    for(len = 3; len < maxlen && ref[len] == ip[len]; len++)
+      ;
+    if(literals(&op, oe, lit, ip) < 0 || op + 3 > oe)
+      return 0;
+    off = ip - ref - 1;
+    if(len - 2 < 7){
+      *op++ = (len - 2) << 5 | off >> 8;
+    } else {
+      *op++ = 7 << 5 | off >> 8;
+      *op++ = len - 2 - 7;
+    }
+    *op++ = off;
+    ip += len;
+    lit = ip;
+  }
+  if(literals(&op, oe, lit, ie) < 0)
+    return 0;
+  return op - out;
+}
+
+// Decompress the n bytes at in into out, which holds max bytes.
+// Returns the decompressed length, or -1 if the input is bad.
+int
+lzdecompress(uchar *in, int n, uchar *out, int max)
+{
+  uchar *ip, *ie, *op, *oe, *ref;
+  uint c, len;
+
+  ip = in;
+  ie = in + n;
+  op = out;
+  oe = out + max;
+  while(ip < ie){
+    c = *ip++;
+    if(c < MAXLIT){
+      len = c + 1;
+      if(ip + len > ie || op + len > oe)
+        return -1;
+      memmove(op, ip, len);
+      op += len;
+      ip += len;
+      continue;
+    }
+    len = c >> 5;
+    if(len == 7){
+      if(ip >= ie)
+        return -1;
+      len += *ip++;
+    }
+    len += 2;
+    if(ip >= ie)
+      return -1;
+    ref = op - ((c & 31) << 8) - *ip++ - 1;
+    if(ref < out || op + len > oe)
+      return -1;
+    while(len-- > 0)
+      *op++ = *ref++;
+  }
+  return op - out;
+}
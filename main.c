@@ -11,14 +11,53 @@ static void mpmain(void)  __attribute__((noreturn));
 extern pde_t *kpgdir;
 extern char end[]; // first address after kernel loaded from ELF file
 
+// Boot phase timing: bootphase() charges the time since the
+// previous call to the named phase, and bootreport() prints
+// them in units of 1024 TSC cycles.
+#define NBOOTPHASE 8
+static struct {
+  char *name;
+  uint kcycles;
+} phases[NBOOTPHASE];
+static int nphase;
+static uint64 lasttsc;
+
+static void
+bootphase(char *name)
+{
+  uint64 now;
+
+  now = rdtsc();
+  if(nphase < NBOOTPHASE){
+    phases[nphase].name = name;
+    phases[nphase].kcycles = (now - lasttsc) >> 10;
+    nphase++;
+  }
+  lasttsc = now;
+}
+
+static void
+bootreport(void)
+{
+  int i;
+
+  cprintf("boot:");
+  for(i = 0; i < nphase; i++)
+    cprintf(" %s %d", phases[i].name, phases[i].kcycles);
+  cprintf(" (Kcycles)\n");
+}
+
 // Bootstrap processor starts running C code here.
 // Allocate a real stack and switch to it, first
 // doing some setup required for memory allocator to work.
 int
 main(void)
 {
+  lasttsc = rdtsc();
   kinit1(end, P2V(4*1024*1024)); // phys page allocator
+  bootphase("kinit1");
   kvmalloc();      // kernel page table
+  bootphase("kvmalloc");
   mpinit();        // detect other processors
   lapicinit();     // interrupt controller
   seginit();       // segment descriptors
@@ -29,11 +68,21 @@ main(void)
   pinit();         // process table
   tvinit();        // trap vectors
   binit();         // buffer cache
+  pcinit();        // executable page cache
+  swapinit();      // swap space
+  shminit();       // shared-memory segments
+  slabinit();      // kernel object caches
   fileinit();      // file table
+  pipeinit();      // pipe cache
   ideinit();       // disk 
+  bootphase("devices");
   startothers();   // start other processors
-  kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+  bootphase("startothers");
+  kinit2(P2V(4*1024*1024), P2V(physstop)); // must come after startothers()
+  bootphase("kinit2");
   userinit();      // first user process
+  bootphase("userinit");
+  bootreport();
   mpmain();        // finish this processor's setup
 }
 
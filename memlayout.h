@@ -1,8 +1,9 @@
 // Memory layout
 
 #define EXTMEM  0x100000            // Start of extended memory
-#define PHYSTOP 0xE000000           // Top physical memory
+#define PHYSTOP 0xE000000           // Top physical memory if the BIOS has no map
 #define DEVSPACE 0xFE000000         // Other devices are at high addresses
+#define E820MAP 0x8000              // BIOS memory map saved by bootasm.S
 
 // Key addresses for address space layout (see kmap in vm.c for layout)
 #define KERNBASE 0x80000000         // First kernel virtual address
@@ -0,0 +1,1392 @@
+
+_memstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "user.h"
+#include "memstat.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+  struct memstat ms;
+  uint k, total, below, ratio;
+
+  if(memstat(&ms) < 0){
+   f:	8d b5 64 ff ff ff    	lea    -0x9c(%ebp),%esi
+{
+  15:	53                   	push   %ebx
+  16:	51                   	push   %ecx
+  17:	81 ec b4 00 00 00    	sub    $0xb4,%esp
+  if(memstat(&ms) < 0){
+  1d:	56                   	push   %esi
+  1e:	e8 10 05 00 00       	call   533 <memstat>
+  23:	83 c4 10             	add    $0x10,%esp
+  26:	85 c0                	test   %eax,%eax
+  28:	0f 88 0e 02 00 00    	js     23c <main+0x23c>
+    printf(2, "memstat: failed\n");
+    exit();
+  }
+  printf(1, "phys pages   %d\n", ms.physpages);
+  2e:	52                   	push   %edx
+  2f:	ff b5 64 ff ff ff    	push   -0x9c(%ebp)
+  35:	68 79 09 00 00       	push   $0x979
+  3a:	6a 01                	push   $0x1
+  3c:	e8 ff 05 00 00       	call   640 <printf>
+  printf(1, "free pages   %d\n", ms.freepages);
+  41:	83 c4 0c             	add    $0xc,%esp
+  44:	ff b5 68 ff ff ff    	push   -0x98(%ebp)
+  4a:	68 8a 09 00 00       	push   $0x98a
+  4f:	6a 01                	push   $0x1
+  51:	e8 ea 05 00 00       	call   640 <printf>
+  printf(1, "untouched    %d\n", ms.untouched);
+  56:	83 c4 0c             	add    $0xc,%esp
+  59:	ff b5 6c ff ff ff    	push   -0x94(%ebp)
+  5f:	68 9b 09 00 00       	push   $0x99b
+  64:	6a 01                	push   $0x1
+  66:	e8 d5 05 00 00       	call   640 <printf>
+  printf(1, "global lock  %d\n", ms.globallock);
+  6b:	83 c4 0c             	add    $0xc,%esp
+  6e:	ff b5 70 ff ff ff    	push   -0x90(%ebp)
+  74:	68 ac 09 00 00       	push   $0x9ac
+  79:	6a 01                	push   $0x1
+  7b:	e8 c0 05 00 00       	call   640 <printf>
+  printf(1, "refills      %d\n", ms.refills);
+  80:	83 c4 0c             	add    $0xc,%esp
+  83:	ff b5 74 ff ff ff    	push   -0x8c(%ebp)
+  89:	68 bd 09 00 00       	push   $0x9bd
+  8e:	6a 01                	push   $0x1
+  90:	e8 ab 05 00 00       	call   640 <printf>
+  printf(1, "drains       %d\n", ms.drains);
+  95:	83 c4 0c             	add    $0xc,%esp
+  98:	ff b5 78 ff ff ff    	push   -0x88(%ebp)
+  9e:	68 ce 09 00 00       	push   $0x9ce
+  a3:	6a 01                	push   $0x1
+  a5:	e8 96 05 00 00       	call   640 <printf>
+  printf(1, "steals       %d\n", ms.steals);
+  aa:	83 c4 0c             	add    $0xc,%esp
+  ad:	ff b5 7c ff ff ff    	push   -0x84(%ebp)
+  b3:	68 df 09 00 00       	push   $0x9df
+  b8:	6a 01                	push   $0x1
+  ba:	e8 81 05 00 00       	call   640 <printf>
+  printf(1, "zero pool    %d\n", ms.zeropool);
+  bf:	83 c4 0c             	add    $0xc,%esp
+  c2:	ff 75 80             	push   -0x80(%ebp)
+  c5:	68 f0 09 00 00       	push   $0x9f0
+  ca:	6a 01                	push   $0x1
+  cc:	e8 6f 05 00 00       	call   640 <printf>
+  printf(1, "zero hits    %d\n", ms.zerohits);
+  d1:	83 c4 0c             	add    $0xc,%esp
+  d4:	ff 75 84             	push   -0x7c(%ebp)
+  d7:	68 01 0a 00 00       	push   $0xa01
+  dc:	6a 01                	push   $0x1
+  de:	e8 5d 05 00 00       	call   640 <printf>
+  printf(1, "zero misses  %d\n", ms.zeromisses);
+  e3:	83 c4 0c             	add    $0xc,%esp
+  e6:	ff 75 88             	push   -0x78(%ebp)
+  e9:	68 12 0a 00 00       	push   $0xa12
+  ee:	6a 01                	push   $0x1
+  f0:	e8 4b 05 00 00       	call   640 <printf>
+  printf(1, "cached pages %d\n", ms.pcpages);
+  f5:	83 c4 0c             	add    $0xc,%esp
+  f8:	ff 75 8c             	push   -0x74(%ebp)
+  fb:	68 23 0a 00 00       	push   $0xa23
+ 100:	6a 01                	push   $0x1
+ 102:	e8 39 05 00 00       	call   640 <printf>
+  printf(1, "cache hits   %d\n", ms.pchits);
+ 107:	83 c4 0c             	add    $0xc,%esp
+ 10a:	ff 75 90             	push   -0x70(%ebp)
+ 10d:	68 34 0a 00 00       	push   $0xa34
+ 112:	6a 01                	push   $0x1
+ 114:	e8 27 05 00 00       	call   640 <printf>
+  printf(1, "cache misses %d\n", ms.pcmisses);
+ 119:	83 c4 0c             	add    $0xc,%esp
+ 11c:	ff 75 94             	push   -0x6c(%ebp)
+ 11f:	68 45 0a 00 00       	push   $0xa45
+ 124:	6a 01                	push   $0x1
+ 126:	e8 15 05 00 00       	call   640 <printf>
+  printf(1, "slab pages   %d\n", ms.slabpages);
+ 12b:	83 c4 0c             	add    $0xc,%esp
+ 12e:	ff 75 c4             	push   -0x3c(%ebp)
+ 131:	68 56 0a 00 00       	push   $0xa56
+ 136:	6a 01                	push   $0x1
+ 138:	e8 03 05 00 00       	call   640 <printf>
+  printf(1, "swap         %d/%d pages\n", ms.swapused, ms.swappages);
+ 13d:	ff 75 c8             	push   -0x38(%ebp)
+ 140:	ff 75 cc             	push   -0x34(%ebp)
+ 143:	68 67 0a 00 00       	push   $0xa67
+ 148:	6a 01                	push   $0x1
+ 14a:	e8 f1 04 00 00       	call   640 <printf>
+  printf(1, "swap outs    %d\n", ms.swapouts);
+ 14f:	83 c4 1c             	add    $0x1c,%esp
+ 152:	ff 75 d0             	push   -0x30(%ebp)
+ 155:	68 81 0a 00 00       	push   $0xa81
+ 15a:	6a 01                	push   $0x1
+ 15c:	e8 df 04 00 00       	call   640 <printf>
+  printf(1, "swap ins     %d from disk, %d from pool\n",
+ 161:	ff 75 d8             	push   -0x28(%ebp)
+ 164:	ff 75 d4             	push   -0x2c(%ebp)
+ 167:	68 94 0a 00 00       	push   $0xa94
+ 16c:	6a 01                	push   $0x1
+ 16e:	e8 cd 04 00 00       	call   640 <printf>
+         ms.swapins, ms.zswapins);
+  ratio = ms.zbytes >= 100 ? ms.zstored * 4096 / (ms.zbytes / 100) : 0;
+ 173:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 176:	83 c4 20             	add    $0x20,%esp
+ 179:	31 c9                	xor    %ecx,%ecx
+ 17b:	83 f8 63             	cmp    $0x63,%eax
+ 17e:	0f 87 9a 00 00 00    	ja     21e <main+0x21e>
+  printf(1, "swap pool    %d pages in %d, ratio %d.%d%d\n",
+ 184:	bb 0a 00 00 00       	mov    $0xa,%ebx
+ 189:	31 d2                	xor    %edx,%edx
+ 18b:	50                   	push   %eax
+ 18c:	89 c8                	mov    %ecx,%eax
+ 18e:	f7 f3                	div    %ebx
+ 190:	52                   	push   %edx
+ 191:	31 d2                	xor    %edx,%edx
+ 193:	f7 f3                	div    %ebx
+ 195:	89 c8                	mov    %ecx,%eax
+ 197:	bb 64 00 00 00       	mov    $0x64,%ebx
+ 19c:	52                   	push   %edx
+ 19d:	31 d2                	xor    %edx,%edx
+ 19f:	f7 f3                	div    %ebx
+         ms.zstored, ms.zpoolpages, ratio / 100, ratio / 10 % 10, ratio % 10);
+
+  // For each block size, the share of free buddy memory that
+  // lies in smaller blocks and so cannot satisfy a request of
+  // that size: a measure of fragmentation.
+  total = 0;
+ 1a1:	31 db                	xor    %ebx,%ebx
+  printf(1, "swap pool    %d pages in %d, ratio %d.%d%d\n",
+ 1a3:	50                   	push   %eax
+ 1a4:	ff 75 dc             	push   -0x24(%ebp)
+ 1a7:	ff 75 e0             	push   -0x20(%ebp)
+ 1aa:	68 c0 0a 00 00       	push   $0xac0
+ 1af:	6a 01                	push   $0x1
+ 1b1:	e8 8a 04 00 00       	call   640 <printf>
+ 1b6:	83 c4 20             	add    $0x20,%esp
+  for(k = 0; k < KORDERS; k++)
+ 1b9:	31 c9                	xor    %ecx,%ecx
+ 1bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1bf:	90                   	nop
+    total += ms.freeblocks[k] << k;
+ 1c0:	8b 44 8e 34          	mov    0x34(%esi,%ecx,4),%eax
+ 1c4:	d3 e0                	shl    %cl,%eax
+  for(k = 0; k < KORDERS; k++)
+ 1c6:	83 c1 01             	add    $0x1,%ecx
+    total += ms.freeblocks[k] << k;
+ 1c9:	01 c3                	add    %eax,%ebx
+  for(k = 0; k < KORDERS; k++)
+ 1cb:	83 f9 0b             	cmp    $0xb,%ecx
+ 1ce:	75 f0                	jne    1c0 <main+0x1c0>
+  below = 0;
+ 1d0:	31 ff                	xor    %edi,%edi
+  for(k = 0; k < KORDERS; k++){
+ 1d2:	31 c9                	xor    %ecx,%ecx
+ 1d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    printf(1, "order %d: %d free blocks, %d%% unusable\n", k,
+ 1d8:	31 c0                	xor    %eax,%eax
+ 1da:	85 db                	test   %ebx,%ebx
+ 1dc:	74 07                	je     1e5 <main+0x1e5>
+           ms.freeblocks[k], total ? below * 100 / total : 0);
+ 1de:	6b c7 64             	imul   $0x64,%edi,%eax
+    printf(1, "order %d: %d free blocks, %d%% unusable\n", k,
+ 1e1:	31 d2                	xor    %edx,%edx
+ 1e3:	f7 f3                	div    %ebx
+ 1e5:	83 ec 0c             	sub    $0xc,%esp
+ 1e8:	50                   	push   %eax
+ 1e9:	ff 74 8e 34          	push   0x34(%esi,%ecx,4)
+ 1ed:	51                   	push   %ecx
+ 1ee:	89 8d 54 ff ff ff    	mov    %ecx,-0xac(%ebp)
+ 1f4:	68 ec 0a 00 00       	push   $0xaec
+ 1f9:	6a 01                	push   $0x1
+ 1fb:	e8 40 04 00 00       	call   640 <printf>
+    below += ms.freeblocks[k] << k;
+ 200:	8b 8d 54 ff ff ff    	mov    -0xac(%ebp),%ecx
+  for(k = 0; k < KORDERS; k++){
+ 206:	83 c4 20             	add    $0x20,%esp
+    below += ms.freeblocks[k] << k;
+ 209:	8b 44 8e 34          	mov    0x34(%esi,%ecx,4),%eax
+ 20d:	d3 e0                	shl    %cl,%eax
+  for(k = 0; k < KORDERS; k++){
+ 20f:	83 c1 01             	add    $0x1,%ecx
+    below += ms.freeblocks[k] << k;
+ 212:	01 c7                	add    %eax,%edi
+  for(k = 0; k < KORDERS; k++){
+ 214:	83 f9 0b             	cmp    $0xb,%ecx
+ 217:	75 bf                	jne    1d8 <main+0x1d8>
+  }
+  exit();
+ 219:	e8 75 02 00 00       	call   493 <exit>
+  ratio = ms.zbytes >= 100 ? ms.zstored * 4096 / (ms.zbytes / 100) : 0;
+ 21e:	bb 64 00 00 00       	mov    $0x64,%ebx
+ 223:	31 d2                	xor    %edx,%edx
+ 225:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 228:	f7 f3                	div    %ebx
+ 22a:	c1 e1 0c             	shl    $0xc,%ecx
+ 22d:	31 d2                	xor    %edx,%edx
+ 22f:	89 c3                	mov    %eax,%ebx
+ 231:	89 c8                	mov    %ecx,%eax
+ 233:	f7 f3                	div    %ebx
+ 235:	89 c1                	mov    %eax,%ecx
+ 237:	e9 48 ff ff ff       	jmp    184 <main+0x184>
+    printf(2, "memstat: failed\n");
+ 23c:	51                   	push   %ecx
+ 23d:	51                   	push   %ecx
+ 23e:	68 68 09 00 00       	push   $0x968
+ 243:	6a 02                	push   $0x2
+ 245:	e8 f6 03 00 00       	call   640 <printf>
+    exit();
+ 24a:	e8 44 02 00 00       	call   493 <exit>
+ 24f:	90                   	nop
+
+00000250 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 250:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 251:	31 c0                	xor    %eax,%eax
+{
+ 253:	89 e5                	mov    %esp,%ebp
+ 255:	53                   	push   %ebx
+ 256:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 259:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 25c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 260:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 264:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 267:	83 c0 01             	add    $0x1,%eax
+ 26a:	84 d2                	test   %dl,%dl
+ 26c:	75 f2                	jne    260 <strcpy+0x10>
+    ;
+  return os;
+}
+ 26e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 271:	89 c8                	mov    %ecx,%eax
+ 273:	c9                   	leave
+ 274:	c3                   	ret
+ 275:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000280 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	53                   	push   %ebx
+ 284:	8b 55 08             	mov    0x8(%ebp),%edx
+ 287:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 28a:	0f b6 02             	movzbl (%edx),%eax
+ 28d:	84 c0                	test   %al,%al
+ 28f:	75 17                	jne    2a8 <strcmp+0x28>
+ 291:	eb 3a                	jmp    2cd <strcmp+0x4d>
+ 293:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 297:	90                   	nop
+ 298:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 29c:	83 c2 01             	add    $0x1,%edx
+ 29f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 2a2:	84 c0                	test   %al,%al
+ 2a4:	74 1a                	je     2c0 <strcmp+0x40>
+    p++, q++;
+ 2a6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 2a8:	0f b6 19             	movzbl (%ecx),%ebx
+ 2ab:	38 c3                	cmp    %al,%bl
+ 2ad:	74 e9                	je     298 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 2af:	29 d8                	sub    %ebx,%eax
+}
+ 2b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2b4:	c9                   	leave
+ 2b5:	c3                   	ret
+ 2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 2c0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 2c4:	31 c0                	xor    %eax,%eax
+ 2c6:	29 d8                	sub    %ebx,%eax
+}
+ 2c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2cb:	c9                   	leave
+ 2cc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 2cd:	0f b6 19             	movzbl (%ecx),%ebx
+ 2d0:	31 c0                	xor    %eax,%eax
+ 2d2:	eb db                	jmp    2af <strcmp+0x2f>
+ 2d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2df:	90                   	nop
+
+000002e0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2e6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 2e9:	74 15                	je     300 <strlen+0x20>
+ 2eb:	31 c0                	xor    %eax,%eax
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+ 2f0:	83 c0 01             	add    $0x1,%eax
+ 2f3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 2f7:	89 c1                	mov    %eax,%ecx
+ 2f9:	75 f5                	jne    2f0 <strlen+0x10>
+    ;
+  return n;
+}
+ 2fb:	89 c8                	mov    %ecx,%eax
+ 2fd:	5d                   	pop    %ebp
+ 2fe:	c3                   	ret
+ 2ff:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 300:	31 c9                	xor    %ecx,%ecx
+}
+ 302:	5d                   	pop    %ebp
+ 303:	89 c8                	mov    %ecx,%eax
+ 305:	c3                   	ret
+ 306:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000310 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	57                   	push   %edi
+ 314:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 317:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 31a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 31d:	89 d7                	mov    %edx,%edi
+ 31f:	fc                   	cld
+ 320:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 322:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 325:	89 d0                	mov    %edx,%eax
+ 327:	c9                   	leave
+ 328:	c3                   	ret
+ 329:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	8b 45 08             	mov    0x8(%ebp),%eax
+ 336:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 33a:	0f b6 10             	movzbl (%eax),%edx
+ 33d:	84 d2                	test   %dl,%dl
+ 33f:	75 12                	jne    353 <strchr+0x23>
+ 341:	eb 1d                	jmp    360 <strchr+0x30>
+ 343:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 347:	90                   	nop
+ 348:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 34c:	83 c0 01             	add    $0x1,%eax
+ 34f:	84 d2                	test   %dl,%dl
+ 351:	74 0d                	je     360 <strchr+0x30>
+    if(*s == c)
+ 353:	38 d1                	cmp    %dl,%cl
+ 355:	75 f1                	jne    348 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 357:	5d                   	pop    %ebp
+ 358:	c3                   	ret
+ 359:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 360:	31 c0                	xor    %eax,%eax
+}
+ 362:	5d                   	pop    %ebp
+ 363:	c3                   	ret
+ 364:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 36f:	90                   	nop
+
+00000370 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	57                   	push   %edi
+ 374:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 375:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 378:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 379:	31 db                	xor    %ebx,%ebx
+{
+ 37b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 37e:	eb 27                	jmp    3a7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 380:	83 ec 04             	sub    $0x4,%esp
+ 383:	6a 01                	push   $0x1
+ 385:	56                   	push   %esi
+ 386:	6a 00                	push   $0x0
+ 388:	e8 1e 01 00 00       	call   4ab <read>
+    if(cc < 1)
+ 38d:	83 c4 10             	add    $0x10,%esp
+ 390:	85 c0                	test   %eax,%eax
+ 392:	7e 1d                	jle    3b1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 394:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 398:	8b 55 08             	mov    0x8(%ebp),%edx
+ 39b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 39f:	3c 0a                	cmp    $0xa,%al
+ 3a1:	74 10                	je     3b3 <gets+0x43>
+ 3a3:	3c 0d                	cmp    $0xd,%al
+ 3a5:	74 0c                	je     3b3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 3a7:	89 df                	mov    %ebx,%edi
+ 3a9:	83 c3 01             	add    $0x1,%ebx
+ 3ac:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 3af:	7c cf                	jl     380 <gets+0x10>
+ 3b1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 3b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 3ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3bd:	5b                   	pop    %ebx
+ 3be:	5e                   	pop    %esi
+ 3bf:	5f                   	pop    %edi
+ 3c0:	5d                   	pop    %ebp
+ 3c1:	c3                   	ret
+ 3c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	56                   	push   %esi
+ 3d4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3d5:	83 ec 08             	sub    $0x8,%esp
+ 3d8:	6a 00                	push   $0x0
+ 3da:	ff 75 08             	push   0x8(%ebp)
+ 3dd:	e8 f1 00 00 00       	call   4d3 <open>
+  if(fd < 0)
+ 3e2:	83 c4 10             	add    $0x10,%esp
+ 3e5:	85 c0                	test   %eax,%eax
+ 3e7:	78 27                	js     410 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 3e9:	83 ec 08             	sub    $0x8,%esp
+ 3ec:	ff 75 0c             	push   0xc(%ebp)
+ 3ef:	89 c3                	mov    %eax,%ebx
+ 3f1:	50                   	push   %eax
+ 3f2:	e8 f4 00 00 00       	call   4eb <fstat>
+  close(fd);
+ 3f7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 3fa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 3fc:	e8 ba 00 00 00       	call   4bb <close>
+  return r;
+ 401:	83 c4 10             	add    $0x10,%esp
+}
+ 404:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 407:	89 f0                	mov    %esi,%eax
+ 409:	5b                   	pop    %ebx
+ 40a:	5e                   	pop    %esi
+ 40b:	5d                   	pop    %ebp
+ 40c:	c3                   	ret
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 410:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 415:	eb ed                	jmp    404 <stat+0x34>
+ 417:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41e:	66 90                	xchg   %ax,%ax
+
+00000420 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	53                   	push   %ebx
+ 424:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 427:	0f be 02             	movsbl (%edx),%eax
+ 42a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 42d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 430:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 435:	77 1e                	ja     455 <atoi+0x35>
+ 437:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 440:	83 c2 01             	add    $0x1,%edx
+ 443:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 446:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 44a:	0f be 02             	movsbl (%edx),%eax
+ 44d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 450:	80 fb 09             	cmp    $0x9,%bl
+ 453:	76 eb                	jbe    440 <atoi+0x20>
+  return n;
+}
+ 455:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 458:	89 c8                	mov    %ecx,%eax
+ 45a:	c9                   	leave
+ 45b:	c3                   	ret
+ 45c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000460 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	56                   	push   %esi
+ 465:	8b 45 10             	mov    0x10(%ebp),%eax
+ 468:	8b 55 08             	mov    0x8(%ebp),%edx
+ 46b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 46e:	85 c0                	test   %eax,%eax
+ 470:	7e 13                	jle    485 <memmove+0x25>
+ 472:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 474:	89 d7                	mov    %edx,%edi
+ 476:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 480:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 481:	39 f8                	cmp    %edi,%eax
+ 483:	75 fb                	jne    480 <memmove+0x20>
+  return vdst;
+}
+ 485:	5e                   	pop    %esi
+ 486:	89 d0                	mov    %edx,%eax
+ 488:	5f                   	pop    %edi
+ 489:	5d                   	pop    %ebp
+ 48a:	c3                   	ret
+
+0000048b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 48b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <exit>:
+SYSCALL(exit)
+ 493:	b8 02 00 00 00       	mov    $0x2,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <wait>:
+SYSCALL(wait)
+ 49b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <pipe>:
+SYSCALL(pipe)
+ 4a3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <read>:
+SYSCALL(read)
+ 4ab:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <write>:
+SYSCALL(write)
+ 4b3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <close>:
+SYSCALL(close)
+ 4bb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <kill>:
+SYSCALL(kill)
+ 4c3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <exec>:
+SYSCALL(exec)
+ 4cb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <open>:
+SYSCALL(open)
+ 4d3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <mknod>:
+SYSCALL(mknod)
+ 4db:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <unlink>:
+SYSCALL(unlink)
+ 4e3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <fstat>:
+SYSCALL(fstat)
+ 4eb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <link>:
+SYSCALL(link)
+ 4f3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <mkdir>:
+SYSCALL(mkdir)
+ 4fb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <chdir>:
+SYSCALL(chdir)
+ 503:	b8 09 00 00 00       	mov    $0x9,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <dup>:
+SYSCALL(dup)
+ 50b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <getpid>:
+SYSCALL(getpid)
+ 513:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <sbrk>:
+SYSCALL(sbrk)
+ 51b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <sleep>:
+SYSCALL(sleep)
+ 523:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <uptime>:
+SYSCALL(uptime)
+ 52b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <memstat>:
+SYSCALL(memstat)
+ 533:	b8 16 00 00 00       	mov    $0x16,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <mmap>:
+SYSCALL(mmap)
+ 53b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <munmap>:
+SYSCALL(munmap)
+ 543:	b8 18 00 00 00       	mov    $0x18,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <shmget>:
+SYSCALL(shmget)
+ 54b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <shmat>:
+SYSCALL(shmat)
+ 553:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <shmdt>:
+SYSCALL(shmdt)
+ 55b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <spawn>:
+SYSCALL(spawn)
+ 563:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <setpriority>:
+SYSCALL(setpriority)
+ 56b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <procinfo>:
+SYSCALL(procinfo)
+ 573:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <setaffinity>:
+SYSCALL(setaffinity)
+ 57b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <getaffinity>:
+SYSCALL(getaffinity)
+ 583:	b8 20 00 00 00       	mov    $0x20,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <shmrm>:
+SYSCALL(shmrm)
+ 58b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+ 593:	66 90                	xchg   %ax,%ax
+ 595:	66 90                	xchg   %ax,%ax
+ 597:	66 90                	xchg   %ax,%ax
+ 599:	66 90                	xchg   %ax,%ax
+ 59b:	66 90                	xchg   %ax,%ax
+ 59d:	66 90                	xchg   %ax,%ax
+ 59f:	90                   	nop
+
+000005a0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5a0:	55                   	push   %ebp
+ 5a1:	89 e5                	mov    %esp,%ebp
+ 5a3:	57                   	push   %edi
+ 5a4:	56                   	push   %esi
+ 5a5:	53                   	push   %ebx
+ 5a6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 5a8:	89 d1                	mov    %edx,%ecx
+{
+ 5aa:	83 ec 3c             	sub    $0x3c,%esp
+ 5ad:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 5b0:	85 d2                	test   %edx,%edx
+ 5b2:	0f 89 80 00 00 00    	jns    638 <printint+0x98>
+ 5b8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 5bc:	74 7a                	je     638 <printint+0x98>
+    x = -xx;
+ 5be:	f7 d9                	neg    %ecx
+    neg = 1;
+ 5c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5c5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 5c8:	31 f6                	xor    %esi,%esi
+ 5ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 5d0:	89 c8                	mov    %ecx,%eax
+ 5d2:	31 d2                	xor    %edx,%edx
+ 5d4:	89 f7                	mov    %esi,%edi
+ 5d6:	f7 f3                	div    %ebx
+ 5d8:	8d 76 01             	lea    0x1(%esi),%esi
+ 5db:	0f b6 92 74 0b 00 00 	movzbl 0xb74(%edx),%edx
+ 5e2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 5e6:	89 ca                	mov    %ecx,%edx
+ 5e8:	89 c1                	mov    %eax,%ecx
+ 5ea:	39 da                	cmp    %ebx,%edx
+ 5ec:	73 e2                	jae    5d0 <printint+0x30>
+  if(neg)
+ 5ee:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 5f1:	85 c0                	test   %eax,%eax
+ 5f3:	74 07                	je     5fc <printint+0x5c>
+    buf[i++] = '-';
+ 5f5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 5fa:	89 f7                	mov    %esi,%edi
+ 5fc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 5ff:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 602:	01 df                	add    %ebx,%edi
+ 604:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 608:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 60b:	83 ec 04             	sub    $0x4,%esp
+ 60e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 611:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 614:	6a 01                	push   $0x1
+ 616:	50                   	push   %eax
+ 617:	56                   	push   %esi
+ 618:	e8 96 fe ff ff       	call   4b3 <write>
+  while(--i >= 0)
+ 61d:	89 f8                	mov    %edi,%eax
+ 61f:	83 c4 10             	add    $0x10,%esp
+ 622:	83 ef 01             	sub    $0x1,%edi
+ 625:	39 d8                	cmp    %ebx,%eax
+ 627:	75 df                	jne    608 <printint+0x68>
+}
+ 629:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 62c:	5b                   	pop    %ebx
+ 62d:	5e                   	pop    %esi
+ 62e:	5f                   	pop    %edi
+ 62f:	5d                   	pop    %ebp
+ 630:	c3                   	ret
+ 631:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 638:	31 c0                	xor    %eax,%eax
+ 63a:	eb 89                	jmp    5c5 <printint+0x25>
+ 63c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000640 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 640:	55                   	push   %ebp
+ 641:	89 e5                	mov    %esp,%ebp
+ 643:	57                   	push   %edi
+ 644:	56                   	push   %esi
+ 645:	53                   	push   %ebx
+ 646:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 649:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 64c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 64f:	0f b6 1e             	movzbl (%esi),%ebx
+ 652:	83 c6 01             	add    $0x1,%esi
+ 655:	84 db                	test   %bl,%bl
+ 657:	74 67                	je     6c0 <printf+0x80>
+ 659:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 65c:	31 d2                	xor    %edx,%edx
+ 65e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 661:	eb 34                	jmp    697 <printf+0x57>
+ 663:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 667:	90                   	nop
+ 668:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 66b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 670:	83 f8 25             	cmp    $0x25,%eax
+ 673:	74 18                	je     68d <printf+0x4d>
+  write(fd, &c, 1);
+ 675:	83 ec 04             	sub    $0x4,%esp
+ 678:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 67b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 67e:	6a 01                	push   $0x1
+ 680:	50                   	push   %eax
+ 681:	57                   	push   %edi
+ 682:	e8 2c fe ff ff       	call   4b3 <write>
+ 687:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 68a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 68d:	0f b6 1e             	movzbl (%esi),%ebx
+ 690:	83 c6 01             	add    $0x1,%esi
+ 693:	84 db                	test   %bl,%bl
+ 695:	74 29                	je     6c0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 697:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 69a:	85 d2                	test   %edx,%edx
+ 69c:	74 ca                	je     668 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 69e:	83 fa 25             	cmp    $0x25,%edx
+ 6a1:	75 ea                	jne    68d <printf+0x4d>
+      if(c == 'd'){
+ 6a3:	83 f8 25             	cmp    $0x25,%eax
+ 6a6:	0f 84 24 01 00 00    	je     7d0 <printf+0x190>
+ 6ac:	83 e8 63             	sub    $0x63,%eax
+ 6af:	83 f8 15             	cmp    $0x15,%eax
+ 6b2:	77 1c                	ja     6d0 <printf+0x90>
+ 6b4:	ff 24 85 1c 0b 00 00 	jmp    *0xb1c(,%eax,4)
+ 6bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6bf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 6c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6c3:	5b                   	pop    %ebx
+ 6c4:	5e                   	pop    %esi
+ 6c5:	5f                   	pop    %edi
+ 6c6:	5d                   	pop    %ebp
+ 6c7:	c3                   	ret
+ 6c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6cf:	90                   	nop
+  write(fd, &c, 1);
+ 6d0:	83 ec 04             	sub    $0x4,%esp
+ 6d3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6d6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 6da:	6a 01                	push   $0x1
+ 6dc:	52                   	push   %edx
+ 6dd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 6e0:	57                   	push   %edi
+ 6e1:	e8 cd fd ff ff       	call   4b3 <write>
+ 6e6:	83 c4 0c             	add    $0xc,%esp
+ 6e9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6ec:	6a 01                	push   $0x1
+ 6ee:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 6f1:	52                   	push   %edx
+ 6f2:	57                   	push   %edi
+ 6f3:	e8 bb fd ff ff       	call   4b3 <write>
+        putc(fd, c);
+ 6f8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6fb:	31 d2                	xor    %edx,%edx
+ 6fd:	eb 8e                	jmp    68d <printf+0x4d>
+ 6ff:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 700:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 703:	83 ec 0c             	sub    $0xc,%esp
+ 706:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 70b:	8b 13                	mov    (%ebx),%edx
+ 70d:	6a 00                	push   $0x0
+ 70f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 711:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 714:	e8 87 fe ff ff       	call   5a0 <printint>
+        ap++;
+ 719:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 71c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 71f:	31 d2                	xor    %edx,%edx
+ 721:	e9 67 ff ff ff       	jmp    68d <printf+0x4d>
+ 726:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 72d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 730:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 733:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 735:	83 c0 04             	add    $0x4,%eax
+ 738:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 73b:	85 db                	test   %ebx,%ebx
+ 73d:	0f 84 9d 00 00 00    	je     7e0 <printf+0x1a0>
+        while(*s != 0){
+ 743:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 746:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 748:	84 c0                	test   %al,%al
+ 74a:	0f 84 3d ff ff ff    	je     68d <printf+0x4d>
+ 750:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 753:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 756:	89 de                	mov    %ebx,%esi
+ 758:	89 d3                	mov    %edx,%ebx
+ 75a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 760:	83 ec 04             	sub    $0x4,%esp
+ 763:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 766:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 769:	6a 01                	push   $0x1
+ 76b:	53                   	push   %ebx
+ 76c:	57                   	push   %edi
+ 76d:	e8 41 fd ff ff       	call   4b3 <write>
+        while(*s != 0){
+ 772:	0f b6 06             	movzbl (%esi),%eax
+ 775:	83 c4 10             	add    $0x10,%esp
+ 778:	84 c0                	test   %al,%al
+ 77a:	75 e4                	jne    760 <printf+0x120>
+      state = 0;
+ 77c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 77f:	31 d2                	xor    %edx,%edx
+ 781:	e9 07 ff ff ff       	jmp    68d <printf+0x4d>
+ 786:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 78d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 790:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 793:	83 ec 0c             	sub    $0xc,%esp
+ 796:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 79b:	8b 13                	mov    (%ebx),%edx
+ 79d:	6a 01                	push   $0x1
+ 79f:	e9 6b ff ff ff       	jmp    70f <printf+0xcf>
+ 7a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 7a8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 7ab:	83 ec 04             	sub    $0x4,%esp
+ 7ae:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 7b1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 7b3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 7b6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7b9:	6a 01                	push   $0x1
+ 7bb:	52                   	push   %edx
+ 7bc:	57                   	push   %edi
+ 7bd:	e8 f1 fc ff ff       	call   4b3 <write>
+        ap++;
+ 7c2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7c5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7c8:	31 d2                	xor    %edx,%edx
+ 7ca:	e9 be fe ff ff       	jmp    68d <printf+0x4d>
+ 7cf:	90                   	nop
+  write(fd, &c, 1);
+ 7d0:	83 ec 04             	sub    $0x4,%esp
+ 7d3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7d6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7d9:	6a 01                	push   $0x1
+ 7db:	e9 11 ff ff ff       	jmp    6f1 <printf+0xb1>
+ 7e0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 7e5:	bb 15 0b 00 00       	mov    $0xb15,%ebx
+ 7ea:	e9 61 ff ff ff       	jmp    750 <printf+0x110>
+ 7ef:	90                   	nop
+
+000007f0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7f0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7f1:	a1 00 10 00 00       	mov    0x1000,%eax
+{
+ 7f6:	89 e5                	mov    %esp,%ebp
+ 7f8:	57                   	push   %edi
+ 7f9:	56                   	push   %esi
+ 7fa:	53                   	push   %ebx
+ 7fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 7fe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 801:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 808:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 80a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 80c:	39 ca                	cmp    %ecx,%edx
+ 80e:	73 30                	jae    840 <free+0x50>
+ 810:	39 c1                	cmp    %eax,%ecx
+ 812:	72 04                	jb     818 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 814:	39 c2                	cmp    %eax,%edx
+ 816:	72 f0                	jb     808 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 818:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 81b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 81e:	39 f8                	cmp    %edi,%eax
+ 820:	74 2e                	je     850 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 822:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 825:	8b 42 04             	mov    0x4(%edx),%eax
+ 828:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 82b:	39 f1                	cmp    %esi,%ecx
+ 82d:	74 38                	je     867 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 82f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 831:	5b                   	pop    %ebx
+  freep = p;
+ 832:	89 15 00 10 00 00    	mov    %edx,0x1000
+}
+ 838:	5e                   	pop    %esi
+ 839:	5f                   	pop    %edi
+ 83a:	5d                   	pop    %ebp
+ 83b:	c3                   	ret
+ 83c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 840:	39 c1                	cmp    %eax,%ecx
+ 842:	72 d0                	jb     814 <free+0x24>
+ 844:	eb c2                	jmp    808 <free+0x18>
+ 846:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 84d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 850:	03 70 04             	add    0x4(%eax),%esi
+ 853:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 856:	8b 02                	mov    (%edx),%eax
+ 858:	8b 00                	mov    (%eax),%eax
+ 85a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 85d:	8b 42 04             	mov    0x4(%edx),%eax
+ 860:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 863:	39 f1                	cmp    %esi,%ecx
+ 865:	75 c8                	jne    82f <free+0x3f>
+    p->s.size += bp->s.size;
+ 867:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 86a:	89 15 00 10 00 00    	mov    %edx,0x1000
+    p->s.size += bp->s.size;
+ 870:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 873:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 876:	89 0a                	mov    %ecx,(%edx)
+}
+ 878:	5b                   	pop    %ebx
+ 879:	5e                   	pop    %esi
+ 87a:	5f                   	pop    %edi
+ 87b:	5d                   	pop    %ebp
+ 87c:	c3                   	ret
+ 87d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000880 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 880:	55                   	push   %ebp
+ 881:	89 e5                	mov    %esp,%ebp
+ 883:	57                   	push   %edi
+ 884:	56                   	push   %esi
+ 885:	53                   	push   %ebx
+ 886:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 889:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 88c:	8b 15 00 10 00 00    	mov    0x1000,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 892:	8d 78 07             	lea    0x7(%eax),%edi
+ 895:	c1 ef 03             	shr    $0x3,%edi
+ 898:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 89b:	85 d2                	test   %edx,%edx
+ 89d:	0f 84 8d 00 00 00    	je     930 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8a3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8a5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8a8:	39 f9                	cmp    %edi,%ecx
+ 8aa:	73 64                	jae    910 <malloc+0x90>
+  if(nu < 4096)
+ 8ac:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 8b1:	39 df                	cmp    %ebx,%edi
+ 8b3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 8b6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 8bd:	eb 0a                	jmp    8c9 <malloc+0x49>
+ 8bf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8c0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8c2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8c5:	39 f9                	cmp    %edi,%ecx
+ 8c7:	73 47                	jae    910 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 8c9:	89 c2                	mov    %eax,%edx
+ 8cb:	39 05 00 10 00 00    	cmp    %eax,0x1000
+ 8d1:	75 ed                	jne    8c0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 8d3:	83 ec 0c             	sub    $0xc,%esp
+ 8d6:	56                   	push   %esi
+ 8d7:	e8 3f fc ff ff       	call   51b <sbrk>
+  if(p == (char*)-1)
+ 8dc:	83 c4 10             	add    $0x10,%esp
+ 8df:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8e2:	74 1c                	je     900 <malloc+0x80>
+  hp->s.size = nu;
+ 8e4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 8e7:	83 ec 0c             	sub    $0xc,%esp
+ 8ea:	83 c0 08             	add    $0x8,%eax
+ 8ed:	50                   	push   %eax
+ 8ee:	e8 fd fe ff ff       	call   7f0 <free>
+  return freep;
+ 8f3:	8b 15 00 10 00 00    	mov    0x1000,%edx
+      if((p = morecore(nunits)) == 0)
+ 8f9:	83 c4 10             	add    $0x10,%esp
+ 8fc:	85 d2                	test   %edx,%edx
+ 8fe:	75 c0                	jne    8c0 <malloc+0x40>
+        return 0;
+  }
+}
+ 900:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 903:	31 c0                	xor    %eax,%eax
+}
+ 905:	5b                   	pop    %ebx
+ 906:	5e                   	pop    %esi
+ 907:	5f                   	pop    %edi
+ 908:	5d                   	pop    %ebp
+ 909:	c3                   	ret
+ 90a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 910:	39 cf                	cmp    %ecx,%edi
+ 912:	74 4c                	je     960 <malloc+0xe0>
+        p->s.size -= nunits;
+ 914:	29 f9                	sub    %edi,%ecx
+ 916:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 919:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 91c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 91f:	89 15 00 10 00 00    	mov    %edx,0x1000
+}
+ 925:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 928:	83 c0 08             	add    $0x8,%eax
+}
+ 92b:	5b                   	pop    %ebx
+ 92c:	5e                   	pop    %esi
+ 92d:	5f                   	pop    %edi
+ 92e:	5d                   	pop    %ebp
+ 92f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 930:	c7 05 00 10 00 00 04 	movl   $0x1004,0x1000
+ 937:	10 00 00 
+    base.s.size = 0;
+ 93a:	b8 04 10 00 00       	mov    $0x1004,%eax
+    base.s.ptr = freep = prevp = &base;
+ 93f:	c7 05 04 10 00 00 04 	movl   $0x1004,0x1004
+ 946:	10 00 00 
+    base.s.size = 0;
+ 949:	c7 05 08 10 00 00 00 	movl   $0x0,0x1008
+ 950:	00 00 00 
+    if(p->s.size >= nunits){
+ 953:	e9 54 ff ff ff       	jmp    8ac <malloc+0x2c>
+ 958:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 95f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 960:	8b 08                	mov    (%eax),%ecx
+ 962:	89 0a                	mov    %ecx,(%edx)
+ 964:	eb b9                	jmp    91f <malloc+0x9f>
@@ -0,0 +1,51 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "memstat.h"
+
+int
+main(int argc, char *argv[])
+{
+  struct memstat ms;
+  uint k, total, below, ratio;
+
+  if(memstat(&ms) < 0){
+    printf(2, "memstat: failed\n");
+    exit();
+  }
+  printf(1, "phys pages   %d\n", ms.physpages);
+  printf(1, "free pages   %d\n", ms.freepages);
+  printf(1, "untouched    %d\n", ms.untouched);
+  printf(1, "global lock  %d\n", ms.globallock);
+  printf(1, "refills      %d\n", ms.refills);
+  printf(1, "drains       %d\n", ms.drains);
+  printf(1, "steals       %d\n", ms.steals);
+  printf(1, "zero pool    %d\n", ms.zeropool);
+  printf(1, "zero hits    %d\n", ms.zerohits);
+  printf(1, "zero misses  %d\n", ms.zeromisses);
+  printf(1, "cached pages %d\n", ms.pcpages);
+  printf(1, "cache hits   %d\n", ms.pchits);
+  printf(1, "cache misses %d\n", ms.pcmisses);
+  printf(1, "slab pages   %d\n", ms.slabpages);
+  printf(1, "swap         %d/%d pages\n", ms.swapused, ms.swappages);
+  printf(1, "swap outs    %d\n", ms.swapouts);
+  printf(1, "swap ins     %d from disk, %d from pool\n",
+         ms.swapins, ms.zswapins);
+  ratio = ms.zbytes >= 100 ? ms.zstored * 4096 / (ms.zbytes / 100) : 0;
+  printf(1, "swap pool    %d pages in %d, ratio %d.%d%d\n",
+         ms.zstored, ms.zpoolpages, ratio / 100, ratio / 10 % 10, ratio % 10);
+
+  // For each block size, the share of free buddy memory that
+  // lies in smaller blocks and so cannot satisfy a request of
+  // that size: a measure of fragmentation.
+  total = 0;
+  for(k = 0; k < KORDERS; k++)
+    total += ms.freeblocks[k] << k;
+  below = 0;
+  for(k = 0; k < KORDERS; k++){
+    printf(1, "order %d: %d free blocks, %d%% unusable\n", k,
+           ms.freeblocks[k], total ? below * 100 / total : 0);
+    below += ms.freeblocks[k] << k;
+  }
+  exit();
+}
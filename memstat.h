@@ -0,0 +1,28 @@
+#define KORDERS 11  // buddy block sizes: 2^0 to 2^10 pages
+
+// Physical memory statistics, filled in by the memstat system call.
+struct memstat {
+  uint physpages;   // pages of physical memory found at boot
+  uint freepages;   // pages on the buddy and per-CPU free lists
+  uint untouched;   // free pages never used since boot
+  uint globallock;  // acquisitions of the global free-list lock
+  uint refills;     // per-CPU cache refills from the buddy lists
+  uint drains;      // per-CPU cache drains to the buddy lists
+  uint steals;      // pages stolen from another CPU's cache
+  uint zeropool;    // pages zeroed ahead of time by idle CPUs
+  uint zerohits;    // zeroed allocations served by the pool
+  uint zeromisses;  // zeroed allocations that cleared a page
+  uint pcpages;     // pages held by the executable page cache
+  uint pchits;      // page cache lookups that found the page
+  uint pcmisses;    // page cache lookups that read the file
+  uint freeblocks[KORDERS];  // free buddy blocks of 2^k pages
+  uint slabpages;   // pages held by slab caches
+  uint swappages;   // pages of swap space
+  uint swapused;    // swap pages holding user pages
+  uint swapouts;    // pages swapped out, to disk or compressed
+  uint swapins;     // pages read back from disk
+  uint zswapins;    // pages decompressed from the swap pool
+  uint zpoolpages;  // pages of the compressed swap pool
+  uint zstored;     // swapped-out pages held compressed in it
+  uint zbytes;      // their compressed size
+};
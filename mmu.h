@@ -10,6 +10,7 @@
 #define CR0_PG          0x80000000      // Paging
 
 #define CR4_PSE         0x00000010      // Page size extension
+#define CR4_PGE         0x00000080      // Page global enable
 
 // various segment selectors.
 #define SEG_KCODE 1  // kernel code
@@ -83,6 +84,8 @@ struct segdesc {
 #define NPDENTRIES      1024    // # directory entries per page directory
 #define NPTENTRIES      1024    // # PTEs per page table
 #define PGSIZE          4096    // bytes mapped by a page
+#define LPGSIZE         (PGSIZE*NPTENTRIES) // bytes mapped by a large page
+#define LPGORDER        10      // a large page is 2^LPGORDER pages
 
 #define PTXSHIFT        12      // offset of PTX in a linear address
 #define PDXSHIFT        22      // offset of PDX in a linear address
@@ -94,11 +97,23 @@ struct segdesc {
 #define PTE_P           0x001   // Present
 #define PTE_W           0x002   // Writeable
 #define PTE_U           0x004   // User
+#define PTE_A           0x020   // Accessed
+#define PTE_D           0x040   // Dirty
 #define PTE_PS          0x080   // Page Size
+#define PTE_G           0x100   // Global (survives %cr3 reloads)
+#define PTE_COW         0x200   // Copy-on-write (available to software)
+#define PTE_SHARED      0x400   // Shared by fork, not copied (software)
+#define PTE_SWAP        0x800   // Not present, in swap slot PTESLOT (software)
 
 // Address in page table or page directory entry
 #define PTE_ADDR(pte)   ((uint)(pte) & ~0xFFF)
 #define PTE_FLAGS(pte)  ((uint)(pte) &  0xFFF)
+#define PTESLOT(pte)    ((uint)(pte) >> PTXSHIFT)
+
+// Page fault error code bits
+#define FEC_PR          0x1     // Protection violation (else not present)
+#define FEC_WR          0x2     // Caused by a write
+#define FEC_U           0x4     // Occurred in user mode
 
 #ifndef __ASSEMBLER__
 typedef uint pte_t;
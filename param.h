@@ -1,8 +1,10 @@
 #define NPROC        64  // maximum number of processes
 #define KSTACKSIZE 4096  // size of per-process kernel stack
+#define USTACKSIZE (1024*1024)  // most a user stack grows to, page aligned
 #define NCPU          8  // maximum number of CPUs
+#define NPRIO         4  // scheduling priority levels, 0 highest
+#define BOOSTTICKS  100  // ticks between scheduling priority boosts
 #define NOFILE       16  // open files per process
-#define NFILE       100  // open files per system
 #define NINODE       50  // maximum number of active i-nodes
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
@@ -11,4 +13,16 @@
 #define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
 #define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
 #define FSSIZE       1000  // size of file system in blocks
+#define NVMA         16  // exec and mmap memory regions per process
+#define FAULTAROUND   4  // pages read per fault on a file-backed region
+#define NPCACHE     128  // pages in the executable page cache
+#define NSLABCACHE   16  // slab caches, including kmalloc's
+#define NZEROPOOL   256  // pages idle CPUs keep zeroed ahead of time
+#define NSWAP      1024  // pages of swap space after the file system
+#define SWAPBLOCKS (NSWAP*8)  // disk blocks of swap space
+#define NZSWAP     4096  // swap slots kept compressed in memory
+#define NZPOOL     1024  // most pages the compressed swap pool may use
+#define NPIN          4  // user memory ranges a system call keeps in memory
+#define NSHM         16  // shared-memory segments
+#define SHMMAXPAGES 1024  // pages in a shared-memory segment
 
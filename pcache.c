@@ -0,0 +1,198 @@
+// Page cache for executable and mapped files.
+//
+// Holds pages of file contents, keyed by device, inode number
+// and file offset, so that every process running the same
+// program or mapping the same file maps the same physical pages
+// instead of reading its own copy. A page holds the file's bytes
+// up to the end of the file, and zeros after that; writes that
+// grow the file extend it. The cache keeps one
+// reference to each page (see kdup) and every mapping adds
+// another; a page whose only reference is the cache's can be
+// evicted to make room for a new one.
+//
+// Interface:
+// * To get a page of a file, call pcget.
+// * Writing a file calls pcwrite to update the cached pages, so
+//   that mappings see the new data.
+// * Truncating a file calls pcinval to drop its pages. Processes
+//   that already map a dropped page keep the old contents.
+//
+// A page is filled from the file by the process that misses on
+// it while it holds the inode's lock, and writes also hold that
+// lock, so two processes cannot insert the same page.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+#include "memstat.h"
+
+struct pcpage {
+  uint dev;
+  uint inum;
+  uint off;     // file offset of the first byte
+  uint n;       // bytes of file data, up to the end of the file;
+                // the rest is zero
+  char *data;   // 0 if unused
+};
+
+struct {
+  struct spinlock lock;
+  struct pcpage page[NPCACHE];
+  int hand;     // next eviction candidate
+  uint nhit;    // lookups that found the page
+  uint nmiss;   // lookups that read the page from the file
+} pcache;
+
+void
+pcinit(void)
+{
+  initlock(&pcache.lock, "pcache");
+}
+
+// Find a slot for a new page: an unused one, or one whose page
+// nobody but the cache is using, which is freed.
+// Caller holds pcache.lock.
+static struct pcpage*
+pcslot(void)
+{
+  struct pcpage *p;
+  int i;
+
+  for(p = pcache.page; p < &pcache.page[NPCACHE]; p++)
+    if(p->data == 0)
+      return p;
+  for(i = 0; i < NPCACHE; i++){
+    p = &pcache.page[pcache.hand];
+    pcache.hand = (pcache.hand + 1) % NPCACHE;
+    if(kref(p->data) == 1){
+      kfree(p->data);
+      p->data = 0;
+      return p;
+    }
+  }
+  return 0;
+}
+
+// Return the page of ip starting at off, with a reference for
+// the caller, who must kfree() it when done. Caller holds
+// ip->lock. Returns 0 if the page cannot be read or memory runs
+// out. If the cache is full of pages in use, the caller gets a
+// private copy, unless it asks for a shared page, which must be
+// the cached one to see writes through other mappings, and then
+// gets 0 as well.
+char*
+pcget(struct inode *ip, uint off, int shared)
+{
+  struct pcpage *p;
+  char *mem;
+  uint n;
+
+  acquire(&pcache.lock);
+  for(p = pcache.page; p < &pcache.page[NPCACHE]; p++){
+    if(p->data && p->dev == ip->dev && p->inum == ip->inum &&
+       p->off == off){
+      mem = kdup(p->data);
+      pcache.nhit++;
+      release(&pcache.lock);
+      return mem;
+    }
+  }
+  pcache.nmiss++;
+  release(&pcache.lock);
+
+  n = off < ip->size ? ip->size - off : 0;
+  if(n > PGSIZE)
+    n = PGSIZE;
+  if((mem = kalloc()) == 0)
+    return 0;
+  memset(mem + n, 0, PGSIZE - n);
+  if(readi(ip, mem, off, n) != n){
+    kfree(mem);
+    return 0;
+  }
+
+  acquire(&pcache.lock);
+  if((p = pcslot()) == 0){
+    release(&pcache.lock);
+    if(shared){
+      kfree(mem);
+      return 0;
+    }
+    return mem;
+  }
+  p->dev = ip->dev;
+  p->inum = ip->inum;
+  p->off = off;
+  p->n = n;
+  p->data = kdup(mem);
+  release(&pcache.lock);
+  return mem;
+}
+
+// Copy the n bytes at src, just written to ip at off, into the
+// cached pages of ip that cover those file bytes, extending the
+// data of a page that held the end of the file if the write
+// grows it. Since writei does not leave holes, the bytes of such
+// a page before the new data are already right. src must not
+// fault. Caller holds ip->lock.
+void
+pcwrite(struct inode *ip, char *src, uint off, uint n)
+{
+  struct pcpage *p;
+  uint s, e;
+
+  acquire(&pcache.lock);
+  for(p = pcache.page; p < &pcache.page[NPCACHE]; p++){
+    if(p->data == 0 || p->dev != ip->dev || p->inum != ip->inum)
+      continue;
+    s = p->off > off ? p->off : off;
+    e = p->off + PGSIZE < off + n ? p->off + PGSIZE : off + n;
+    if(s < e){
+      memmove(p->data + (s - p->off), src + (s - off), e - s);
+      if(e - p->off > p->n)
+        p->n = e - p->off;
+    }
+  }
+  release(&pcache.lock);
+}
+
+// Drop the cached pages of ip that overlap the n bytes at off.
+// Caller holds ip->lock.
+void
+pcinval(struct inode *ip, uint off, uint n)
+{
+  struct pcpage *p;
+
+  if(n == 0)
+    return;
+  acquire(&pcache.lock);
+  for(p = pcache.page; p < &pcache.page[NPCACHE]; p++){
+    if(p->data && p->dev == ip->dev && p->inum == ip->inum &&
+       p->off < off + n && off < p->off + PGSIZE){
+      kfree(p->data);
+      p->data = 0;
+    }
+  }
+  release(&pcache.lock);
+}
+
+// Report page cache statistics for the memstat system call.
+void
+pcstat(struct memstat *ms)
+{
+  struct pcpage *p;
+
+  acquire(&pcache.lock);
+  ms->pcpages = 0;
+  for(p = pcache.page; p < &pcache.page[NPCACHE]; p++)
+    if(p->data)
+      ms->pcpages++;
+  ms->pchits = pcache.nhit;
+  ms->pcmisses = pcache.nmiss;
+  release(&pcache.lock);
+}
@@ -0,0 +1,1447 @@
+
+_pipebench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return q;
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 48             	sub    $0x48,%esp
+  int i, rounds, ticks, ping[2], pong[2];
+  uint64 t0, t;
+  char c;
+
+  rounds = argc > 1 ? atoi(argv[1]) : 10000;
+  14:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  17:	8b 41 04             	mov    0x4(%ecx),%eax
+  rounds = argc > 1 ? atoi(argv[1]) : 10000;
+  1a:	0f 8e ac 00 00 00    	jle    cc <main+0xcc>
+  20:	83 ec 0c             	sub    $0xc,%esp
+  23:	ff 70 04             	push   0x4(%eax)
+  26:	e8 05 04 00 00       	call   430 <atoi>
+  if(rounds < 1){
+  2b:	83 c4 10             	add    $0x10,%esp
+  rounds = argc > 1 ? atoi(argv[1]) : 10000;
+  2e:	89 c6                	mov    %eax,%esi
+  if(rounds < 1){
+  30:	85 c0                	test   %eax,%eax
+  32:	0f 8e 9e 00 00 00    	jle    d6 <main+0xd6>
+    printf(2, "usage: pipebench [rounds]\n");
+    exit();
+  }
+  if(pipe(ping) < 0 || pipe(pong) < 0){
+  38:	83 ec 0c             	sub    $0xc,%esp
+  3b:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  3e:	50                   	push   %eax
+  3f:	e8 6f 04 00 00       	call   4b3 <pipe>
+  44:	83 c4 10             	add    $0x10,%esp
+  47:	85 c0                	test   %eax,%eax
+  49:	78 13                	js     5e <main+0x5e>
+  4b:	83 ec 0c             	sub    $0xc,%esp
+  4e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  51:	50                   	push   %eax
+  52:	e8 5c 04 00 00       	call   4b3 <pipe>
+  57:	83 c4 10             	add    $0x10,%esp
+  5a:	85 c0                	test   %eax,%eax
+  5c:	79 13                	jns    71 <main+0x71>
+    printf(2, "pipebench: pipe failed\n");
+  5e:	53                   	push   %ebx
+  5f:	53                   	push   %ebx
+  60:	68 93 09 00 00       	push   $0x993
+  65:	6a 02                	push   $0x2
+  67:	e8 e4 05 00 00       	call   650 <printf>
+    exit();
+  6c:	e8 32 04 00 00       	call   4a3 <exit>
+  }
+  if(fork() == 0){
+  71:	e8 25 04 00 00       	call   49b <fork>
+  76:	85 c0                	test   %eax,%eax
+  78:	75 6f                	jne    e9 <main+0xe9>
+    close(ping[1]);
+  7a:	83 ec 0c             	sub    $0xc,%esp
+  7d:	ff 75 dc             	push   -0x24(%ebp)
+  80:	8d 5d d7             	lea    -0x29(%ebp),%ebx
+  83:	e8 43 04 00 00       	call   4cb <close>
+    close(pong[0]);
+  88:	59                   	pop    %ecx
+  89:	ff 75 e0             	push   -0x20(%ebp)
+  8c:	e8 3a 04 00 00       	call   4cb <close>
+    while(read(ping[0], &c, 1) == 1)
+  91:	83 c4 10             	add    $0x10,%esp
+  94:	eb 1b                	jmp    b1 <main+0xb1>
+  96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9d:	8d 76 00             	lea    0x0(%esi),%esi
+      write(pong[1], &c, 1);
+  a0:	83 ec 04             	sub    $0x4,%esp
+  a3:	6a 01                	push   $0x1
+  a5:	53                   	push   %ebx
+  a6:	ff 75 e4             	push   -0x1c(%ebp)
+  a9:	e8 15 04 00 00       	call   4c3 <write>
+  ae:	83 c4 10             	add    $0x10,%esp
+    while(read(ping[0], &c, 1) == 1)
+  b1:	83 ec 04             	sub    $0x4,%esp
+  b4:	6a 01                	push   $0x1
+  b6:	53                   	push   %ebx
+  b7:	ff 75 d8             	push   -0x28(%ebp)
+  ba:	e8 fc 03 00 00       	call   4bb <read>
+  bf:	83 c4 10             	add    $0x10,%esp
+  c2:	83 f8 01             	cmp    $0x1,%eax
+  c5:	74 d9                	je     a0 <main+0xa0>
+  ticks = uptime() - ticks;
+  close(ping[1]);
+  wait();
+  printf(1, "%d round trips in %d ticks, %d cycles each\n",
+         rounds, ticks, div64(t, rounds));
+  exit();
+  c7:	e8 d7 03 00 00       	call   4a3 <exit>
+  rounds = argc > 1 ? atoi(argv[1]) : 10000;
+  cc:	be 10 27 00 00       	mov    $0x2710,%esi
+  d1:	e9 62 ff ff ff       	jmp    38 <main+0x38>
+    printf(2, "usage: pipebench [rounds]\n");
+  d6:	56                   	push   %esi
+  d7:	56                   	push   %esi
+  d8:	68 78 09 00 00       	push   $0x978
+  dd:	6a 02                	push   $0x2
+  df:	e8 6c 05 00 00       	call   650 <printf>
+    exit();
+  e4:	e8 ba 03 00 00       	call   4a3 <exit>
+  close(ping[0]);
+  e9:	83 ec 0c             	sub    $0xc,%esp
+  ec:	ff 75 d8             	push   -0x28(%ebp)
+  ef:	e8 d7 03 00 00       	call   4cb <close>
+  close(pong[1]);
+  f4:	5a                   	pop    %edx
+  f5:	ff 75 e4             	push   -0x1c(%ebp)
+  f8:	e8 ce 03 00 00       	call   4cb <close>
+  ticks = uptime();
+  fd:	e8 39 04 00 00       	call   53b <uptime>
+ 102:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+ 105:	0f 31                	rdtsc
+  for(i = 0; i < rounds; i++){
+ 107:	31 ff                	xor    %edi,%edi
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+ 109:	89 55 ac             	mov    %edx,-0x54(%ebp)
+ 10c:	83 c4 10             	add    $0x10,%esp
+ 10f:	8d 5d d7             	lea    -0x29(%ebp),%ebx
+ 112:	89 45 b0             	mov    %eax,-0x50(%ebp)
+  for(i = 0; i < rounds; i++){
+ 115:	eb 10                	jmp    127 <main+0x127>
+ 117:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11e:	66 90                	xchg   %ax,%ax
+ 120:	83 c7 01             	add    $0x1,%edi
+ 123:	39 fe                	cmp    %edi,%esi
+ 125:	74 3b                	je     162 <main+0x162>
+    write(ping[1], "x", 1);
+ 127:	83 ec 04             	sub    $0x4,%esp
+ 12a:	6a 01                	push   $0x1
+ 12c:	68 ab 09 00 00       	push   $0x9ab
+ 131:	ff 75 dc             	push   -0x24(%ebp)
+ 134:	e8 8a 03 00 00       	call   4c3 <write>
+    if(read(pong[0], &c, 1) != 1){
+ 139:	83 c4 0c             	add    $0xc,%esp
+ 13c:	6a 01                	push   $0x1
+ 13e:	53                   	push   %ebx
+ 13f:	ff 75 e0             	push   -0x20(%ebp)
+ 142:	e8 74 03 00 00       	call   4bb <read>
+ 147:	83 c4 10             	add    $0x10,%esp
+ 14a:	83 f8 01             	cmp    $0x1,%eax
+ 14d:	74 d1                	je     120 <main+0x120>
+      printf(2, "pipebench: read failed\n");
+ 14f:	50                   	push   %eax
+ 150:	50                   	push   %eax
+ 151:	68 ad 09 00 00       	push   $0x9ad
+ 156:	6a 02                	push   $0x2
+ 158:	e8 f3 04 00 00       	call   650 <printf>
+      exit();
+ 15d:	e8 41 03 00 00       	call   4a3 <exit>
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+ 162:	0f 31                	rdtsc
+  return ((uint64)hi << 32) | lo;
+ 164:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 167:	8b 45 ac             	mov    -0x54(%ebp),%eax
+ 16a:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+  t = rdtsc() - t0;
+ 16d:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+  return ((uint64)hi << 32) | lo;
+ 170:	89 45 bc             	mov    %eax,-0x44(%ebp)
+ 173:	8b 45 b0             	mov    -0x50(%ebp),%eax
+ 176:	89 45 b8             	mov    %eax,-0x48(%ebp)
+  t = rdtsc() - t0;
+ 179:	8b 45 c0             	mov    -0x40(%ebp),%eax
+ 17c:	2b 45 b8             	sub    -0x48(%ebp),%eax
+ 17f:	1b 55 bc             	sbb    -0x44(%ebp),%edx
+ 182:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+ 185:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  ticks = uptime() - ticks;
+ 188:	e8 ae 03 00 00       	call   53b <uptime>
+ 18d:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+  close(ping[1]);
+ 190:	83 ec 0c             	sub    $0xc,%esp
+ 193:	ff 75 dc             	push   -0x24(%ebp)
+  ticks = uptime() - ticks;
+ 196:	89 c3                	mov    %eax,%ebx
+ 198:	29 d3                	sub    %edx,%ebx
+  close(ping[1]);
+ 19a:	e8 2c 03 00 00       	call   4cb <close>
+  wait();
+ 19f:	e8 07 03 00 00       	call   4ab <wait>
+  printf(1, "%d round trips in %d ticks, %d cycles each\n",
+ 1a4:	83 c4 0c             	add    $0xc,%esp
+ 1a7:	56                   	push   %esi
+ 1a8:	ff 75 c4             	push   -0x3c(%ebp)
+ 1ab:	ff 75 c0             	push   -0x40(%ebp)
+ 1ae:	e8 1d 00 00 00       	call   1d0 <div64>
+ 1b3:	89 04 24             	mov    %eax,(%esp)
+ 1b6:	53                   	push   %ebx
+ 1b7:	56                   	push   %esi
+ 1b8:	68 c8 09 00 00       	push   $0x9c8
+ 1bd:	6a 01                	push   $0x1
+ 1bf:	e8 8c 04 00 00       	call   650 <printf>
+  exit();
+ 1c4:	83 c4 20             	add    $0x20,%esp
+ 1c7:	e9 fb fe ff ff       	jmp    c7 <main+0xc7>
+ 1cc:	66 90                	xchg   %ax,%ax
+ 1ce:	66 90                	xchg   %ax,%ax
+
+000001d0 <div64>:
+{
+ 1d0:	55                   	push   %ebp
+  r = 0;
+ 1d1:	31 c9                	xor    %ecx,%ecx
+{
+ 1d3:	89 e5                	mov    %esp,%ebp
+ 1d5:	57                   	push   %edi
+  for(i = 63; i >= 0; i--){
+ 1d6:	bf 3f 00 00 00       	mov    $0x3f,%edi
+{
+ 1db:	56                   	push   %esi
+  q = 0;
+ 1dc:	31 f6                	xor    %esi,%esi
+{
+ 1de:	53                   	push   %ebx
+  r = 0;
+ 1df:	31 db                	xor    %ebx,%ebx
+{
+ 1e1:	83 ec 24             	sub    $0x24,%esp
+ 1e4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  r = 0;
+ 1ea:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+{
+ 1ed:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    if(r >= d){
+ 1f0:	8b 45 10             	mov    0x10(%ebp),%eax
+{
+ 1f3:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    if(r >= d){
+ 1f6:	31 d2                	xor    %edx,%edx
+ 1f8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 1fb:	89 55 dc             	mov    %edx,-0x24(%ebp)
+ 1fe:	66 90                	xchg   %ax,%ax
+    r = r << 1 | ((n >> i) & 1);
+ 200:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 203:	89 c8                	mov    %ecx,%eax
+ 205:	89 da                	mov    %ebx,%edx
+ 207:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 20a:	0f a4 ca 01          	shld   $0x1,%ecx,%edx
+ 20e:	01 c8                	add    %ecx,%eax
+ 210:	89 f9                	mov    %edi,%ecx
+ 212:	0f ad f3             	shrd   %cl,%esi,%ebx
+ 215:	d3 ee                	shr    %cl,%esi
+ 217:	f6 c1 20             	test   $0x20,%cl
+ 21a:	74 02                	je     21e <div64+0x4e>
+ 21c:	89 f3                	mov    %esi,%ebx
+ 21e:	89 de                	mov    %ebx,%esi
+ 220:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 227:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+ 22a:	83 e6 01             	and    $0x1,%esi
+    q <<= 1;
+ 22d:	d1 65 e4             	shll   -0x1c(%ebp)
+    r = r << 1 | ((n >> i) & 1);
+ 230:	89 75 e8             	mov    %esi,-0x18(%ebp)
+ 233:	8b 4d e8             	mov    -0x18(%ebp),%ecx
+ 236:	09 d3                	or     %edx,%ebx
+    if(r >= d){
+ 238:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 23b:	89 de                	mov    %ebx,%esi
+    r = r << 1 | ((n >> i) & 1);
+ 23d:	09 c1                	or     %eax,%ecx
+    if(r >= d){
+ 23f:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 242:	39 c1                	cmp    %eax,%ecx
+ 244:	19 d6                	sbb    %edx,%esi
+ 246:	72 08                	jb     250 <div64+0x80>
+      r -= d;
+ 248:	29 c1                	sub    %eax,%ecx
+ 24a:	19 d3                	sbb    %edx,%ebx
+      q |= 1;
+ 24c:	83 4d e4 01          	orl    $0x1,-0x1c(%ebp)
+  for(i = 63; i >= 0; i--){
+ 250:	83 ef 01             	sub    $0x1,%edi
+ 253:	73 ab                	jae    200 <div64+0x30>
+}
+ 255:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 258:	83 c4 24             	add    $0x24,%esp
+ 25b:	5b                   	pop    %ebx
+ 25c:	5e                   	pop    %esi
+ 25d:	5f                   	pop    %edi
+ 25e:	5d                   	pop    %ebp
+ 25f:	c3                   	ret
+
+00000260 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 260:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 261:	31 c0                	xor    %eax,%eax
+{
+ 263:	89 e5                	mov    %esp,%ebp
+ 265:	53                   	push   %ebx
+ 266:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 269:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 26c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 270:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 274:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 277:	83 c0 01             	add    $0x1,%eax
+ 27a:	84 d2                	test   %dl,%dl
+ 27c:	75 f2                	jne    270 <strcpy+0x10>
+    ;
+  return os;
+}
+ 27e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 281:	89 c8                	mov    %ecx,%eax
+ 283:	c9                   	leave
+ 284:	c3                   	ret
+ 285:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	53                   	push   %ebx
+ 294:	8b 55 08             	mov    0x8(%ebp),%edx
+ 297:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 29a:	0f b6 02             	movzbl (%edx),%eax
+ 29d:	84 c0                	test   %al,%al
+ 29f:	75 17                	jne    2b8 <strcmp+0x28>
+ 2a1:	eb 3a                	jmp    2dd <strcmp+0x4d>
+ 2a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2a7:	90                   	nop
+ 2a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 2ac:	83 c2 01             	add    $0x1,%edx
+ 2af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 2b2:	84 c0                	test   %al,%al
+ 2b4:	74 1a                	je     2d0 <strcmp+0x40>
+    p++, q++;
+ 2b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 2b8:	0f b6 19             	movzbl (%ecx),%ebx
+ 2bb:	38 c3                	cmp    %al,%bl
+ 2bd:	74 e9                	je     2a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 2bf:	29 d8                	sub    %ebx,%eax
+}
+ 2c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2c4:	c9                   	leave
+ 2c5:	c3                   	ret
+ 2c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 2d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 2d4:	31 c0                	xor    %eax,%eax
+ 2d6:	29 d8                	sub    %ebx,%eax
+}
+ 2d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2db:	c9                   	leave
+ 2dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 2dd:	0f b6 19             	movzbl (%ecx),%ebx
+ 2e0:	31 c0                	xor    %eax,%eax
+ 2e2:	eb db                	jmp    2bf <strcmp+0x2f>
+ 2e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ef:	90                   	nop
+
+000002f0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2f6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 2f9:	74 15                	je     310 <strlen+0x20>
+ 2fb:	31 c0                	xor    %eax,%eax
+ 2fd:	8d 76 00             	lea    0x0(%esi),%esi
+ 300:	83 c0 01             	add    $0x1,%eax
+ 303:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 307:	89 c1                	mov    %eax,%ecx
+ 309:	75 f5                	jne    300 <strlen+0x10>
+    ;
+  return n;
+}
+ 30b:	89 c8                	mov    %ecx,%eax
+ 30d:	5d                   	pop    %ebp
+ 30e:	c3                   	ret
+ 30f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 310:	31 c9                	xor    %ecx,%ecx
+}
+ 312:	5d                   	pop    %ebp
+ 313:	89 c8                	mov    %ecx,%eax
+ 315:	c3                   	ret
+ 316:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000320 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	57                   	push   %edi
+ 324:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 327:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 32a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 32d:	89 d7                	mov    %edx,%edi
+ 32f:	fc                   	cld
+ 330:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 332:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 335:	89 d0                	mov    %edx,%eax
+ 337:	c9                   	leave
+ 338:	c3                   	ret
+ 339:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000340 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	8b 45 08             	mov    0x8(%ebp),%eax
+ 346:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 34a:	0f b6 10             	movzbl (%eax),%edx
+ 34d:	84 d2                	test   %dl,%dl
+ 34f:	75 12                	jne    363 <strchr+0x23>
+ 351:	eb 1d                	jmp    370 <strchr+0x30>
+ 353:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 357:	90                   	nop
+ 358:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 35c:	83 c0 01             	add    $0x1,%eax
+ 35f:	84 d2                	test   %dl,%dl
+ 361:	74 0d                	je     370 <strchr+0x30>
+    if(*s == c)
+ 363:	38 d1                	cmp    %dl,%cl
+ 365:	75 f1                	jne    358 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 367:	5d                   	pop    %ebp
+ 368:	c3                   	ret
+ 369:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 370:	31 c0                	xor    %eax,%eax
+}
+ 372:	5d                   	pop    %ebp
+ 373:	c3                   	ret
+ 374:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 37f:	90                   	nop
+
+00000380 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	57                   	push   %edi
+ 384:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 385:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 388:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 389:	31 db                	xor    %ebx,%ebx
+{
+ 38b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 38e:	eb 27                	jmp    3b7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 390:	83 ec 04             	sub    $0x4,%esp
+ 393:	6a 01                	push   $0x1
+ 395:	56                   	push   %esi
+ 396:	6a 00                	push   $0x0
+ 398:	e8 1e 01 00 00       	call   4bb <read>
+    if(cc < 1)
+ 39d:	83 c4 10             	add    $0x10,%esp
+ 3a0:	85 c0                	test   %eax,%eax
+ 3a2:	7e 1d                	jle    3c1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 3a4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 3a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3ab:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 3af:	3c 0a                	cmp    $0xa,%al
+ 3b1:	74 10                	je     3c3 <gets+0x43>
+ 3b3:	3c 0d                	cmp    $0xd,%al
+ 3b5:	74 0c                	je     3c3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 3b7:	89 df                	mov    %ebx,%edi
+ 3b9:	83 c3 01             	add    $0x1,%ebx
+ 3bc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 3bf:	7c cf                	jl     390 <gets+0x10>
+ 3c1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 3c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 3ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3cd:	5b                   	pop    %ebx
+ 3ce:	5e                   	pop    %esi
+ 3cf:	5f                   	pop    %edi
+ 3d0:	5d                   	pop    %ebp
+ 3d1:	c3                   	ret
+ 3d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003e0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	56                   	push   %esi
+ 3e4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3e5:	83 ec 08             	sub    $0x8,%esp
+ 3e8:	6a 00                	push   $0x0
+ 3ea:	ff 75 08             	push   0x8(%ebp)
+ 3ed:	e8 f1 00 00 00       	call   4e3 <open>
+  if(fd < 0)
+ 3f2:	83 c4 10             	add    $0x10,%esp
+ 3f5:	85 c0                	test   %eax,%eax
+ 3f7:	78 27                	js     420 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 3f9:	83 ec 08             	sub    $0x8,%esp
+ 3fc:	ff 75 0c             	push   0xc(%ebp)
+ 3ff:	89 c3                	mov    %eax,%ebx
+ 401:	50                   	push   %eax
+ 402:	e8 f4 00 00 00       	call   4fb <fstat>
+  close(fd);
+ 407:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 40a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 40c:	e8 ba 00 00 00       	call   4cb <close>
+  return r;
+ 411:	83 c4 10             	add    $0x10,%esp
+}
+ 414:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 417:	89 f0                	mov    %esi,%eax
+ 419:	5b                   	pop    %ebx
+ 41a:	5e                   	pop    %esi
+ 41b:	5d                   	pop    %ebp
+ 41c:	c3                   	ret
+ 41d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 420:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 425:	eb ed                	jmp    414 <stat+0x34>
+ 427:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42e:	66 90                	xchg   %ax,%ax
+
+00000430 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	53                   	push   %ebx
+ 434:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 437:	0f be 02             	movsbl (%edx),%eax
+ 43a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 43d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 440:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 445:	77 1e                	ja     465 <atoi+0x35>
+ 447:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 450:	83 c2 01             	add    $0x1,%edx
+ 453:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 456:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 45a:	0f be 02             	movsbl (%edx),%eax
+ 45d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 460:	80 fb 09             	cmp    $0x9,%bl
+ 463:	76 eb                	jbe    450 <atoi+0x20>
+  return n;
+}
+ 465:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 468:	89 c8                	mov    %ecx,%eax
+ 46a:	c9                   	leave
+ 46b:	c3                   	ret
+ 46c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000470 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	57                   	push   %edi
+ 474:	56                   	push   %esi
+ 475:	8b 45 10             	mov    0x10(%ebp),%eax
+ 478:	8b 55 08             	mov    0x8(%ebp),%edx
+ 47b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 47e:	85 c0                	test   %eax,%eax
+ 480:	7e 13                	jle    495 <memmove+0x25>
+ 482:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 484:	89 d7                	mov    %edx,%edi
+ 486:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 490:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 491:	39 f8                	cmp    %edi,%eax
+ 493:	75 fb                	jne    490 <memmove+0x20>
+  return vdst;
+}
+ 495:	5e                   	pop    %esi
+ 496:	89 d0                	mov    %edx,%eax
+ 498:	5f                   	pop    %edi
+ 499:	5d                   	pop    %ebp
+ 49a:	c3                   	ret
+
+0000049b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 49b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <exit>:
+SYSCALL(exit)
+ 4a3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <wait>:
+SYSCALL(wait)
+ 4ab:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <pipe>:
+SYSCALL(pipe)
+ 4b3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <read>:
+SYSCALL(read)
+ 4bb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <write>:
+SYSCALL(write)
+ 4c3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <close>:
+SYSCALL(close)
+ 4cb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <kill>:
+SYSCALL(kill)
+ 4d3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <exec>:
+SYSCALL(exec)
+ 4db:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <open>:
+SYSCALL(open)
+ 4e3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <mknod>:
+SYSCALL(mknod)
+ 4eb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <unlink>:
+SYSCALL(unlink)
+ 4f3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <fstat>:
+SYSCALL(fstat)
+ 4fb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <link>:
+SYSCALL(link)
+ 503:	b8 13 00 00 00       	mov    $0x13,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <mkdir>:
+SYSCALL(mkdir)
+ 50b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <chdir>:
+SYSCALL(chdir)
+ 513:	b8 09 00 00 00       	mov    $0x9,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <dup>:
+SYSCALL(dup)
+ 51b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <getpid>:
+SYSCALL(getpid)
+ 523:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <sbrk>:
+SYSCALL(sbrk)
+ 52b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <sleep>:
+SYSCALL(sleep)
+ 533:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <uptime>:
+SYSCALL(uptime)
+ 53b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <memstat>:
+SYSCALL(memstat)
+ 543:	b8 16 00 00 00       	mov    $0x16,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <mmap>:
+SYSCALL(mmap)
+ 54b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <munmap>:
+SYSCALL(munmap)
+ 553:	b8 18 00 00 00       	mov    $0x18,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <shmget>:
+SYSCALL(shmget)
+ 55b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <shmat>:
+SYSCALL(shmat)
+ 563:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <shmdt>:
+SYSCALL(shmdt)
+ 56b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <spawn>:
+SYSCALL(spawn)
+ 573:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <setpriority>:
+SYSCALL(setpriority)
+ 57b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <procinfo>:
+SYSCALL(procinfo)
+ 583:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <setaffinity>:
+SYSCALL(setaffinity)
+ 58b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <getaffinity>:
+SYSCALL(getaffinity)
+ 593:	b8 20 00 00 00       	mov    $0x20,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <shmrm>:
+SYSCALL(shmrm)
+ 59b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+ 5a3:	66 90                	xchg   %ax,%ax
+ 5a5:	66 90                	xchg   %ax,%ax
+ 5a7:	66 90                	xchg   %ax,%ax
+ 5a9:	66 90                	xchg   %ax,%ax
+ 5ab:	66 90                	xchg   %ax,%ax
+ 5ad:	66 90                	xchg   %ax,%ax
+ 5af:	90                   	nop
+
+000005b0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	57                   	push   %edi
+ 5b4:	56                   	push   %esi
+ 5b5:	53                   	push   %ebx
+ 5b6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 5b8:	89 d1                	mov    %edx,%ecx
+{
+ 5ba:	83 ec 3c             	sub    $0x3c,%esp
+ 5bd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 5c0:	85 d2                	test   %edx,%edx
+ 5c2:	0f 89 80 00 00 00    	jns    648 <printint+0x98>
+ 5c8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 5cc:	74 7a                	je     648 <printint+0x98>
+    x = -xx;
+ 5ce:	f7 d9                	neg    %ecx
+    neg = 1;
+ 5d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5d5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 5d8:	31 f6                	xor    %esi,%esi
+ 5da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 5e0:	89 c8                	mov    %ecx,%eax
+ 5e2:	31 d2                	xor    %edx,%edx
+ 5e4:	89 f7                	mov    %esi,%edi
+ 5e6:	f7 f3                	div    %ebx
+ 5e8:	8d 76 01             	lea    0x1(%esi),%esi
+ 5eb:	0f b6 92 54 0a 00 00 	movzbl 0xa54(%edx),%edx
+ 5f2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 5f6:	89 ca                	mov    %ecx,%edx
+ 5f8:	89 c1                	mov    %eax,%ecx
+ 5fa:	39 da                	cmp    %ebx,%edx
+ 5fc:	73 e2                	jae    5e0 <printint+0x30>
+  if(neg)
+ 5fe:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 601:	85 c0                	test   %eax,%eax
+ 603:	74 07                	je     60c <printint+0x5c>
+    buf[i++] = '-';
+ 605:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 60a:	89 f7                	mov    %esi,%edi
+ 60c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 60f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 612:	01 df                	add    %ebx,%edi
+ 614:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 618:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 61b:	83 ec 04             	sub    $0x4,%esp
+ 61e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 621:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 624:	6a 01                	push   $0x1
+ 626:	50                   	push   %eax
+ 627:	56                   	push   %esi
+ 628:	e8 96 fe ff ff       	call   4c3 <write>
+  while(--i >= 0)
+ 62d:	89 f8                	mov    %edi,%eax
+ 62f:	83 c4 10             	add    $0x10,%esp
+ 632:	83 ef 01             	sub    $0x1,%edi
+ 635:	39 d8                	cmp    %ebx,%eax
+ 637:	75 df                	jne    618 <printint+0x68>
+}
+ 639:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 63c:	5b                   	pop    %ebx
+ 63d:	5e                   	pop    %esi
+ 63e:	5f                   	pop    %edi
+ 63f:	5d                   	pop    %ebp
+ 640:	c3                   	ret
+ 641:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 648:	31 c0                	xor    %eax,%eax
+ 64a:	eb 89                	jmp    5d5 <printint+0x25>
+ 64c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000650 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 650:	55                   	push   %ebp
+ 651:	89 e5                	mov    %esp,%ebp
+ 653:	57                   	push   %edi
+ 654:	56                   	push   %esi
+ 655:	53                   	push   %ebx
+ 656:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 659:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 65c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 65f:	0f b6 1e             	movzbl (%esi),%ebx
+ 662:	83 c6 01             	add    $0x1,%esi
+ 665:	84 db                	test   %bl,%bl
+ 667:	74 67                	je     6d0 <printf+0x80>
+ 669:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 66c:	31 d2                	xor    %edx,%edx
+ 66e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 671:	eb 34                	jmp    6a7 <printf+0x57>
+ 673:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 677:	90                   	nop
+ 678:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 67b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 680:	83 f8 25             	cmp    $0x25,%eax
+ 683:	74 18                	je     69d <printf+0x4d>
+  write(fd, &c, 1);
+ 685:	83 ec 04             	sub    $0x4,%esp
+ 688:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 68b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 68e:	6a 01                	push   $0x1
+ 690:	50                   	push   %eax
+ 691:	57                   	push   %edi
+ 692:	e8 2c fe ff ff       	call   4c3 <write>
+ 697:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 69a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 69d:	0f b6 1e             	movzbl (%esi),%ebx
+ 6a0:	83 c6 01             	add    $0x1,%esi
+ 6a3:	84 db                	test   %bl,%bl
+ 6a5:	74 29                	je     6d0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 6a7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 6aa:	85 d2                	test   %edx,%edx
+ 6ac:	74 ca                	je     678 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 6ae:	83 fa 25             	cmp    $0x25,%edx
+ 6b1:	75 ea                	jne    69d <printf+0x4d>
+      if(c == 'd'){
+ 6b3:	83 f8 25             	cmp    $0x25,%eax
+ 6b6:	0f 84 24 01 00 00    	je     7e0 <printf+0x190>
+ 6bc:	83 e8 63             	sub    $0x63,%eax
+ 6bf:	83 f8 15             	cmp    $0x15,%eax
+ 6c2:	77 1c                	ja     6e0 <printf+0x90>
+ 6c4:	ff 24 85 fc 09 00 00 	jmp    *0x9fc(,%eax,4)
+ 6cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6cf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 6d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6d3:	5b                   	pop    %ebx
+ 6d4:	5e                   	pop    %esi
+ 6d5:	5f                   	pop    %edi
+ 6d6:	5d                   	pop    %ebp
+ 6d7:	c3                   	ret
+ 6d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6df:	90                   	nop
+  write(fd, &c, 1);
+ 6e0:	83 ec 04             	sub    $0x4,%esp
+ 6e3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6e6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 6ea:	6a 01                	push   $0x1
+ 6ec:	52                   	push   %edx
+ 6ed:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 6f0:	57                   	push   %edi
+ 6f1:	e8 cd fd ff ff       	call   4c3 <write>
+ 6f6:	83 c4 0c             	add    $0xc,%esp
+ 6f9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6fc:	6a 01                	push   $0x1
+ 6fe:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 701:	52                   	push   %edx
+ 702:	57                   	push   %edi
+ 703:	e8 bb fd ff ff       	call   4c3 <write>
+        putc(fd, c);
+ 708:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 70b:	31 d2                	xor    %edx,%edx
+ 70d:	eb 8e                	jmp    69d <printf+0x4d>
+ 70f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 710:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 713:	83 ec 0c             	sub    $0xc,%esp
+ 716:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 71b:	8b 13                	mov    (%ebx),%edx
+ 71d:	6a 00                	push   $0x0
+ 71f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 721:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 724:	e8 87 fe ff ff       	call   5b0 <printint>
+        ap++;
+ 729:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 72c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 72f:	31 d2                	xor    %edx,%edx
+ 731:	e9 67 ff ff ff       	jmp    69d <printf+0x4d>
+ 736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 73d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 740:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 743:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 745:	83 c0 04             	add    $0x4,%eax
+ 748:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 74b:	85 db                	test   %ebx,%ebx
+ 74d:	0f 84 9d 00 00 00    	je     7f0 <printf+0x1a0>
+        while(*s != 0){
+ 753:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 756:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 758:	84 c0                	test   %al,%al
+ 75a:	0f 84 3d ff ff ff    	je     69d <printf+0x4d>
+ 760:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 763:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 766:	89 de                	mov    %ebx,%esi
+ 768:	89 d3                	mov    %edx,%ebx
+ 76a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 770:	83 ec 04             	sub    $0x4,%esp
+ 773:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 776:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 779:	6a 01                	push   $0x1
+ 77b:	53                   	push   %ebx
+ 77c:	57                   	push   %edi
+ 77d:	e8 41 fd ff ff       	call   4c3 <write>
+        while(*s != 0){
+ 782:	0f b6 06             	movzbl (%esi),%eax
+ 785:	83 c4 10             	add    $0x10,%esp
+ 788:	84 c0                	test   %al,%al
+ 78a:	75 e4                	jne    770 <printf+0x120>
+      state = 0;
+ 78c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 78f:	31 d2                	xor    %edx,%edx
+ 791:	e9 07 ff ff ff       	jmp    69d <printf+0x4d>
+ 796:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 79d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 7a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7a3:	83 ec 0c             	sub    $0xc,%esp
+ 7a6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 7ab:	8b 13                	mov    (%ebx),%edx
+ 7ad:	6a 01                	push   $0x1
+ 7af:	e9 6b ff ff ff       	jmp    71f <printf+0xcf>
+ 7b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 7b8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 7bb:	83 ec 04             	sub    $0x4,%esp
+ 7be:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 7c1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 7c3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 7c6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7c9:	6a 01                	push   $0x1
+ 7cb:	52                   	push   %edx
+ 7cc:	57                   	push   %edi
+ 7cd:	e8 f1 fc ff ff       	call   4c3 <write>
+        ap++;
+ 7d2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7d5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7d8:	31 d2                	xor    %edx,%edx
+ 7da:	e9 be fe ff ff       	jmp    69d <printf+0x4d>
+ 7df:	90                   	nop
+  write(fd, &c, 1);
+ 7e0:	83 ec 04             	sub    $0x4,%esp
+ 7e3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7e6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7e9:	6a 01                	push   $0x1
+ 7eb:	e9 11 ff ff ff       	jmp    701 <printf+0xb1>
+ 7f0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 7f5:	bb f4 09 00 00       	mov    $0x9f4,%ebx
+ 7fa:	e9 61 ff ff ff       	jmp    760 <printf+0x110>
+ 7ff:	90                   	nop
+
+00000800 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 800:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 801:	a1 00 10 00 00       	mov    0x1000,%eax
+{
+ 806:	89 e5                	mov    %esp,%ebp
+ 808:	57                   	push   %edi
+ 809:	56                   	push   %esi
+ 80a:	53                   	push   %ebx
+ 80b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 80e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 811:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 818:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 81a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 81c:	39 ca                	cmp    %ecx,%edx
+ 81e:	73 30                	jae    850 <free+0x50>
+ 820:	39 c1                	cmp    %eax,%ecx
+ 822:	72 04                	jb     828 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 824:	39 c2                	cmp    %eax,%edx
+ 826:	72 f0                	jb     818 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 828:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 82b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 82e:	39 f8                	cmp    %edi,%eax
+ 830:	74 2e                	je     860 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 832:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 835:	8b 42 04             	mov    0x4(%edx),%eax
+ 838:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 83b:	39 f1                	cmp    %esi,%ecx
+ 83d:	74 38                	je     877 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 83f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 841:	5b                   	pop    %ebx
+  freep = p;
+ 842:	89 15 00 10 00 00    	mov    %edx,0x1000
+}
+ 848:	5e                   	pop    %esi
+ 849:	5f                   	pop    %edi
+ 84a:	5d                   	pop    %ebp
+ 84b:	c3                   	ret
+ 84c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 850:	39 c1                	cmp    %eax,%ecx
+ 852:	72 d0                	jb     824 <free+0x24>
+ 854:	eb c2                	jmp    818 <free+0x18>
+ 856:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 85d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 860:	03 70 04             	add    0x4(%eax),%esi
+ 863:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 866:	8b 02                	mov    (%edx),%eax
+ 868:	8b 00                	mov    (%eax),%eax
+ 86a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 86d:	8b 42 04             	mov    0x4(%edx),%eax
+ 870:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 873:	39 f1                	cmp    %esi,%ecx
+ 875:	75 c8                	jne    83f <free+0x3f>
+    p->s.size += bp->s.size;
+ 877:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 87a:	89 15 00 10 00 00    	mov    %edx,0x1000
+    p->s.size += bp->s.size;
+ 880:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 883:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 886:	89 0a                	mov    %ecx,(%edx)
+}
+ 888:	5b                   	pop    %ebx
+ 889:	5e                   	pop    %esi
+ 88a:	5f                   	pop    %edi
+ 88b:	5d                   	pop    %ebp
+ 88c:	c3                   	ret
+ 88d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000890 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 890:	55                   	push   %ebp
+ 891:	89 e5                	mov    %esp,%ebp
+ 893:	57                   	push   %edi
+ 894:	56                   	push   %esi
+ 895:	53                   	push   %ebx
+ 896:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 899:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 89c:	8b 15 00 10 00 00    	mov    0x1000,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8a2:	8d 78 07             	lea    0x7(%eax),%edi
+ 8a5:	c1 ef 03             	shr    $0x3,%edi
+ 8a8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 8ab:	85 d2                	test   %edx,%edx
+ 8ad:	0f 84 8d 00 00 00    	je     940 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8b3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8b5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8b8:	39 f9                	cmp    %edi,%ecx
+ 8ba:	73 64                	jae    920 <malloc+0x90>
+  if(nu < 4096)
+ 8bc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 8c1:	39 df                	cmp    %ebx,%edi
+ 8c3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 8c6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 8cd:	eb 0a                	jmp    8d9 <malloc+0x49>
+ 8cf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8d0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8d2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8d5:	39 f9                	cmp    %edi,%ecx
+ 8d7:	73 47                	jae    920 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 8d9:	89 c2                	mov    %eax,%edx
+ 8db:	39 05 00 10 00 00    	cmp    %eax,0x1000
+ 8e1:	75 ed                	jne    8d0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 8e3:	83 ec 0c             	sub    $0xc,%esp
+ 8e6:	56                   	push   %esi
+ 8e7:	e8 3f fc ff ff       	call   52b <sbrk>
+  if(p == (char*)-1)
+ 8ec:	83 c4 10             	add    $0x10,%esp
+ 8ef:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8f2:	74 1c                	je     910 <malloc+0x80>
+  hp->s.size = nu;
+ 8f4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 8f7:	83 ec 0c             	sub    $0xc,%esp
+ 8fa:	83 c0 08             	add    $0x8,%eax
+ 8fd:	50                   	push   %eax
+ 8fe:	e8 fd fe ff ff       	call   800 <free>
+  return freep;
+ 903:	8b 15 00 10 00 00    	mov    0x1000,%edx
+      if((p = morecore(nunits)) == 0)
+ 909:	83 c4 10             	add    $0x10,%esp
+ 90c:	85 d2                	test   %edx,%edx
+ 90e:	75 c0                	jne    8d0 <malloc+0x40>
+        return 0;
+  }
+}
+ 910:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 913:	31 c0                	xor    %eax,%eax
+}
+ 915:	5b                   	pop    %ebx
+ 916:	5e                   	pop    %esi
+ 917:	5f                   	pop    %edi
+ 918:	5d                   	pop    %ebp
+ 919:	c3                   	ret
+ 91a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 920:	39 cf                	cmp    %ecx,%edi
+ 922:	74 4c                	je     970 <malloc+0xe0>
+        p->s.size -= nunits;
+ 924:	29 f9                	sub    %edi,%ecx
+ 926:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 929:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 92c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 92f:	89 15 00 10 00 00    	mov    %edx,0x1000
+}
+ 935:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 938:	83 c0 08             	add    $0x8,%eax
+}
+ 93b:	5b                   	pop    %ebx
+ 93c:	5e                   	pop    %esi
+ 93d:	5f                   	pop    %edi
+ 93e:	5d                   	pop    %ebp
+ 93f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 940:	c7 05 00 10 00 00 04 	movl   $0x1004,0x1000
+ 947:	10 00 00 
+    base.s.size = 0;
+ 94a:	b8 04 10 00 00       	mov    $0x1004,%eax
+    base.s.ptr = freep = prevp = &base;
+ 94f:	c7 05 04 10 00 00 04 	movl   $0x1004,0x1004
+ 956:	10 00 00 
+    base.s.size = 0;
+ 959:	c7 05 08 10 00 00 00 	movl   $0x0,0x1008
+ 960:	00 00 00 
+    if(p->s.size >= nunits){
+ 963:	e9 54 ff ff ff       	jmp    8bc <malloc+0x2c>
+ 968:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 96f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 970:	8b 08                	mov    (%eax),%ecx
+ 972:	89 0a                	mov    %ecx,(%edx)
+ 974:	eb b9                	jmp    92f <malloc+0x9f>
@@ -0,0 +1,84 @@
+// Time a byte bouncing between two processes over a pair of
+// pipes, which is mostly the cost of sleep and wakeup.
+//
+// usage: pipebench [rounds]
+//
+// Prints the average round trip in TSC cycles.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+static inline uint64
+rdtsc(void)
+{
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  return ((uint64)hi << 32) | lo;
+}
+
+// n / d, without the 64-bit division that libgcc would provide.
+uint
+div64(uint64 n, uint d)
+{
+  uint64 r;
+  uint q;
+  int i;
+
+  r = 0;
+  q = 0;
+  for(i = 63; i >= 0; i--){
+    r = r << 1 | ((n >> i) & 1);
+    q <<= 1;
+    if(r >= d){
+      r -= d;
+      q |= 1;
+    }
+  }
+  return q;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, rounds, ticks, ping[2], pong[2];
+  uint64 t0, t;
+  char c;
+
+  rounds = argc > 1 ? atoi(argv[1]) : 10000;
+  if(rounds < 1){
+    printf(2, "usage: pipebench [rounds]\n");
+    exit();
+  }
+  if(pipe(ping) < 0 || pipe(pong) < 0){
+    printf(2, "pipebench: pipe failed\n");
+    exit();
+  }
+  if(fork() == 0){
+    close(ping[1]);
+    close(pong[0]);
+    while(read(ping[0], &c, 1) == 1)
+      write(pong[1], &c, 1);
+    exit();
+  }
+  close(ping[0]);
+  close(pong[1]);
+
+  ticks = uptime();
+  t0 = rdtsc();
+  for(i = 0; i < rounds; i++){
+    write(ping[1], "x", 1);
+    if(read(pong[0], &c, 1) != 1){
+      printf(2, "pipebench: read failed\n");
+      exit();
+    }
+  }
+  t = rdtsc() - t0;
+  ticks = uptime() - ticks;
+  close(ping[1]);
+  wait();
+  printf(1, "%d round trips in %d ticks, %d cycles each\n",
+         rounds, ticks, div64(t, rounds));
+  exit();
+}
@@ -6,24 +6,86 @@
 #include "x86.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "procinfo.h"
+#include "traps.h"
 
 struct {
   struct spinlock lock;
   struct proc proc[NPROC];
 } ptable;
 
+// Each CPU has a queue of RUNNABLE processes, so that picking
+// the next process to run takes constant time, and a CPU with
+// nothing to do only looks at the queue lengths instead of
+// taking ptable.lock. A CPU whose queue is empty steals from
+// the others. ptable.lock still guards p->state: a process is
+// queued as it becomes RUNNABLE, with ptable.lock held, and the
+// scheduler takes ptable.lock after dequeuing it, which also
+// waits for the process to finish switching away on the CPU
+// that queued it. Lock order: ptable.lock, then a queue's lock.
+//
+// How a queue orders its processes depends on the policy the
+// kernel is built with. By default the queues are multilevel
+// feedback queues: a queue holds a FIFO list for each of NPRIO
+// priority levels, and the scheduler runs the first process of
+// the highest level. A process starts at level p->nice. One that
+// uses up the time slice of its level, SLICE(level) ticks, moves
+// down a level, so CPU-bound processes sink below interactive
+// ones, which mostly sleep. Every BOOSTTICKS ticks boost() moves
+// every process back up to its nice level so that none starves.
+//
+// Built with -DFAIRSCHED (make SCHED=fair), the kernel shares the
+// CPU in proportion to weights instead. Each process accumulates
+// virtual runtime, the TSC cycles it has run multiplied by 2^nice,
+// and a queue is a balanced tree ordered by virtual runtime, from
+// which the scheduler runs the process that is furthest behind.
+// So a process gets twice the CPU time of one a nice level below.
+//
+// A CPU that finds no work anywhere halts (see idle) instead of
+// polling the queues, and ready() sends it a wakeup interrupt
+// when a process is queued that it could run.
+struct runq {
+  struct spinlock lock;
+#ifdef FAIRSCHED
+  struct proc *root;    // AVL tree of the processes by vruntime
+  uint64 minv;          // least vruntime run from here; never drops
+  uint64 leftv;         // vruntime of the leftmost process
+#else
+  struct proc *head[NPRIO];
+  struct proc *tail[NPRIO];
+#endif
+  int n;
+};
+
+static struct runq runq[NCPU];
+static uint nboost;  // priority boosts so far
+
+// Sleeping processes are kept in lists hashed by channel, so
+// that wakeup() looks only at the processes that might be
+// sleeping on its channel. Guarded by ptable.lock.
+#define SLEEPQLOG 6
+#define SLEEPQ(chan) \
+  (&sleepq[((uint)(chan) * 2654435761U) >> (32 - SLEEPQLOG)])
+
+static struct proc *sleepq[1 << SLEEPQLOG];
+
 static struct proc *initproc;
 
 int nextpid = 1;
 extern void forkret(void);
 extern void trapret(void);
 
+static void ready(struct proc *p);
 static void wakeup1(void *chan);
 
 void
 pinit(void)
 {
+  int i;
+
   initlock(&ptable.lock, "ptable");
+  for(i = 0; i < NCPU; i++)
+    initlock(&runq[i].lock, "runq");
 }
 
 // Must be called with interrupts disabled
@@ -88,6 +150,12 @@ allocproc(void)
 found:
   p->state = EMBRYO;
   p->pid = nextpid++;
+  p->nice = 0;
+  p->prio = 0;
+  p->ticks = 0;
+  p->boostgen = nboost;
+  p->vruntime = 0;
+  p->cpumask = ~0;
 
   release(&ptable.lock);
 
@@ -148,7 +216,8 @@ userinit(void)
   // because the assignment might not be atomic.
   acquire(&ptable.lock);
 
-  p->state = RUNNABLE;
+  p->lastcpu = cpuid();
+  ready(p);
 
   release(&ptable.lock);
 }
@@ -163,8 +232,14 @@ growproc(int n)
 
   sz = curproc->sz;
   if(n > 0){
-    if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
+    // Only reserve the address space: pagefault() allocates
+    // and zeroes each page the first time it is touched.
+    // Refuse requests that could never be backed by memory,
+    // counting what swapping out other pages could free.
+    if(sz + n < sz || sz + n > mmapbase(curproc) || sz + n >= KERNBASE ||
+       PGROUNDUP(n)/PGSIZE > kfreepages() + swapfreepages())
       return -1;
+    sz += n;
   } else if(n < 0){
     if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
       return -1;
@@ -190,12 +265,16 @@ fork(void)
   }
 
   // Copy process state from proc.
-  if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
+  if((np->pgdir = copyuvm(curproc->pgdir)) == 0){
     kfree(np->kstack);
     np->kstack = 0;
     np->state = UNUSED;
+    lcr3(V2P(curproc->pgdir));
     return -1;
   }
+  // copyuvm made our writable pages copy-on-write;
+  // flush the stale writable TLB entries.
+  lcr3(V2P(curproc->pgdir));
   np->sz = curproc->sz;
   np->parent = curproc;
   *np->tf = *curproc->tf;
@@ -207,6 +286,15 @@ fork(void)
     if(curproc->ofile[i])
       np->ofile[i] = filedup(curproc->ofile[i]);
   np->cwd = idup(curproc->cwd);
+  np->nice = np->prio = curproc->nice;
+  np->cpumask = curproc->cpumask;
+  for(i = 0; i < NVMA; i++){
+    np->vma[i] = curproc->vma[i];
+    if(np->vma[i].ip)
+      idup(np->vma[i].ip);
+    if(np->vma[i].shm)
+      shmdup(np->vma[i].shm);
+  }
 
   safestrcpy(np->name, curproc->name, sizeof(curproc->name));
 
@@ -214,7 +302,60 @@ fork(void)
 
   acquire(&ptable.lock);
 
-  np->state = RUNNABLE;
+  np->lastcpu = cpuid();
+  ready(np);
+
+  release(&ptable.lock);
+
+  return pid;
+}
+
+// Create a new process running the program in path, as fork()
+// followed by exec() in the child would, but without copying
+// the current process's memory only to throw it away. If ofile
+// is not 0, the child's descriptors 0-2 are ofile[0-2], which
+// may be 0, and it gets no others; otherwise it gets a copy of
+// every descriptor. Returns the child's pid.
+int
+spawn(char *path, char **argv, struct file **ofile)
+{
+  int i, pid;
+  struct proc *np;
+  struct proc *curproc = myproc();
+
+  if((np = allocproc()) == 0)
+    return -1;
+
+  memset(np->tf, 0, sizeof(*np->tf));
+  np->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+  np->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+  np->tf->es = np->tf->ds;
+  np->tf->ss = np->tf->ds;
+  np->tf->eflags = FL_IF;
+  if(execnew(np, path, argv) < 0){
+    kfree(np->kstack);
+    np->kstack = 0;
+    np->state = UNUSED;
+    return -1;
+  }
+  np->parent = curproc;
+
+  for(i = 0; i < NOFILE; i++){
+    if(ofile && i < 3 && ofile[i])
+      np->ofile[i] = filedup(ofile[i]);
+    else if(ofile == 0 && curproc->ofile[i])
+      np->ofile[i] = filedup(curproc->ofile[i]);
+  }
+  np->cwd = idup(curproc->cwd);
+  np->nice = np->prio = curproc->nice;
+  np->cpumask = curproc->cpumask;
+
+  pid = np->pid;
+
+  acquire(&ptable.lock);
+
+  np->lastcpu = cpuid();
+  ready(np);
 
   release(&ptable.lock);
 
@@ -242,8 +383,11 @@ exit(void)
     }
   }
 
+  // Write back and drop mmap regions, then the rest.
+  munmap(0, KERNBASE);
   begin_op();
   iput(curproc->cwd);
+  freevmas(curproc->vma);
   end_op();
   curproc->cwd = 0;
 
@@ -312,6 +456,537 @@ wait(void)
 }
 
 //PAGEBREAK: 42
+#ifndef FAIRSCHED
+// Multilevel feedback queues.
+
+#define SLICE(prio) (1 << (prio))
+
+static void catchup(struct proc *p);
+
+// Append p to q's list for its level. Caller holds q->lock.
+static void
+enqueue(struct runq *q, struct proc *p)
+{
+  catchup(p);
+  p->rqnext = 0;
+  if(q->tail[p->prio])
+    q->tail[p->prio]->rqnext = p;
+  else
+    q->head[p->prio] = p;
+  q->tail[p->prio] = p;
+  q->n++;
+}
+
+// Bring p back to its nice level if there was a boost since
+// p last looked.
+static void
+catchup(struct proc *p)
+{
+  if(p->boostgen != nboost){
+    p->boostgen = nboost;
+    p->prio = p->nice;
+    p->ticks = 0;
+  }
+}
+
+// Take the first process of the highest level of q that may
+// run on CPU id, or any process if id is -1. Returns 0 if there
+// is none. The unlocked look at q->n keeps idle CPUs off the
+// locks of empty queues.
+static struct proc*
+dequeue(struct runq *q, int id)
+{
+  struct proc *p, *prev;
+  int i;
+
+  if(q->n == 0)
+    return 0;
+  acquire(&q->lock);
+  for(i = 0; i < NPRIO; i++){
+    prev = 0;
+    for(p = q->head[i]; p; prev = p, p = p->rqnext)
+      if(id < 0 || (p->cpumask & (1 << id)))
+        break;
+    if(p){
+      if(prev)
+        prev->rqnext = p->rqnext;
+      else
+        q->head[i] = p->rqnext;
+      if(q->tail[i] == p)
+        q->tail[i] = prev;
+      q->n--;
+      p->rqnext = 0;
+      break;
+    }
+  }
+  release(&q->lock);
+  return p;
+}
+
+// Move every process back up to its nice level. Called by the
+// timer interrupt every BOOSTTICKS ticks. Queued processes are
+// moved now, the others when they are next queued or charged a
+// tick (see catchup).
+void
+boost(void)
+{
+  struct runq *q;
+  struct proc *p, *next;
+  int i;
+
+  nboost++;
+  for(q = runq; q < &runq[NCPU]; q++){
+    if(q->n == 0)
+      continue;
+    acquire(&q->lock);
+    q->n = 0;
+    for(i = 0; i < NPRIO; i++){
+      p = q->head[i];
+      q->head[i] = q->tail[i] = 0;
+      for(; p; p = next){
+        next = p->rqnext;
+        enqueue(q, p);
+      }
+    }
+    release(&q->lock);
+  }
+}
+
+// Charge a timer tick to p, which is running. Returns 1 if it
+// should give up the CPU: when it has used up the time slice of
+// its level, which also moves it down a level, or when a process
+// of a higher level is waiting on this CPU.
+static int
+sliceover(struct proc *p)
+{
+  struct runq *q;
+  int i;
+
+  catchup(p);
+  if(++p->ticks >= SLICE(p->prio)){
+    p->ticks = 0;
+    if(p->prio < NPRIO-1)
+      p->prio++;
+    return 1;
+  }
+  q = &runq[p->lastcpu];
+  for(i = 0; i < p->prio; i++)
+    if(q->head[i])
+      return 1;
+  return 0;
+}
+
+// Timer ticks do the charging (see sliceover).
+static void
+charge(struct proc *p)
+{
+}
+
+static void
+migrate(struct proc *p, struct runq *from, struct runq *to)
+{
+}
+
+#else
+// Fair share.
+
+// Charge p, which is giving up the CPU, for the time it ran.
+static void
+charge(struct proc *p)
+{
+  uint64 now;
+
+  now = rdtsc();
+  p->vruntime += (now - p->tstart) << p->nice;
+  p->tstart = now;
+}
+
+static int
+height(struct proc *t)
+{
+  return t ? t->height : 0;
+}
+
+// Rotate the subtree at t up from its right or left child.
+static struct proc*
+rotate(struct proc *t, int left)
+{
+  struct proc *c;
+
+  if(left){
+    c = t->right;
+    t->right = c->left;
+    c->left = t;
+  } else {
+    c = t->left;
+    t->left = c->right;
+    c->right = t;
+  }
+  t->height = 1 + (height(t->left) > height(t->right) ? height(t->left) : height(t->right));
+  c->height = 1 + (height(c->left) > height(c->right) ? height(c->left) : height(c->right));
+  return c;
+}
+
+// Restore the AVL balance at t after one of its subtrees changed
+// height by one. Returns the new root of the subtree.
+static struct proc*
+balance(struct proc *t)
+{
+  int d;
+
+  d = height(t->left) - height(t->right);
+  if(d > 1){
+    if(height(t->left->left) < height(t->left->right))
+      t->left = rotate(t->left, 1);
+    return rotate(t, 0);
+  }
+  if(d < -1){
+    if(height(t->right->right) < height(t->right->left))
+      t->right = rotate(t->right, 0);
+    return rotate(t, 1);
+  }
+  t->height = 1 + (d > 0 ? height(t->left) : height(t->right));
+  return t;
+}
+
+static struct proc*
+treeinsert(struct proc *t, struct proc *p)
+{
+  if(t == 0){
+    p->left = p->right = 0;
+    p->height = 1;
+    return p;
+  }
+  if(p->vruntime < t->vruntime)
+    t->left = treeinsert(t->left, p);
+  else
+    t->right = treeinsert(t->right, p);
+  return balance(t);
+}
+
+// Remove the leftmost process of t into *min.
+static struct proc*
+treeremovemin(struct proc *t, struct proc **min)
+{
+  if(t->left == 0){
+    *min = t;
+    return t->right;
+  }
+  t->left = treeremovemin(t->left, min);
+  return balance(t);
+}
+
+// Remove into *p the leftmost process of t that may run on CPU
+// id, or the leftmost of all if id is -1, leaving *p 0 if there
+// is none. Only a steal looks past the leftmost process.
+static struct proc*
+treeremove(struct proc *t, int id, struct proc **p)
+{
+  struct proc *m, *r;
+
+  if(t == 0)
+    return 0;
+  t->left = treeremove(t->left, id, p);
+  if(*p)
+    return balance(t);
+  if(id >= 0 && (t->cpumask & (1 << id)) == 0){
+    t->right = treeremove(t->right, id, p);
+    return balance(t);
+  }
+  *p = t;
+  if(t->left == 0)
+    return t->right;
+  if(t->right == 0)
+    return t->left;
+  r = treeremovemin(t->right, &m);
+  m->left = t->left;
+  m->right = r;
+  return balance(m);
+}
+
+static void
+setleftv(struct runq *q)
+{
+  struct proc *t;
+
+  for(t = q->root; t && t->left; t = t->left)
+    ;
+  q->leftv = t ? t->vruntime : ~0ULL;
+}
+
+// Insert p into q. A process that slept, or is new, starts no
+// further behind than the least vruntime the queue has run, so
+// it cannot make up for time it did not want the CPU.
+// Caller holds q->lock.
+static void
+enqueue(struct runq *q, struct proc *p)
+{
+  p->prio = p->nice;
+  if(p->vruntime < q->minv)
+    p->vruntime = q->minv;
+  q->root = treeinsert(q->root, p);
+  q->n++;
+  setleftv(q);
+}
+
+// Take the process of q with the least vruntime that may run on
+// CPU id, or any process if id is -1. Returns 0 if there is none.
+// The unlocked look at q->n keeps idle CPUs off the locks of
+// empty queues.
+static struct proc*
+dequeue(struct runq *q, int id)
+{
+  struct proc *p;
+
+  if(q->n == 0)
+    return 0;
+  acquire(&q->lock);
+  p = 0;
+  q->root = treeremove(q->root, id, &p);
+  if(p){
+    q->n--;
+    if(p->vruntime == q->leftv && p->vruntime > q->minv)
+      q->minv = p->vruntime;
+    setleftv(q);
+  }
+  release(&q->lock);
+  return p;
+}
+
+// Make the vruntime of p, stolen from queue from, relative to
+// queue to instead.
+static void
+migrate(struct proc *p, struct runq *from, struct runq *to)
+{
+  uint64 lag;
+
+  lag = p->vruntime > from->minv ? p->vruntime - from->minv : 0;
+  p->vruntime = to->minv + lag;
+}
+
+// Fair-share scheduling needs no boosts.
+void
+boost(void)
+{
+}
+
+// Returns 1 if p, which is running, should give up the CPU
+// because a process on its queue is further behind than it is
+// now.
+static int
+sliceover(struct proc *p)
+{
+  struct runq *q;
+
+  q = &runq[p->lastcpu];
+  return q->n > 0 &&
+         q->leftv < p->vruntime + ((rdtsc() - p->tstart) << p->nice);
+}
+#endif
+
+// Called on each timer tick. Returns 1 if the current process
+// should give up the CPU, as the policy decides, or because it
+// may no longer run on this CPU (see setaffinity).
+int
+slicetick(void)
+{
+  struct proc *p = myproc();
+
+  if(sliceover(p))
+    return 1;
+  return (p->cpumask & (1 << cpuid())) == 0;
+}
+
+// Wake a halted CPU to run a process just queued on CPU id's
+// queue: id itself if it is idle, else any idle CPU in mask, the
+// process's affinity, which can steal it. No other CPU is woken
+// for a process queued on this CPU's own queue, as by yield() at
+// the end of a time slice: this CPU will soon pick it itself, on
+// its way through the scheduler or at the latest when the timer
+// ends the current slice, and waking another CPU would only
+// migrate the process away from its cache. xchg clears the flag,
+// so that only one waker sends the interrupt. Interrupts must
+// be off.
+static void
+kick(int id, uint mask)
+{
+  int i, me;
+
+  me = cpuid();
+  if(xchg(&cpus[id].idle, 0)){
+    if(id != me)
+      lapicipi(cpus[id].apicid, T_IRQ0 + IRQ_WAKEUP);
+    return;
+  }
+  if(id == me)
+    return;
+  for(i = 0; i < ncpu; i++){
+    if(i != id && (mask & (1 << i)) && xchg(&cpus[i].idle, 0)){
+      if(i != me)
+        lapicipi(cpus[i].apicid, T_IRQ0 + IRQ_WAKEUP);
+      return;
+    }
+  }
+}
+
+// Mark p RUNNABLE and add it to the run queue of the CPU it
+// last ran on, whose caches may still hold its memory, or if p
+// may no longer run there, of the least busy CPU it may run on.
+// Caller holds ptable.lock.
+static void
+ready(struct proc *p)
+{
+  struct runq *q;
+  int i, id;
+
+  if(p->state == RUNNING)
+    charge(p);
+  p->state = RUNNABLE;
+  id = p->lastcpu;
+  if((p->cpumask & (1 << id)) == 0){
+    id = -1;
+    for(i = 0; i < ncpu; i++)
+      if((p->cpumask & (1 << i)) && (id < 0 || runq[i].n < runq[id].n))
+        id = i;
+  }
+  q = &runq[id];
+  acquire(&q->lock);
+  enqueue(q, p);
+  release(&q->lock);
+  kick(id, p->cpumask);
+}
+
+// Set the nice level of process pid, the scheduling level it
+// starts at and is boosted back to. Returns -1 if there is no
+// such process or the level is out of range. p->prio may index
+// the lists of a run queue that p is on, which only that queue's
+// lock guards, so p moves to its new level as if it had missed
+// a boost, when it is next queued or charged a tick (see
+// catchup).
+int
+setpriority(int pid, int nice)
+{
+  struct proc *p;
+
+  if(nice < 0 || nice >= NPRIO)
+    return -1;
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    if(p->pid == pid && p->state != UNUSED){
+      p->nice = nice;
+      p->boostgen = nboost - 1;
+      release(&ptable.lock);
+      return 0;
+    }
+  }
+  release(&ptable.lock);
+  return -1;
+}
+
+// Set the CPUs process pid may run on to those in mask, bit i
+// for cpus[i]. Returns -1 if there is no such process or mask
+// has no CPU. The process moves when it next gives up the CPU,
+// which the timer makes it do soon if it is running elsewhere
+// (see slicetick); the current process moves at once.
+int
+setaffinity(int pid, uint mask)
+{
+  struct proc *p;
+
+  mask &= (1 << ncpu) - 1;
+  if(mask == 0)
+    return -1;
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    if(p->pid == pid && p->state != UNUSED){
+      p->cpumask = mask;
+      release(&ptable.lock);
+      if(p == myproc() && (mask & (1 << p->lastcpu)) == 0)
+        yield();
+      return 0;
+    }
+  }
+  release(&ptable.lock);
+  return -1;
+}
+
+// Return the mask of CPUs process pid may run on, or -1 if
+// there is no such process.
+int
+getaffinity(int pid)
+{
+  struct proc *p;
+  int mask;
+
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    if(p->pid == pid && p->state != UNUSED){
+      mask = p->cpumask & ((1 << ncpu) - 1);
+      release(&ptable.lock);
+      return mask;
+    }
+  }
+  release(&ptable.lock);
+  return -1;
+}
+
+// Choose the next process for this CPU to run: the first of its
+// own queue, or else one that may run here stolen from another
+// queue, the busiest first.
+static struct proc*
+pick(int id)
+{
+  struct proc *p;
+  int i, n, victim;
+  uint tried;
+
+  if((p = dequeue(&runq[id], -1)) != 0)
+    return p;
+  tried = 1 << id;
+  for(;;){
+    victim = -1;
+    n = 0;
+    for(i = 0; i < ncpu; i++){
+      if((tried & (1 << i)) == 0 && runq[i].n > n){
+        n = runq[i].n;
+        victim = i;
+      }
+    }
+    if(victim < 0)
+      return 0;
+    if((p = dequeue(&runq[victim], id)) != 0)
+      break;
+    tried |= 1 << victim;
+  }
+  migrate(p, &runq[victim], &runq[id]);
+  return p;
+}
+
+// Halt this CPU until an interrupt arrives, unless there is a
+// process for it to run, which it returns. Setting c->idle
+// before looking at the queues means a process queued after the
+// look always finds the flag set and sends the wakeup (see kick),
+// and sti takes effect only after the next instruction, so the
+// interrupt cannot slip in between sti and hlt.
+static struct proc*
+idle(int id)
+{
+  struct cpu *c;
+  struct proc *p;
+
+  cli();
+  c = mycpu();
+  xchg(&c->idle, 1);
+  if((p = pick(id)) != 0){
+    c->idle = 0;
+    sti();
+    return p;
+  }
+  asm volatile("sti; hlt");
+  c->idle = 0;
+  return 0;
+}
+
 // Per-CPU process scheduler.
 // Each CPU calls scheduler() after setting itself up.
 // Scheduler never returns.  It loops, doing:
@@ -324,34 +999,45 @@ scheduler(void)
 {
   struct proc *p;
   struct cpu *c = mycpu();
+  int id = cpuid();
   c->proc = 0;
   
   for(;;){
     // Enable interrupts on this processor.
     sti();
 
-    // Loop over process table looking for process to run.
-    acquire(&ptable.lock);
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->state != RUNNABLE)
+    if((p = pick(id)) == 0){
+      // Nothing to run: use the time to zero a free page,
+      // or sleep until there is something to do.
+      if(kzeroidle() || (p = idle(id)) == 0)
         continue;
+    }
 
-      // Switch to chosen process.  It is the process's job
-      // to release ptable.lock and then reacquire it
-      // before jumping back to us.
-      c->proc = p;
-      switchuvm(p);
-      p->state = RUNNING;
-
-      swtch(&(c->scheduler), p->context);
-      switchkvm();
-
-      // Process is done running for now.
-      // It should have changed its p->state before coming back.
-      c->proc = 0;
+    // Switch to chosen process.  It is the process's job
+    // to release ptable.lock and then reacquire it
+    // before jumping back to us.
+    acquire(&ptable.lock);
+    if(p->state != RUNNABLE)
+      panic("scheduler: queued process not runnable");
+    if((p->cpumask & (1 << id)) == 0){
+      // Its affinity changed while it was queued here.
+      ready(p);
+      release(&ptable.lock);
+      continue;
     }
+    c->proc = p;
+    p->lastcpu = id;
+    p->tstart = rdtsc();
+    switchuvm(p);
+    p->state = RUNNING;
+
+    swtch(&(c->scheduler), p->context);
+    switchkvm();
+
+    // Process is done running for now.
+    // It should have changed its p->state before coming back.
+    c->proc = 0;
     release(&ptable.lock);
-
   }
 }
 
@@ -376,6 +1062,8 @@ sched(void)
     panic("sched running");
   if(readeflags()&FL_IF)
     panic("sched interruptible");
+  if(p->state != RUNNABLE)
+    charge(p);  // ready() charged a process that yields
   intena = mycpu()->intena;
   swtch(&p->context, mycpu()->scheduler);
   mycpu()->intena = intena;
@@ -386,7 +1074,7 @@ void
 yield(void)
 {
   acquire(&ptable.lock);  //DOC: yieldlock
-  myproc()->state = RUNNABLE;
+  ready(myproc());
   sched();
   release(&ptable.lock);
 }
@@ -438,6 +1126,8 @@ sleep(void *chan, struct spinlock *lk)
   // Go to sleep.
   p->chan = chan;
   p->state = SLEEPING;
+  p->slnext = *SLEEPQ(chan);
+  *SLEEPQ(chan) = p;
 
   sched();
 
@@ -457,11 +1147,29 @@ sleep(void *chan, struct spinlock *lk)
 static void
 wakeup1(void *chan)
 {
-  struct proc *p;
+  struct proc *p, **pp;
+
+  pp = SLEEPQ(chan);
+  while((p = *pp) != 0){
+    if(p->chan == chan){
+      *pp = p->slnext;
+      ready(p);
+    } else
+      pp = &p->slnext;
+  }
+}
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == SLEEPING && p->chan == chan)
-      p->state = RUNNABLE;
+// Take p, which is SLEEPING, off its sleep list and make it
+// RUNNABLE. The ptable lock must be held.
+static void
+unsleep(struct proc *p)
+{
+  struct proc **pp;
+
+  for(pp = SLEEPQ(p->chan); *pp != p; pp = &(*pp)->slnext)
+    ;
+  *pp = p->slnext;
+  ready(p);
 }
 
 // Wake up all processes sleeping on chan.
@@ -487,7 +1195,7 @@ kill(int pid)
       p->killed = 1;
       // Wake process from sleep if necessary.
       if(p->state == SLEEPING)
-        p->state = RUNNABLE;
+        unsleep(p);
       release(&ptable.lock);
       return 0;
     }
@@ -496,6 +1204,78 @@ kill(int pid)
   return -1;
 }
 
+// Choose up to n user pages for swapout() to write to the swap
+// slots slot[0..n-1], storing them in page[]. The clock hand
+// goes around the processes twice at most, the first time to
+// clear accessed bits. Processes running on other CPUs are
+// passed over, since their TLBs may hold the PTEs. Returns
+// the number of pages chosen.
+int
+evict(uint *slot, char **page, int n)
+{
+  static int hand;
+  struct proc *p;
+  int i, got;
+
+  got = 0;
+  acquire(&ptable.lock);
+  for(i = 0; i <= 2*NPROC && got < n; i++){
+    p = &ptable.proc[hand];
+    if(p->state == RUNNABLE || p->state == SLEEPING || p == myproc())
+      got += uvmevict(p, slot + got, page + got, n - got);
+    if(got < n)
+      hand = (hand + 1) % NPROC;
+  }
+  release(&ptable.lock);
+  return got;
+}
+
+static char *states[] = {
+[UNUSED]    "unused",
+[EMBRYO]    "embryo",
+[SLEEPING]  "sleep ",
+[RUNNABLE]  "runble",
+[RUNNING]   "run   ",
+[ZOMBIE]    "zombie"
+};
+
+// Copy information about up to n processes to the array of
+// struct procinfo at user address addr, for the procinfo system
+// call. Each process is copied out after ptable.lock is released,
+// since writing to user memory may fault. Returns the number of
+// processes.
+int
+procinfo(uint addr, int n)
+{
+  struct procinfo pi;
+  struct proc *p;
+  int i, got;
+
+  got = 0;
+  for(i = 0; i < NPROC && got < n; i++){
+    p = &ptable.proc[i];
+    acquire(&ptable.lock);
+    if(p->state == UNUSED){
+      release(&ptable.lock);
+      continue;
+    }
+    pi.pid = p->pid;
+    pi.ppid = p->parent ? p->parent->pid : 0;
+    safestrcpy(pi.state, states[p->state], sizeof(pi.state));
+    pi.prio = p->prio;
+    pi.nice = p->nice;
+    pi.cpu = p->lastcpu;
+    pi.cpumask = p->cpumask & ((1 << ncpu) - 1);
+    pi.sz = p->sz;
+    safestrcpy(pi.name, p->name, sizeof(pi.name));
+    release(&ptable.lock);
+    if(copyout(myproc()->pgdir, addr + got*sizeof(pi), &pi, sizeof(pi)) < 0)
+      return -1;
+    got++;
+  }
+  return got;
+}
+
 //PAGEBREAK: 36
 // Print a process listing to console.  For debugging.
 // Runs when user types ^P on console.
@@ -503,14 +1283,6 @@ kill(int pid)
 void
 procdump(void)
 {
-  static char *states[] = {
-  [UNUSED]    "unused",
-  [EMBRYO]    "embryo",
-  [SLEEPING]  "sleep ",
-  [RUNNABLE]  "runble",
-  [RUNNING]   "run   ",
-  [ZOMBIE]    "zombie"
-  };
   int i;
   struct proc *p;
   char *state;
@@ -523,7 +1295,7 @@ procdump(void)
       state = states[p->state];
     else
       state = "???";
-    cprintf("%d %s %s", p->pid, state, p->name);
+    cprintf("%d %s %d %s", p->pid, state, p->prio, p->name);
     if(p->state == SLEEPING){
       getcallerpcs((uint*)p->context->ebp+2, pc);
       for(i=0; i<10 && pc[i] != 0; i++)
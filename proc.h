@@ -8,6 +8,7 @@ struct cpu {
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
   struct proc *proc;           // The process running on this cpu or null
+  volatile uint idle;          // Halted in scheduler() waiting for work?
 };
 
 extern struct cpu cpus[NCPU];
@@ -34,6 +35,25 @@ struct context {
 
 enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 
+// A region of user memory whose pages are filled in the first
+// time they are touched (see pagefault in vm.c), either from a
+// file or with zeros.
+struct vma {
+  uint start;                  // First address, page aligned
+  uint end;                    // End address, page aligned; 0 if unused
+  int flags;                   // VMA_WRITE, VMA_SHARED, VMA_MMAP, ...
+  struct inode *ip;            // File the pages come from; 0 if anonymous
+  uint off;                    // File offset of start
+  uint filesz;                 // Bytes of file data; the rest reads as zero
+  struct shm *shm;             // Shared-memory segment mapped; 0 if none
+};
+
+#define VMA_WRITE  0x1         // Pages are mapped writable
+#define VMA_SHARED 0x2         // Writes go to the file, or to memory
+                               // shared with forked children
+#define VMA_MMAP   0x4         // Made by mmap, above the heap
+#define VMA_LARGE  0x8         // Anonymous memory backed by large pages
+
 // Per-process state
 struct proc {
   uint sz;                     // Size of process memory (bytes)
@@ -45,14 +65,38 @@ struct proc {
   struct trapframe *tf;        // Trap frame for current syscall
   struct context *context;     // swtch() here to run process
   void *chan;                  // If non-zero, sleeping on chan
+  struct proc *slnext;         // Next in its sleep list, if SLEEPING
   int killed;                  // If non-zero, have been killed
   struct file *ofile[NOFILE];  // Open files
   struct inode *cwd;           // Current directory
+  struct vma vma[NVMA];        // Demand-filled memory regions
+  struct proc *rqnext;         // Next in its run queue, if RUNNABLE
+  int lastcpu;                 // CPU it last ran on
+  uint cpumask;                // CPUs it may run on, bit i for cpus[i]
+  int prio;                    // Scheduling level, 0 highest
+  int nice;                    // Level it starts at and is boosted to
+  int ticks;                   // Timer ticks used at this level
+  uint boostgen;               // Priority boosts it has seen
+  uint64 vruntime;             // Weighted TSC cycles run (FAIRSCHED)
+  uint64 tstart;               // TSC when it last started running
+  struct proc *left, *right;   // Run queue tree links (FAIRSCHED)
+  int height;                  // Height of its run queue subtree
+  uint clock;                  // Next address for swap's clock hand
+  int npin;                    // Entries used in pin[]
+  struct {                     // Pages the current system call uses,
+    uint start, end;           // which stay in memory
+  } pin[NPIN];
   char name[16];               // Process name (debugging)
 };
 
-// Process memory is laid out contiguously, low addresses first:
+// Process memory is laid out low addresses first:
 //   text
 //   original data and bss
-//   fixed-size stack
+//   guard page
+//   stack, up to USTACKSIZE bytes, growing down
 //   expandable heap
+//   ...
+//   mmap regions, allocated downward from KERNBASE
+// Text and data are read from the executable on demand, as
+// described by vma[]; bss, stack and heap pages are zero-filled
+// on first touch. The heap cannot grow into the lowest mmap region.
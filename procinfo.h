@@ -0,0 +1,12 @@
+// Process information, filled in by the procinfo system call.
+struct procinfo {
+  int pid;
+  int ppid;         // parent's pid, or 0
+  char state[8];    // as ^P shows it
+  int prio;         // scheduling level, 0 highest
+  int nice;         // level it starts at and is boosted back to
+  int cpu;          // CPU it last ran on
+  uint cpumask;     // CPUs it may run on, bit i for CPU i
+  uint sz;          // bytes of user memory
+  char name[16];
+};
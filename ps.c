@@ -0,0 +1,24 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "procinfo.h"
+
+struct procinfo pi[NPROC];
+
+int
+main(int argc, char *argv[])
+{
+  int i, n;
+
+  if((n = procinfo(pi, NPROC)) < 0){
+    printf(2, "ps: failed\n");
+    exit();
+  }
+  printf(1, "PID\tPPID\tSTATE\tPRIO\tNICE\tCPU\tMASK\tMEM\tNAME\n");
+  for(i = 0; i < n; i++)
+    printf(1, "%d\t%d\t%s\t%d\t%d\t%d\t%x\t%d\t%s\n", pi[i].pid, pi[i].ppid,
+           pi[i].state, pi[i].prio, pi[i].nice, pi[i].cpu, pi[i].cpumask,
+           pi[i].sz, pi[i].name);
+  exit();
+}
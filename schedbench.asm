@@ -0,0 +1,1564 @@
+
+_schedbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+  uint total;
+  uint64 t0;
+  char c;
+
+  nhogs = argc > 1 ? atoi(argv[1]) : 4;
+  nsamples = argc > 2 ? atoi(argv[2]) : 200;
+   f:	be c8 00 00 00       	mov    $0xc8,%esi
+{
+  14:	53                   	push   %ebx
+  nhogs = argc > 1 ? atoi(argv[1]) : 4;
+  15:	bb 04 00 00 00       	mov    $0x4,%ebx
+{
+  1a:	51                   	push   %ecx
+  1b:	83 ec 78             	sub    $0x78,%esp
+  1e:	8b 39                	mov    (%ecx),%edi
+  20:	8b 51 04             	mov    0x4(%ecx),%edx
+  nhogs = argc > 1 ? atoi(argv[1]) : 4;
+  23:	83 ff 01             	cmp    $0x1,%edi
+  26:	7f 47                	jg     6f <main+0x6f>
+  if(nhogs < 1 || nhogs > MAXHOGS || nsamples < 1 || nsamples > MAXSAMPLES){
+    printf(2, "usage: schedbench [hogs [samples]]\n");
+    exit();
+  }
+  count = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+  28:	52                   	push   %edx
+  29:	52                   	push   %edx
+  2a:	6a 00                	push   $0x0
+  2c:	6a ff                	push   $0xffffffff
+  2e:	6a 21                	push   $0x21
+  30:	6a 03                	push   $0x3
+  32:	68 00 10 00 00       	push   $0x1000
+  37:	6a 00                	push   $0x0
+  39:	e8 fd 05 00 00       	call   63b <mmap>
+  if(count == MAP_FAILED || pipe(ping) < 0 || pipe(pong) < 0){
+  3e:	83 c4 20             	add    $0x20,%esp
+  count = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+  41:	89 45 84             	mov    %eax,-0x7c(%ebp)
+  if(count == MAP_FAILED || pipe(ping) < 0 || pipe(pong) < 0){
+  44:	83 c0 01             	add    $0x1,%eax
+  47:	74 13                	je     5c <main+0x5c>
+  49:	83 ec 0c             	sub    $0xc,%esp
+  4c:	8d 45 98             	lea    -0x68(%ebp),%eax
+  4f:	50                   	push   %eax
+  50:	e8 4e 05 00 00       	call   5a3 <pipe>
+  55:	83 c4 10             	add    $0x10,%esp
+  58:	85 c0                	test   %eax,%eax
+  5a:	79 71                	jns    cd <main+0xcd>
+    printf(2, "schedbench: setup failed\n");
+  5c:	50                   	push   %eax
+  5d:	50                   	push   %eax
+  5e:	68 d9 0a 00 00       	push   $0xad9
+  63:	6a 02                	push   $0x2
+  65:	e8 d6 06 00 00       	call   740 <printf>
+    exit();
+  6a:	e8 24 05 00 00       	call   593 <exit>
+  nhogs = argc > 1 ? atoi(argv[1]) : 4;
+  6f:	83 ec 0c             	sub    $0xc,%esp
+  72:	ff 72 04             	push   0x4(%edx)
+  75:	89 55 84             	mov    %edx,-0x7c(%ebp)
+  78:	e8 a3 04 00 00       	call   520 <atoi>
+  nsamples = argc > 2 ? atoi(argv[2]) : 200;
+  7d:	83 c4 10             	add    $0x10,%esp
+  80:	83 ff 02             	cmp    $0x2,%edi
+  83:	8b 55 84             	mov    -0x7c(%ebp),%edx
+  nhogs = argc > 1 ? atoi(argv[1]) : 4;
+  86:	89 c3                	mov    %eax,%ebx
+  nsamples = argc > 2 ? atoi(argv[2]) : 200;
+  88:	75 1c                	jne    a6 <main+0xa6>
+  if(nhogs < 1 || nhogs > MAXHOGS || nsamples < 1 || nsamples > MAXSAMPLES){
+  8a:	8d 40 ff             	lea    -0x1(%eax),%eax
+  8d:	83 f8 0f             	cmp    $0xf,%eax
+  90:	76 96                	jbe    28 <main+0x28>
+    printf(2, "usage: schedbench [hogs [samples]]\n");
+  92:	83 ec 08             	sub    $0x8,%esp
+  95:	68 68 0a 00 00       	push   $0xa68
+  9a:	6a 02                	push   $0x2
+  9c:	e8 9f 06 00 00       	call   740 <printf>
+    exit();
+  a1:	e8 ed 04 00 00       	call   593 <exit>
+  nsamples = argc > 2 ? atoi(argv[2]) : 200;
+  a6:	83 ec 0c             	sub    $0xc,%esp
+  a9:	ff 72 08             	push   0x8(%edx)
+  ac:	e8 6f 04 00 00       	call   520 <atoi>
+  if(nhogs < 1 || nhogs > MAXHOGS || nsamples < 1 || nsamples > MAXSAMPLES){
+  b1:	83 c4 10             	add    $0x10,%esp
+  nsamples = argc > 2 ? atoi(argv[2]) : 200;
+  b4:	89 c6                	mov    %eax,%esi
+  if(nhogs < 1 || nhogs > MAXHOGS || nsamples < 1 || nsamples > MAXSAMPLES){
+  b6:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  b9:	83 f8 0f             	cmp    $0xf,%eax
+  bc:	77 d4                	ja     92 <main+0x92>
+  be:	8d 46 ff             	lea    -0x1(%esi),%eax
+  c1:	3d e7 03 00 00       	cmp    $0x3e7,%eax
+  c6:	77 ca                	ja     92 <main+0x92>
+  c8:	e9 5b ff ff ff       	jmp    28 <main+0x28>
+  if(count == MAP_FAILED || pipe(ping) < 0 || pipe(pong) < 0){
+  cd:	83 ec 0c             	sub    $0xc,%esp
+  d0:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  d3:	50                   	push   %eax
+  d4:	e8 ca 04 00 00       	call   5a3 <pipe>
+  d9:	83 c4 10             	add    $0x10,%esp
+  dc:	85 c0                	test   %eax,%eax
+  de:	0f 88 78 ff ff ff    	js     5c <main+0x5c>
+  }
+
+  for(i = 0; i < nhogs; i++){
+  e4:	31 ff                	xor    %edi,%edi
+  e6:	eb 07                	jmp    ef <main+0xef>
+  e8:	83 c7 01             	add    $0x1,%edi
+  eb:	39 df                	cmp    %ebx,%edi
+  ed:	74 32                	je     121 <main+0x121>
+    if((pid[i] = fork()) == 0){
+  ef:	e8 97 04 00 00       	call   58b <fork>
+  f4:	89 44 bd a8          	mov    %eax,-0x58(%ebp,%edi,4)
+  f8:	85 c0                	test   %eax,%eax
+  fa:	75 ec                	jne    e8 <main+0xe8>
+      setpriority(0, i % 2);
+  fc:	50                   	push   %eax
+  fd:	50                   	push   %eax
+  fe:	89 f8                	mov    %edi,%eax
+ 100:	83 e0 01             	and    $0x1,%eax
+ 103:	50                   	push   %eax
+ 104:	6a 00                	push   $0x0
+ 106:	e8 60 05 00 00       	call   66b <setpriority>
+      for(;;)
+        count[i]++;
+ 10b:	8b 45 84             	mov    -0x7c(%ebp),%eax
+ 10e:	83 c4 10             	add    $0x10,%esp
+ 111:	8d 14 b8             	lea    (%eax,%edi,4),%edx
+ 114:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 118:	8b 02                	mov    (%edx),%eax
+ 11a:	83 c0 01             	add    $0x1,%eax
+ 11d:	89 02                	mov    %eax,(%edx)
+      for(;;)
+ 11f:	eb f7                	jmp    118 <main+0x118>
+    }
+  }
+  if(fork() == 0){
+ 121:	e8 65 04 00 00       	call   58b <fork>
+ 126:	85 c0                	test   %eax,%eax
+ 128:	75 46                	jne    170 <main+0x170>
+    close(ping[1]);
+ 12a:	83 ec 0c             	sub    $0xc,%esp
+ 12d:	ff 75 9c             	push   -0x64(%ebp)
+ 130:	e8 86 04 00 00       	call   5bb <close>
+    close(pong[0]);
+ 135:	58                   	pop    %eax
+ 136:	ff 75 a0             	push   -0x60(%ebp)
+ 139:	e8 7d 04 00 00       	call   5bb <close>
+    while(read(ping[0], &c, 1) == 1)
+ 13e:	8d 45 97             	lea    -0x69(%ebp),%eax
+ 141:	83 c4 10             	add    $0x10,%esp
+ 144:	89 c3                	mov    %eax,%ebx
+ 146:	eb 0f                	jmp    157 <main+0x157>
+      write(pong[1], &c, 1);
+ 148:	50                   	push   %eax
+ 149:	6a 01                	push   $0x1
+ 14b:	53                   	push   %ebx
+ 14c:	ff 75 a4             	push   -0x5c(%ebp)
+ 14f:	e8 5f 04 00 00       	call   5b3 <write>
+ 154:	83 c4 10             	add    $0x10,%esp
+    while(read(ping[0], &c, 1) == 1)
+ 157:	50                   	push   %eax
+ 158:	6a 01                	push   $0x1
+ 15a:	53                   	push   %ebx
+ 15b:	ff 75 98             	push   -0x68(%ebp)
+ 15e:	e8 48 04 00 00       	call   5ab <read>
+ 163:	83 c4 10             	add    $0x10,%esp
+ 166:	83 e8 01             	sub    $0x1,%eax
+ 169:	74 dd                	je     148 <main+0x148>
+  }
+  printf(1, "%d iterations in %d ticks\n", total, ticks);
+  sort(lat, nsamples);
+  printf(1, "round trip Kcycles: median %d p99 %d max %d\n",
+         lat[nsamples/2], lat[nsamples*99/100], lat[nsamples-1]);
+  exit();
+ 16b:	e8 23 04 00 00       	call   593 <exit>
+  close(ping[0]);
+ 170:	83 ec 0c             	sub    $0xc,%esp
+ 173:	ff 75 98             	push   -0x68(%ebp)
+ 176:	e8 40 04 00 00       	call   5bb <close>
+  close(pong[1]);
+ 17b:	5f                   	pop    %edi
+ 17c:	ff 75 a4             	push   -0x5c(%ebp)
+ 17f:	e8 37 04 00 00       	call   5bb <close>
+  ticks = uptime();
+ 184:	e8 a2 04 00 00       	call   62b <uptime>
+  for(i = 0; i < nsamples; i++){
+ 189:	31 c9                	xor    %ecx,%ecx
+    lat[i] = (uint)(rdtsc() - t0) / 1000;
+ 18b:	89 9d 78 ff ff ff    	mov    %ebx,-0x88(%ebp)
+  ticks = uptime();
+ 191:	83 c4 10             	add    $0x10,%esp
+ 194:	89 85 7c ff ff ff    	mov    %eax,-0x84(%ebp)
+  for(i = 0; i < nsamples; i++){
+ 19a:	8d 45 97             	lea    -0x69(%ebp),%eax
+    lat[i] = (uint)(rdtsc() - t0) / 1000;
+ 19d:	89 cb                	mov    %ecx,%ebx
+ 19f:	89 45 80             	mov    %eax,-0x80(%ebp)
+    sleep(1);
+ 1a2:	83 ec 0c             	sub    $0xc,%esp
+ 1a5:	6a 01                	push   $0x1
+ 1a7:	e8 77 04 00 00       	call   623 <sleep>
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+ 1ac:	0f 31                	rdtsc
+    write(ping[1], "x", 1);
+ 1ae:	83 c4 0c             	add    $0xc,%esp
+  return ((uint64)hi << 32) | lo;
+ 1b1:	89 c7                	mov    %eax,%edi
+    write(ping[1], "x", 1);
+ 1b3:	6a 01                	push   $0x1
+ 1b5:	68 f3 0a 00 00       	push   $0xaf3
+ 1ba:	ff 75 9c             	push   -0x64(%ebp)
+ 1bd:	e8 f1 03 00 00       	call   5b3 <write>
+    read(pong[0], &c, 1);
+ 1c2:	83 c4 0c             	add    $0xc,%esp
+ 1c5:	6a 01                	push   $0x1
+ 1c7:	ff 75 80             	push   -0x80(%ebp)
+ 1ca:	ff 75 a0             	push   -0x60(%ebp)
+ 1cd:	e8 d9 03 00 00       	call   5ab <read>
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+ 1d2:	0f 31                	rdtsc
+    lat[i] = (uint)(rdtsc() - t0) / 1000;
+ 1d4:	31 d2                	xor    %edx,%edx
+ 1d6:	29 f8                	sub    %edi,%eax
+ 1d8:	bf e8 03 00 00       	mov    $0x3e8,%edi
+  for(i = 0; i < nsamples; i++){
+ 1dd:	83 c4 10             	add    $0x10,%esp
+    lat[i] = (uint)(rdtsc() - t0) / 1000;
+ 1e0:	f7 f7                	div    %edi
+ 1e2:	89 04 9d 00 10 00 00 	mov    %eax,0x1000(,%ebx,4)
+  for(i = 0; i < nsamples; i++){
+ 1e9:	83 c3 01             	add    $0x1,%ebx
+ 1ec:	39 f3                	cmp    %esi,%ebx
+ 1ee:	75 b2                	jne    1a2 <main+0x1a2>
+  ticks = uptime() - ticks;
+ 1f0:	8b 9d 78 ff ff ff    	mov    -0x88(%ebp),%ebx
+ 1f6:	e8 30 04 00 00       	call   62b <uptime>
+ 1fb:	8b bd 7c ff ff ff    	mov    -0x84(%ebp),%edi
+ 201:	29 f8                	sub    %edi,%eax
+  for(i = 0; i < nhogs; i++)
+ 203:	31 ff                	xor    %edi,%edi
+  ticks = uptime() - ticks;
+ 205:	89 85 7c ff ff ff    	mov    %eax,-0x84(%ebp)
+    kill(pid[i]);
+ 20b:	83 ec 0c             	sub    $0xc,%esp
+ 20e:	ff 74 bd a8          	push   -0x58(%ebp,%edi,4)
+  for(i = 0; i < nhogs; i++)
+ 212:	83 c7 01             	add    $0x1,%edi
+    kill(pid[i]);
+ 215:	e8 a9 03 00 00       	call   5c3 <kill>
+  for(i = 0; i < nhogs; i++)
+ 21a:	83 c4 10             	add    $0x10,%esp
+ 21d:	39 df                	cmp    %ebx,%edi
+ 21f:	75 ea                	jne    20b <main+0x20b>
+  close(ping[1]);
+ 221:	83 ec 0c             	sub    $0xc,%esp
+ 224:	ff 75 9c             	push   -0x64(%ebp)
+  for(i = 0; i < nhogs + 1; i++)
+ 227:	31 ff                	xor    %edi,%edi
+  close(ping[1]);
+ 229:	e8 8d 03 00 00       	call   5bb <close>
+ 22e:	83 c4 10             	add    $0x10,%esp
+    wait();
+ 231:	e8 65 03 00 00       	call   59b <wait>
+  for(i = 0; i < nhogs + 1; i++)
+ 236:	83 c7 01             	add    $0x1,%edi
+ 239:	39 df                	cmp    %ebx,%edi
+ 23b:	7e f4                	jle    231 <main+0x231>
+  for(i = 0; i < nhogs; i++){
+ 23d:	89 5d 80             	mov    %ebx,-0x80(%ebp)
+  total = 0;
+ 240:	31 c9                	xor    %ecx,%ecx
+  for(i = 0; i < nhogs; i++){
+ 242:	31 c0                	xor    %eax,%eax
+ 244:	89 b5 78 ff ff ff    	mov    %esi,-0x88(%ebp)
+ 24a:	89 c7                	mov    %eax,%edi
+ 24c:	89 ce                	mov    %ecx,%esi
+    printf(1, "hog %d nice %d: %d iterations\n", i, i % 2, count[i]);
+ 24e:	8b 45 84             	mov    -0x7c(%ebp),%eax
+ 251:	83 ec 0c             	sub    $0xc,%esp
+ 254:	8d 1c b8             	lea    (%eax,%edi,4),%ebx
+ 257:	8b 0b                	mov    (%ebx),%ecx
+ 259:	51                   	push   %ecx
+ 25a:	89 f9                	mov    %edi,%ecx
+ 25c:	83 e1 01             	and    $0x1,%ecx
+ 25f:	51                   	push   %ecx
+ 260:	57                   	push   %edi
+  for(i = 0; i < nhogs; i++){
+ 261:	83 c7 01             	add    $0x1,%edi
+    printf(1, "hog %d nice %d: %d iterations\n", i, i % 2, count[i]);
+ 264:	68 8c 0a 00 00       	push   $0xa8c
+ 269:	6a 01                	push   $0x1
+ 26b:	e8 d0 04 00 00       	call   740 <printf>
+    total += count[i];
+ 270:	8b 13                	mov    (%ebx),%edx
+  for(i = 0; i < nhogs; i++){
+ 272:	8b 45 80             	mov    -0x80(%ebp),%eax
+ 275:	83 c4 20             	add    $0x20,%esp
+    total += count[i];
+ 278:	01 d6                	add    %edx,%esi
+  for(i = 0; i < nhogs; i++){
+ 27a:	39 c7                	cmp    %eax,%edi
+ 27c:	75 d0                	jne    24e <main+0x24e>
+  printf(1, "%d iterations in %d ticks\n", total, ticks);
+ 27e:	89 f1                	mov    %esi,%ecx
+ 280:	8b b5 78 ff ff ff    	mov    -0x88(%ebp),%esi
+ 286:	ff b5 7c ff ff ff    	push   -0x84(%ebp)
+ 28c:	51                   	push   %ecx
+ 28d:	68 f5 0a 00 00       	push   $0xaf5
+ 292:	6a 01                	push   $0x1
+ 294:	e8 a7 04 00 00       	call   740 <printf>
+  sort(lat, nsamples);
+ 299:	58                   	pop    %eax
+ 29a:	5a                   	pop    %edx
+ 29b:	56                   	push   %esi
+ 29c:	68 00 10 00 00       	push   $0x1000
+ 2a1:	e8 3a 00 00 00       	call   2e0 <sort>
+         lat[nsamples/2], lat[nsamples*99/100], lat[nsamples-1]);
+ 2a6:	6b c6 63             	imul   $0x63,%esi,%eax
+  printf(1, "round trip Kcycles: median %d p99 %d max %d\n",
+ 2a9:	59                   	pop    %ecx
+         lat[nsamples/2], lat[nsamples*99/100], lat[nsamples-1]);
+ 2aa:	b9 64 00 00 00       	mov    $0x64,%ecx
+  printf(1, "round trip Kcycles: median %d p99 %d max %d\n",
+ 2af:	ff 34 b5 fc 0f 00 00 	push   0xffc(,%esi,4)
+         lat[nsamples/2], lat[nsamples*99/100], lat[nsamples-1]);
+ 2b6:	d1 fe                	sar    %esi
+ 2b8:	99                   	cltd
+ 2b9:	f7 f9                	idiv   %ecx
+  printf(1, "round trip Kcycles: median %d p99 %d max %d\n",
+ 2bb:	ff 34 85 00 10 00 00 	push   0x1000(,%eax,4)
+ 2c2:	ff 34 b5 00 10 00 00 	push   0x1000(,%esi,4)
+ 2c9:	68 ac 0a 00 00       	push   $0xaac
+ 2ce:	6a 01                	push   $0x1
+ 2d0:	e8 6b 04 00 00       	call   740 <printf>
+  exit();
+ 2d5:	83 c4 20             	add    $0x20,%esp
+ 2d8:	e9 8e fe ff ff       	jmp    16b <main+0x16b>
+ 2dd:	66 90                	xchg   %ax,%ax
+ 2df:	90                   	nop
+
+000002e0 <sort>:
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	57                   	push   %edi
+ 2e4:	56                   	push   %esi
+ 2e5:	53                   	push   %ebx
+ 2e6:	83 ec 04             	sub    $0x4,%esp
+  for(i = 1; i < n; i++){
+ 2e9:	83 7d 0c 01          	cmpl   $0x1,0xc(%ebp)
+{
+ 2ed:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  for(i = 1; i < n; i++){
+ 2f0:	7e 3e                	jle    330 <sort+0x50>
+ 2f2:	bf 01 00 00 00       	mov    $0x1,%edi
+ 2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fe:	66 90                	xchg   %ax,%ax
+    t = a[i];
+ 300:	89 7d f0             	mov    %edi,-0x10(%ebp)
+ 303:	8b 34 b9             	mov    (%ecx,%edi,4),%esi
+    for(j = i; j > 0 && a[j-1] > t; j--)
+ 306:	8d 04 b9             	lea    (%ecx,%edi,4),%eax
+    t = a[i];
+ 309:	89 fa                	mov    %edi,%edx
+ 30b:	eb 0d                	jmp    31a <sort+0x3a>
+ 30d:	8d 76 00             	lea    0x0(%esi),%esi
+      a[j] = a[j-1];
+ 310:	89 38                	mov    %edi,(%eax)
+    for(j = i; j > 0 && a[j-1] > t; j--)
+ 312:	8d 43 fc             	lea    -0x4(%ebx),%eax
+ 315:	83 ea 01             	sub    $0x1,%edx
+ 318:	74 26                	je     340 <sort+0x60>
+ 31a:	8b 78 fc             	mov    -0x4(%eax),%edi
+ 31d:	89 c3                	mov    %eax,%ebx
+ 31f:	39 fe                	cmp    %edi,%esi
+ 321:	72 ed                	jb     310 <sort+0x30>
+ 323:	8b 7d f0             	mov    -0x10(%ebp),%edi
+    a[j] = t;
+ 326:	89 33                	mov    %esi,(%ebx)
+  for(i = 1; i < n; i++){
+ 328:	83 c7 01             	add    $0x1,%edi
+ 32b:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+ 32e:	75 d0                	jne    300 <sort+0x20>
+}
+ 330:	83 c4 04             	add    $0x4,%esp
+ 333:	5b                   	pop    %ebx
+ 334:	5e                   	pop    %esi
+ 335:	5f                   	pop    %edi
+ 336:	5d                   	pop    %ebp
+ 337:	c3                   	ret
+ 338:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33f:	90                   	nop
+ 340:	8b 7d f0             	mov    -0x10(%ebp),%edi
+ 343:	89 cb                	mov    %ecx,%ebx
+ 345:	eb df                	jmp    326 <sort+0x46>
+ 347:	66 90                	xchg   %ax,%ax
+ 349:	66 90                	xchg   %ax,%ax
+ 34b:	66 90                	xchg   %ax,%ax
+ 34d:	66 90                	xchg   %ax,%ax
+ 34f:	90                   	nop
+
+00000350 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 350:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 351:	31 c0                	xor    %eax,%eax
+{
+ 353:	89 e5                	mov    %esp,%ebp
+ 355:	53                   	push   %ebx
+ 356:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 359:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 35c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 360:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 364:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 367:	83 c0 01             	add    $0x1,%eax
+ 36a:	84 d2                	test   %dl,%dl
+ 36c:	75 f2                	jne    360 <strcpy+0x10>
+    ;
+  return os;
+}
+ 36e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 371:	89 c8                	mov    %ecx,%eax
+ 373:	c9                   	leave
+ 374:	c3                   	ret
+ 375:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000380 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	53                   	push   %ebx
+ 384:	8b 55 08             	mov    0x8(%ebp),%edx
+ 387:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 38a:	0f b6 02             	movzbl (%edx),%eax
+ 38d:	84 c0                	test   %al,%al
+ 38f:	75 17                	jne    3a8 <strcmp+0x28>
+ 391:	eb 3a                	jmp    3cd <strcmp+0x4d>
+ 393:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 397:	90                   	nop
+ 398:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 39c:	83 c2 01             	add    $0x1,%edx
+ 39f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 3a2:	84 c0                	test   %al,%al
+ 3a4:	74 1a                	je     3c0 <strcmp+0x40>
+    p++, q++;
+ 3a6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 3a8:	0f b6 19             	movzbl (%ecx),%ebx
+ 3ab:	38 c3                	cmp    %al,%bl
+ 3ad:	74 e9                	je     398 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 3af:	29 d8                	sub    %ebx,%eax
+}
+ 3b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3b4:	c9                   	leave
+ 3b5:	c3                   	ret
+ 3b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3bd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 3c0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 3c4:	31 c0                	xor    %eax,%eax
+ 3c6:	29 d8                	sub    %ebx,%eax
+}
+ 3c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3cb:	c9                   	leave
+ 3cc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 3cd:	0f b6 19             	movzbl (%ecx),%ebx
+ 3d0:	31 c0                	xor    %eax,%eax
+ 3d2:	eb db                	jmp    3af <strcmp+0x2f>
+ 3d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3df:	90                   	nop
+
+000003e0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 3e6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 3e9:	74 15                	je     400 <strlen+0x20>
+ 3eb:	31 c0                	xor    %eax,%eax
+ 3ed:	8d 76 00             	lea    0x0(%esi),%esi
+ 3f0:	83 c0 01             	add    $0x1,%eax
+ 3f3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 3f7:	89 c1                	mov    %eax,%ecx
+ 3f9:	75 f5                	jne    3f0 <strlen+0x10>
+    ;
+  return n;
+}
+ 3fb:	89 c8                	mov    %ecx,%eax
+ 3fd:	5d                   	pop    %ebp
+ 3fe:	c3                   	ret
+ 3ff:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 400:	31 c9                	xor    %ecx,%ecx
+}
+ 402:	5d                   	pop    %ebp
+ 403:	89 c8                	mov    %ecx,%eax
+ 405:	c3                   	ret
+ 406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000410 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	57                   	push   %edi
+ 414:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 417:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 41a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 41d:	89 d7                	mov    %edx,%edi
+ 41f:	fc                   	cld
+ 420:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 422:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 425:	89 d0                	mov    %edx,%eax
+ 427:	c9                   	leave
+ 428:	c3                   	ret
+ 429:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000430 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	8b 45 08             	mov    0x8(%ebp),%eax
+ 436:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 43a:	0f b6 10             	movzbl (%eax),%edx
+ 43d:	84 d2                	test   %dl,%dl
+ 43f:	75 12                	jne    453 <strchr+0x23>
+ 441:	eb 1d                	jmp    460 <strchr+0x30>
+ 443:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 447:	90                   	nop
+ 448:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 44c:	83 c0 01             	add    $0x1,%eax
+ 44f:	84 d2                	test   %dl,%dl
+ 451:	74 0d                	je     460 <strchr+0x30>
+    if(*s == c)
+ 453:	38 d1                	cmp    %dl,%cl
+ 455:	75 f1                	jne    448 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 457:	5d                   	pop    %ebp
+ 458:	c3                   	ret
+ 459:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 460:	31 c0                	xor    %eax,%eax
+}
+ 462:	5d                   	pop    %ebp
+ 463:	c3                   	ret
+ 464:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 46f:	90                   	nop
+
+00000470 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	57                   	push   %edi
+ 474:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 475:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 478:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 479:	31 db                	xor    %ebx,%ebx
+{
+ 47b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 47e:	eb 27                	jmp    4a7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 480:	83 ec 04             	sub    $0x4,%esp
+ 483:	6a 01                	push   $0x1
+ 485:	56                   	push   %esi
+ 486:	6a 00                	push   $0x0
+ 488:	e8 1e 01 00 00       	call   5ab <read>
+    if(cc < 1)
+ 48d:	83 c4 10             	add    $0x10,%esp
+ 490:	85 c0                	test   %eax,%eax
+ 492:	7e 1d                	jle    4b1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 494:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 498:	8b 55 08             	mov    0x8(%ebp),%edx
+ 49b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 49f:	3c 0a                	cmp    $0xa,%al
+ 4a1:	74 10                	je     4b3 <gets+0x43>
+ 4a3:	3c 0d                	cmp    $0xd,%al
+ 4a5:	74 0c                	je     4b3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 4a7:	89 df                	mov    %ebx,%edi
+ 4a9:	83 c3 01             	add    $0x1,%ebx
+ 4ac:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 4af:	7c cf                	jl     480 <gets+0x10>
+ 4b1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 4b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4b6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 4ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4bd:	5b                   	pop    %ebx
+ 4be:	5e                   	pop    %esi
+ 4bf:	5f                   	pop    %edi
+ 4c0:	5d                   	pop    %ebp
+ 4c1:	c3                   	ret
+ 4c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004d0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	56                   	push   %esi
+ 4d4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 4d5:	83 ec 08             	sub    $0x8,%esp
+ 4d8:	6a 00                	push   $0x0
+ 4da:	ff 75 08             	push   0x8(%ebp)
+ 4dd:	e8 f1 00 00 00       	call   5d3 <open>
+  if(fd < 0)
+ 4e2:	83 c4 10             	add    $0x10,%esp
+ 4e5:	85 c0                	test   %eax,%eax
+ 4e7:	78 27                	js     510 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 4e9:	83 ec 08             	sub    $0x8,%esp
+ 4ec:	ff 75 0c             	push   0xc(%ebp)
+ 4ef:	89 c3                	mov    %eax,%ebx
+ 4f1:	50                   	push   %eax
+ 4f2:	e8 f4 00 00 00       	call   5eb <fstat>
+  close(fd);
+ 4f7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 4fa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 4fc:	e8 ba 00 00 00       	call   5bb <close>
+  return r;
+ 501:	83 c4 10             	add    $0x10,%esp
+}
+ 504:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 507:	89 f0                	mov    %esi,%eax
+ 509:	5b                   	pop    %ebx
+ 50a:	5e                   	pop    %esi
+ 50b:	5d                   	pop    %ebp
+ 50c:	c3                   	ret
+ 50d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 510:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 515:	eb ed                	jmp    504 <stat+0x34>
+ 517:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 51e:	66 90                	xchg   %ax,%ax
+
+00000520 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	53                   	push   %ebx
+ 524:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 527:	0f be 02             	movsbl (%edx),%eax
+ 52a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 52d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 530:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 535:	77 1e                	ja     555 <atoi+0x35>
+ 537:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 540:	83 c2 01             	add    $0x1,%edx
+ 543:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 546:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 54a:	0f be 02             	movsbl (%edx),%eax
+ 54d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 550:	80 fb 09             	cmp    $0x9,%bl
+ 553:	76 eb                	jbe    540 <atoi+0x20>
+  return n;
+}
+ 555:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 558:	89 c8                	mov    %ecx,%eax
+ 55a:	c9                   	leave
+ 55b:	c3                   	ret
+ 55c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000560 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+ 563:	57                   	push   %edi
+ 564:	56                   	push   %esi
+ 565:	8b 45 10             	mov    0x10(%ebp),%eax
+ 568:	8b 55 08             	mov    0x8(%ebp),%edx
+ 56b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 56e:	85 c0                	test   %eax,%eax
+ 570:	7e 13                	jle    585 <memmove+0x25>
+ 572:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 574:	89 d7                	mov    %edx,%edi
+ 576:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 57d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 580:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 581:	39 f8                	cmp    %edi,%eax
+ 583:	75 fb                	jne    580 <memmove+0x20>
+  return vdst;
+}
+ 585:	5e                   	pop    %esi
+ 586:	89 d0                	mov    %edx,%eax
+ 588:	5f                   	pop    %edi
+ 589:	5d                   	pop    %ebp
+ 58a:	c3                   	ret
+
+0000058b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 58b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <exit>:
+SYSCALL(exit)
+ 593:	b8 02 00 00 00       	mov    $0x2,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <wait>:
+SYSCALL(wait)
+ 59b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <pipe>:
+SYSCALL(pipe)
+ 5a3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <read>:
+SYSCALL(read)
+ 5ab:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <write>:
+SYSCALL(write)
+ 5b3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <close>:
+SYSCALL(close)
+ 5bb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <kill>:
+SYSCALL(kill)
+ 5c3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <exec>:
+SYSCALL(exec)
+ 5cb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <open>:
+SYSCALL(open)
+ 5d3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <mknod>:
+SYSCALL(mknod)
+ 5db:	b8 11 00 00 00       	mov    $0x11,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <unlink>:
+SYSCALL(unlink)
+ 5e3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <fstat>:
+SYSCALL(fstat)
+ 5eb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <link>:
+SYSCALL(link)
+ 5f3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <mkdir>:
+SYSCALL(mkdir)
+ 5fb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <chdir>:
+SYSCALL(chdir)
+ 603:	b8 09 00 00 00       	mov    $0x9,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <dup>:
+SYSCALL(dup)
+ 60b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <getpid>:
+SYSCALL(getpid)
+ 613:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <sbrk>:
+SYSCALL(sbrk)
+ 61b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <sleep>:
+SYSCALL(sleep)
+ 623:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <uptime>:
+SYSCALL(uptime)
+ 62b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <memstat>:
+SYSCALL(memstat)
+ 633:	b8 16 00 00 00       	mov    $0x16,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <mmap>:
+SYSCALL(mmap)
+ 63b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <munmap>:
+SYSCALL(munmap)
+ 643:	b8 18 00 00 00       	mov    $0x18,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <shmget>:
+SYSCALL(shmget)
+ 64b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <shmat>:
+SYSCALL(shmat)
+ 653:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <shmdt>:
+SYSCALL(shmdt)
+ 65b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <spawn>:
+SYSCALL(spawn)
+ 663:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <setpriority>:
+SYSCALL(setpriority)
+ 66b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <procinfo>:
+SYSCALL(procinfo)
+ 673:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <setaffinity>:
+SYSCALL(setaffinity)
+ 67b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <getaffinity>:
+SYSCALL(getaffinity)
+ 683:	b8 20 00 00 00       	mov    $0x20,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <shmrm>:
+SYSCALL(shmrm)
+ 68b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+ 693:	66 90                	xchg   %ax,%ax
+ 695:	66 90                	xchg   %ax,%ax
+ 697:	66 90                	xchg   %ax,%ax
+ 699:	66 90                	xchg   %ax,%ax
+ 69b:	66 90                	xchg   %ax,%ax
+ 69d:	66 90                	xchg   %ax,%ax
+ 69f:	90                   	nop
+
+000006a0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6a0:	55                   	push   %ebp
+ 6a1:	89 e5                	mov    %esp,%ebp
+ 6a3:	57                   	push   %edi
+ 6a4:	56                   	push   %esi
+ 6a5:	53                   	push   %ebx
+ 6a6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 6a8:	89 d1                	mov    %edx,%ecx
+{
+ 6aa:	83 ec 3c             	sub    $0x3c,%esp
+ 6ad:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 6b0:	85 d2                	test   %edx,%edx
+ 6b2:	0f 89 80 00 00 00    	jns    738 <printint+0x98>
+ 6b8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 6bc:	74 7a                	je     738 <printint+0x98>
+    x = -xx;
+ 6be:	f7 d9                	neg    %ecx
+    neg = 1;
+ 6c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 6c5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 6c8:	31 f6                	xor    %esi,%esi
+ 6ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 6d0:	89 c8                	mov    %ecx,%eax
+ 6d2:	31 d2                	xor    %edx,%edx
+ 6d4:	89 f7                	mov    %esi,%edi
+ 6d6:	f7 f3                	div    %ebx
+ 6d8:	8d 76 01             	lea    0x1(%esi),%esi
+ 6db:	0f b6 92 70 0b 00 00 	movzbl 0xb70(%edx),%edx
+ 6e2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 6e6:	89 ca                	mov    %ecx,%edx
+ 6e8:	89 c1                	mov    %eax,%ecx
+ 6ea:	39 da                	cmp    %ebx,%edx
+ 6ec:	73 e2                	jae    6d0 <printint+0x30>
+  if(neg)
+ 6ee:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 6f1:	85 c0                	test   %eax,%eax
+ 6f3:	74 07                	je     6fc <printint+0x5c>
+    buf[i++] = '-';
+ 6f5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 6fa:	89 f7                	mov    %esi,%edi
+ 6fc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 6ff:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 702:	01 df                	add    %ebx,%edi
+ 704:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 708:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 70b:	83 ec 04             	sub    $0x4,%esp
+ 70e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 711:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 714:	6a 01                	push   $0x1
+ 716:	50                   	push   %eax
+ 717:	56                   	push   %esi
+ 718:	e8 96 fe ff ff       	call   5b3 <write>
+  while(--i >= 0)
+ 71d:	89 f8                	mov    %edi,%eax
+ 71f:	83 c4 10             	add    $0x10,%esp
+ 722:	83 ef 01             	sub    $0x1,%edi
+ 725:	39 d8                	cmp    %ebx,%eax
+ 727:	75 df                	jne    708 <printint+0x68>
+}
+ 729:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 72c:	5b                   	pop    %ebx
+ 72d:	5e                   	pop    %esi
+ 72e:	5f                   	pop    %edi
+ 72f:	5d                   	pop    %ebp
+ 730:	c3                   	ret
+ 731:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 738:	31 c0                	xor    %eax,%eax
+ 73a:	eb 89                	jmp    6c5 <printint+0x25>
+ 73c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000740 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 740:	55                   	push   %ebp
+ 741:	89 e5                	mov    %esp,%ebp
+ 743:	57                   	push   %edi
+ 744:	56                   	push   %esi
+ 745:	53                   	push   %ebx
+ 746:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 749:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 74c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 74f:	0f b6 1e             	movzbl (%esi),%ebx
+ 752:	83 c6 01             	add    $0x1,%esi
+ 755:	84 db                	test   %bl,%bl
+ 757:	74 67                	je     7c0 <printf+0x80>
+ 759:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 75c:	31 d2                	xor    %edx,%edx
+ 75e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 761:	eb 34                	jmp    797 <printf+0x57>
+ 763:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 767:	90                   	nop
+ 768:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 76b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 770:	83 f8 25             	cmp    $0x25,%eax
+ 773:	74 18                	je     78d <printf+0x4d>
+  write(fd, &c, 1);
+ 775:	83 ec 04             	sub    $0x4,%esp
+ 778:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 77b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 77e:	6a 01                	push   $0x1
+ 780:	50                   	push   %eax
+ 781:	57                   	push   %edi
+ 782:	e8 2c fe ff ff       	call   5b3 <write>
+ 787:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 78a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 78d:	0f b6 1e             	movzbl (%esi),%ebx
+ 790:	83 c6 01             	add    $0x1,%esi
+ 793:	84 db                	test   %bl,%bl
+ 795:	74 29                	je     7c0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 797:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 79a:	85 d2                	test   %edx,%edx
+ 79c:	74 ca                	je     768 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 79e:	83 fa 25             	cmp    $0x25,%edx
+ 7a1:	75 ea                	jne    78d <printf+0x4d>
+      if(c == 'd'){
+ 7a3:	83 f8 25             	cmp    $0x25,%eax
+ 7a6:	0f 84 24 01 00 00    	je     8d0 <printf+0x190>
+ 7ac:	83 e8 63             	sub    $0x63,%eax
+ 7af:	83 f8 15             	cmp    $0x15,%eax
+ 7b2:	77 1c                	ja     7d0 <printf+0x90>
+ 7b4:	ff 24 85 18 0b 00 00 	jmp    *0xb18(,%eax,4)
+ 7bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7bf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 7c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7c3:	5b                   	pop    %ebx
+ 7c4:	5e                   	pop    %esi
+ 7c5:	5f                   	pop    %edi
+ 7c6:	5d                   	pop    %ebp
+ 7c7:	c3                   	ret
+ 7c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7cf:	90                   	nop
+  write(fd, &c, 1);
+ 7d0:	83 ec 04             	sub    $0x4,%esp
+ 7d3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7d6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 7da:	6a 01                	push   $0x1
+ 7dc:	52                   	push   %edx
+ 7dd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 7e0:	57                   	push   %edi
+ 7e1:	e8 cd fd ff ff       	call   5b3 <write>
+ 7e6:	83 c4 0c             	add    $0xc,%esp
+ 7e9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7ec:	6a 01                	push   $0x1
+ 7ee:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 7f1:	52                   	push   %edx
+ 7f2:	57                   	push   %edi
+ 7f3:	e8 bb fd ff ff       	call   5b3 <write>
+        putc(fd, c);
+ 7f8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7fb:	31 d2                	xor    %edx,%edx
+ 7fd:	eb 8e                	jmp    78d <printf+0x4d>
+ 7ff:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 800:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 803:	83 ec 0c             	sub    $0xc,%esp
+ 806:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 80b:	8b 13                	mov    (%ebx),%edx
+ 80d:	6a 00                	push   $0x0
+ 80f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 811:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 814:	e8 87 fe ff ff       	call   6a0 <printint>
+        ap++;
+ 819:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 81c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 81f:	31 d2                	xor    %edx,%edx
+ 821:	e9 67 ff ff ff       	jmp    78d <printf+0x4d>
+ 826:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 82d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 830:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 833:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 835:	83 c0 04             	add    $0x4,%eax
+ 838:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 83b:	85 db                	test   %ebx,%ebx
+ 83d:	0f 84 9d 00 00 00    	je     8e0 <printf+0x1a0>
+        while(*s != 0){
+ 843:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 846:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 848:	84 c0                	test   %al,%al
+ 84a:	0f 84 3d ff ff ff    	je     78d <printf+0x4d>
+ 850:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 853:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 856:	89 de                	mov    %ebx,%esi
+ 858:	89 d3                	mov    %edx,%ebx
+ 85a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 860:	83 ec 04             	sub    $0x4,%esp
+ 863:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 866:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 869:	6a 01                	push   $0x1
+ 86b:	53                   	push   %ebx
+ 86c:	57                   	push   %edi
+ 86d:	e8 41 fd ff ff       	call   5b3 <write>
+        while(*s != 0){
+ 872:	0f b6 06             	movzbl (%esi),%eax
+ 875:	83 c4 10             	add    $0x10,%esp
+ 878:	84 c0                	test   %al,%al
+ 87a:	75 e4                	jne    860 <printf+0x120>
+      state = 0;
+ 87c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 87f:	31 d2                	xor    %edx,%edx
+ 881:	e9 07 ff ff ff       	jmp    78d <printf+0x4d>
+ 886:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 88d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 890:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 893:	83 ec 0c             	sub    $0xc,%esp
+ 896:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 89b:	8b 13                	mov    (%ebx),%edx
+ 89d:	6a 01                	push   $0x1
+ 89f:	e9 6b ff ff ff       	jmp    80f <printf+0xcf>
+ 8a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 8a8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 8ab:	83 ec 04             	sub    $0x4,%esp
+ 8ae:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 8b1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 8b3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 8b6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 8b9:	6a 01                	push   $0x1
+ 8bb:	52                   	push   %edx
+ 8bc:	57                   	push   %edi
+ 8bd:	e8 f1 fc ff ff       	call   5b3 <write>
+        ap++;
+ 8c2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8c5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8c8:	31 d2                	xor    %edx,%edx
+ 8ca:	e9 be fe ff ff       	jmp    78d <printf+0x4d>
+ 8cf:	90                   	nop
+  write(fd, &c, 1);
+ 8d0:	83 ec 04             	sub    $0x4,%esp
+ 8d3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8d6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8d9:	6a 01                	push   $0x1
+ 8db:	e9 11 ff ff ff       	jmp    7f1 <printf+0xb1>
+ 8e0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 8e5:	bb 10 0b 00 00       	mov    $0xb10,%ebx
+ 8ea:	e9 61 ff ff ff       	jmp    850 <printf+0x110>
+ 8ef:	90                   	nop
+
+000008f0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 8f0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8f1:	a1 a0 1f 00 00       	mov    0x1fa0,%eax
+{
+ 8f6:	89 e5                	mov    %esp,%ebp
+ 8f8:	57                   	push   %edi
+ 8f9:	56                   	push   %esi
+ 8fa:	53                   	push   %ebx
+ 8fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 8fe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 901:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 908:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 90a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 90c:	39 ca                	cmp    %ecx,%edx
+ 90e:	73 30                	jae    940 <free+0x50>
+ 910:	39 c1                	cmp    %eax,%ecx
+ 912:	72 04                	jb     918 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 914:	39 c2                	cmp    %eax,%edx
+ 916:	72 f0                	jb     908 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 918:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 91b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 91e:	39 f8                	cmp    %edi,%eax
+ 920:	74 2e                	je     950 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 922:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 925:	8b 42 04             	mov    0x4(%edx),%eax
+ 928:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 92b:	39 f1                	cmp    %esi,%ecx
+ 92d:	74 38                	je     967 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 92f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 931:	5b                   	pop    %ebx
+  freep = p;
+ 932:	89 15 a0 1f 00 00    	mov    %edx,0x1fa0
+}
+ 938:	5e                   	pop    %esi
+ 939:	5f                   	pop    %edi
+ 93a:	5d                   	pop    %ebp
+ 93b:	c3                   	ret
+ 93c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 940:	39 c1                	cmp    %eax,%ecx
+ 942:	72 d0                	jb     914 <free+0x24>
+ 944:	eb c2                	jmp    908 <free+0x18>
+ 946:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 94d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 950:	03 70 04             	add    0x4(%eax),%esi
+ 953:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 956:	8b 02                	mov    (%edx),%eax
+ 958:	8b 00                	mov    (%eax),%eax
+ 95a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 95d:	8b 42 04             	mov    0x4(%edx),%eax
+ 960:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 963:	39 f1                	cmp    %esi,%ecx
+ 965:	75 c8                	jne    92f <free+0x3f>
+    p->s.size += bp->s.size;
+ 967:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 96a:	89 15 a0 1f 00 00    	mov    %edx,0x1fa0
+    p->s.size += bp->s.size;
+ 970:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 973:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 976:	89 0a                	mov    %ecx,(%edx)
+}
+ 978:	5b                   	pop    %ebx
+ 979:	5e                   	pop    %esi
+ 97a:	5f                   	pop    %edi
+ 97b:	5d                   	pop    %ebp
+ 97c:	c3                   	ret
+ 97d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000980 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 980:	55                   	push   %ebp
+ 981:	89 e5                	mov    %esp,%ebp
+ 983:	57                   	push   %edi
+ 984:	56                   	push   %esi
+ 985:	53                   	push   %ebx
+ 986:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 989:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 98c:	8b 15 a0 1f 00 00    	mov    0x1fa0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 992:	8d 78 07             	lea    0x7(%eax),%edi
+ 995:	c1 ef 03             	shr    $0x3,%edi
+ 998:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 99b:	85 d2                	test   %edx,%edx
+ 99d:	0f 84 8d 00 00 00    	je     a30 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9a3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 9a5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 9a8:	39 f9                	cmp    %edi,%ecx
+ 9aa:	73 64                	jae    a10 <malloc+0x90>
+  if(nu < 4096)
+ 9ac:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 9b1:	39 df                	cmp    %ebx,%edi
+ 9b3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 9b6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 9bd:	eb 0a                	jmp    9c9 <malloc+0x49>
+ 9bf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9c0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 9c2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 9c5:	39 f9                	cmp    %edi,%ecx
+ 9c7:	73 47                	jae    a10 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 9c9:	89 c2                	mov    %eax,%edx
+ 9cb:	39 05 a0 1f 00 00    	cmp    %eax,0x1fa0
+ 9d1:	75 ed                	jne    9c0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 9d3:	83 ec 0c             	sub    $0xc,%esp
+ 9d6:	56                   	push   %esi
+ 9d7:	e8 3f fc ff ff       	call   61b <sbrk>
+  if(p == (char*)-1)
+ 9dc:	83 c4 10             	add    $0x10,%esp
+ 9df:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 9e2:	74 1c                	je     a00 <malloc+0x80>
+  hp->s.size = nu;
+ 9e4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 9e7:	83 ec 0c             	sub    $0xc,%esp
+ 9ea:	83 c0 08             	add    $0x8,%eax
+ 9ed:	50                   	push   %eax
+ 9ee:	e8 fd fe ff ff       	call   8f0 <free>
+  return freep;
+ 9f3:	8b 15 a0 1f 00 00    	mov    0x1fa0,%edx
+      if((p = morecore(nunits)) == 0)
+ 9f9:	83 c4 10             	add    $0x10,%esp
+ 9fc:	85 d2                	test   %edx,%edx
+ 9fe:	75 c0                	jne    9c0 <malloc+0x40>
+        return 0;
+  }
+}
+ a00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ a03:	31 c0                	xor    %eax,%eax
+}
+ a05:	5b                   	pop    %ebx
+ a06:	5e                   	pop    %esi
+ a07:	5f                   	pop    %edi
+ a08:	5d                   	pop    %ebp
+ a09:	c3                   	ret
+ a0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ a10:	39 cf                	cmp    %ecx,%edi
+ a12:	74 4c                	je     a60 <malloc+0xe0>
+        p->s.size -= nunits;
+ a14:	29 f9                	sub    %edi,%ecx
+ a16:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ a19:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ a1c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ a1f:	89 15 a0 1f 00 00    	mov    %edx,0x1fa0
+}
+ a25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ a28:	83 c0 08             	add    $0x8,%eax
+}
+ a2b:	5b                   	pop    %ebx
+ a2c:	5e                   	pop    %esi
+ a2d:	5f                   	pop    %edi
+ a2e:	5d                   	pop    %ebp
+ a2f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ a30:	c7 05 a0 1f 00 00 a4 	movl   $0x1fa4,0x1fa0
+ a37:	1f 00 00 
+    base.s.size = 0;
+ a3a:	b8 a4 1f 00 00       	mov    $0x1fa4,%eax
+    base.s.ptr = freep = prevp = &base;
+ a3f:	c7 05 a4 1f 00 00 a4 	movl   $0x1fa4,0x1fa4
+ a46:	1f 00 00 
+    base.s.size = 0;
+ a49:	c7 05 a8 1f 00 00 00 	movl   $0x0,0x1fa8
+ a50:	00 00 00 
+    if(p->s.size >= nunits){
+ a53:	e9 54 ff ff ff       	jmp    9ac <malloc+0x2c>
+ a58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a5f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ a60:	8b 08                	mov    (%eax),%ecx
+ a62:	89 0a                	mov    %ecx,(%edx)
+ a64:	eb b9                	jmp    a1f <malloc+0x9f>
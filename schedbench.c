@@ -0,0 +1,110 @@
+// Measure how the scheduler shares the CPU, to compare the
+// multilevel feedback queues with fair share (make SCHED=fair).
+//
+// usage: schedbench [hogs [samples]]
+//
+// Starts some CPU-bound processes, alternately at nice levels 0
+// and 1, that count loop iterations in shared memory. Meanwhile
+// it bounces a byte off a child over pipes once a tick, timing
+// each round trip, which shows how long a process that wakes up
+// waits for the CPU. Prints the iterations of each hog (the
+// throughput and how it was shared) and the median, 99th
+// percentile and worst round trip in thousands of TSC cycles.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "mman.h"
+
+#define MAXHOGS    16
+#define MAXSAMPLES 1000
+
+static inline uint64
+rdtsc(void)
+{
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  return ((uint64)hi << 32) | lo;
+}
+
+uint lat[MAXSAMPLES];
+
+void
+sort(uint *a, int n)
+{
+  int i, j;
+  uint t;
+
+  for(i = 1; i < n; i++){
+    t = a[i];
+    for(j = i; j > 0 && a[j-1] > t; j--)
+      a[j] = a[j-1];
+    a[j] = t;
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  volatile uint *count;
+  int i, nhogs, nsamples, ticks, pid[MAXHOGS], ping[2], pong[2];
+  uint total;
+  uint64 t0;
+  char c;
+
+  nhogs = argc > 1 ? atoi(argv[1]) : 4;
+  nsamples = argc > 2 ? atoi(argv[2]) : 200;
+  if(nhogs < 1 || nhogs > MAXHOGS || nsamples < 1 || nsamples > MAXSAMPLES){
+    printf(2, "usage: schedbench [hogs [samples]]\n");
+    exit();
+  }
+  count = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+  if(count == MAP_FAILED || pipe(ping) < 0 || pipe(pong) < 0){
+    printf(2, "schedbench: setup failed\n");
+    exit();
+  }
+
+  for(i = 0; i < nhogs; i++){
+    if((pid[i] = fork()) == 0){
+      setpriority(0, i % 2);
+      for(;;)
+        count[i]++;
+    }
+  }
+  if(fork() == 0){
+    close(ping[1]);
+    close(pong[0]);
+    while(read(ping[0], &c, 1) == 1)
+      write(pong[1], &c, 1);
+    exit();
+  }
+  close(ping[0]);
+  close(pong[1]);
+
+  ticks = uptime();
+  for(i = 0; i < nsamples; i++){
+    sleep(1);
+    t0 = rdtsc();
+    write(ping[1], "x", 1);
+    read(pong[0], &c, 1);
+    lat[i] = (uint)(rdtsc() - t0) / 1000;
+  }
+  ticks = uptime() - ticks;
+  for(i = 0; i < nhogs; i++)
+    kill(pid[i]);
+  close(ping[1]);
+  for(i = 0; i < nhogs + 1; i++)
+    wait();
+
+  total = 0;
+  for(i = 0; i < nhogs; i++){
+    printf(1, "hog %d nice %d: %d iterations\n", i, i % 2, count[i]);
+    total += count[i];
+  }
+  printf(1, "%d iterations in %d ticks\n", total, ticks);
+  sort(lat, nsamples);
+  printf(1, "round trip Kcycles: median %d p99 %d max %d\n",
+         lat[nsamples/2], lat[nsamples*99/100], lat[nsamples-1]);
+  exit();
+}
@@ -0,0 +1,3125 @@
+
+_sh:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return 0;
+}
+
+int
+main(void)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	53                   	push   %ebx
+       e:	51                   	push   %ecx
+  static char buf[100];
+  int fd;
+  struct cmd *cmd;
+
+  // Ensure that three file descriptors are open.
+  while((fd = open("console", O_RDWR)) >= 0){
+       f:	eb 10                	jmp    21 <main+0x21>
+      11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(fd >= 3){
+      18:	83 f8 02             	cmp    $0x2,%eax
+      1b:	0f 8f 14 01 00 00    	jg     135 <main+0x135>
+  while((fd = open("console", O_RDWR)) >= 0){
+      21:	83 ec 08             	sub    $0x8,%esp
+      24:	6a 02                	push   $0x2
+      26:	68 b9 16 00 00       	push   $0x16b9
+      2b:	e8 53 11 00 00       	call   1183 <open>
+      30:	83 c4 10             	add    $0x10,%esp
+      33:	85 c0                	test   %eax,%eax
+      35:	79 e1                	jns    18 <main+0x18>
+      37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      3e:	66 90                	xchg   %ax,%ax
+  printf(2, "$ ");
+      40:	83 ec 08             	sub    $0x8,%esp
+      43:	68 38 16 00 00       	push   $0x1638
+      48:	6a 02                	push   $0x2
+      4a:	e8 a1 12 00 00       	call   12f0 <printf>
+  memset(buf, 0, nbuf);
+      4f:	83 c4 0c             	add    $0xc,%esp
+      52:	6a 64                	push   $0x64
+      54:	6a 00                	push   $0x0
+      56:	68 40 20 00 00       	push   $0x2040
+      5b:	e8 60 0f 00 00       	call   fc0 <memset>
+  gets(buf, nbuf);
+      60:	58                   	pop    %eax
+      61:	5a                   	pop    %edx
+      62:	6a 64                	push   $0x64
+      64:	68 40 20 00 00       	push   $0x2040
+      69:	e8 b2 0f 00 00       	call   1020 <gets>
+  if(buf[0] == 0) // EOF
+      6e:	0f b6 05 40 20 00 00 	movzbl 0x2040,%eax
+      75:	83 c4 10             	add    $0x10,%esp
+      78:	84 c0                	test   %al,%al
+      7a:	0f 84 b0 00 00 00    	je     130 <main+0x130>
+    }
+  }
+
+  // Read and run input commands.
+  while(getcmd(buf, sizeof(buf)) >= 0){
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+      80:	3c 63                	cmp    $0x63,%al
+      82:	75 09                	jne    8d <main+0x8d>
+      84:	80 3d 41 20 00 00 64 	cmpb   $0x64,0x2041
+      8b:	74 53                	je     e0 <main+0xe0>
+      buf[strlen(buf)-1] = 0;  // chop \n
+      if(chdir(buf+3) < 0)
+        printf(2, "cannot cd %s\n", buf+3);
+      continue;
+    }
+    if((cmd = parsecmd(buf)) == 0)
+      8d:	83 ec 0c             	sub    $0xc,%esp
+      90:	68 40 20 00 00       	push   $0x2040
+      95:	e8 96 0d 00 00       	call   e30 <parsecmd>
+      9a:	83 c4 10             	add    $0x10,%esp
+      9d:	89 c3                	mov    %eax,%ebx
+      9f:	85 c0                	test   %eax,%eax
+      a1:	74 9d                	je     40 <main+0x40>
+      continue;
+    if(spawncmd(cmd) < 0){
+      a3:	83 ec 0c             	sub    $0xc,%esp
+      a6:	50                   	push   %eax
+      a7:	e8 b4 00 00 00       	call   160 <spawncmd>
+      ac:	83 c4 10             	add    $0x10,%esp
+      af:	85 c0                	test   %eax,%eax
+      b1:	78 15                	js     c8 <main+0xc8>
+      if(fork1() == 0)
+        runcmd(cmd);
+      wait();
+    }
+    freecmd(cmd);
+      b3:	83 ec 0c             	sub    $0xc,%esp
+      b6:	53                   	push   %ebx
+      b7:	e8 f4 0c 00 00       	call   db0 <freecmd>
+      bc:	83 c4 10             	add    $0x10,%esp
+      bf:	e9 7c ff ff ff       	jmp    40 <main+0x40>
+      c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+int
+fork1(void)
+{
+  int pid;
+
+  pid = fork();
+      c8:	e8 6e 10 00 00       	call   113b <fork>
+  if(pid == -1)
+      cd:	83 f8 ff             	cmp    $0xffffffff,%eax
+      d0:	74 7d                	je     14f <main+0x14f>
+      if(fork1() == 0)
+      d2:	85 c0                	test   %eax,%eax
+      d4:	74 70                	je     146 <main+0x146>
+      wait();
+      d6:	e8 70 10 00 00       	call   114b <wait>
+      db:	eb d6                	jmp    b3 <main+0xb3>
+      dd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+      e0:	80 3d 42 20 00 00 20 	cmpb   $0x20,0x2042
+      e7:	75 a4                	jne    8d <main+0x8d>
+      buf[strlen(buf)-1] = 0;  // chop \n
+      e9:	83 ec 0c             	sub    $0xc,%esp
+      ec:	68 40 20 00 00       	push   $0x2040
+      f1:	e8 9a 0e 00 00       	call   f90 <strlen>
+      if(chdir(buf+3) < 0)
+      f6:	c7 04 24 43 20 00 00 	movl   $0x2043,(%esp)
+      buf[strlen(buf)-1] = 0;  // chop \n
+      fd:	c6 80 3f 20 00 00 00 	movb   $0x0,0x203f(%eax)
+      if(chdir(buf+3) < 0)
+     104:	e8 aa 10 00 00       	call   11b3 <chdir>
+     109:	83 c4 10             	add    $0x10,%esp
+     10c:	85 c0                	test   %eax,%eax
+     10e:	0f 89 2c ff ff ff    	jns    40 <main+0x40>
+        printf(2, "cannot cd %s\n", buf+3);
+     114:	51                   	push   %ecx
+     115:	68 43 20 00 00       	push   $0x2043
+     11a:	68 c1 16 00 00       	push   $0x16c1
+     11f:	6a 02                	push   $0x2
+     121:	e8 ca 11 00 00       	call   12f0 <printf>
+     126:	83 c4 10             	add    $0x10,%esp
+     129:	e9 12 ff ff ff       	jmp    40 <main+0x40>
+     12e:	66 90                	xchg   %ax,%ax
+  exit();
+     130:	e8 0e 10 00 00       	call   1143 <exit>
+      close(fd);
+     135:	83 ec 0c             	sub    $0xc,%esp
+     138:	50                   	push   %eax
+     139:	e8 2d 10 00 00       	call   116b <close>
+      break;
+     13e:	83 c4 10             	add    $0x10,%esp
+     141:	e9 fa fe ff ff       	jmp    40 <main+0x40>
+        runcmd(cmd);
+     146:	83 ec 0c             	sub    $0xc,%esp
+     149:	53                   	push   %ebx
+     14a:	e8 e1 01 00 00       	call   330 <runcmd>
+    panic("fork");
+     14f:	83 ec 0c             	sub    $0xc,%esp
+     152:	68 3b 16 00 00       	push   $0x163b
+     157:	e8 94 01 00 00       	call   2f0 <panic>
+     15c:	66 90                	xchg   %ax,%ax
+     15e:	66 90                	xchg   %ax,%ax
+
+00000160 <spawncmd>:
+{
+     160:	55                   	push   %ebp
+     161:	89 e5                	mov    %esp,%ebp
+     163:	57                   	push   %edi
+     164:	56                   	push   %esi
+     165:	53                   	push   %ebx
+     166:	83 ec 2c             	sub    $0x2c,%esp
+     169:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  for(c = cmd; c->type == REDIR; c = ((struct redircmd*)c)->cmd)
+     16c:	8b 13                	mov    (%ebx),%edx
+     16e:	89 df                	mov    %ebx,%edi
+     170:	83 fa 02             	cmp    $0x2,%edx
+     173:	0f 85 1f 01 00 00    	jne    298 <spawncmd+0x138>
+     179:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     180:	8b 7f 04             	mov    0x4(%edi),%edi
+     183:	8b 07                	mov    (%edi),%eax
+     185:	83 f8 02             	cmp    $0x2,%eax
+     188:	74 f6                	je     180 <spawncmd+0x20>
+  if(c->type != EXEC)
+     18a:	83 f8 01             	cmp    $0x1,%eax
+     18d:	0f 85 0c 01 00 00    	jne    29f <spawncmd+0x13f>
+  if(ecmd->argv[0] == 0)
+     193:	8b 4f 04             	mov    0x4(%edi),%ecx
+     196:	85 c9                	test   %ecx,%ecx
+     198:	0f 84 a2 00 00 00    	je     240 <spawncmd+0xe0>
+    fd[i] = i;
+     19e:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+     1a5:	c7 45 e0 01 00 00 00 	movl   $0x1,-0x20(%ebp)
+     1ac:	c7 45 e4 02 00 00 00 	movl   $0x2,-0x1c(%ebp)
+  for(c = cmd; c->type == REDIR; c = rcmd->cmd){
+     1b3:	83 fa 02             	cmp    $0x2,%edx
+     1b6:	74 2e                	je     1e6 <spawncmd+0x86>
+     1b8:	e9 a3 00 00 00       	jmp    260 <spawncmd+0x100>
+     1bd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(fd[rcmd->fd] != rcmd->fd)
+     1c0:	8b 53 14             	mov    0x14(%ebx),%edx
+     1c3:	8b 44 95 dc          	mov    -0x24(%ebp,%edx,4),%eax
+     1c7:	39 c2                	cmp    %eax,%edx
+     1c9:	74 0f                	je     1da <spawncmd+0x7a>
+      close(fd[rcmd->fd]);
+     1cb:	83 ec 0c             	sub    $0xc,%esp
+     1ce:	50                   	push   %eax
+     1cf:	e8 97 0f 00 00       	call   116b <close>
+    fd[rcmd->fd] = f;
+     1d4:	8b 43 14             	mov    0x14(%ebx),%eax
+     1d7:	83 c4 10             	add    $0x10,%esp
+     1da:	89 74 85 dc          	mov    %esi,-0x24(%ebp,%eax,4)
+  for(c = cmd; c->type == REDIR; c = rcmd->cmd){
+     1de:	8b 5b 04             	mov    0x4(%ebx),%ebx
+     1e1:	83 3b 02             	cmpl   $0x2,(%ebx)
+     1e4:	75 7a                	jne    260 <spawncmd+0x100>
+    if((f = open(rcmd->file, rcmd->mode)) < 0){
+     1e6:	83 ec 08             	sub    $0x8,%esp
+     1e9:	ff 73 10             	push   0x10(%ebx)
+     1ec:	ff 73 08             	push   0x8(%ebx)
+     1ef:	e8 8f 0f 00 00       	call   1183 <open>
+     1f4:	83 c4 10             	add    $0x10,%esp
+     1f7:	89 c6                	mov    %eax,%esi
+     1f9:	85 c0                	test   %eax,%eax
+     1fb:	79 c3                	jns    1c0 <spawncmd+0x60>
+      printf(2, "open %s failed\n", rcmd->file);
+     1fd:	83 ec 04             	sub    $0x4,%esp
+     200:	ff 73 08             	push   0x8(%ebx)
+     203:	8d 75 dc             	lea    -0x24(%ebp),%esi
+     206:	68 18 16 00 00       	push   $0x1618
+     20b:	6a 02                	push   $0x2
+     20d:	e8 de 10 00 00       	call   12f0 <printf>
+      pid = -1;
+     212:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+      printf(2, "open %s failed\n", rcmd->file);
+     219:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 3; i++)
+     21c:	31 db                	xor    %ebx,%ebx
+    if(fd[i] != i)
+     21e:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+     221:	39 d8                	cmp    %ebx,%eax
+     223:	74 0c                	je     231 <spawncmd+0xd1>
+      close(fd[i]);
+     225:	83 ec 0c             	sub    $0xc,%esp
+     228:	50                   	push   %eax
+     229:	e8 3d 0f 00 00       	call   116b <close>
+     22e:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 3; i++)
+     231:	83 c3 01             	add    $0x1,%ebx
+     234:	83 fb 03             	cmp    $0x3,%ebx
+     237:	75 e5                	jne    21e <spawncmd+0xbe>
+  if(pid > 0)
+     239:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     23c:	85 c0                	test   %eax,%eax
+     23e:	7f 10                	jg     250 <spawncmd+0xf0>
+    return 0;
+     240:	31 c0                	xor    %eax,%eax
+}
+     242:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     245:	5b                   	pop    %ebx
+     246:	5e                   	pop    %esi
+     247:	5f                   	pop    %edi
+     248:	5d                   	pop    %ebp
+     249:	c3                   	ret
+     24a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+     250:	e8 f6 0e 00 00       	call   114b <wait>
+     255:	eb e9                	jmp    240 <spawncmd+0xe0>
+     257:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     25e:	66 90                	xchg   %ax,%ax
+  if(pid == 0 && (pid = spawn(ecmd->argv[0], ecmd->argv, fd)) < 0)
+     260:	83 ec 04             	sub    $0x4,%esp
+     263:	8d 47 04             	lea    0x4(%edi),%eax
+     266:	8d 75 dc             	lea    -0x24(%ebp),%esi
+     269:	56                   	push   %esi
+     26a:	50                   	push   %eax
+     26b:	ff 77 04             	push   0x4(%edi)
+     26e:	e8 a0 0f 00 00       	call   1213 <spawn>
+     273:	83 c4 10             	add    $0x10,%esp
+     276:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     279:	85 c0                	test   %eax,%eax
+     27b:	79 9f                	jns    21c <spawncmd+0xbc>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+     27d:	83 ec 04             	sub    $0x4,%esp
+     280:	ff 77 04             	push   0x4(%edi)
+     283:	68 28 16 00 00       	push   $0x1628
+     288:	6a 02                	push   $0x2
+     28a:	e8 61 10 00 00       	call   12f0 <printf>
+     28f:	83 c4 10             	add    $0x10,%esp
+     292:	eb 88                	jmp    21c <spawncmd+0xbc>
+     294:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(c = cmd; c->type == REDIR; c = ((struct redircmd*)c)->cmd)
+     298:	89 d0                	mov    %edx,%eax
+     29a:	e9 eb fe ff ff       	jmp    18a <spawncmd+0x2a>
+    return -1;
+     29f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     2a4:	eb 9c                	jmp    242 <spawncmd+0xe2>
+     2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002b0 <getcmd>:
+{
+     2b0:	55                   	push   %ebp
+     2b1:	89 e5                	mov    %esp,%ebp
+     2b3:	56                   	push   %esi
+     2b4:	53                   	push   %ebx
+     2b5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     2b8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  printf(2, "$ ");
+     2bb:	83 ec 08             	sub    $0x8,%esp
+     2be:	68 38 16 00 00       	push   $0x1638
+     2c3:	6a 02                	push   $0x2
+     2c5:	e8 26 10 00 00       	call   12f0 <printf>
+  memset(buf, 0, nbuf);
+     2ca:	83 c4 0c             	add    $0xc,%esp
+     2cd:	56                   	push   %esi
+     2ce:	6a 00                	push   $0x0
+     2d0:	53                   	push   %ebx
+     2d1:	e8 ea 0c 00 00       	call   fc0 <memset>
+  gets(buf, nbuf);
+     2d6:	58                   	pop    %eax
+     2d7:	5a                   	pop    %edx
+     2d8:	56                   	push   %esi
+     2d9:	53                   	push   %ebx
+     2da:	e8 41 0d 00 00       	call   1020 <gets>
+  if(buf[0] == 0) // EOF
+     2df:	83 c4 10             	add    $0x10,%esp
+     2e2:	80 3b 01             	cmpb   $0x1,(%ebx)
+     2e5:	19 c0                	sbb    %eax,%eax
+}
+     2e7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     2ea:	5b                   	pop    %ebx
+     2eb:	5e                   	pop    %esi
+     2ec:	5d                   	pop    %ebp
+     2ed:	c3                   	ret
+     2ee:	66 90                	xchg   %ax,%ax
+
+000002f0 <panic>:
+{
+     2f0:	55                   	push   %ebp
+     2f1:	89 e5                	mov    %esp,%ebp
+     2f3:	83 ec 0c             	sub    $0xc,%esp
+  printf(2, "%s\n", s);
+     2f6:	ff 75 08             	push   0x8(%ebp)
+     2f9:	68 b5 16 00 00       	push   $0x16b5
+     2fe:	6a 02                	push   $0x2
+     300:	e8 eb 0f 00 00       	call   12f0 <printf>
+  exit();
+     305:	e8 39 0e 00 00       	call   1143 <exit>
+     30a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000310 <fork1>:
+{
+     310:	55                   	push   %ebp
+     311:	89 e5                	mov    %esp,%ebp
+     313:	83 ec 08             	sub    $0x8,%esp
+  pid = fork();
+     316:	e8 20 0e 00 00       	call   113b <fork>
+  if(pid == -1)
+     31b:	83 f8 ff             	cmp    $0xffffffff,%eax
+     31e:	74 02                	je     322 <fork1+0x12>
+  return pid;
+}
+     320:	c9                   	leave
+     321:	c3                   	ret
+    panic("fork");
+     322:	83 ec 0c             	sub    $0xc,%esp
+     325:	68 3b 16 00 00       	push   $0x163b
+     32a:	e8 c1 ff ff ff       	call   2f0 <panic>
+     32f:	90                   	nop
+
+00000330 <runcmd>:
+{
+     330:	55                   	push   %ebp
+     331:	89 e5                	mov    %esp,%ebp
+     333:	53                   	push   %ebx
+     334:	83 ec 14             	sub    $0x14,%esp
+     337:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(cmd == 0)
+     33a:	85 db                	test   %ebx,%ebx
+     33c:	74 42                	je     380 <runcmd+0x50>
+  switch(cmd->type){
+     33e:	83 3b 05             	cmpl   $0x5,(%ebx)
+     341:	0f 87 e3 00 00 00    	ja     42a <runcmd+0xfa>
+     347:	8b 03                	mov    (%ebx),%eax
+     349:	ff 24 85 d0 16 00 00 	jmp    *0x16d0(,%eax,4)
+    if(ecmd->argv[0] == 0)
+     350:	8b 43 04             	mov    0x4(%ebx),%eax
+     353:	85 c0                	test   %eax,%eax
+     355:	74 29                	je     380 <runcmd+0x50>
+    exec(ecmd->argv[0], ecmd->argv);
+     357:	8d 53 04             	lea    0x4(%ebx),%edx
+     35a:	51                   	push   %ecx
+     35b:	51                   	push   %ecx
+     35c:	52                   	push   %edx
+     35d:	50                   	push   %eax
+     35e:	e8 18 0e 00 00       	call   117b <exec>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+     363:	83 c4 0c             	add    $0xc,%esp
+     366:	ff 73 04             	push   0x4(%ebx)
+     369:	68 28 16 00 00       	push   $0x1628
+     36e:	6a 02                	push   $0x2
+     370:	e8 7b 0f 00 00       	call   12f0 <printf>
+    break;
+     375:	83 c4 10             	add    $0x10,%esp
+     378:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     37f:	90                   	nop
+    exit();
+     380:	e8 be 0d 00 00       	call   1143 <exit>
+    if(fork1() == 0)
+     385:	e8 86 ff ff ff       	call   310 <fork1>
+     38a:	85 c0                	test   %eax,%eax
+     38c:	75 f2                	jne    380 <runcmd+0x50>
+     38e:	e9 8c 00 00 00       	jmp    41f <runcmd+0xef>
+    if(pipe(p) < 0)
+     393:	83 ec 0c             	sub    $0xc,%esp
+     396:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     399:	50                   	push   %eax
+     39a:	e8 b4 0d 00 00       	call   1153 <pipe>
+     39f:	83 c4 10             	add    $0x10,%esp
+     3a2:	85 c0                	test   %eax,%eax
+     3a4:	0f 88 a2 00 00 00    	js     44c <runcmd+0x11c>
+    if(fork1() == 0){
+     3aa:	e8 61 ff ff ff       	call   310 <fork1>
+     3af:	85 c0                	test   %eax,%eax
+     3b1:	0f 84 a2 00 00 00    	je     459 <runcmd+0x129>
+    if(fork1() == 0){
+     3b7:	e8 54 ff ff ff       	call   310 <fork1>
+     3bc:	85 c0                	test   %eax,%eax
+     3be:	0f 84 c3 00 00 00    	je     487 <runcmd+0x157>
+    close(p[0]);
+     3c4:	83 ec 0c             	sub    $0xc,%esp
+     3c7:	ff 75 f0             	push   -0x10(%ebp)
+     3ca:	e8 9c 0d 00 00       	call   116b <close>
+    close(p[1]);
+     3cf:	58                   	pop    %eax
+     3d0:	ff 75 f4             	push   -0xc(%ebp)
+     3d3:	e8 93 0d 00 00       	call   116b <close>
+    wait();
+     3d8:	e8 6e 0d 00 00       	call   114b <wait>
+    wait();
+     3dd:	e8 69 0d 00 00       	call   114b <wait>
+    break;
+     3e2:	83 c4 10             	add    $0x10,%esp
+     3e5:	eb 99                	jmp    380 <runcmd+0x50>
+    if(fork1() == 0)
+     3e7:	e8 24 ff ff ff       	call   310 <fork1>
+     3ec:	85 c0                	test   %eax,%eax
+     3ee:	74 2f                	je     41f <runcmd+0xef>
+    wait();
+     3f0:	e8 56 0d 00 00       	call   114b <wait>
+    runcmd(lcmd->right);
+     3f5:	83 ec 0c             	sub    $0xc,%esp
+     3f8:	ff 73 08             	push   0x8(%ebx)
+     3fb:	e8 30 ff ff ff       	call   330 <runcmd>
+    close(rcmd->fd);
+     400:	83 ec 0c             	sub    $0xc,%esp
+     403:	ff 73 14             	push   0x14(%ebx)
+     406:	e8 60 0d 00 00       	call   116b <close>
+    if(open(rcmd->file, rcmd->mode) < 0){
+     40b:	58                   	pop    %eax
+     40c:	5a                   	pop    %edx
+     40d:	ff 73 10             	push   0x10(%ebx)
+     410:	ff 73 08             	push   0x8(%ebx)
+     413:	e8 6b 0d 00 00       	call   1183 <open>
+     418:	83 c4 10             	add    $0x10,%esp
+     41b:	85 c0                	test   %eax,%eax
+     41d:	78 18                	js     437 <runcmd+0x107>
+      runcmd(bcmd->cmd);
+     41f:	83 ec 0c             	sub    $0xc,%esp
+     422:	ff 73 04             	push   0x4(%ebx)
+     425:	e8 06 ff ff ff       	call   330 <runcmd>
+    panic("runcmd");
+     42a:	83 ec 0c             	sub    $0xc,%esp
+     42d:	68 40 16 00 00       	push   $0x1640
+     432:	e8 b9 fe ff ff       	call   2f0 <panic>
+      printf(2, "open %s failed\n", rcmd->file);
+     437:	51                   	push   %ecx
+     438:	ff 73 08             	push   0x8(%ebx)
+     43b:	68 18 16 00 00       	push   $0x1618
+     440:	6a 02                	push   $0x2
+     442:	e8 a9 0e 00 00       	call   12f0 <printf>
+      exit();
+     447:	e8 f7 0c 00 00       	call   1143 <exit>
+      panic("pipe");
+     44c:	83 ec 0c             	sub    $0xc,%esp
+     44f:	68 47 16 00 00       	push   $0x1647
+     454:	e8 97 fe ff ff       	call   2f0 <panic>
+      close(1);
+     459:	83 ec 0c             	sub    $0xc,%esp
+     45c:	6a 01                	push   $0x1
+     45e:	e8 08 0d 00 00       	call   116b <close>
+      dup(p[1]);
+     463:	58                   	pop    %eax
+     464:	ff 75 f4             	push   -0xc(%ebp)
+     467:	e8 4f 0d 00 00       	call   11bb <dup>
+      close(p[0]);
+     46c:	58                   	pop    %eax
+     46d:	ff 75 f0             	push   -0x10(%ebp)
+     470:	e8 f6 0c 00 00       	call   116b <close>
+      close(p[1]);
+     475:	58                   	pop    %eax
+     476:	ff 75 f4             	push   -0xc(%ebp)
+     479:	e8 ed 0c 00 00       	call   116b <close>
+      runcmd(pcmd->left);
+     47e:	5a                   	pop    %edx
+     47f:	ff 73 04             	push   0x4(%ebx)
+     482:	e8 a9 fe ff ff       	call   330 <runcmd>
+      close(0);
+     487:	83 ec 0c             	sub    $0xc,%esp
+     48a:	6a 00                	push   $0x0
+     48c:	e8 da 0c 00 00       	call   116b <close>
+      dup(p[0]);
+     491:	5a                   	pop    %edx
+     492:	ff 75 f0             	push   -0x10(%ebp)
+     495:	e8 21 0d 00 00       	call   11bb <dup>
+      close(p[0]);
+     49a:	59                   	pop    %ecx
+     49b:	ff 75 f0             	push   -0x10(%ebp)
+     49e:	e8 c8 0c 00 00       	call   116b <close>
+      close(p[1]);
+     4a3:	58                   	pop    %eax
+     4a4:	ff 75 f4             	push   -0xc(%ebp)
+     4a7:	e8 bf 0c 00 00       	call   116b <close>
+      runcmd(pcmd->right);
+     4ac:	58                   	pop    %eax
+     4ad:	ff 73 08             	push   0x8(%ebx)
+     4b0:	e8 7b fe ff ff       	call   330 <runcmd>
+     4b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <execcmd>:
+//PAGEBREAK!
+// Constructors
+
+struct cmd*
+execcmd(void)
+{
+     4c0:	55                   	push   %ebp
+     4c1:	89 e5                	mov    %esp,%ebp
+     4c3:	53                   	push   %ebx
+     4c4:	83 ec 10             	sub    $0x10,%esp
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     4c7:	6a 54                	push   $0x54
+     4c9:	e8 62 10 00 00       	call   1530 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     4ce:	83 c4 0c             	add    $0xc,%esp
+     4d1:	6a 54                	push   $0x54
+  cmd = malloc(sizeof(*cmd));
+     4d3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     4d5:	6a 00                	push   $0x0
+     4d7:	50                   	push   %eax
+     4d8:	e8 e3 0a 00 00       	call   fc0 <memset>
+  cmd->type = EXEC;
+     4dd:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  return (struct cmd*)cmd;
+}
+     4e3:	89 d8                	mov    %ebx,%eax
+     4e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4e8:	c9                   	leave
+     4e9:	c3                   	ret
+     4ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000004f0 <redircmd>:
+
+struct cmd*
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+     4f0:	55                   	push   %ebp
+     4f1:	89 e5                	mov    %esp,%ebp
+     4f3:	53                   	push   %ebx
+     4f4:	83 ec 10             	sub    $0x10,%esp
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     4f7:	6a 18                	push   $0x18
+     4f9:	e8 32 10 00 00       	call   1530 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     4fe:	83 c4 0c             	add    $0xc,%esp
+     501:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     503:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     505:	6a 00                	push   $0x0
+     507:	50                   	push   %eax
+     508:	e8 b3 0a 00 00       	call   fc0 <memset>
+  cmd->type = REDIR;
+  cmd->cmd = subcmd;
+     50d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = REDIR;
+     510:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  cmd->cmd = subcmd;
+     516:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->file = file;
+     519:	8b 45 0c             	mov    0xc(%ebp),%eax
+     51c:	89 43 08             	mov    %eax,0x8(%ebx)
+  cmd->efile = efile;
+     51f:	8b 45 10             	mov    0x10(%ebp),%eax
+     522:	89 43 0c             	mov    %eax,0xc(%ebx)
+  cmd->mode = mode;
+     525:	8b 45 14             	mov    0x14(%ebp),%eax
+     528:	89 43 10             	mov    %eax,0x10(%ebx)
+  cmd->fd = fd;
+     52b:	8b 45 18             	mov    0x18(%ebp),%eax
+     52e:	89 43 14             	mov    %eax,0x14(%ebx)
+  return (struct cmd*)cmd;
+}
+     531:	89 d8                	mov    %ebx,%eax
+     533:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     536:	c9                   	leave
+     537:	c3                   	ret
+     538:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     53f:	90                   	nop
+
+00000540 <pipecmd>:
+
+struct cmd*
+pipecmd(struct cmd *left, struct cmd *right)
+{
+     540:	55                   	push   %ebp
+     541:	89 e5                	mov    %esp,%ebp
+     543:	53                   	push   %ebx
+     544:	83 ec 10             	sub    $0x10,%esp
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     547:	6a 0c                	push   $0xc
+     549:	e8 e2 0f 00 00       	call   1530 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     54e:	83 c4 0c             	add    $0xc,%esp
+     551:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     553:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     555:	6a 00                	push   $0x0
+     557:	50                   	push   %eax
+     558:	e8 63 0a 00 00       	call   fc0 <memset>
+  cmd->type = PIPE;
+  cmd->left = left;
+     55d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = PIPE;
+     560:	c7 03 03 00 00 00    	movl   $0x3,(%ebx)
+  cmd->left = left;
+     566:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     569:	8b 45 0c             	mov    0xc(%ebp),%eax
+     56c:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     56f:	89 d8                	mov    %ebx,%eax
+     571:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     574:	c9                   	leave
+     575:	c3                   	ret
+     576:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     57d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000580 <listcmd>:
+
+struct cmd*
+listcmd(struct cmd *left, struct cmd *right)
+{
+     580:	55                   	push   %ebp
+     581:	89 e5                	mov    %esp,%ebp
+     583:	53                   	push   %ebx
+     584:	83 ec 10             	sub    $0x10,%esp
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     587:	6a 0c                	push   $0xc
+     589:	e8 a2 0f 00 00       	call   1530 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     58e:	83 c4 0c             	add    $0xc,%esp
+     591:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     593:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     595:	6a 00                	push   $0x0
+     597:	50                   	push   %eax
+     598:	e8 23 0a 00 00       	call   fc0 <memset>
+  cmd->type = LIST;
+  cmd->left = left;
+     59d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = LIST;
+     5a0:	c7 03 04 00 00 00    	movl   $0x4,(%ebx)
+  cmd->left = left;
+     5a6:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     5a9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     5ac:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     5af:	89 d8                	mov    %ebx,%eax
+     5b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5b4:	c9                   	leave
+     5b5:	c3                   	ret
+     5b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005c0 <backcmd>:
+
+struct cmd*
+backcmd(struct cmd *subcmd)
+{
+     5c0:	55                   	push   %ebp
+     5c1:	89 e5                	mov    %esp,%ebp
+     5c3:	53                   	push   %ebx
+     5c4:	83 ec 10             	sub    $0x10,%esp
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     5c7:	6a 08                	push   $0x8
+     5c9:	e8 62 0f 00 00       	call   1530 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     5ce:	83 c4 0c             	add    $0xc,%esp
+     5d1:	6a 08                	push   $0x8
+  cmd = malloc(sizeof(*cmd));
+     5d3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     5d5:	6a 00                	push   $0x0
+     5d7:	50                   	push   %eax
+     5d8:	e8 e3 09 00 00       	call   fc0 <memset>
+  cmd->type = BACK;
+  cmd->cmd = subcmd;
+     5dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = BACK;
+     5e0:	c7 03 05 00 00 00    	movl   $0x5,(%ebx)
+  cmd->cmd = subcmd;
+     5e6:	89 43 04             	mov    %eax,0x4(%ebx)
+  return (struct cmd*)cmd;
+}
+     5e9:	89 d8                	mov    %ebx,%eax
+     5eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5ee:	c9                   	leave
+     5ef:	c3                   	ret
+
+000005f0 <gettoken>:
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int
+gettoken(char **ps, char *es, char **q, char **eq)
+{
+     5f0:	55                   	push   %ebp
+     5f1:	89 e5                	mov    %esp,%ebp
+     5f3:	57                   	push   %edi
+     5f4:	56                   	push   %esi
+     5f5:	53                   	push   %ebx
+     5f6:	83 ec 0c             	sub    $0xc,%esp
+  char *s;
+  int ret;
+
+  s = *ps;
+     5f9:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+     5fc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     5ff:	8b 75 10             	mov    0x10(%ebp),%esi
+  s = *ps;
+     602:	8b 38                	mov    (%eax),%edi
+  while(s < es && strchr(whitespace, *s))
+     604:	39 df                	cmp    %ebx,%edi
+     606:	72 0f                	jb     617 <gettoken+0x27>
+     608:	eb 25                	jmp    62f <gettoken+0x3f>
+     60a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    s++;
+     610:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     613:	39 fb                	cmp    %edi,%ebx
+     615:	74 18                	je     62f <gettoken+0x3f>
+     617:	0f be 07             	movsbl (%edi),%eax
+     61a:	83 ec 08             	sub    $0x8,%esp
+     61d:	50                   	push   %eax
+     61e:	68 08 20 00 00       	push   $0x2008
+     623:	e8 b8 09 00 00       	call   fe0 <strchr>
+     628:	83 c4 10             	add    $0x10,%esp
+     62b:	85 c0                	test   %eax,%eax
+     62d:	75 e1                	jne    610 <gettoken+0x20>
+  if(q)
+     62f:	85 f6                	test   %esi,%esi
+     631:	74 02                	je     635 <gettoken+0x45>
+    *q = s;
+     633:	89 3e                	mov    %edi,(%esi)
+  ret = *s;
+     635:	0f b6 07             	movzbl (%edi),%eax
+  switch(*s){
+     638:	3c 3c                	cmp    $0x3c,%al
+     63a:	0f 8f d0 00 00 00    	jg     710 <gettoken+0x120>
+     640:	3c 3a                	cmp    $0x3a,%al
+     642:	0f 8f bc 00 00 00    	jg     704 <gettoken+0x114>
+     648:	84 c0                	test   %al,%al
+     64a:	75 44                	jne    690 <gettoken+0xa0>
+     64c:	31 f6                	xor    %esi,%esi
+    ret = 'a';
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+      s++;
+    break;
+  }
+  if(eq)
+     64e:	8b 4d 14             	mov    0x14(%ebp),%ecx
+     651:	85 c9                	test   %ecx,%ecx
+     653:	74 05                	je     65a <gettoken+0x6a>
+    *eq = s;
+     655:	8b 45 14             	mov    0x14(%ebp),%eax
+     658:	89 38                	mov    %edi,(%eax)
+
+  while(s < es && strchr(whitespace, *s))
+     65a:	39 df                	cmp    %ebx,%edi
+     65c:	72 09                	jb     667 <gettoken+0x77>
+     65e:	eb 1f                	jmp    67f <gettoken+0x8f>
+    s++;
+     660:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     663:	39 fb                	cmp    %edi,%ebx
+     665:	74 18                	je     67f <gettoken+0x8f>
+     667:	0f be 07             	movsbl (%edi),%eax
+     66a:	83 ec 08             	sub    $0x8,%esp
+     66d:	50                   	push   %eax
+     66e:	68 08 20 00 00       	push   $0x2008
+     673:	e8 68 09 00 00       	call   fe0 <strchr>
+     678:	83 c4 10             	add    $0x10,%esp
+     67b:	85 c0                	test   %eax,%eax
+     67d:	75 e1                	jne    660 <gettoken+0x70>
+  *ps = s;
+     67f:	8b 45 08             	mov    0x8(%ebp),%eax
+     682:	89 38                	mov    %edi,(%eax)
+  return ret;
+}
+     684:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     687:	89 f0                	mov    %esi,%eax
+     689:	5b                   	pop    %ebx
+     68a:	5e                   	pop    %esi
+     68b:	5f                   	pop    %edi
+     68c:	5d                   	pop    %ebp
+     68d:	c3                   	ret
+     68e:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     690:	79 66                	jns    6f8 <gettoken+0x108>
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     692:	39 df                	cmp    %ebx,%edi
+     694:	72 39                	jb     6cf <gettoken+0xdf>
+  if(eq)
+     696:	8b 55 14             	mov    0x14(%ebp),%edx
+     699:	85 d2                	test   %edx,%edx
+     69b:	0f 84 b3 00 00 00    	je     754 <gettoken+0x164>
+    *eq = s;
+     6a1:	8b 45 14             	mov    0x14(%ebp),%eax
+     6a4:	89 38                	mov    %edi,(%eax)
+  while(s < es && strchr(whitespace, *s))
+     6a6:	e9 a9 00 00 00       	jmp    754 <gettoken+0x164>
+     6ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6af:	90                   	nop
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     6b0:	0f be 07             	movsbl (%edi),%eax
+     6b3:	83 ec 08             	sub    $0x8,%esp
+     6b6:	50                   	push   %eax
+     6b7:	68 00 20 00 00       	push   $0x2000
+     6bc:	e8 1f 09 00 00       	call   fe0 <strchr>
+     6c1:	83 c4 10             	add    $0x10,%esp
+     6c4:	85 c0                	test   %eax,%eax
+     6c6:	75 1f                	jne    6e7 <gettoken+0xf7>
+      s++;
+     6c8:	83 c7 01             	add    $0x1,%edi
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     6cb:	39 fb                	cmp    %edi,%ebx
+     6cd:	74 77                	je     746 <gettoken+0x156>
+     6cf:	0f be 07             	movsbl (%edi),%eax
+     6d2:	83 ec 08             	sub    $0x8,%esp
+     6d5:	50                   	push   %eax
+     6d6:	68 08 20 00 00       	push   $0x2008
+     6db:	e8 00 09 00 00       	call   fe0 <strchr>
+     6e0:	83 c4 10             	add    $0x10,%esp
+     6e3:	85 c0                	test   %eax,%eax
+     6e5:	74 c9                	je     6b0 <gettoken+0xc0>
+    ret = 'a';
+     6e7:	be 61 00 00 00       	mov    $0x61,%esi
+     6ec:	e9 5d ff ff ff       	jmp    64e <gettoken+0x5e>
+     6f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  switch(*s){
+     6f8:	3c 26                	cmp    $0x26,%al
+     6fa:	74 08                	je     704 <gettoken+0x114>
+     6fc:	8d 48 d8             	lea    -0x28(%eax),%ecx
+     6ff:	80 f9 01             	cmp    $0x1,%cl
+     702:	77 8e                	ja     692 <gettoken+0xa2>
+  ret = *s;
+     704:	0f be f0             	movsbl %al,%esi
+    s++;
+     707:	83 c7 01             	add    $0x1,%edi
+    break;
+     70a:	e9 3f ff ff ff       	jmp    64e <gettoken+0x5e>
+     70f:	90                   	nop
+  switch(*s){
+     710:	3c 3e                	cmp    $0x3e,%al
+     712:	75 1c                	jne    730 <gettoken+0x140>
+    if(*s == '>'){
+     714:	80 7f 01 3e          	cmpb   $0x3e,0x1(%edi)
+     718:	74 1f                	je     739 <gettoken+0x149>
+    s++;
+     71a:	83 c7 01             	add    $0x1,%edi
+  ret = *s;
+     71d:	be 3e 00 00 00       	mov    $0x3e,%esi
+     722:	e9 27 ff ff ff       	jmp    64e <gettoken+0x5e>
+     727:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     72e:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     730:	3c 7c                	cmp    $0x7c,%al
+     732:	74 d0                	je     704 <gettoken+0x114>
+     734:	e9 59 ff ff ff       	jmp    692 <gettoken+0xa2>
+      s++;
+     739:	83 c7 02             	add    $0x2,%edi
+      ret = '+';
+     73c:	be 2b 00 00 00       	mov    $0x2b,%esi
+     741:	e9 08 ff ff ff       	jmp    64e <gettoken+0x5e>
+  if(eq)
+     746:	8b 45 14             	mov    0x14(%ebp),%eax
+     749:	85 c0                	test   %eax,%eax
+     74b:	74 05                	je     752 <gettoken+0x162>
+    *eq = s;
+     74d:	8b 45 14             	mov    0x14(%ebp),%eax
+     750:	89 18                	mov    %ebx,(%eax)
+      s++;
+     752:	89 df                	mov    %ebx,%edi
+    ret = 'a';
+     754:	be 61 00 00 00       	mov    $0x61,%esi
+     759:	e9 21 ff ff ff       	jmp    67f <gettoken+0x8f>
+     75e:	66 90                	xchg   %ax,%ax
+
+00000760 <peek>:
+
+int
+peek(char **ps, char *es, char *toks)
+{
+     760:	55                   	push   %ebp
+     761:	89 e5                	mov    %esp,%ebp
+     763:	57                   	push   %edi
+     764:	56                   	push   %esi
+     765:	53                   	push   %ebx
+     766:	83 ec 0c             	sub    $0xc,%esp
+     769:	8b 7d 08             	mov    0x8(%ebp),%edi
+     76c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *s;
+
+  s = *ps;
+     76f:	8b 1f                	mov    (%edi),%ebx
+  while(s < es && strchr(whitespace, *s))
+     771:	39 f3                	cmp    %esi,%ebx
+     773:	72 12                	jb     787 <peek+0x27>
+     775:	eb 28                	jmp    79f <peek+0x3f>
+     777:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     77e:	66 90                	xchg   %ax,%ax
+    s++;
+     780:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+     783:	39 de                	cmp    %ebx,%esi
+     785:	74 18                	je     79f <peek+0x3f>
+     787:	0f be 03             	movsbl (%ebx),%eax
+     78a:	83 ec 08             	sub    $0x8,%esp
+     78d:	50                   	push   %eax
+     78e:	68 08 20 00 00       	push   $0x2008
+     793:	e8 48 08 00 00       	call   fe0 <strchr>
+     798:	83 c4 10             	add    $0x10,%esp
+     79b:	85 c0                	test   %eax,%eax
+     79d:	75 e1                	jne    780 <peek+0x20>
+  *ps = s;
+     79f:	89 1f                	mov    %ebx,(%edi)
+  return *s && strchr(toks, *s);
+     7a1:	0f be 03             	movsbl (%ebx),%eax
+     7a4:	31 d2                	xor    %edx,%edx
+     7a6:	84 c0                	test   %al,%al
+     7a8:	75 0e                	jne    7b8 <peek+0x58>
+}
+     7aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     7ad:	89 d0                	mov    %edx,%eax
+     7af:	5b                   	pop    %ebx
+     7b0:	5e                   	pop    %esi
+     7b1:	5f                   	pop    %edi
+     7b2:	5d                   	pop    %ebp
+     7b3:	c3                   	ret
+     7b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  return *s && strchr(toks, *s);
+     7b8:	83 ec 08             	sub    $0x8,%esp
+     7bb:	50                   	push   %eax
+     7bc:	ff 75 10             	push   0x10(%ebp)
+     7bf:	e8 1c 08 00 00       	call   fe0 <strchr>
+     7c4:	83 c4 10             	add    $0x10,%esp
+     7c7:	31 d2                	xor    %edx,%edx
+     7c9:	85 c0                	test   %eax,%eax
+     7cb:	0f 95 c2             	setne  %dl
+}
+     7ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     7d1:	5b                   	pop    %ebx
+     7d2:	89 d0                	mov    %edx,%eax
+     7d4:	5e                   	pop    %esi
+     7d5:	5f                   	pop    %edi
+     7d6:	5d                   	pop    %ebp
+     7d7:	c3                   	ret
+     7d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7df:	90                   	nop
+
+000007e0 <syntax>:
+int parseerr;
+
+void
+syntax(char *s)
+{
+  if(!parseerr)
+     7e0:	a1 20 20 00 00       	mov    0x2020,%eax
+     7e5:	85 c0                	test   %eax,%eax
+     7e7:	74 0f                	je     7f8 <syntax+0x18>
+    printf(2, "%s\n", s);
+  parseerr = 1;
+     7e9:	c7 05 20 20 00 00 01 	movl   $0x1,0x2020
+     7f0:	00 00 00 
+     7f3:	c3                   	ret
+     7f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+{
+     7f8:	55                   	push   %ebp
+     7f9:	89 e5                	mov    %esp,%ebp
+     7fb:	83 ec 0c             	sub    $0xc,%esp
+    printf(2, "%s\n", s);
+     7fe:	ff 75 08             	push   0x8(%ebp)
+     801:	68 b5 16 00 00       	push   $0x16b5
+     806:	6a 02                	push   $0x2
+     808:	e8 e3 0a 00 00       	call   12f0 <printf>
+     80d:	83 c4 10             	add    $0x10,%esp
+  parseerr = 1;
+     810:	c7 05 20 20 00 00 01 	movl   $0x1,0x2020
+     817:	00 00 00 
+}
+     81a:	c9                   	leave
+     81b:	c3                   	ret
+     81c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000820 <parseredirs>:
+  return cmd;
+}
+
+struct cmd*
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+     820:	55                   	push   %ebp
+     821:	89 e5                	mov    %esp,%ebp
+     823:	57                   	push   %edi
+     824:	56                   	push   %esi
+     825:	53                   	push   %ebx
+     826:	83 ec 2c             	sub    $0x2c,%esp
+     829:	8b 75 0c             	mov    0xc(%ebp),%esi
+     82c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int tok;
+  char *q, *eq;
+
+  while(peek(ps, es, "<>")){
+     82f:	90                   	nop
+     830:	83 ec 04             	sub    $0x4,%esp
+     833:	68 69 16 00 00       	push   $0x1669
+     838:	53                   	push   %ebx
+     839:	56                   	push   %esi
+     83a:	e8 21 ff ff ff       	call   760 <peek>
+     83f:	83 c4 10             	add    $0x10,%esp
+     842:	85 c0                	test   %eax,%eax
+     844:	0f 84 09 01 00 00    	je     953 <parseredirs+0x133>
+    tok = gettoken(ps, es, 0, 0);
+     84a:	6a 00                	push   $0x0
+     84c:	6a 00                	push   $0x0
+     84e:	53                   	push   %ebx
+     84f:	56                   	push   %esi
+     850:	e8 9b fd ff ff       	call   5f0 <gettoken>
+     855:	89 c7                	mov    %eax,%edi
+    if(gettoken(ps, es, &q, &eq) != 'a'){
+     857:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     85a:	50                   	push   %eax
+     85b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     85e:	50                   	push   %eax
+     85f:	53                   	push   %ebx
+     860:	56                   	push   %esi
+     861:	e8 8a fd ff ff       	call   5f0 <gettoken>
+     866:	83 c4 20             	add    $0x20,%esp
+     869:	83 f8 61             	cmp    $0x61,%eax
+     86c:	0f 85 ce 00 00 00    	jne    940 <parseredirs+0x120>
+      syntax("missing file for redirection");
+      break;
+    }
+    switch(tok){
+     872:	83 ff 3c             	cmp    $0x3c,%edi
+     875:	74 69                	je     8e0 <parseredirs+0xc0>
+     877:	83 ff 3e             	cmp    $0x3e,%edi
+     87a:	74 05                	je     881 <parseredirs+0x61>
+     87c:	83 ff 2b             	cmp    $0x2b,%edi
+     87f:	75 af                	jne    830 <parseredirs+0x10>
+      break;
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+      break;
+    case '+':  // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     881:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     884:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     887:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     88a:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     88d:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     890:	6a 18                	push   $0x18
+     892:	e8 99 0c 00 00       	call   1530 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     897:	83 c4 0c             	add    $0xc,%esp
+     89a:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     89c:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     89e:	6a 00                	push   $0x0
+     8a0:	50                   	push   %eax
+     8a1:	e8 1a 07 00 00       	call   fc0 <memset>
+  cmd->type = REDIR;
+     8a6:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+  cmd->cmd = subcmd;
+     8ac:	8b 45 08             	mov    0x8(%ebp),%eax
+      break;
+     8af:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     8b2:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     8b5:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     8b8:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     8bb:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->mode = mode;
+     8be:	c7 47 10 01 02 00 00 	movl   $0x201,0x10(%edi)
+  cmd->efile = efile;
+     8c5:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->fd = fd;
+     8c8:	c7 47 14 01 00 00 00 	movl   $0x1,0x14(%edi)
+      break;
+     8cf:	89 7d 08             	mov    %edi,0x8(%ebp)
+     8d2:	e9 59 ff ff ff       	jmp    830 <parseredirs+0x10>
+     8d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8de:	66 90                	xchg   %ax,%ax
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     8e0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     8e3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     8e6:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     8e9:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     8ec:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     8ef:	6a 18                	push   $0x18
+     8f1:	e8 3a 0c 00 00       	call   1530 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     8f6:	83 c4 0c             	add    $0xc,%esp
+     8f9:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     8fb:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     8fd:	6a 00                	push   $0x0
+     8ff:	50                   	push   %eax
+     900:	e8 bb 06 00 00       	call   fc0 <memset>
+  cmd->cmd = subcmd;
+     905:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->file = file;
+     908:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+      break;
+     90b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  cmd->efile = efile;
+     90e:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->type = REDIR;
+     911:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+      break;
+     917:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     91a:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     91d:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     920:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->mode = mode;
+     923:	c7 47 10 00 00 00 00 	movl   $0x0,0x10(%edi)
+  cmd->fd = fd;
+     92a:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+      break;
+     931:	e9 fa fe ff ff       	jmp    830 <parseredirs+0x10>
+     936:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     93d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(!parseerr)
+     940:	a1 20 20 00 00       	mov    0x2020,%eax
+     945:	85 c0                	test   %eax,%eax
+     947:	74 15                	je     95e <parseredirs+0x13e>
+  parseerr = 1;
+     949:	c7 05 20 20 00 00 01 	movl   $0x1,0x2020
+     950:	00 00 00 
+    }
+  }
+  return cmd;
+}
+     953:	8b 45 08             	mov    0x8(%ebp),%eax
+     956:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     959:	5b                   	pop    %ebx
+     95a:	5e                   	pop    %esi
+     95b:	5f                   	pop    %edi
+     95c:	5d                   	pop    %ebp
+     95d:	c3                   	ret
+    printf(2, "%s\n", s);
+     95e:	83 ec 04             	sub    $0x4,%esp
+     961:	68 4c 16 00 00       	push   $0x164c
+     966:	68 b5 16 00 00       	push   $0x16b5
+     96b:	6a 02                	push   $0x2
+     96d:	e8 7e 09 00 00       	call   12f0 <printf>
+     972:	83 c4 10             	add    $0x10,%esp
+     975:	eb d2                	jmp    949 <parseredirs+0x129>
+     977:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     97e:	66 90                	xchg   %ax,%ax
+
+00000980 <parseexec>:
+  return cmd;
+}
+
+struct cmd*
+parseexec(char **ps, char *es)
+{
+     980:	55                   	push   %ebp
+     981:	89 e5                	mov    %esp,%ebp
+     983:	57                   	push   %edi
+     984:	56                   	push   %esi
+     985:	53                   	push   %ebx
+     986:	83 ec 30             	sub    $0x30,%esp
+     989:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     98c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+
+  if(peek(ps, es, "("))
+     98f:	68 6c 16 00 00       	push   $0x166c
+     994:	56                   	push   %esi
+     995:	53                   	push   %ebx
+     996:	e8 c5 fd ff ff       	call   760 <peek>
+     99b:	83 c4 10             	add    $0x10,%esp
+     99e:	85 c0                	test   %eax,%eax
+     9a0:	0f 85 ca 00 00 00    	jne    a70 <parseexec+0xf0>
+  cmd = malloc(sizeof(*cmd));
+     9a6:	83 ec 0c             	sub    $0xc,%esp
+     9a9:	89 c7                	mov    %eax,%edi
+     9ab:	6a 54                	push   $0x54
+     9ad:	e8 7e 0b 00 00       	call   1530 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     9b2:	83 c4 0c             	add    $0xc,%esp
+     9b5:	6a 54                	push   $0x54
+     9b7:	6a 00                	push   $0x0
+     9b9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     9bc:	50                   	push   %eax
+     9bd:	e8 fe 05 00 00       	call   fc0 <memset>
+  cmd->type = EXEC;
+     9c2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+
+  ret = execcmd();
+  cmd = (struct execcmd*)ret;
+
+  argc = 0;
+  ret = parseredirs(ret, ps, es);
+     9c5:	83 c4 0c             	add    $0xc,%esp
+  cmd->type = EXEC;
+     9c8:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  ret = parseredirs(ret, ps, es);
+     9ce:	56                   	push   %esi
+     9cf:	53                   	push   %ebx
+     9d0:	50                   	push   %eax
+     9d1:	e8 4a fe ff ff       	call   820 <parseredirs>
+  while(!peek(ps, es, "|)&;")){
+     9d6:	83 c4 10             	add    $0x10,%esp
+  ret = parseredirs(ret, ps, es);
+     9d9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     9dc:	eb 29                	jmp    a07 <parseexec+0x87>
+     9de:	66 90                	xchg   %ax,%ax
+    }
+    if(argc + 1 >= MAXARGS){
+      syntax("too many args");
+      break;
+    }
+    cmd->argv[argc] = q;
+     9e0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     9e3:	8b 55 d0             	mov    -0x30(%ebp),%edx
+    cmd->eargv[argc] = eq;
+    argc++;
+    ret = parseredirs(ret, ps, es);
+     9e6:	83 ec 04             	sub    $0x4,%esp
+    cmd->argv[argc] = q;
+     9e9:	89 44 ba 04          	mov    %eax,0x4(%edx,%edi,4)
+    cmd->eargv[argc] = eq;
+     9ed:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     9f0:	89 44 ba 2c          	mov    %eax,0x2c(%edx,%edi,4)
+    argc++;
+     9f4:	83 c7 01             	add    $0x1,%edi
+    ret = parseredirs(ret, ps, es);
+     9f7:	56                   	push   %esi
+     9f8:	53                   	push   %ebx
+     9f9:	ff 75 d4             	push   -0x2c(%ebp)
+     9fc:	e8 1f fe ff ff       	call   820 <parseredirs>
+     a01:	83 c4 10             	add    $0x10,%esp
+     a04:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     a07:	83 ec 04             	sub    $0x4,%esp
+     a0a:	68 83 16 00 00       	push   $0x1683
+     a0f:	56                   	push   %esi
+     a10:	53                   	push   %ebx
+     a11:	e8 4a fd ff ff       	call   760 <peek>
+     a16:	83 c4 10             	add    $0x10,%esp
+     a19:	85 c0                	test   %eax,%eax
+     a1b:	75 33                	jne    a50 <parseexec+0xd0>
+    if((tok=gettoken(ps, es, &q, &eq)) == 0)
+     a1d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     a20:	50                   	push   %eax
+     a21:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     a24:	50                   	push   %eax
+     a25:	56                   	push   %esi
+     a26:	53                   	push   %ebx
+     a27:	e8 c4 fb ff ff       	call   5f0 <gettoken>
+     a2c:	83 c4 10             	add    $0x10,%esp
+     a2f:	85 c0                	test   %eax,%eax
+     a31:	74 1d                	je     a50 <parseexec+0xd0>
+    if(tok != 'a'){
+     a33:	83 f8 61             	cmp    $0x61,%eax
+     a36:	75 70                	jne    aa8 <parseexec+0x128>
+    if(argc + 1 >= MAXARGS){
+     a38:	83 ff 09             	cmp    $0x9,%edi
+     a3b:	75 a3                	jne    9e0 <parseexec+0x60>
+  if(!parseerr)
+     a3d:	a1 20 20 00 00       	mov    0x2020,%eax
+     a42:	85 c0                	test   %eax,%eax
+     a44:	74 42                	je     a88 <parseexec+0x108>
+  parseerr = 1;
+     a46:	c7 05 20 20 00 00 01 	movl   $0x1,0x2020
+     a4d:	00 00 00 
+  }
+  cmd->argv[argc] = 0;
+     a50:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     a53:	c7 44 b8 04 00 00 00 	movl   $0x0,0x4(%eax,%edi,4)
+     a5a:	00 
+  cmd->eargv[argc] = 0;
+     a5b:	c7 44 b8 2c 00 00 00 	movl   $0x0,0x2c(%eax,%edi,4)
+     a62:	00 
+  return ret;
+}
+     a63:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     a66:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a69:	5b                   	pop    %ebx
+     a6a:	5e                   	pop    %esi
+     a6b:	5f                   	pop    %edi
+     a6c:	5d                   	pop    %ebp
+     a6d:	c3                   	ret
+     a6e:	66 90                	xchg   %ax,%ax
+    return parseblock(ps, es);
+     a70:	89 75 0c             	mov    %esi,0xc(%ebp)
+     a73:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     a76:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a79:	5b                   	pop    %ebx
+     a7a:	5e                   	pop    %esi
+     a7b:	5f                   	pop    %edi
+     a7c:	5d                   	pop    %ebp
+    return parseblock(ps, es);
+     a7d:	e9 be 01 00 00       	jmp    c40 <parseblock>
+     a82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    printf(2, "%s\n", s);
+     a88:	83 ec 04             	sub    $0x4,%esp
+     a8b:	68 75 16 00 00       	push   $0x1675
+     a90:	68 b5 16 00 00       	push   $0x16b5
+     a95:	6a 02                	push   $0x2
+     a97:	e8 54 08 00 00       	call   12f0 <printf>
+     a9c:	83 c4 10             	add    $0x10,%esp
+     a9f:	eb a5                	jmp    a46 <parseexec+0xc6>
+     aa1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(!parseerr)
+     aa8:	8b 15 20 20 00 00    	mov    0x2020,%edx
+     aae:	85 d2                	test   %edx,%edx
+     ab0:	75 94                	jne    a46 <parseexec+0xc6>
+    printf(2, "%s\n", s);
+     ab2:	83 ec 04             	sub    $0x4,%esp
+     ab5:	68 6e 16 00 00       	push   $0x166e
+     aba:	68 b5 16 00 00       	push   $0x16b5
+     abf:	6a 02                	push   $0x2
+     ac1:	e8 2a 08 00 00       	call   12f0 <printf>
+     ac6:	83 c4 10             	add    $0x10,%esp
+  parseerr = 1;
+     ac9:	e9 78 ff ff ff       	jmp    a46 <parseexec+0xc6>
+     ace:	66 90                	xchg   %ax,%ax
+
+00000ad0 <parsepipe>:
+{
+     ad0:	55                   	push   %ebp
+     ad1:	89 e5                	mov    %esp,%ebp
+     ad3:	57                   	push   %edi
+     ad4:	56                   	push   %esi
+     ad5:	53                   	push   %ebx
+     ad6:	83 ec 14             	sub    $0x14,%esp
+     ad9:	8b 75 08             	mov    0x8(%ebp),%esi
+     adc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parseexec(ps, es);
+     adf:	57                   	push   %edi
+     ae0:	56                   	push   %esi
+     ae1:	e8 9a fe ff ff       	call   980 <parseexec>
+  if(peek(ps, es, "|")){
+     ae6:	83 c4 0c             	add    $0xc,%esp
+     ae9:	68 88 16 00 00       	push   $0x1688
+  cmd = parseexec(ps, es);
+     aee:	89 c3                	mov    %eax,%ebx
+  if(peek(ps, es, "|")){
+     af0:	57                   	push   %edi
+     af1:	56                   	push   %esi
+     af2:	e8 69 fc ff ff       	call   760 <peek>
+     af7:	83 c4 10             	add    $0x10,%esp
+     afa:	85 c0                	test   %eax,%eax
+     afc:	75 12                	jne    b10 <parsepipe+0x40>
+}
+     afe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b01:	89 d8                	mov    %ebx,%eax
+     b03:	5b                   	pop    %ebx
+     b04:	5e                   	pop    %esi
+     b05:	5f                   	pop    %edi
+     b06:	5d                   	pop    %ebp
+     b07:	c3                   	ret
+     b08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b0f:	90                   	nop
+    gettoken(ps, es, 0, 0);
+     b10:	6a 00                	push   $0x0
+     b12:	6a 00                	push   $0x0
+     b14:	57                   	push   %edi
+     b15:	56                   	push   %esi
+     b16:	e8 d5 fa ff ff       	call   5f0 <gettoken>
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     b1b:	58                   	pop    %eax
+     b1c:	5a                   	pop    %edx
+     b1d:	57                   	push   %edi
+     b1e:	56                   	push   %esi
+     b1f:	e8 ac ff ff ff       	call   ad0 <parsepipe>
+  cmd = malloc(sizeof(*cmd));
+     b24:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     b2b:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     b2d:	e8 fe 09 00 00       	call   1530 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     b32:	83 c4 0c             	add    $0xc,%esp
+     b35:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     b37:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     b39:	6a 00                	push   $0x0
+     b3b:	50                   	push   %eax
+     b3c:	e8 7f 04 00 00       	call   fc0 <memset>
+  cmd->left = left;
+     b41:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     b44:	83 c4 10             	add    $0x10,%esp
+     b47:	89 f3                	mov    %esi,%ebx
+  cmd->type = PIPE;
+     b49:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+}
+     b4f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     b51:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     b54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b57:	5b                   	pop    %ebx
+     b58:	5e                   	pop    %esi
+     b59:	5f                   	pop    %edi
+     b5a:	5d                   	pop    %ebp
+     b5b:	c3                   	ret
+     b5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b60 <parseline>:
+{
+     b60:	55                   	push   %ebp
+     b61:	89 e5                	mov    %esp,%ebp
+     b63:	57                   	push   %edi
+     b64:	56                   	push   %esi
+     b65:	53                   	push   %ebx
+     b66:	83 ec 24             	sub    $0x24,%esp
+     b69:	8b 75 08             	mov    0x8(%ebp),%esi
+     b6c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parsepipe(ps, es);
+     b6f:	57                   	push   %edi
+     b70:	56                   	push   %esi
+     b71:	e8 5a ff ff ff       	call   ad0 <parsepipe>
+  while(peek(ps, es, "&")){
+     b76:	83 c4 10             	add    $0x10,%esp
+  cmd = parsepipe(ps, es);
+     b79:	89 c3                	mov    %eax,%ebx
+  while(peek(ps, es, "&")){
+     b7b:	eb 3b                	jmp    bb8 <parseline+0x58>
+     b7d:	8d 76 00             	lea    0x0(%esi),%esi
+    gettoken(ps, es, 0, 0);
+     b80:	6a 00                	push   $0x0
+     b82:	6a 00                	push   $0x0
+     b84:	57                   	push   %edi
+     b85:	56                   	push   %esi
+     b86:	e8 65 fa ff ff       	call   5f0 <gettoken>
+  cmd = malloc(sizeof(*cmd));
+     b8b:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+     b92:	e8 99 09 00 00       	call   1530 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     b97:	83 c4 0c             	add    $0xc,%esp
+     b9a:	6a 08                	push   $0x8
+     b9c:	6a 00                	push   $0x0
+     b9e:	50                   	push   %eax
+     b9f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     ba2:	e8 19 04 00 00       	call   fc0 <memset>
+  cmd->type = BACK;
+     ba7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  cmd->cmd = subcmd;
+     baa:	83 c4 10             	add    $0x10,%esp
+  cmd->type = BACK;
+     bad:	c7 02 05 00 00 00    	movl   $0x5,(%edx)
+  cmd->cmd = subcmd;
+     bb3:	89 5a 04             	mov    %ebx,0x4(%edx)
+     bb6:	89 d3                	mov    %edx,%ebx
+  while(peek(ps, es, "&")){
+     bb8:	83 ec 04             	sub    $0x4,%esp
+     bbb:	68 8a 16 00 00       	push   $0x168a
+     bc0:	57                   	push   %edi
+     bc1:	56                   	push   %esi
+     bc2:	e8 99 fb ff ff       	call   760 <peek>
+     bc7:	83 c4 10             	add    $0x10,%esp
+     bca:	85 c0                	test   %eax,%eax
+     bcc:	75 b2                	jne    b80 <parseline+0x20>
+  if(peek(ps, es, ";")){
+     bce:	83 ec 04             	sub    $0x4,%esp
+     bd1:	68 86 16 00 00       	push   $0x1686
+     bd6:	57                   	push   %edi
+     bd7:	56                   	push   %esi
+     bd8:	e8 83 fb ff ff       	call   760 <peek>
+     bdd:	83 c4 10             	add    $0x10,%esp
+     be0:	85 c0                	test   %eax,%eax
+     be2:	75 0c                	jne    bf0 <parseline+0x90>
+}
+     be4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     be7:	89 d8                	mov    %ebx,%eax
+     be9:	5b                   	pop    %ebx
+     bea:	5e                   	pop    %esi
+     beb:	5f                   	pop    %edi
+     bec:	5d                   	pop    %ebp
+     bed:	c3                   	ret
+     bee:	66 90                	xchg   %ax,%ax
+    gettoken(ps, es, 0, 0);
+     bf0:	6a 00                	push   $0x0
+     bf2:	6a 00                	push   $0x0
+     bf4:	57                   	push   %edi
+     bf5:	56                   	push   %esi
+     bf6:	e8 f5 f9 ff ff       	call   5f0 <gettoken>
+    cmd = listcmd(cmd, parseline(ps, es));
+     bfb:	58                   	pop    %eax
+     bfc:	5a                   	pop    %edx
+     bfd:	57                   	push   %edi
+     bfe:	56                   	push   %esi
+     bff:	e8 5c ff ff ff       	call   b60 <parseline>
+  cmd = malloc(sizeof(*cmd));
+     c04:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = listcmd(cmd, parseline(ps, es));
+     c0b:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     c0d:	e8 1e 09 00 00       	call   1530 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     c12:	83 c4 0c             	add    $0xc,%esp
+     c15:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     c17:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     c19:	6a 00                	push   $0x0
+     c1b:	50                   	push   %eax
+     c1c:	e8 9f 03 00 00       	call   fc0 <memset>
+  cmd->left = left;
+     c21:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     c24:	83 c4 10             	add    $0x10,%esp
+     c27:	89 f3                	mov    %esi,%ebx
+  cmd->type = LIST;
+     c29:	c7 06 04 00 00 00    	movl   $0x4,(%esi)
+}
+     c2f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     c31:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     c34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c37:	5b                   	pop    %ebx
+     c38:	5e                   	pop    %esi
+     c39:	5f                   	pop    %edi
+     c3a:	5d                   	pop    %ebp
+     c3b:	c3                   	ret
+     c3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c40 <parseblock>:
+{
+     c40:	55                   	push   %ebp
+     c41:	89 e5                	mov    %esp,%ebp
+     c43:	57                   	push   %edi
+     c44:	56                   	push   %esi
+     c45:	53                   	push   %ebx
+     c46:	83 ec 10             	sub    $0x10,%esp
+     c49:	8b 75 08             	mov    0x8(%ebp),%esi
+     c4c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(!peek(ps, es, "("))
+     c4f:	68 6c 16 00 00       	push   $0x166c
+     c54:	57                   	push   %edi
+     c55:	56                   	push   %esi
+     c56:	e8 05 fb ff ff       	call   760 <peek>
+     c5b:	83 c4 10             	add    $0x10,%esp
+     c5e:	85 c0                	test   %eax,%eax
+     c60:	0f 84 93 00 00 00    	je     cf9 <parseblock+0xb9>
+  gettoken(ps, es, 0, 0);
+     c66:	6a 00                	push   $0x0
+     c68:	6a 00                	push   $0x0
+     c6a:	57                   	push   %edi
+     c6b:	56                   	push   %esi
+     c6c:	e8 7f f9 ff ff       	call   5f0 <gettoken>
+  cmd = parseline(ps, es);
+     c71:	5a                   	pop    %edx
+     c72:	59                   	pop    %ecx
+     c73:	57                   	push   %edi
+     c74:	56                   	push   %esi
+     c75:	e8 e6 fe ff ff       	call   b60 <parseline>
+  if(!peek(ps, es, ")")){
+     c7a:	83 c4 0c             	add    $0xc,%esp
+     c7d:	68 a8 16 00 00       	push   $0x16a8
+  cmd = parseline(ps, es);
+     c82:	89 c3                	mov    %eax,%ebx
+  if(!peek(ps, es, ")")){
+     c84:	57                   	push   %edi
+     c85:	56                   	push   %esi
+     c86:	e8 d5 fa ff ff       	call   760 <peek>
+     c8b:	83 c4 10             	add    $0x10,%esp
+     c8e:	85 c0                	test   %eax,%eax
+     c90:	74 2e                	je     cc0 <parseblock+0x80>
+  gettoken(ps, es, 0, 0);
+     c92:	6a 00                	push   $0x0
+     c94:	6a 00                	push   $0x0
+     c96:	57                   	push   %edi
+     c97:	56                   	push   %esi
+     c98:	e8 53 f9 ff ff       	call   5f0 <gettoken>
+  cmd = parseredirs(cmd, ps, es);
+     c9d:	83 c4 0c             	add    $0xc,%esp
+     ca0:	57                   	push   %edi
+     ca1:	56                   	push   %esi
+     ca2:	53                   	push   %ebx
+     ca3:	e8 78 fb ff ff       	call   820 <parseredirs>
+  return cmd;
+     ca8:	83 c4 10             	add    $0x10,%esp
+}
+     cab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  cmd = parseredirs(cmd, ps, es);
+     cae:	89 c3                	mov    %eax,%ebx
+}
+     cb0:	89 d8                	mov    %ebx,%eax
+     cb2:	5b                   	pop    %ebx
+     cb3:	5e                   	pop    %esi
+     cb4:	5f                   	pop    %edi
+     cb5:	5d                   	pop    %ebp
+     cb6:	c3                   	ret
+     cb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cbe:	66 90                	xchg   %ax,%ax
+  if(!parseerr)
+     cc0:	a1 20 20 00 00       	mov    0x2020,%eax
+     cc5:	85 c0                	test   %eax,%eax
+     cc7:	74 17                	je     ce0 <parseblock+0xa0>
+  parseerr = 1;
+     cc9:	c7 05 20 20 00 00 01 	movl   $0x1,0x2020
+     cd0:	00 00 00 
+}
+     cd3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cd6:	89 d8                	mov    %ebx,%eax
+     cd8:	5b                   	pop    %ebx
+     cd9:	5e                   	pop    %esi
+     cda:	5f                   	pop    %edi
+     cdb:	5d                   	pop    %ebp
+     cdc:	c3                   	ret
+     cdd:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(2, "%s\n", s);
+     ce0:	83 ec 04             	sub    $0x4,%esp
+     ce3:	68 97 16 00 00       	push   $0x1697
+     ce8:	68 b5 16 00 00       	push   $0x16b5
+     ced:	6a 02                	push   $0x2
+     cef:	e8 fc 05 00 00       	call   12f0 <printf>
+     cf4:	83 c4 10             	add    $0x10,%esp
+     cf7:	eb d0                	jmp    cc9 <parseblock+0x89>
+    panic("parseblock");
+     cf9:	83 ec 0c             	sub    $0xc,%esp
+     cfc:	68 8c 16 00 00       	push   $0x168c
+     d01:	e8 ea f5 ff ff       	call   2f0 <panic>
+     d06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d0d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d10 <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd*
+nulterminate(struct cmd *cmd)
+{
+     d10:	55                   	push   %ebp
+     d11:	89 e5                	mov    %esp,%ebp
+     d13:	53                   	push   %ebx
+     d14:	83 ec 04             	sub    $0x4,%esp
+     d17:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+     d1a:	85 db                	test   %ebx,%ebx
+     d1c:	0f 84 7e 00 00 00    	je     da0 <nulterminate+0x90>
+    return 0;
+
+  switch(cmd->type){
+     d22:	83 3b 05             	cmpl   $0x5,(%ebx)
+     d25:	77 20                	ja     d47 <nulterminate+0x37>
+     d27:	8b 03                	mov    (%ebx),%eax
+     d29:	ff 24 85 e8 16 00 00 	jmp    *0x16e8(,%eax,4)
+    nulterminate(pcmd->right);
+    break;
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+    nulterminate(lcmd->left);
+     d30:	83 ec 0c             	sub    $0xc,%esp
+     d33:	ff 73 04             	push   0x4(%ebx)
+     d36:	e8 d5 ff ff ff       	call   d10 <nulterminate>
+    nulterminate(lcmd->right);
+     d3b:	58                   	pop    %eax
+     d3c:	ff 73 08             	push   0x8(%ebx)
+     d3f:	e8 cc ff ff ff       	call   d10 <nulterminate>
+    break;
+     d44:	83 c4 10             	add    $0x10,%esp
+    return 0;
+     d47:	89 d8                	mov    %ebx,%eax
+    bcmd = (struct backcmd*)cmd;
+    nulterminate(bcmd->cmd);
+    break;
+  }
+  return cmd;
+}
+     d49:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     d4c:	c9                   	leave
+     d4d:	c3                   	ret
+     d4e:	66 90                	xchg   %ax,%ax
+    nulterminate(bcmd->cmd);
+     d50:	83 ec 0c             	sub    $0xc,%esp
+     d53:	ff 73 04             	push   0x4(%ebx)
+     d56:	e8 b5 ff ff ff       	call   d10 <nulterminate>
+    break;
+     d5b:	83 c4 10             	add    $0x10,%esp
+     d5e:	eb e7                	jmp    d47 <nulterminate+0x37>
+    for(i=0; ecmd->argv[i]; i++)
+     d60:	8b 4b 04             	mov    0x4(%ebx),%ecx
+     d63:	8d 43 08             	lea    0x8(%ebx),%eax
+     d66:	85 c9                	test   %ecx,%ecx
+     d68:	74 dd                	je     d47 <nulterminate+0x37>
+     d6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      *ecmd->eargv[i] = 0;
+     d70:	8b 50 24             	mov    0x24(%eax),%edx
+    for(i=0; ecmd->argv[i]; i++)
+     d73:	83 c0 04             	add    $0x4,%eax
+      *ecmd->eargv[i] = 0;
+     d76:	c6 02 00             	movb   $0x0,(%edx)
+    for(i=0; ecmd->argv[i]; i++)
+     d79:	8b 50 fc             	mov    -0x4(%eax),%edx
+     d7c:	85 d2                	test   %edx,%edx
+     d7e:	75 f0                	jne    d70 <nulterminate+0x60>
+     d80:	eb c5                	jmp    d47 <nulterminate+0x37>
+     d82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    nulterminate(rcmd->cmd);
+     d88:	83 ec 0c             	sub    $0xc,%esp
+     d8b:	ff 73 04             	push   0x4(%ebx)
+     d8e:	e8 7d ff ff ff       	call   d10 <nulterminate>
+    *rcmd->efile = 0;
+     d93:	8b 43 0c             	mov    0xc(%ebx),%eax
+    break;
+     d96:	83 c4 10             	add    $0x10,%esp
+    *rcmd->efile = 0;
+     d99:	c6 00 00             	movb   $0x0,(%eax)
+    break;
+     d9c:	eb a9                	jmp    d47 <nulterminate+0x37>
+     d9e:	66 90                	xchg   %ax,%ax
+    return 0;
+     da0:	31 c0                	xor    %eax,%eax
+     da2:	eb a5                	jmp    d49 <nulterminate+0x39>
+     da4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     daf:	90                   	nop
+
+00000db0 <freecmd>:
+
+// Free the memory of a parsed command.
+void
+freecmd(struct cmd *cmd)
+{
+     db0:	55                   	push   %ebp
+     db1:	89 e5                	mov    %esp,%ebp
+     db3:	53                   	push   %ebx
+     db4:	83 ec 04             	sub    $0x4,%esp
+     db7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct backcmd *bcmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+     dba:	85 db                	test   %ebx,%ebx
+     dbc:	74 62                	je     e20 <freecmd+0x70>
+    return;
+
+  switch(cmd->type){
+     dbe:	8b 03                	mov    (%ebx),%eax
+     dc0:	83 f8 04             	cmp    $0x4,%eax
+     dc3:	74 0c                	je     dd1 <freecmd+0x21>
+     dc5:	7f 31                	jg     df8 <freecmd+0x48>
+     dc7:	83 f8 02             	cmp    $0x2,%eax
+     dca:	74 31                	je     dfd <freecmd+0x4d>
+     dcc:	83 f8 03             	cmp    $0x3,%eax
+     dcf:	75 17                	jne    de8 <freecmd+0x38>
+    freecmd(pcmd->right);
+    break;
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+    freecmd(lcmd->left);
+     dd1:	83 ec 0c             	sub    $0xc,%esp
+     dd4:	ff 73 04             	push   0x4(%ebx)
+     dd7:	e8 d4 ff ff ff       	call   db0 <freecmd>
+    freecmd(lcmd->right);
+     ddc:	58                   	pop    %eax
+     ddd:	ff 73 08             	push   0x8(%ebx)
+     de0:	e8 cb ff ff ff       	call   db0 <freecmd>
+    break;
+     de5:	83 c4 10             	add    $0x10,%esp
+  case BACK:
+    bcmd = (struct backcmd*)cmd;
+    freecmd(bcmd->cmd);
+    break;
+  }
+  free(cmd);
+     de8:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     deb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     dee:	c9                   	leave
+  free(cmd);
+     def:	e9 ac 06 00 00       	jmp    14a0 <free>
+     df4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  switch(cmd->type){
+     df8:	83 f8 05             	cmp    $0x5,%eax
+     dfb:	75 eb                	jne    de8 <freecmd+0x38>
+    freecmd(bcmd->cmd);
+     dfd:	83 ec 0c             	sub    $0xc,%esp
+     e00:	ff 73 04             	push   0x4(%ebx)
+     e03:	e8 a8 ff ff ff       	call   db0 <freecmd>
+  free(cmd);
+     e08:	89 5d 08             	mov    %ebx,0x8(%ebp)
+    break;
+     e0b:	83 c4 10             	add    $0x10,%esp
+}
+     e0e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e11:	c9                   	leave
+  free(cmd);
+     e12:	e9 89 06 00 00       	jmp    14a0 <free>
+     e17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e1e:	66 90                	xchg   %ax,%ax
+}
+     e20:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e23:	c9                   	leave
+     e24:	c3                   	ret
+     e25:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000e30 <parsecmd>:
+{
+     e30:	55                   	push   %ebp
+     e31:	89 e5                	mov    %esp,%ebp
+     e33:	57                   	push   %edi
+     e34:	56                   	push   %esi
+     e35:	53                   	push   %ebx
+     e36:	83 ec 18             	sub    $0x18,%esp
+  es = s + strlen(s);
+     e39:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  parseerr = 0;
+     e3c:	c7 05 20 20 00 00 00 	movl   $0x0,0x2020
+     e43:	00 00 00 
+  es = s + strlen(s);
+     e46:	53                   	push   %ebx
+     e47:	e8 44 01 00 00       	call   f90 <strlen>
+  cmd = parseline(&s, es);
+     e4c:	5e                   	pop    %esi
+     e4d:	5f                   	pop    %edi
+     e4e:	8d 7d 08             	lea    0x8(%ebp),%edi
+  es = s + strlen(s);
+     e51:	01 c3                	add    %eax,%ebx
+  cmd = parseline(&s, es);
+     e53:	53                   	push   %ebx
+     e54:	57                   	push   %edi
+     e55:	e8 06 fd ff ff       	call   b60 <parseline>
+  peek(&s, es, "");
+     e5a:	83 c4 0c             	add    $0xc,%esp
+     e5d:	68 37 16 00 00       	push   $0x1637
+  cmd = parseline(&s, es);
+     e62:	89 c6                	mov    %eax,%esi
+  peek(&s, es, "");
+     e64:	53                   	push   %ebx
+     e65:	57                   	push   %edi
+     e66:	e8 f5 f8 ff ff       	call   760 <peek>
+  if(s != es && !parseerr){
+     e6b:	8b 45 08             	mov    0x8(%ebp),%eax
+     e6e:	83 c4 10             	add    $0x10,%esp
+     e71:	39 d8                	cmp    %ebx,%eax
+     e73:	74 4b                	je     ec0 <parsecmd+0x90>
+     e75:	8b 0d 20 20 00 00    	mov    0x2020,%ecx
+     e7b:	85 c9                	test   %ecx,%ecx
+     e7d:	75 27                	jne    ea6 <parsecmd+0x76>
+    printf(2, "leftovers: %s\n", s);
+     e7f:	83 ec 04             	sub    $0x4,%esp
+     e82:	50                   	push   %eax
+     e83:	68 aa 16 00 00       	push   $0x16aa
+     e88:	6a 02                	push   $0x2
+     e8a:	e8 61 04 00 00       	call   12f0 <printf>
+  if(!parseerr)
+     e8f:	8b 15 20 20 00 00    	mov    0x2020,%edx
+     e95:	83 c4 10             	add    $0x10,%esp
+     e98:	85 d2                	test   %edx,%edx
+     e9a:	74 44                	je     ee0 <parsecmd+0xb0>
+  parseerr = 1;
+     e9c:	c7 05 20 20 00 00 01 	movl   $0x1,0x2020
+     ea3:	00 00 00 
+    freecmd(cmd);
+     ea6:	83 ec 0c             	sub    $0xc,%esp
+     ea9:	56                   	push   %esi
+    return 0;
+     eaa:	31 f6                	xor    %esi,%esi
+    freecmd(cmd);
+     eac:	e8 ff fe ff ff       	call   db0 <freecmd>
+    return 0;
+     eb1:	83 c4 10             	add    $0x10,%esp
+}
+     eb4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     eb7:	89 f0                	mov    %esi,%eax
+     eb9:	5b                   	pop    %ebx
+     eba:	5e                   	pop    %esi
+     ebb:	5f                   	pop    %edi
+     ebc:	5d                   	pop    %ebp
+     ebd:	c3                   	ret
+     ebe:	66 90                	xchg   %ax,%ax
+  if(parseerr){
+     ec0:	a1 20 20 00 00       	mov    0x2020,%eax
+     ec5:	85 c0                	test   %eax,%eax
+     ec7:	75 dd                	jne    ea6 <parsecmd+0x76>
+  nulterminate(cmd);
+     ec9:	83 ec 0c             	sub    $0xc,%esp
+     ecc:	56                   	push   %esi
+     ecd:	e8 3e fe ff ff       	call   d10 <nulterminate>
+  return cmd;
+     ed2:	83 c4 10             	add    $0x10,%esp
+}
+     ed5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ed8:	89 f0                	mov    %esi,%eax
+     eda:	5b                   	pop    %ebx
+     edb:	5e                   	pop    %esi
+     edc:	5f                   	pop    %edi
+     edd:	5d                   	pop    %ebp
+     ede:	c3                   	ret
+     edf:	90                   	nop
+    printf(2, "%s\n", s);
+     ee0:	83 ec 04             	sub    $0x4,%esp
+     ee3:	68 6e 16 00 00       	push   $0x166e
+     ee8:	68 b5 16 00 00       	push   $0x16b5
+     eed:	6a 02                	push   $0x2
+     eef:	e8 fc 03 00 00       	call   12f0 <printf>
+     ef4:	83 c4 10             	add    $0x10,%esp
+     ef7:	eb a3                	jmp    e9c <parsecmd+0x6c>
+     ef9:	66 90                	xchg   %ax,%ax
+     efb:	66 90                	xchg   %ax,%ax
+     efd:	66 90                	xchg   %ax,%ax
+     eff:	90                   	nop
+
+00000f00 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     f00:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     f01:	31 c0                	xor    %eax,%eax
+{
+     f03:	89 e5                	mov    %esp,%ebp
+     f05:	53                   	push   %ebx
+     f06:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     f09:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     f0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     f10:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     f14:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     f17:	83 c0 01             	add    $0x1,%eax
+     f1a:	84 d2                	test   %dl,%dl
+     f1c:	75 f2                	jne    f10 <strcpy+0x10>
+    ;
+  return os;
+}
+     f1e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f21:	89 c8                	mov    %ecx,%eax
+     f23:	c9                   	leave
+     f24:	c3                   	ret
+     f25:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000f30 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     f30:	55                   	push   %ebp
+     f31:	89 e5                	mov    %esp,%ebp
+     f33:	53                   	push   %ebx
+     f34:	8b 55 08             	mov    0x8(%ebp),%edx
+     f37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     f3a:	0f b6 02             	movzbl (%edx),%eax
+     f3d:	84 c0                	test   %al,%al
+     f3f:	75 17                	jne    f58 <strcmp+0x28>
+     f41:	eb 3a                	jmp    f7d <strcmp+0x4d>
+     f43:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f47:	90                   	nop
+     f48:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     f4c:	83 c2 01             	add    $0x1,%edx
+     f4f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     f52:	84 c0                	test   %al,%al
+     f54:	74 1a                	je     f70 <strcmp+0x40>
+    p++, q++;
+     f56:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     f58:	0f b6 19             	movzbl (%ecx),%ebx
+     f5b:	38 c3                	cmp    %al,%bl
+     f5d:	74 e9                	je     f48 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     f5f:	29 d8                	sub    %ebx,%eax
+}
+     f61:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f64:	c9                   	leave
+     f65:	c3                   	ret
+     f66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f6d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     f70:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     f74:	31 c0                	xor    %eax,%eax
+     f76:	29 d8                	sub    %ebx,%eax
+}
+     f78:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f7b:	c9                   	leave
+     f7c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     f7d:	0f b6 19             	movzbl (%ecx),%ebx
+     f80:	31 c0                	xor    %eax,%eax
+     f82:	eb db                	jmp    f5f <strcmp+0x2f>
+     f84:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f8f:	90                   	nop
+
+00000f90 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     f90:	55                   	push   %ebp
+     f91:	89 e5                	mov    %esp,%ebp
+     f93:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     f96:	80 3a 00             	cmpb   $0x0,(%edx)
+     f99:	74 15                	je     fb0 <strlen+0x20>
+     f9b:	31 c0                	xor    %eax,%eax
+     f9d:	8d 76 00             	lea    0x0(%esi),%esi
+     fa0:	83 c0 01             	add    $0x1,%eax
+     fa3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     fa7:	89 c1                	mov    %eax,%ecx
+     fa9:	75 f5                	jne    fa0 <strlen+0x10>
+    ;
+  return n;
+}
+     fab:	89 c8                	mov    %ecx,%eax
+     fad:	5d                   	pop    %ebp
+     fae:	c3                   	ret
+     faf:	90                   	nop
+  for(n = 0; s[n]; n++)
+     fb0:	31 c9                	xor    %ecx,%ecx
+}
+     fb2:	5d                   	pop    %ebp
+     fb3:	89 c8                	mov    %ecx,%eax
+     fb5:	c3                   	ret
+     fb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fbd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000fc0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     fc0:	55                   	push   %ebp
+     fc1:	89 e5                	mov    %esp,%ebp
+     fc3:	57                   	push   %edi
+     fc4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     fc7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     fca:	8b 45 0c             	mov    0xc(%ebp),%eax
+     fcd:	89 d7                	mov    %edx,%edi
+     fcf:	fc                   	cld
+     fd0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     fd2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     fd5:	89 d0                	mov    %edx,%eax
+     fd7:	c9                   	leave
+     fd8:	c3                   	ret
+     fd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000fe0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     fe0:	55                   	push   %ebp
+     fe1:	89 e5                	mov    %esp,%ebp
+     fe3:	8b 45 08             	mov    0x8(%ebp),%eax
+     fe6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     fea:	0f b6 10             	movzbl (%eax),%edx
+     fed:	84 d2                	test   %dl,%dl
+     fef:	75 12                	jne    1003 <strchr+0x23>
+     ff1:	eb 1d                	jmp    1010 <strchr+0x30>
+     ff3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ff7:	90                   	nop
+     ff8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     ffc:	83 c0 01             	add    $0x1,%eax
+     fff:	84 d2                	test   %dl,%dl
+    1001:	74 0d                	je     1010 <strchr+0x30>
+    if(*s == c)
+    1003:	38 d1                	cmp    %dl,%cl
+    1005:	75 f1                	jne    ff8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1007:	5d                   	pop    %ebp
+    1008:	c3                   	ret
+    1009:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1010:	31 c0                	xor    %eax,%eax
+}
+    1012:	5d                   	pop    %ebp
+    1013:	c3                   	ret
+    1014:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    101b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    101f:	90                   	nop
+
+00001020 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1020:	55                   	push   %ebp
+    1021:	89 e5                	mov    %esp,%ebp
+    1023:	57                   	push   %edi
+    1024:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1025:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    1028:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    1029:	31 db                	xor    %ebx,%ebx
+{
+    102b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    102e:	eb 27                	jmp    1057 <gets+0x37>
+    cc = read(0, &c, 1);
+    1030:	83 ec 04             	sub    $0x4,%esp
+    1033:	6a 01                	push   $0x1
+    1035:	56                   	push   %esi
+    1036:	6a 00                	push   $0x0
+    1038:	e8 1e 01 00 00       	call   115b <read>
+    if(cc < 1)
+    103d:	83 c4 10             	add    $0x10,%esp
+    1040:	85 c0                	test   %eax,%eax
+    1042:	7e 1d                	jle    1061 <gets+0x41>
+      break;
+    buf[i++] = c;
+    1044:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1048:	8b 55 08             	mov    0x8(%ebp),%edx
+    104b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    104f:	3c 0a                	cmp    $0xa,%al
+    1051:	74 10                	je     1063 <gets+0x43>
+    1053:	3c 0d                	cmp    $0xd,%al
+    1055:	74 0c                	je     1063 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1057:	89 df                	mov    %ebx,%edi
+    1059:	83 c3 01             	add    $0x1,%ebx
+    105c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    105f:	7c cf                	jl     1030 <gets+0x10>
+    1061:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1063:	8b 45 08             	mov    0x8(%ebp),%eax
+    1066:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    106a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    106d:	5b                   	pop    %ebx
+    106e:	5e                   	pop    %esi
+    106f:	5f                   	pop    %edi
+    1070:	5d                   	pop    %ebp
+    1071:	c3                   	ret
+    1072:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1079:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001080 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    1080:	55                   	push   %ebp
+    1081:	89 e5                	mov    %esp,%ebp
+    1083:	56                   	push   %esi
+    1084:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1085:	83 ec 08             	sub    $0x8,%esp
+    1088:	6a 00                	push   $0x0
+    108a:	ff 75 08             	push   0x8(%ebp)
+    108d:	e8 f1 00 00 00       	call   1183 <open>
+  if(fd < 0)
+    1092:	83 c4 10             	add    $0x10,%esp
+    1095:	85 c0                	test   %eax,%eax
+    1097:	78 27                	js     10c0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    1099:	83 ec 08             	sub    $0x8,%esp
+    109c:	ff 75 0c             	push   0xc(%ebp)
+    109f:	89 c3                	mov    %eax,%ebx
+    10a1:	50                   	push   %eax
+    10a2:	e8 f4 00 00 00       	call   119b <fstat>
+  close(fd);
+    10a7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    10aa:	89 c6                	mov    %eax,%esi
+  close(fd);
+    10ac:	e8 ba 00 00 00       	call   116b <close>
+  return r;
+    10b1:	83 c4 10             	add    $0x10,%esp
+}
+    10b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    10b7:	89 f0                	mov    %esi,%eax
+    10b9:	5b                   	pop    %ebx
+    10ba:	5e                   	pop    %esi
+    10bb:	5d                   	pop    %ebp
+    10bc:	c3                   	ret
+    10bd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    10c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    10c5:	eb ed                	jmp    10b4 <stat+0x34>
+    10c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10ce:	66 90                	xchg   %ax,%ax
+
+000010d0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    10d0:	55                   	push   %ebp
+    10d1:	89 e5                	mov    %esp,%ebp
+    10d3:	53                   	push   %ebx
+    10d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    10d7:	0f be 02             	movsbl (%edx),%eax
+    10da:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    10dd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    10e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    10e5:	77 1e                	ja     1105 <atoi+0x35>
+    10e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10ee:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    10f0:	83 c2 01             	add    $0x1,%edx
+    10f3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    10f6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    10fa:	0f be 02             	movsbl (%edx),%eax
+    10fd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1100:	80 fb 09             	cmp    $0x9,%bl
+    1103:	76 eb                	jbe    10f0 <atoi+0x20>
+  return n;
+}
+    1105:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1108:	89 c8                	mov    %ecx,%eax
+    110a:	c9                   	leave
+    110b:	c3                   	ret
+    110c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001110 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1110:	55                   	push   %ebp
+    1111:	89 e5                	mov    %esp,%ebp
+    1113:	57                   	push   %edi
+    1114:	56                   	push   %esi
+    1115:	8b 45 10             	mov    0x10(%ebp),%eax
+    1118:	8b 55 08             	mov    0x8(%ebp),%edx
+    111b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    111e:	85 c0                	test   %eax,%eax
+    1120:	7e 13                	jle    1135 <memmove+0x25>
+    1122:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1124:	89 d7                	mov    %edx,%edi
+    1126:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    112d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1130:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1131:	39 f8                	cmp    %edi,%eax
+    1133:	75 fb                	jne    1130 <memmove+0x20>
+  return vdst;
+}
+    1135:	5e                   	pop    %esi
+    1136:	89 d0                	mov    %edx,%eax
+    1138:	5f                   	pop    %edi
+    1139:	5d                   	pop    %ebp
+    113a:	c3                   	ret
+
+0000113b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    113b:	b8 01 00 00 00       	mov    $0x1,%eax
+    1140:	cd 40                	int    $0x40
+    1142:	c3                   	ret
+
+00001143 <exit>:
+SYSCALL(exit)
+    1143:	b8 02 00 00 00       	mov    $0x2,%eax
+    1148:	cd 40                	int    $0x40
+    114a:	c3                   	ret
+
+0000114b <wait>:
+SYSCALL(wait)
+    114b:	b8 03 00 00 00       	mov    $0x3,%eax
+    1150:	cd 40                	int    $0x40
+    1152:	c3                   	ret
+
+00001153 <pipe>:
+SYSCALL(pipe)
+    1153:	b8 04 00 00 00       	mov    $0x4,%eax
+    1158:	cd 40                	int    $0x40
+    115a:	c3                   	ret
+
+0000115b <read>:
+SYSCALL(read)
+    115b:	b8 05 00 00 00       	mov    $0x5,%eax
+    1160:	cd 40                	int    $0x40
+    1162:	c3                   	ret
+
+00001163 <write>:
+SYSCALL(write)
+    1163:	b8 10 00 00 00       	mov    $0x10,%eax
+    1168:	cd 40                	int    $0x40
+    116a:	c3                   	ret
+
+0000116b <close>:
+SYSCALL(close)
+    116b:	b8 15 00 00 00       	mov    $0x15,%eax
+    1170:	cd 40                	int    $0x40
+    1172:	c3                   	ret
+
+00001173 <kill>:
+SYSCALL(kill)
+    1173:	b8 06 00 00 00       	mov    $0x6,%eax
+    1178:	cd 40                	int    $0x40
+    117a:	c3                   	ret
+
+0000117b <exec>:
+SYSCALL(exec)
+    117b:	b8 07 00 00 00       	mov    $0x7,%eax
+    1180:	cd 40                	int    $0x40
+    1182:	c3                   	ret
+
+00001183 <open>:
+SYSCALL(open)
+    1183:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1188:	cd 40                	int    $0x40
+    118a:	c3                   	ret
+
+0000118b <mknod>:
+SYSCALL(mknod)
+    118b:	b8 11 00 00 00       	mov    $0x11,%eax
+    1190:	cd 40                	int    $0x40
+    1192:	c3                   	ret
+
+00001193 <unlink>:
+SYSCALL(unlink)
+    1193:	b8 12 00 00 00       	mov    $0x12,%eax
+    1198:	cd 40                	int    $0x40
+    119a:	c3                   	ret
+
+0000119b <fstat>:
+SYSCALL(fstat)
+    119b:	b8 08 00 00 00       	mov    $0x8,%eax
+    11a0:	cd 40                	int    $0x40
+    11a2:	c3                   	ret
+
+000011a3 <link>:
+SYSCALL(link)
+    11a3:	b8 13 00 00 00       	mov    $0x13,%eax
+    11a8:	cd 40                	int    $0x40
+    11aa:	c3                   	ret
+
+000011ab <mkdir>:
+SYSCALL(mkdir)
+    11ab:	b8 14 00 00 00       	mov    $0x14,%eax
+    11b0:	cd 40                	int    $0x40
+    11b2:	c3                   	ret
+
+000011b3 <chdir>:
+SYSCALL(chdir)
+    11b3:	b8 09 00 00 00       	mov    $0x9,%eax
+    11b8:	cd 40                	int    $0x40
+    11ba:	c3                   	ret
+
+000011bb <dup>:
+SYSCALL(dup)
+    11bb:	b8 0a 00 00 00       	mov    $0xa,%eax
+    11c0:	cd 40                	int    $0x40
+    11c2:	c3                   	ret
+
+000011c3 <getpid>:
+SYSCALL(getpid)
+    11c3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    11c8:	cd 40                	int    $0x40
+    11ca:	c3                   	ret
+
+000011cb <sbrk>:
+SYSCALL(sbrk)
+    11cb:	b8 0c 00 00 00       	mov    $0xc,%eax
+    11d0:	cd 40                	int    $0x40
+    11d2:	c3                   	ret
+
+000011d3 <sleep>:
+SYSCALL(sleep)
+    11d3:	b8 0d 00 00 00       	mov    $0xd,%eax
+    11d8:	cd 40                	int    $0x40
+    11da:	c3                   	ret
+
+000011db <uptime>:
+SYSCALL(uptime)
+    11db:	b8 0e 00 00 00       	mov    $0xe,%eax
+    11e0:	cd 40                	int    $0x40
+    11e2:	c3                   	ret
+
+000011e3 <memstat>:
+SYSCALL(memstat)
+    11e3:	b8 16 00 00 00       	mov    $0x16,%eax
+    11e8:	cd 40                	int    $0x40
+    11ea:	c3                   	ret
+
+000011eb <mmap>:
+SYSCALL(mmap)
+    11eb:	b8 17 00 00 00       	mov    $0x17,%eax
+    11f0:	cd 40                	int    $0x40
+    11f2:	c3                   	ret
+
+000011f3 <munmap>:
+SYSCALL(munmap)
+    11f3:	b8 18 00 00 00       	mov    $0x18,%eax
+    11f8:	cd 40                	int    $0x40
+    11fa:	c3                   	ret
+
+000011fb <shmget>:
+SYSCALL(shmget)
+    11fb:	b8 19 00 00 00       	mov    $0x19,%eax
+    1200:	cd 40                	int    $0x40
+    1202:	c3                   	ret
+
+00001203 <shmat>:
+SYSCALL(shmat)
+    1203:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1208:	cd 40                	int    $0x40
+    120a:	c3                   	ret
+
+0000120b <shmdt>:
+SYSCALL(shmdt)
+    120b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1210:	cd 40                	int    $0x40
+    1212:	c3                   	ret
+
+00001213 <spawn>:
+SYSCALL(spawn)
+    1213:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1218:	cd 40                	int    $0x40
+    121a:	c3                   	ret
+
+0000121b <setpriority>:
+SYSCALL(setpriority)
+    121b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1220:	cd 40                	int    $0x40
+    1222:	c3                   	ret
+
+00001223 <procinfo>:
+SYSCALL(procinfo)
+    1223:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1228:	cd 40                	int    $0x40
+    122a:	c3                   	ret
+
+0000122b <setaffinity>:
+SYSCALL(setaffinity)
+    122b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1230:	cd 40                	int    $0x40
+    1232:	c3                   	ret
+
+00001233 <getaffinity>:
+SYSCALL(getaffinity)
+    1233:	b8 20 00 00 00       	mov    $0x20,%eax
+    1238:	cd 40                	int    $0x40
+    123a:	c3                   	ret
+
+0000123b <shmrm>:
+SYSCALL(shmrm)
+    123b:	b8 21 00 00 00       	mov    $0x21,%eax
+    1240:	cd 40                	int    $0x40
+    1242:	c3                   	ret
+    1243:	66 90                	xchg   %ax,%ax
+    1245:	66 90                	xchg   %ax,%ax
+    1247:	66 90                	xchg   %ax,%ax
+    1249:	66 90                	xchg   %ax,%ax
+    124b:	66 90                	xchg   %ax,%ax
+    124d:	66 90                	xchg   %ax,%ax
+    124f:	90                   	nop
+
+00001250 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1250:	55                   	push   %ebp
+    1251:	89 e5                	mov    %esp,%ebp
+    1253:	57                   	push   %edi
+    1254:	56                   	push   %esi
+    1255:	53                   	push   %ebx
+    1256:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1258:	89 d1                	mov    %edx,%ecx
+{
+    125a:	83 ec 3c             	sub    $0x3c,%esp
+    125d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    1260:	85 d2                	test   %edx,%edx
+    1262:	0f 89 80 00 00 00    	jns    12e8 <printint+0x98>
+    1268:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    126c:	74 7a                	je     12e8 <printint+0x98>
+    x = -xx;
+    126e:	f7 d9                	neg    %ecx
+    neg = 1;
+    1270:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1275:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    1278:	31 f6                	xor    %esi,%esi
+    127a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    1280:	89 c8                	mov    %ecx,%eax
+    1282:	31 d2                	xor    %edx,%edx
+    1284:	89 f7                	mov    %esi,%edi
+    1286:	f7 f3                	div    %ebx
+    1288:	8d 76 01             	lea    0x1(%esi),%esi
+    128b:	0f b6 92 60 17 00 00 	movzbl 0x1760(%edx),%edx
+    1292:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1296:	89 ca                	mov    %ecx,%edx
+    1298:	89 c1                	mov    %eax,%ecx
+    129a:	39 da                	cmp    %ebx,%edx
+    129c:	73 e2                	jae    1280 <printint+0x30>
+  if(neg)
+    129e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    12a1:	85 c0                	test   %eax,%eax
+    12a3:	74 07                	je     12ac <printint+0x5c>
+    buf[i++] = '-';
+    12a5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    12aa:	89 f7                	mov    %esi,%edi
+    12ac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    12af:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    12b2:	01 df                	add    %ebx,%edi
+    12b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    12b8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    12bb:	83 ec 04             	sub    $0x4,%esp
+    12be:	88 45 d7             	mov    %al,-0x29(%ebp)
+    12c1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    12c4:	6a 01                	push   $0x1
+    12c6:	50                   	push   %eax
+    12c7:	56                   	push   %esi
+    12c8:	e8 96 fe ff ff       	call   1163 <write>
+  while(--i >= 0)
+    12cd:	89 f8                	mov    %edi,%eax
+    12cf:	83 c4 10             	add    $0x10,%esp
+    12d2:	83 ef 01             	sub    $0x1,%edi
+    12d5:	39 d8                	cmp    %ebx,%eax
+    12d7:	75 df                	jne    12b8 <printint+0x68>
+}
+    12d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    12dc:	5b                   	pop    %ebx
+    12dd:	5e                   	pop    %esi
+    12de:	5f                   	pop    %edi
+    12df:	5d                   	pop    %ebp
+    12e0:	c3                   	ret
+    12e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    12e8:	31 c0                	xor    %eax,%eax
+    12ea:	eb 89                	jmp    1275 <printint+0x25>
+    12ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000012f0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    12f0:	55                   	push   %ebp
+    12f1:	89 e5                	mov    %esp,%ebp
+    12f3:	57                   	push   %edi
+    12f4:	56                   	push   %esi
+    12f5:	53                   	push   %ebx
+    12f6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    12f9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    12fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    12ff:	0f b6 1e             	movzbl (%esi),%ebx
+    1302:	83 c6 01             	add    $0x1,%esi
+    1305:	84 db                	test   %bl,%bl
+    1307:	74 67                	je     1370 <printf+0x80>
+    1309:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    130c:	31 d2                	xor    %edx,%edx
+    130e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1311:	eb 34                	jmp    1347 <printf+0x57>
+    1313:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1317:	90                   	nop
+    1318:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    131b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    1320:	83 f8 25             	cmp    $0x25,%eax
+    1323:	74 18                	je     133d <printf+0x4d>
+  write(fd, &c, 1);
+    1325:	83 ec 04             	sub    $0x4,%esp
+    1328:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    132b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    132e:	6a 01                	push   $0x1
+    1330:	50                   	push   %eax
+    1331:	57                   	push   %edi
+    1332:	e8 2c fe ff ff       	call   1163 <write>
+    1337:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    133a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    133d:	0f b6 1e             	movzbl (%esi),%ebx
+    1340:	83 c6 01             	add    $0x1,%esi
+    1343:	84 db                	test   %bl,%bl
+    1345:	74 29                	je     1370 <printf+0x80>
+    c = fmt[i] & 0xff;
+    1347:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    134a:	85 d2                	test   %edx,%edx
+    134c:	74 ca                	je     1318 <printf+0x28>
+      }
+    } else if(state == '%'){
+    134e:	83 fa 25             	cmp    $0x25,%edx
+    1351:	75 ea                	jne    133d <printf+0x4d>
+      if(c == 'd'){
+    1353:	83 f8 25             	cmp    $0x25,%eax
+    1356:	0f 84 24 01 00 00    	je     1480 <printf+0x190>
+    135c:	83 e8 63             	sub    $0x63,%eax
+    135f:	83 f8 15             	cmp    $0x15,%eax
+    1362:	77 1c                	ja     1380 <printf+0x90>
+    1364:	ff 24 85 08 17 00 00 	jmp    *0x1708(,%eax,4)
+    136b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    136f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    1370:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1373:	5b                   	pop    %ebx
+    1374:	5e                   	pop    %esi
+    1375:	5f                   	pop    %edi
+    1376:	5d                   	pop    %ebp
+    1377:	c3                   	ret
+    1378:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    137f:	90                   	nop
+  write(fd, &c, 1);
+    1380:	83 ec 04             	sub    $0x4,%esp
+    1383:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1386:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    138a:	6a 01                	push   $0x1
+    138c:	52                   	push   %edx
+    138d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1390:	57                   	push   %edi
+    1391:	e8 cd fd ff ff       	call   1163 <write>
+    1396:	83 c4 0c             	add    $0xc,%esp
+    1399:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    139c:	6a 01                	push   $0x1
+    139e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    13a1:	52                   	push   %edx
+    13a2:	57                   	push   %edi
+    13a3:	e8 bb fd ff ff       	call   1163 <write>
+        putc(fd, c);
+    13a8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    13ab:	31 d2                	xor    %edx,%edx
+    13ad:	eb 8e                	jmp    133d <printf+0x4d>
+    13af:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    13b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    13b3:	83 ec 0c             	sub    $0xc,%esp
+    13b6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    13bb:	8b 13                	mov    (%ebx),%edx
+    13bd:	6a 00                	push   $0x0
+    13bf:	89 f8                	mov    %edi,%eax
+        ap++;
+    13c1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    13c4:	e8 87 fe ff ff       	call   1250 <printint>
+        ap++;
+    13c9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    13cc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    13cf:	31 d2                	xor    %edx,%edx
+    13d1:	e9 67 ff ff ff       	jmp    133d <printf+0x4d>
+    13d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13dd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    13e0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    13e3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    13e5:	83 c0 04             	add    $0x4,%eax
+    13e8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    13eb:	85 db                	test   %ebx,%ebx
+    13ed:	0f 84 9d 00 00 00    	je     1490 <printf+0x1a0>
+        while(*s != 0){
+    13f3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    13f6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    13f8:	84 c0                	test   %al,%al
+    13fa:	0f 84 3d ff ff ff    	je     133d <printf+0x4d>
+    1400:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1403:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1406:	89 de                	mov    %ebx,%esi
+    1408:	89 d3                	mov    %edx,%ebx
+    140a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1410:	83 ec 04             	sub    $0x4,%esp
+    1413:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1416:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1419:	6a 01                	push   $0x1
+    141b:	53                   	push   %ebx
+    141c:	57                   	push   %edi
+    141d:	e8 41 fd ff ff       	call   1163 <write>
+        while(*s != 0){
+    1422:	0f b6 06             	movzbl (%esi),%eax
+    1425:	83 c4 10             	add    $0x10,%esp
+    1428:	84 c0                	test   %al,%al
+    142a:	75 e4                	jne    1410 <printf+0x120>
+      state = 0;
+    142c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    142f:	31 d2                	xor    %edx,%edx
+    1431:	e9 07 ff ff ff       	jmp    133d <printf+0x4d>
+    1436:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    143d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1440:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1443:	83 ec 0c             	sub    $0xc,%esp
+    1446:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    144b:	8b 13                	mov    (%ebx),%edx
+    144d:	6a 01                	push   $0x1
+    144f:	e9 6b ff ff ff       	jmp    13bf <printf+0xcf>
+    1454:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    1458:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    145b:	83 ec 04             	sub    $0x4,%esp
+    145e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    1461:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    1463:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    1466:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1469:	6a 01                	push   $0x1
+    146b:	52                   	push   %edx
+    146c:	57                   	push   %edi
+    146d:	e8 f1 fc ff ff       	call   1163 <write>
+        ap++;
+    1472:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    1475:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1478:	31 d2                	xor    %edx,%edx
+    147a:	e9 be fe ff ff       	jmp    133d <printf+0x4d>
+    147f:	90                   	nop
+  write(fd, &c, 1);
+    1480:	83 ec 04             	sub    $0x4,%esp
+    1483:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    1486:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1489:	6a 01                	push   $0x1
+    148b:	e9 11 ff ff ff       	jmp    13a1 <printf+0xb1>
+    1490:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    1495:	bb 00 17 00 00       	mov    $0x1700,%ebx
+    149a:	e9 61 ff ff ff       	jmp    1400 <printf+0x110>
+    149f:	90                   	nop
+
+000014a0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    14a0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    14a1:	a1 a4 20 00 00       	mov    0x20a4,%eax
+{
+    14a6:	89 e5                	mov    %esp,%ebp
+    14a8:	57                   	push   %edi
+    14a9:	56                   	push   %esi
+    14aa:	53                   	push   %ebx
+    14ab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    14ae:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    14b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14b8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    14ba:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    14bc:	39 ca                	cmp    %ecx,%edx
+    14be:	73 30                	jae    14f0 <free+0x50>
+    14c0:	39 c1                	cmp    %eax,%ecx
+    14c2:	72 04                	jb     14c8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    14c4:	39 c2                	cmp    %eax,%edx
+    14c6:	72 f0                	jb     14b8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    14c8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    14cb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    14ce:	39 f8                	cmp    %edi,%eax
+    14d0:	74 2e                	je     1500 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    14d2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    14d5:	8b 42 04             	mov    0x4(%edx),%eax
+    14d8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    14db:	39 f1                	cmp    %esi,%ecx
+    14dd:	74 38                	je     1517 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    14df:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    14e1:	5b                   	pop    %ebx
+  freep = p;
+    14e2:	89 15 a4 20 00 00    	mov    %edx,0x20a4
+}
+    14e8:	5e                   	pop    %esi
+    14e9:	5f                   	pop    %edi
+    14ea:	5d                   	pop    %ebp
+    14eb:	c3                   	ret
+    14ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    14f0:	39 c1                	cmp    %eax,%ecx
+    14f2:	72 d0                	jb     14c4 <free+0x24>
+    14f4:	eb c2                	jmp    14b8 <free+0x18>
+    14f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14fd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1500:	03 70 04             	add    0x4(%eax),%esi
+    1503:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1506:	8b 02                	mov    (%edx),%eax
+    1508:	8b 00                	mov    (%eax),%eax
+    150a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    150d:	8b 42 04             	mov    0x4(%edx),%eax
+    1510:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1513:	39 f1                	cmp    %esi,%ecx
+    1515:	75 c8                	jne    14df <free+0x3f>
+    p->s.size += bp->s.size;
+    1517:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    151a:	89 15 a4 20 00 00    	mov    %edx,0x20a4
+    p->s.size += bp->s.size;
+    1520:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1523:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1526:	89 0a                	mov    %ecx,(%edx)
+}
+    1528:	5b                   	pop    %ebx
+    1529:	5e                   	pop    %esi
+    152a:	5f                   	pop    %edi
+    152b:	5d                   	pop    %ebp
+    152c:	c3                   	ret
+    152d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001530 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1530:	55                   	push   %ebp
+    1531:	89 e5                	mov    %esp,%ebp
+    1533:	57                   	push   %edi
+    1534:	56                   	push   %esi
+    1535:	53                   	push   %ebx
+    1536:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1539:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    153c:	8b 15 a4 20 00 00    	mov    0x20a4,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1542:	8d 78 07             	lea    0x7(%eax),%edi
+    1545:	c1 ef 03             	shr    $0x3,%edi
+    1548:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    154b:	85 d2                	test   %edx,%edx
+    154d:	0f 84 8d 00 00 00    	je     15e0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1553:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1555:	8b 48 04             	mov    0x4(%eax),%ecx
+    1558:	39 f9                	cmp    %edi,%ecx
+    155a:	73 64                	jae    15c0 <malloc+0x90>
+  if(nu < 4096)
+    155c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1561:	39 df                	cmp    %ebx,%edi
+    1563:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1566:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    156d:	eb 0a                	jmp    1579 <malloc+0x49>
+    156f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1570:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1572:	8b 48 04             	mov    0x4(%eax),%ecx
+    1575:	39 f9                	cmp    %edi,%ecx
+    1577:	73 47                	jae    15c0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1579:	89 c2                	mov    %eax,%edx
+    157b:	39 05 a4 20 00 00    	cmp    %eax,0x20a4
+    1581:	75 ed                	jne    1570 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1583:	83 ec 0c             	sub    $0xc,%esp
+    1586:	56                   	push   %esi
+    1587:	e8 3f fc ff ff       	call   11cb <sbrk>
+  if(p == (char*)-1)
+    158c:	83 c4 10             	add    $0x10,%esp
+    158f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1592:	74 1c                	je     15b0 <malloc+0x80>
+  hp->s.size = nu;
+    1594:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1597:	83 ec 0c             	sub    $0xc,%esp
+    159a:	83 c0 08             	add    $0x8,%eax
+    159d:	50                   	push   %eax
+    159e:	e8 fd fe ff ff       	call   14a0 <free>
+  return freep;
+    15a3:	8b 15 a4 20 00 00    	mov    0x20a4,%edx
+      if((p = morecore(nunits)) == 0)
+    15a9:	83 c4 10             	add    $0x10,%esp
+    15ac:	85 d2                	test   %edx,%edx
+    15ae:	75 c0                	jne    1570 <malloc+0x40>
+        return 0;
+  }
+}
+    15b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    15b3:	31 c0                	xor    %eax,%eax
+}
+    15b5:	5b                   	pop    %ebx
+    15b6:	5e                   	pop    %esi
+    15b7:	5f                   	pop    %edi
+    15b8:	5d                   	pop    %ebp
+    15b9:	c3                   	ret
+    15ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    15c0:	39 cf                	cmp    %ecx,%edi
+    15c2:	74 4c                	je     1610 <malloc+0xe0>
+        p->s.size -= nunits;
+    15c4:	29 f9                	sub    %edi,%ecx
+    15c6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    15c9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    15cc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    15cf:	89 15 a4 20 00 00    	mov    %edx,0x20a4
+}
+    15d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    15d8:	83 c0 08             	add    $0x8,%eax
+}
+    15db:	5b                   	pop    %ebx
+    15dc:	5e                   	pop    %esi
+    15dd:	5f                   	pop    %edi
+    15de:	5d                   	pop    %ebp
+    15df:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    15e0:	c7 05 a4 20 00 00 a8 	movl   $0x20a8,0x20a4
+    15e7:	20 00 00 
+    base.s.size = 0;
+    15ea:	b8 a8 20 00 00       	mov    $0x20a8,%eax
+    base.s.ptr = freep = prevp = &base;
+    15ef:	c7 05 a8 20 00 00 a8 	movl   $0x20a8,0x20a8
+    15f6:	20 00 00 
+    base.s.size = 0;
+    15f9:	c7 05 ac 20 00 00 00 	movl   $0x0,0x20ac
+    1600:	00 00 00 
+    if(p->s.size >= nunits){
+    1603:	e9 54 ff ff ff       	jmp    155c <malloc+0x2c>
+    1608:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    160f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1610:	8b 08                	mov    (%eax),%ecx
+    1612:	89 0a                	mov    %ecx,(%edx)
+    1614:	eb b9                	jmp    15cf <malloc+0x9f>
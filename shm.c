@@ -0,0 +1,219 @@
+// Shared-memory segments.
+//
+// A segment is a set of pages that any number of processes can
+// map, found by a key that the processes agree on. shmget()
+// creates the segment for a key, or finds the one that exists,
+// and shmat() maps it at a new address, as a shared region
+// whose pages are the segment's (see mmap in vm.c). The pages
+// are never copied: fork() keeps them shared and they are not
+// swapped out.
+//
+// Each region mapping a segment holds a reference to it, and
+// once the segment has been attached, it is freed when the last
+// region goes away, whether by shmdt(), munmap(), exec() or
+// exit(). Until then it stays, so that the processes that got
+// its id can attach it. shmrm() removes a segment: its key no
+// longer finds it and it cannot be attached again, and it is
+// freed at once if nothing maps it.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "shm.h"
+
+struct {
+  struct spinlock lock;
+  struct shm seg[NSHM];
+} shmtab;
+
+void
+shminit(void)
+{
+  initlock(&shmtab.lock, "shm");
+}
+
+// Return the segment with the given key, or 0.
+// Caller holds shmtab.lock.
+static struct shm*
+shmfind(int key)
+{
+  struct shm *s;
+
+  for(s = shmtab.seg; s < &shmtab.seg[NSHM]; s++)
+    if(s->npages && !s->removed && s->key == key)
+      return s;
+  return 0;
+}
+
+static void
+freepages(char **page, uint npages)
+{
+  uint i;
+
+  for(i = 0; i < npages; i++)
+    if(page[i])
+      kfree(page[i]);
+  kmfree(page);
+}
+
+// Return the id of the segment with the given key, creating
+// it with size bytes of zeroed memory if there is none. If
+// size is 0, only an existing segment is found. Key 0 always
+// makes a new segment. Returns -1 if the segment is smaller
+// than size, or if memory or segments run out.
+int
+shmget(int key, uint size)
+{
+  struct shm *s;
+  char **page;
+  uint i, npages;
+  int id;
+
+  npages = PGROUNDUP(size) / PGSIZE;
+  if(size > SHMMAXPAGES*PGSIZE)
+    return -1;
+  if(key != 0){
+    acquire(&shmtab.lock);
+    if((s = shmfind(key)) != 0){
+      id = s->npages >= npages ? s - shmtab.seg : -1;
+      release(&shmtab.lock);
+      return id;
+    }
+    release(&shmtab.lock);
+  }
+  if(npages == 0)
+    return -1;
+
+  // Allocate outside the lock, since kalloc() may sleep.
+  if((page = kmalloc(npages * sizeof(page[0]))) == 0)
+    return -1;
+  memset(page, 0, npages * sizeof(page[0]));
+  for(i = 0; i < npages; i++){
+    if((page[i] = kalloc_zeroed()) == 0){
+      freepages(page, npages);
+      return -1;
+    }
+  }
+
+  acquire(&shmtab.lock);
+  if(key != 0 && (s = shmfind(key)) != 0){
+    // Someone else made it meanwhile.
+    id = s->npages >= npages ? s - shmtab.seg : -1;
+    release(&shmtab.lock);
+    freepages(page, npages);
+    return id;
+  }
+  for(s = shmtab.seg; s < &shmtab.seg[NSHM]; s++)
+    if(s->npages == 0)
+      break;
+  if(s == &shmtab.seg[NSHM]){
+    release(&shmtab.lock);
+    freepages(page, npages);
+    return -1;
+  }
+  s->key = key;
+  s->ref = 0;
+  s->attached = 0;
+  s->removed = 0;
+  s->npages = npages;
+  s->page = page;
+  release(&shmtab.lock);
+  return s - shmtab.seg;
+}
+
+// Map segment id into the current process. Returns the
+// address, or 0 if there is no such segment or no room.
+uint
+shmat(int id)
+{
+  struct shm *s;
+  uint va;
+
+  if(id < 0 || id >= NSHM)
+    return 0;
+  s = &shmtab.seg[id];
+  acquire(&shmtab.lock);
+  if(s->npages == 0 || s->removed){
+    release(&shmtab.lock);
+    return 0;
+  }
+  s->ref++;  // keep it while mapping
+  release(&shmtab.lock);
+  va = mmap(s->npages * PGSIZE, VMA_WRITE|VMA_SHARED, 0, 0, s);
+  if(va){
+    acquire(&shmtab.lock);
+    s->attached = 1;
+    release(&shmtab.lock);
+  }
+  shmput(s);
+  return va;
+}
+
+// Free s, which nothing maps. Releases shmtab.lock,
+// which the caller holds.
+static void
+shmfree(struct shm *s)
+{
+  char **page;
+  uint npages;
+
+  page = s->page;
+  npages = s->npages;
+  s->npages = 0;
+  s->page = 0;
+  release(&shmtab.lock);
+  freepages(page, npages);
+}
+
+// Remove segment id. Returns -1 if there is no such segment.
+int
+shmrm(int id)
+{
+  struct shm *s;
+
+  if(id < 0 || id >= NSHM)
+    return -1;
+  s = &shmtab.seg[id];
+  acquire(&shmtab.lock);
+  if(s->npages == 0 || s->removed){
+    release(&shmtab.lock);
+    return -1;
+  }
+  s->removed = 1;
+  if(s->ref == 0){
+    shmfree(s);
+    return 0;
+  }
+  release(&shmtab.lock);
+  return 0;
+}
+
+// Add a reference to s, for a new region that maps it.
+void
+shmdup(struct shm *s)
+{
+  acquire(&shmtab.lock);
+  if(s->ref < 1)
+    panic("shmdup");
+  s->ref++;
+  release(&shmtab.lock);
+}
+
+// Drop a reference to s, freeing it with the last one if it
+// has been attached or removed. Its pages must be unmapped from
+// the region already.
+void
+shmput(struct shm *s)
+{
+  acquire(&shmtab.lock);
+  if(s->ref < 1)
+    panic("shmput");
+  if(--s->ref > 0 || !(s->attached || s->removed)){
+    release(&shmtab.lock);
+    return;
+  }
+  shmfree(s);
+}
@@ -0,0 +1,9 @@
+// Shared-memory segment (see shm.c).
+struct shm {
+  int key;
+  int ref;       // mmap regions that map it
+  int attached;  // mapped at least once; freed with the last region
+  int removed;   // by shmrm(); its key no longer finds it
+  uint npages;   // 0 if unused
+  char **page;   // its pages
+};
@@ -0,0 +1,268 @@
+// Slab allocator for kernel objects smaller than a page.
+//
+// A cache hands out objects of one size. It carves them out of
+// slabs: blocks of 2^order pages from kalloc_pages() that start
+// with a struct slab header, followed by as many objects as fit.
+// The free objects of a slab are chained through their first
+// word. A slab whose objects are all free is given back to the
+// page allocator, unless it is the cache's last one.
+//
+// Each CPU keeps a magazine of free objects for every cache, so
+// most slaballoc() and slabfree() calls touch neither the cache
+// lock nor the slabs. A CPU fills its empty magazine, or empties
+// its full one, MAGSIZE/2 objects at a time.
+//
+// kmalloc() serves sizes up to KMALLOCMAX from caches of
+// power-of-two sizes, and larger sizes with whole pages.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "memstat.h"
+
+#define MAGSIZE    16   // objects in a per-CPU magazine
+#define KMALLOCMIN 16   // smallest kmalloc size class
+#define KMALLOCMAX 512  // largest kmalloc size class
+#define NKMALLOC   6    // size classes 16, 32, ..., 512
+
+struct slab {
+  struct slabcache *cache;  // 0 for a large kmalloc block
+  struct slab *next;        // in cache's list of slabs with free objects
+  struct slab *prev;
+  int inuse;                // objects handed out; order of a large block
+  void *free;               // free objects
+};
+
+#define SLABHDR ((sizeof(struct slab) + 7) & ~7)
+
+struct magazine {
+  int n;
+  void *obj[MAGSIZE];
+};
+
+struct slabcache {
+  struct spinlock lock;
+  char *name;
+  uint size;              // object size, a multiple of 8
+  int order;              // slabs are 2^order pages
+  int perslab;            // objects per slab
+  struct slab *partial;   // slabs with free objects
+  uint nslabs;            // slabs allocated
+  struct magazine mag[NCPU];
+};
+
+struct {
+  int n;
+  struct slabcache cache[NSLABCACHE];
+  struct slabcache *kmalloc[NKMALLOC];
+} slabs;
+
+// Create a cache of objects of the given size, which must be
+// smaller than a page. Only called during boot.
+struct slabcache*
+slabcreate(char *name, uint size)
+{
+  struct slabcache *c;
+
+  size = (size + 7) & ~7;
+  if(slabs.n == NSLABCACHE || size + SLABHDR > PGSIZE)
+    panic("slabcreate");
+  c = &slabs.cache[slabs.n++];
+  initlock(&c->lock, name);
+  c->name = name;
+  c->size = size;
+  c->order = 0;
+  while(c->order < 3 && ((PGSIZE << c->order) - SLABHDR) / size < 4)
+    c->order++;
+  c->perslab = ((PGSIZE << c->order) - SLABHDR) / size;
+  return c;
+}
+
+void
+slabinit(void)
+{
+  static char *names[NKMALLOC] = {
+    "kmalloc16", "kmalloc32", "kmalloc64",
+    "kmalloc128", "kmalloc256", "kmalloc512",
+  };
+  int i;
+
+  for(i = 0; i < NKMALLOC; i++){
+    slabs.kmalloc[i] = slabcreate(names[i], KMALLOCMIN << i);
+    if(slabs.kmalloc[i]->order != 0)
+      panic("slabinit");  // kmfree finds slabs by page
+  }
+}
+
+// Allocate a slab for c and put its objects on its free list.
+// Caller holds c->lock.
+static struct slab*
+newslab(struct slabcache *c)
+{
+  struct slab *s;
+  char *p;
+  int i;
+
+  if((s = (struct slab*)kalloc_pages(c->order)) == 0)
+    return 0;
+  s->cache = c;
+  s->inuse = 0;
+  s->free = 0;
+  p = (char*)s + SLABHDR + (c->perslab - 1) * c->size;
+  for(i = 0; i < c->perslab; i++, p -= c->size){
+    *(void**)p = s->free;
+    s->free = p;
+  }
+  s->prev = 0;
+  s->next = c->partial;
+  if(c->partial)
+    c->partial->prev = s;
+  c->partial = s;
+  c->nslabs++;
+  return s;
+}
+
+static void
+unlinkslab(struct slabcache *c, struct slab *s)
+{
+  if(s->prev)
+    s->prev->next = s->next;
+  else
+    c->partial = s->next;
+  if(s->next)
+    s->next->prev = s->prev;
+  s->next = s->prev = 0;
+}
+
+// Move objects from c's slabs into m until it holds n.
+// Caller holds c->lock.
+static void
+fill(struct slabcache *c, struct magazine *m, int n)
+{
+  struct slab *s;
+  void *obj;
+
+  while(m->n < n){
+    if((s = c->partial) == 0 && (s = newslab(c)) == 0)
+      break;
+    obj = s->free;
+    s->free = *(void**)obj;
+    s->inuse++;
+    if(s->free == 0)
+      unlinkslab(c, s);
+    m->obj[m->n++] = obj;
+  }
+}
+
+// Return obj to its slab. Caller holds c->lock.
+static void
+put(struct slabcache *c, void *obj)
+{
+  struct slab *s;
+
+  s = (struct slab*)((uint)obj & ~((PGSIZE << c->order) - 1));
+  if(s->cache != c)
+    panic("slabfree");
+  if(s->free == 0){
+    s->prev = 0;
+    s->next = c->partial;
+    if(c->partial)
+      c->partial->prev = s;
+    c->partial = s;
+  }
+  *(void**)obj = s->free;
+  s->free = obj;
+  if(--s->inuse == 0 && (c->partial != s || s->next)){
+    unlinkslab(c, s);
+    c->nslabs--;
+    kfree_pages((char*)s, c->order);
+  }
+}
+
+// Allocate an object from c. Returns 0 if memory runs out.
+void*
+slaballoc(struct slabcache *c)
+{
+  struct magazine *m;
+  void *obj;
+
+  pushcli();
+  m = &c->mag[cpuid()];
+  if(m->n == 0){
+    acquire(&c->lock);
+    fill(c, m, MAGSIZE/2);
+    release(&c->lock);
+  }
+  obj = 0;
+  if(m->n > 0)
+    obj = m->obj[--m->n];
+  popcli();
+  return obj;
+}
+
+// Free an object allocated from c.
+void
+slabfree(struct slabcache *c, void *obj)
+{
+  struct magazine *m;
+
+  pushcli();
+  m = &c->mag[cpuid()];
+  if(m->n == MAGSIZE){
+    acquire(&c->lock);
+    while(m->n > MAGSIZE/2)
+      put(c, m->obj[--m->n]);
+    release(&c->lock);
+  }
+  m->obj[m->n++] = obj;
+  popcli();
+}
+
+// Allocate n bytes of kernel memory, aligned to 8 bytes.
+// Returns 0 if memory runs out.
+void*
+kmalloc(uint n)
+{
+  struct slab *s;
+  int i;
+
+  if(n <= KMALLOCMAX){
+    for(i = 0; (KMALLOCMIN << i) < n; i++)
+      ;
+    return slaballoc(slabs.kmalloc[i]);
+  }
+  for(i = 0; (PGSIZE << i) < n + SLABHDR; i++)
+    ;
+  if((s = (struct slab*)kalloc_pages(i)) == 0)
+    return 0;
+  s->cache = 0;
+  s->inuse = i;
+  return (char*)s + SLABHDR;
+}
+
+// Free memory returned by kmalloc().
+void
+kmfree(void *p)
+{
+  struct slab *s;
+
+  s = (struct slab*)PGROUNDDOWN((uint)p);
+  if(s->cache)
+    slabfree(s->cache, p);
+  else
+    kfree_pages((char*)s, s->inuse);
+}
+
+// Report the pages held by slab caches for the memstat system
+// call, read without locks.
+void
+slabstat(struct memstat *ms)
+{
+  int i;
+
+  ms->slabpages = 0;
+  for(i = 0; i < slabs.n; i++)
+    ms->slabpages += slabs.cache[i].nslabs << slabs.cache[i].order;
+}
@@ -0,0 +1,388 @@
+// Swap space for user pages.
+//
+// When kalloc() runs out of memory, it calls swapout() to move
+// some user pages out of memory and free them. The pages are
+// chosen by the clock algorithm (see evict in proc.c and
+// uvmevict in vm.c), which sweeps over the page tables of the
+// processes, clearing the accessed bit of the pages that have it
+// and taking those that do not. The PTE of a page that was
+// swapped out is not present but has PTE_SWAP set and a slot
+// number in place of the address; touching the page faults, and
+// faultin() calls swapin() to bring it back.
+//
+// A page goes to one of two places. If it compresses well
+// (see lz.c), the compressed copy is kept in memory in the
+// swap pool, which is far faster to fault back in than the disk.
+// Otherwise it is written to a page of the swap area that mkfs
+// leaves after the file system. The pool grows by taking one of
+// the pages being swapped out when its current page is full, so
+// it never has to allocate memory while memory is short. A pool
+// page is freed when no slot uses it any more.
+//
+// A slot counts the PTEs that refer to it, since fork copies
+// the PTEs of swapped-out pages. While a slot is being stored
+// it is busy, and swapin() waits for it to be done.
+//
+// Only pages mapped once are swapped out, so pages shared with
+// another process or held by the page cache stay in memory, and
+// so does the user memory that the current system call of a
+// process is using (see uvmprefault).
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+#include "memstat.h"
+
+#define SWAPBATCH 16              // pages evicted per swapout()
+#define NSLOT     (NSWAP+NZSWAP)  // disk slots and compressed ones
+#define ZMAX      (PGSIZE*3/4)    // largest compressed copy kept
+
+extern struct superblock sb;
+
+struct slot {
+  ushort ref;   // PTEs that refer to the slot
+  uchar busy;   // being stored
+  short blk;    // page of the swap area holding the data, or -1
+  ushort zlen;  // length of the compressed copy
+  char *z;      // compressed copy in the pool, or 0
+};
+
+// Header of a pool page; compressed copies follow it.
+struct zpage {
+  int nobj;     // live copies in the page
+  int used;     // bytes used, including this header
+};
+
+struct {
+  struct spinlock lock;
+  struct slot slot[NSLOT];
+  uchar blkused[NSWAP];
+  uint nout;          // pages swapped out
+  uint nin;           // pages read back from disk
+  uint nzin;          // pages decompressed from the pool
+} swap;
+
+// The pool. Its lock also serializes the compressor.
+struct {
+  struct spinlock lock;
+  struct zpage *cur;  // page new copies go to
+  int npages;
+  uint nstored;       // pages held compressed
+  uint nbytes;        // their compressed size
+  uchar buf[ZMAX];
+} zpool;
+
+static struct buf swapbuf;  // its lock serializes swap I/O
+
+void
+swapinit(void)
+{
+  int i;
+
+  initlock(&swap.lock, "swap");
+  initlock(&zpool.lock, "zpool");
+  initsleeplock(&swapbuf.lock, "swapbuf");
+  for(i = 0; i < NSLOT; i++)
+    swap.slot[i].blk = -1;
+}
+
+// Number of pages in the swap area: none until iinit() has
+// read the superblock.
+static int
+nblks(void)
+{
+  return sb.nswap < NSWAP ? sb.nswap : NSWAP;
+}
+
+// Read or write the page mem from or to page blk of the
+// swap area.
+static void
+swapio(char *mem, int blk, int write)
+{
+  struct buf *b = &swapbuf;
+  int i;
+
+  acquiresleep(&b->lock);
+  for(i = 0; i < PGSIZE/BSIZE; i++){
+    b->dev = ROOTDEV;
+    b->blockno = sb.swapstart + blk*(PGSIZE/BSIZE) + i;
+    if(write){
+      memmove(b->data, mem + i*BSIZE, BSIZE);
+      b->flags = B_DIRTY;
+    } else
+      b->flags = 0;
+    iderw(b);
+    if(!write)
+      memmove(mem + i*BSIZE, b->data, BSIZE);
+  }
+  releasesleep(&b->lock);
+}
+
+// Compress page into the pool for slot s. Returns 1 if the pool
+// took page itself as its new current page, 0 if page can be
+// freed, or -1 if page does not compress well or the pool is
+// full.
+static int
+zstore(struct slot *s, char *page)
+{
+  int n, took;
+  struct zpage *zp;
+
+  acquire(&zpool.lock);
+  n = lzcompress((uchar*)page, PGSIZE, zpool.buf, ZMAX);
+  if(n == 0){
+    release(&zpool.lock);
+    return -1;
+  }
+  took = 0;
+  zp = zpool.cur;
+  if(zp == 0 || zp->used + n > PGSIZE){
+    if(zpool.npages == NZPOOL){
+      release(&zpool.lock);
+      return -1;
+    }
+    if(zp && zp->nobj == 0){
+      kfree((char*)zp);
+      zpool.npages--;
+    }
+    zp = zpool.cur = (struct zpage*)page;
+    zp->nobj = 0;
+    zp->used = sizeof(*zp);
+    zpool.npages++;
+    took = 1;
+  }
+  s->z = (char*)zp + zp->used;
+  s->zlen = n;
+  memmove(s->z, zpool.buf, n);
+  zp->used += n;
+  zp->nobj++;
+  zpool.nstored++;
+  zpool.nbytes += n;
+  release(&zpool.lock);
+  return took;
+}
+
+// Drop the compressed copy at z, n bytes long, freeing its
+// page if that was the last copy in it.
+static void
+zfree(char *z, int n)
+{
+  struct zpage *zp;
+
+  zp = (struct zpage*)PGROUNDDOWN((uint)z);
+  acquire(&zpool.lock);
+  zpool.nstored--;
+  zpool.nbytes -= n;
+  if(--zp->nobj == 0 && zp != zpool.cur){
+    kfree((char*)zp);
+    zpool.npages--;
+  }
+  release(&zpool.lock);
+}
+
+// Evict up to SWAPBATCH user pages. Returns the number of pages
+// freed, which is 0 if the caller cannot sleep: it must be a
+// process holding no spinlocks.
+int
+swapout(void)
+{
+  uint id[SWAPBATCH];
+  int blk[SWAPBATCH];
+  char *page[SWAPBATCH];
+  int i, j, n, nres, nfreed, zlen;
+  struct slot *s;
+  char *z;
+
+  if((readeflags() & FL_IF) == 0 || myproc() == 0)
+    return 0;
+
+  // Reserve slots now, since evict() holds ptable.lock, which
+  // sleep() takes while holding swap.lock. Each gets a page of
+  // the swap area in case its page does not compress.
+  acquire(&swap.lock);
+  nres = 0;
+  for(i = 0, j = 0; i < NSLOT && nres < SWAPBATCH; i++){
+    s = &swap.slot[i];
+    if(s->ref || s->busy)
+      continue;
+    while(j < nblks() && swap.blkused[j])
+      j++;
+    if(j == nblks())
+      break;
+    s->ref = 1;
+    s->busy = 1;
+    swap.blkused[j] = 1;
+    id[nres] = i;
+    blk[nres] = j;
+    nres++;
+  }
+  release(&swap.lock);
+  n = evict(id, page, nres);
+
+  nfreed = 0;
+  for(i = 0; i < nres; i++){
+    s = &swap.slot[id[i]];
+    if(i < n){
+      switch(zstore(s, page[i])){
+      case 1:
+        break;
+      case 0:
+        kfree(page[i]);
+        nfreed++;
+        break;
+      default:
+        swapio(page[i], blk[i], 1);
+        s->blk = blk[i];
+        kfree(page[i]);
+        nfreed++;
+      }
+    }
+    acquire(&swap.lock);
+    if(i < n)
+      swap.nout++;
+    else
+      s->ref = 0;
+    z = 0;
+    zlen = 0;
+    if(s->ref == 0){
+      // Never used, or freed while being stored.
+      z = s->z;
+      zlen = s->zlen;
+      s->z = 0;
+      s->blk = -1;
+    }
+    if(s->blk != blk[i])
+      swap.blkused[blk[i]] = 0;
+    s->busy = 0;
+    wakeup(&swap);
+    release(&swap.lock);
+    if(z)
+      zfree(z, zlen);
+  }
+  return nfreed;
+}
+
+// Bring the swapped-out page that pte refers to back into
+// memory and map it. pte belongs to the current process.
+// Returns -1 if memory runs out.
+int
+swapin(pte_t *pte)
+{
+  uint slot;
+  struct slot *s;
+  char *mem;
+
+  if((mem = kalloc()) == 0)
+    return -1;
+  slot = PTESLOT(*pte);
+  s = &swap.slot[slot];
+  acquire(&swap.lock);
+  while(s->busy)
+    sleep(&swap, &swap.lock);
+  if(s->z)
+    swap.nzin++;
+  else
+    swap.nin++;
+  release(&swap.lock);
+  if(s->z){
+    acquire(&zpool.lock);
+    if(lzdecompress((uchar*)s->z, s->zlen, (uchar*)mem, PGSIZE) != PGSIZE)
+      panic("swapin");
+    release(&zpool.lock);
+  } else
+    swapio(mem, s->blk, 0);
+  *pte = V2P(mem) | (PTE_FLAGS(*pte) & ~PTE_SWAP) | PTE_P | PTE_A;
+  swapfree(slot);
+  return 0;
+}
+
+// Add a reference to slot, for a PTE copied by fork.
+void
+swapdup(uint slot)
+{
+  acquire(&swap.lock);
+  if(slot >= NSLOT || swap.slot[slot].ref == 0)
+    panic("swapdup");
+  swap.slot[slot].ref++;
+  release(&swap.lock);
+}
+
+// Drop a reference to slot, and free its data with the last,
+// unless swapout() is still storing it and will free it.
+void
+swapfree(uint slot)
+{
+  struct slot *s;
+  char *z;
+  int zlen;
+
+  acquire(&swap.lock);
+  if(slot >= NSLOT || swap.slot[slot].ref == 0)
+    panic("swapfree");
+  s = &swap.slot[slot];
+  z = 0;
+  zlen = 0;
+  if(--s->ref == 0 && !s->busy){
+    if(s->blk >= 0)
+      swap.blkused[s->blk] = 0;
+    z = s->z;
+    zlen = s->zlen;
+    s->blk = -1;
+    s->z = 0;
+  }
+  release(&swap.lock);
+  if(z)
+    zfree(z, zlen);
+}
+
+// Return the number of pages that could still be swapped out:
+// each needs a free slot and, while it is stored, a free page
+// of the swap area. Like kfreepages(), it reads the counts
+// without locks.
+uint
+swapfreepages(void)
+{
+  uint i, nslot, nblk;
+
+  nslot = 0;
+  for(i = 0; i < NSLOT; i++)
+    if(swap.slot[i].ref == 0 && !swap.slot[i].busy)
+      nslot++;
+  nblk = 0;
+  for(i = 0; i < nblks(); i++)
+    if(!swap.blkused[i])
+      nblk++;
+  return nslot < nblk ? nslot : nblk;
+}
+
+// Report swap statistics for the memstat system call.
+void
+swapstat(struct memstat *ms)
+{
+  int i;
+
+  acquire(&swap.lock);
+  ms->swappages = nblks();
+  ms->swapused = 0;
+  for(i = 0; i < nblks(); i++)
+    if(swap.blkused[i])
+      ms->swapused++;
+  ms->swapouts = swap.nout;
+  ms->swapins = swap.nin;
+  ms->zswapins = swap.nzin;
+  release(&swap.lock);
+
+  acquire(&zpool.lock);
+  ms->zpoolpages = zpool.npages;
+  ms->zstored = zpool.nstored;
+  ms->zbytes = zpool.nbytes;
+  release(&zpool.lock);
+}
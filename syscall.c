@@ -13,13 +13,19 @@
 // library system call function. The saved user %esp points
 // to a saved program counter, and then the first argument.
 
+// User memory may not be present yet (see pagefault in vm.c),
+// so the fetch and arg functions check addresses with uvmvalid
+// and fault the memory in with uvmprefault before handing it
+// to the rest of the kernel. uvmprefault also keeps the memory
+// from being swapped out until the system call returns. Memory
+// the system call writes is fetched with argout, which also
+// copies copy-on-write pages up front.
+
 // Fetch the int at addr from the current process.
 int
 fetchint(uint addr, int *ip)
 {
-  struct proc *curproc = myproc();
-
-  if(addr >= curproc->sz || addr+4 > curproc->sz)
+  if(!uvmvalid(addr, 4) || uvmprefault(addr, 4, 0) < 0)
     return -1;
   *ip = *(int*)(addr);
   return 0;
@@ -31,18 +37,18 @@ fetchint(uint addr, int *ip)
 int
 fetchstr(uint addr, char **pp)
 {
-  char *s, *ep;
+  char *s;
   struct proc *curproc = myproc();
 
-  if(addr >= curproc->sz)
-    return -1;
   *pp = (char*)addr;
-  ep = (char*)curproc->sz;
-  for(s = *pp; s < ep; s++){
+  for(s = *pp; ; s++){
+    if(s == *pp || (uint)s == curproc->sz || (uint)s % PGSIZE == 0){
+      if(!uvmvalid((uint)s, 1) || uvmprefault((uint)s, 1, 0) < 0)
+        return -1;
+    }
     if(*s == 0)
       return s - *pp;
   }
-  return -1;
 }
 
 // Fetch the nth 32-bit system call argument.
@@ -59,11 +65,24 @@ int
 argptr(int n, char **pp, int size)
 {
   int i;
-  struct proc *curproc = myproc();
- 
+
+  if(argint(n, &i) < 0)
+    return -1;
+  if(size < 0 || !uvmvalid(i, size) || uvmprefault(i, size, 0) < 0)
+    return -1;
+  *pp = (char*)i;
+  return 0;
+}
+
+// Like argptr, for a block that the system call will write.
+int
+argout(int n, char **pp, int size)
+{
+  int i;
+
   if(argint(n, &i) < 0)
     return -1;
-  if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+  if(size < 0 || !uvmvalid(i, size) || uvmprefault(i, size, 1) < 0)
     return -1;
   *pp = (char*)i;
   return 0;
@@ -71,8 +90,8 @@ argptr(int n, char **pp, int size)
 
 // Fetch the nth word-sized system call argument as a string pointer.
 // Check that the pointer is valid and the string is nul-terminated.
-// (There is no shared writable memory, so the string can't change
-// between this check and being used by the kernel.)
+// (A string in memory shared through mmap can still be changed
+// by another process after this check.)
 int
 argstr(int n, char **pp)
 {
@@ -103,6 +122,18 @@ extern int sys_unlink(void);
 extern int sys_wait(void);
 extern int sys_write(void);
 extern int sys_uptime(void);
+extern int sys_memstat(void);
+extern int sys_mmap(void);
+extern int sys_munmap(void);
+extern int sys_shmget(void);
+extern int sys_shmat(void);
+extern int sys_shmdt(void);
+extern int sys_shmrm(void);
+extern int sys_spawn(void);
+extern int sys_setpriority(void);
+extern int sys_procinfo(void);
+extern int sys_setaffinity(void);
+extern int sys_getaffinity(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    sys_fork,
@@ -126,6 +157,18 @@ static int (*syscalls[])(void) = {
 [SYS_link]    sys_link,
 [SYS_mkdir]   sys_mkdir,
 [SYS_close]   sys_close,
+[SYS_memstat] sys_memstat,
+[SYS_mmap]    sys_mmap,
+[SYS_munmap]  sys_munmap,
+[SYS_shmget]  sys_shmget,
+[SYS_shmat]   sys_shmat,
+[SYS_shmdt]   sys_shmdt,
+[SYS_spawn]   sys_spawn,
+[SYS_setpriority] sys_setpriority,
+[SYS_procinfo] sys_procinfo,
+[SYS_setaffinity] sys_setaffinity,
+[SYS_getaffinity] sys_getaffinity,
+[SYS_shmrm]   sys_shmrm,
 };
 
 void
@@ -135,6 +178,7 @@ syscall(void)
   struct proc *curproc = myproc();
 
   num = curproc->tf->eax;
+  curproc->npin = 0;
   if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
     curproc->tf->eax = syscalls[num]();
   } else {
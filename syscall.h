@@ -20,3 +20,15 @@
 #define SYS_link   19
 #define SYS_mkdir  20
 #define SYS_close  21
+#define SYS_memstat 22
+#define SYS_mmap   23
+#define SYS_munmap 24
+#define SYS_shmget 25
+#define SYS_shmat  26
+#define SYS_shmdt  27
+#define SYS_spawn  28
+#define SYS_setpriority 29
+#define SYS_procinfo 30
+#define SYS_setaffinity 31
+#define SYS_getaffinity 32
+#define SYS_shmrm  33
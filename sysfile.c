@@ -15,6 +15,8 @@
 #include "sleeplock.h"
 #include "file.h"
 #include "fcntl.h"
+#include "mman.h"
+#include "memlayout.h"
 
 // Fetch the nth word-sized system call argument as a file descriptor
 // and return both the descriptor and the corresponding struct file.
@@ -73,7 +75,7 @@ sys_read(void)
   int n;
   char *p;
 
-  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argout(1, &p, n) < 0)
     return -1;
   return fileread(f, p, n);
 }
@@ -109,7 +111,7 @@ sys_fstat(void)
   struct file *f;
   struct stat *st;
 
-  if(argfd(0, 0, &f) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+  if(argfd(0, 0, &f) < 0 || argout(1, (void*)&st, sizeof(*st)) < 0)
     return -1;
   return filestat(f, st);
 }
@@ -393,19 +395,19 @@ sys_chdir(void)
   return 0;
 }
 
-int
-sys_exec(void)
+// Fetch the nth system call argument as a null-terminated
+// array of at most MAXARG string pointers into argv.
+static int
+argargv(int n, char **argv)
 {
-  char *path, *argv[MAXARG];
   int i;
   uint uargv, uarg;
 
-  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
+  if(argint(n, (int*)&uargv) < 0)
     return -1;
-  }
-  memset(argv, 0, sizeof(argv));
+  memset(argv, 0, MAXARG*sizeof(argv[0]));
   for(i=0;; i++){
-    if(i >= NELEM(argv))
+    if(i >= MAXARG)
       return -1;
     if(fetchint(uargv+4*i, (int*)&uarg) < 0)
       return -1;
@@ -416,9 +418,48 @@ sys_exec(void)
     if(fetchstr(uarg, &argv[i]) < 0)
       return -1;
   }
+  return 0;
+}
+
+int
+sys_exec(void)
+{
+  char *path, *argv[MAXARG];
+
+  if(argstr(0, &path) < 0 || argargv(1, argv) < 0){
+    return -1;
+  }
   return exec(path, argv);
 }
 
+// Start the program in path with arguments argv in a new
+// process. If the third argument is not 0, it points at three
+// descriptors of the caller, or -1 for none, that become the
+// child's descriptors 0, 1 and 2.
+int
+sys_spawn(void)
+{
+  char *path, *argv[MAXARG];
+  int i, *fds;
+  struct file *ofile[3];
+
+  if(argstr(0, &path) < 0 || argargv(1, argv) < 0 ||
+     argint(2, (int*)&fds) < 0)
+    return -1;
+  if(fds == 0)
+    return spawn(path, argv, 0);
+  if(argptr(2, (void*)&fds, 3*sizeof(fds[0])) < 0)
+    return -1;
+  for(i = 0; i < 3; i++){
+    ofile[i] = 0;
+    if(fds[i] == -1)
+      continue;
+    if(fds[i] < 0 || fds[i] >= NOFILE || (ofile[i]=myproc()->ofile[fds[i]]) == 0)
+      return -1;
+  }
+  return spawn(path, argv, ofile);
+}
+
 int
 sys_pipe(void)
 {
@@ -426,7 +467,7 @@ sys_pipe(void)
   struct file *rf, *wf;
   int fd0, fd1;
 
-  if(argptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+  if(argout(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
     return -1;
   if(pipealloc(&rf, &wf) < 0)
     return -1;
@@ -442,3 +483,55 @@ sys_pipe(void)
   fd[1] = fd1;
   return 0;
 }
+
+int
+sys_mmap(void)
+{
+  struct file *f;
+  struct inode *ip;
+  int addr, len, prot, flags, off, vflags;
+  uint va;
+
+  if(argint(0, &addr) < 0 || argint(1, &len) < 0 || argint(2, &prot) < 0 ||
+     argint(3, &flags) < 0 || argint(5, &off) < 0)
+    return -1;
+  if(addr != 0 || len <= 0 || off < 0 || off % PGSIZE != 0)
+    return -1;
+  if(!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE))
+    return -1;
+
+  vflags = 0;
+  if(prot & PROT_WRITE)
+    vflags |= VMA_WRITE;
+  if(flags & MAP_SHARED)
+    vflags |= VMA_SHARED;
+  if(flags & MAP_LARGE){
+    if(!(flags & MAP_ANONYMOUS))
+      return -1;
+    vflags |= VMA_LARGE;
+  }
+  ip = 0;
+  if(!(flags & MAP_ANONYMOUS)){
+    if(argfd(4, 0, &f) < 0 || f->type != FD_INODE || !f->readable)
+      return -1;
+    if((vflags & VMA_SHARED) && (vflags & VMA_WRITE) && !f->writable)
+      return -1;
+    ip = f->ip;
+  }
+  if((va = mmap(len, vflags, ip, off, 0)) == 0)
+    return -1;
+  return va;
+}
+
+int
+sys_munmap(void)
+{
+  int addr, len;
+
+  if(argint(0, &addr) < 0 || argint(1, &len) < 0)
+    return -1;
+  if(addr % PGSIZE != 0 || len <= 0 || (uint)addr >= KERNBASE ||
+     (uint)addr + PGROUNDUP(len) > KERNBASE)
+    return -1;
+  return munmap(addr, PGROUNDUP(len));
+}
@@ -6,6 +6,8 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
+#include "memstat.h"
+#include "procinfo.h"
 
 int
 sys_fork(void)
@@ -89,3 +91,125 @@ sys_uptime(void)
   release(&tickslock);
   return xticks;
 }
+
+// Set the nice level of a process; pid 0 means the caller.
+int
+sys_setpriority(void)
+{
+  int pid, nice;
+
+  if(argint(0, &pid) < 0 || argint(1, &nice) < 0)
+    return -1;
+  if(pid == 0)
+    pid = myproc()->pid;
+  return setpriority(pid, nice);
+}
+
+// Set the CPUs a process may run on, as a bit mask.
+int
+sys_setaffinity(void)
+{
+  int pid, mask;
+
+  if(argint(0, &pid) < 0 || argint(1, &mask) < 0)
+    return -1;
+  if(pid == 0)
+    pid = myproc()->pid;
+  return setaffinity(pid, mask);
+}
+
+// Return the CPUs a process may run on, as a bit mask.
+int
+sys_getaffinity(void)
+{
+  int pid;
+
+  if(argint(0, &pid) < 0)
+    return -1;
+  if(pid == 0)
+    pid = myproc()->pid;
+  return getaffinity(pid);
+}
+
+// Report on up to n processes; returns how many.
+int
+sys_procinfo(void)
+{
+  struct procinfo *pi;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0)
+    return -1;
+  if(n > NPROC)
+    n = NPROC;
+  if(argout(0, (void*)&pi, n*sizeof(*pi)) < 0)
+    return -1;
+  return procinfo((uint)pi, n);
+}
+
+// report physical memory allocator statistics.
+int
+sys_memstat(void)
+{
+  struct memstat *ms;
+
+  if(argout(0, (void*)&ms, sizeof(*ms)) < 0)
+    return -1;
+  kmemstat(ms);
+  pcstat(ms);
+  slabstat(ms);
+  swapstat(ms);
+  return 0;
+}
+
+// find or create the shared-memory segment for a key.
+int
+sys_shmget(void)
+{
+  int key, size;
+
+  if(argint(0, &key) < 0 || argint(1, &size) < 0 || size < 0)
+    return -1;
+  return shmget(key, size);
+}
+
+// map a shared-memory segment; returns its address.
+int
+sys_shmat(void)
+{
+  int id;
+  uint va;
+
+  if(argint(0, &id) < 0)
+    return -1;
+  if((va = shmat(id)) == 0)
+    return -1;
+  return va;
+}
+
+// remove a shared-memory segment.
+int
+sys_shmrm(void)
+{
+  int id;
+
+  if(argint(0, &id) < 0)
+    return -1;
+  return shmrm(id);
+}
+
+// unmap the shared-memory segment mapped at addr.
+int
+sys_shmdt(void)
+{
+  struct proc *curproc = myproc();
+  struct vma *v;
+  int addr;
+
+  if(argint(0, &addr) < 0)
+    return -1;
+  for(v = curproc->vma; v < &curproc->vma[NVMA]; v++)
+    if(v->end && v->shm && v->start == addr)
+      return munmap(v->start, v->end - v->start);
+  return -1;
+}
@@ -0,0 +1,40 @@
+// Run a command on a set of CPUs, given as a hexadecimal mask
+// with bit i for CPU i.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+// Parse s as a hexadecimal number. Returns 0 if it is not one.
+uint
+hex(char *s)
+{
+  uint n;
+
+  n = 0;
+  for(; *s; s++){
+    if(*s >= '0' && *s <= '9')
+      n = n*16 + *s - '0';
+    else if(*s >= 'a' && *s <= 'f')
+      n = n*16 + *s - 'a' + 10;
+    else
+      return 0;
+  }
+  return n;
+}
+
+int
+main(int argc, char *argv[])
+{
+  if(argc < 3){
+    printf(2, "usage: taskset mask command [args...]\n");
+    exit();
+  }
+  if(setaffinity(0, hex(argv[1])) < 0){
+    printf(2, "taskset: bad mask %s\n", argv[1]);
+    exit();
+  }
+  exec(argv[2], argv + 2);
+  printf(2, "taskset: exec %s failed\n", argv[2]);
+  exit();
+}
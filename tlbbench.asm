@@ -0,0 +1,1407 @@
+
+_tlbbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return t;
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+  uint mb;
+  int rounds, small, large;
+
+  mb = argc > 1 ? atoi(argv[1]) : 64;
+  rounds = argc > 2 ? atoi(argv[2]) : 500;
+   7:	ba f4 01 00 00       	mov    $0x1f4,%edx
+{
+   c:	ff 71 fc             	push   -0x4(%ecx)
+   f:	55                   	push   %ebp
+  10:	89 e5                	mov    %esp,%ebp
+  12:	57                   	push   %edi
+  13:	56                   	push   %esi
+  14:	53                   	push   %ebx
+  mb = argc > 1 ? atoi(argv[1]) : 64;
+  15:	bb 40 00 00 00       	mov    $0x40,%ebx
+{
+  1a:	51                   	push   %ecx
+  1b:	83 ec 18             	sub    $0x18,%esp
+  1e:	8b 39                	mov    (%ecx),%edi
+  20:	8b 71 04             	mov    0x4(%ecx),%esi
+  mb = argc > 1 ? atoi(argv[1]) : 64;
+  23:	83 ff 01             	cmp    $0x1,%edi
+  26:	7f 45                	jg     6d <main+0x6d>
+  if(mb == 0 || mb % 4 || rounds <= 0){
+    printf(2, "usage: tlbbench [megabytes [rounds]]\n");
+    printf(2, "megabytes must be a multiple of 4\n");
+    exit();
+  }
+  small = run(mb << 20, 0, rounds);
+  28:	89 df                	mov    %ebx,%edi
+  2a:	56                   	push   %esi
+  2b:	c1 e7 14             	shl    $0x14,%edi
+  2e:	52                   	push   %edx
+  2f:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  32:	6a 00                	push   $0x0
+  34:	57                   	push   %edi
+  35:	e8 c6 00 00 00       	call   100 <run>
+  large = run(mb << 20, MAP_LARGE, rounds);
+  3a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  3d:	83 c4 0c             	add    $0xc,%esp
+  small = run(mb << 20, 0, rounds);
+  40:	89 c6                	mov    %eax,%esi
+  large = run(mb << 20, MAP_LARGE, rounds);
+  42:	52                   	push   %edx
+  43:	68 00 00 04 00       	push   $0x40000
+  48:	57                   	push   %edi
+  49:	e8 b2 00 00 00       	call   100 <run>
+  if(small < 0 || large < 0){
+  4e:	89 f2                	mov    %esi,%edx
+  50:	83 c4 10             	add    $0x10,%esp
+  53:	09 c2                	or     %eax,%edx
+  55:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  58:	79 7f                	jns    d9 <main+0xd9>
+    printf(2, "tlbbench: mmap failed\n");
+  5a:	53                   	push   %ebx
+  5b:	53                   	push   %ebx
+  5c:	68 7e 09 00 00       	push   $0x97e
+  61:	6a 02                	push   $0x2
+  63:	e8 68 05 00 00       	call   5d0 <printf>
+    exit();
+  68:	e8 b6 03 00 00       	call   423 <exit>
+  mb = argc > 1 ? atoi(argv[1]) : 64;
+  6d:	83 ec 0c             	sub    $0xc,%esp
+  70:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  73:	ff 76 04             	push   0x4(%esi)
+  76:	e8 35 03 00 00       	call   3b0 <atoi>
+  rounds = argc > 2 ? atoi(argv[2]) : 500;
+  7b:	83 c4 10             	add    $0x10,%esp
+  mb = argc > 1 ? atoi(argv[1]) : 64;
+  7e:	89 c3                	mov    %eax,%ebx
+  rounds = argc > 2 ? atoi(argv[2]) : 500;
+  80:	83 ff 02             	cmp    $0x2,%edi
+  83:	75 29                	jne    ae <main+0xae>
+  if(mb == 0 || mb % 4 || rounds <= 0){
+  85:	85 c0                	test   %eax,%eax
+  87:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8a:	75 44                	jne    d0 <main+0xd0>
+    printf(2, "usage: tlbbench [megabytes [rounds]]\n");
+  8c:	83 ec 08             	sub    $0x8,%esp
+  8f:	68 f8 08 00 00       	push   $0x8f8
+  94:	6a 02                	push   $0x2
+  96:	e8 35 05 00 00       	call   5d0 <printf>
+    printf(2, "megabytes must be a multiple of 4\n");
+  9b:	5f                   	pop    %edi
+  9c:	58                   	pop    %eax
+  9d:	68 20 09 00 00       	push   $0x920
+  a2:	6a 02                	push   $0x2
+  a4:	e8 27 05 00 00       	call   5d0 <printf>
+    exit();
+  a9:	e8 75 03 00 00       	call   423 <exit>
+  rounds = argc > 2 ? atoi(argv[2]) : 500;
+  ae:	83 ec 0c             	sub    $0xc,%esp
+  b1:	ff 76 08             	push   0x8(%esi)
+  b4:	e8 f7 02 00 00       	call   3b0 <atoi>
+  if(mb == 0 || mb % 4 || rounds <= 0){
+  b9:	83 c4 10             	add    $0x10,%esp
+  rounds = argc > 2 ? atoi(argv[2]) : 500;
+  bc:	89 c2                	mov    %eax,%edx
+  if(mb == 0 || mb % 4 || rounds <= 0){
+  be:	85 db                	test   %ebx,%ebx
+  c0:	74 ca                	je     8c <main+0x8c>
+  c2:	f6 c3 03             	test   $0x3,%bl
+  c5:	75 c5                	jne    8c <main+0x8c>
+  c7:	85 c0                	test   %eax,%eax
+  c9:	7e c1                	jle    8c <main+0x8c>
+  cb:	e9 58 ff ff ff       	jmp    28 <main+0x28>
+  d0:	a8 03                	test   $0x3,%al
+  d2:	75 b8                	jne    8c <main+0x8c>
+  d4:	e9 4f ff ff ff       	jmp    28 <main+0x28>
+  }
+  printf(1, "%d MB, %d rounds: 4KB pages %d ticks, 4MB pages %d ticks\n",
+  d9:	51                   	push   %ecx
+  da:	51                   	push   %ecx
+  db:	50                   	push   %eax
+  dc:	56                   	push   %esi
+  dd:	52                   	push   %edx
+  de:	53                   	push   %ebx
+  df:	68 44 09 00 00       	push   $0x944
+  e4:	6a 01                	push   $0x1
+  e6:	e8 e5 04 00 00       	call   5d0 <printf>
+         mb, rounds, small, large);
+  exit();
+  eb:	83 c4 20             	add    $0x20,%esp
+  ee:	e8 30 03 00 00       	call   423 <exit>
+  f3:	66 90                	xchg   %ax,%ax
+  f5:	66 90                	xchg   %ax,%ax
+  f7:	66 90                	xchg   %ax,%ax
+  f9:	66 90                	xchg   %ax,%ax
+  fb:	66 90                	xchg   %ax,%ax
+  fd:	66 90                	xchg   %ax,%ax
+  ff:	90                   	nop
+
+00000100 <run>:
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	57                   	push   %edi
+ 104:	56                   	push   %esi
+ 105:	53                   	push   %ebx
+ 106:	83 ec 24             	sub    $0x24,%esp
+ 109:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 10c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  p = mmap(0, n, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS|flags, -1, 0);
+ 10f:	6a 00                	push   $0x0
+ 111:	6a ff                	push   $0xffffffff
+ 113:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 116:	83 c8 22             	or     $0x22,%eax
+ 119:	50                   	push   %eax
+ 11a:	6a 03                	push   $0x3
+ 11c:	53                   	push   %ebx
+ 11d:	6a 00                	push   $0x0
+ 11f:	e8 a7 03 00 00       	call   4cb <mmap>
+  if(p == MAP_FAILED)
+ 124:	83 c4 20             	add    $0x20,%esp
+ 127:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 12a:	0f 84 a0 00 00 00    	je     1d0 <run+0xd0>
+ 130:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < n; i += PGSIZE)
+ 132:	85 db                	test   %ebx,%ebx
+ 134:	74 19                	je     14f <run+0x4f>
+ 136:	31 c0                	xor    %eax,%eax
+ 138:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13f:	90                   	nop
+    p[i] = i;
+ 140:	8d 14 06             	lea    (%esi,%eax,1),%edx
+  for(i = 0; i < n; i += PGSIZE)
+ 143:	05 00 10 00 00       	add    $0x1000,%eax
+    p[i] = i;
+ 148:	c6 02 00             	movb   $0x0,(%edx)
+  for(i = 0; i < n; i += PGSIZE)
+ 14b:	39 d8                	cmp    %ebx,%eax
+ 14d:	72 f1                	jb     140 <run+0x40>
+  t = uptime();
+ 14f:	e8 67 03 00 00       	call   4bb <uptime>
+  for(r = 0; r < rounds; r++)
+ 154:	31 c9                	xor    %ecx,%ecx
+  t = uptime();
+ 156:	89 c2                	mov    %eax,%edx
+  for(r = 0; r < rounds; r++)
+ 158:	85 ff                	test   %edi,%edi
+ 15a:	7e 35                	jle    191 <run+0x91>
+    for(i = 0; i < n; i += PGSIZE)
+ 15c:	85 db                	test   %ebx,%ebx
+ 15e:	74 60                	je     1c0 <run+0xc0>
+ 160:	89 55 e0             	mov    %edx,-0x20(%ebp)
+ 163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 167:	90                   	nop
+ 168:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 16b:	31 c0                	xor    %eax,%eax
+ 16d:	8d 76 00             	lea    0x0(%esi),%esi
+      p[i]++;
+ 170:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+    for(i = 0; i < n; i += PGSIZE)
+ 173:	05 00 10 00 00       	add    $0x1000,%eax
+      p[i]++;
+ 178:	0f b6 11             	movzbl (%ecx),%edx
+ 17b:	83 c2 01             	add    $0x1,%edx
+ 17e:	88 11                	mov    %dl,(%ecx)
+    for(i = 0; i < n; i += PGSIZE)
+ 180:	39 d8                	cmp    %ebx,%eax
+ 182:	72 ec                	jb     170 <run+0x70>
+  for(r = 0; r < rounds; r++)
+ 184:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 187:	83 c1 01             	add    $0x1,%ecx
+ 18a:	39 f9                	cmp    %edi,%ecx
+ 18c:	75 da                	jne    168 <run+0x68>
+ 18e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 191:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  t = uptime() - t;
+ 194:	e8 22 03 00 00       	call   4bb <uptime>
+  munmap((void*)p, n);
+ 199:	83 ec 08             	sub    $0x8,%esp
+  t = uptime() - t;
+ 19c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  munmap((void*)p, n);
+ 19f:	53                   	push   %ebx
+ 1a0:	56                   	push   %esi
+  t = uptime() - t;
+ 1a1:	29 d0                	sub    %edx,%eax
+ 1a3:	89 c7                	mov    %eax,%edi
+  munmap((void*)p, n);
+ 1a5:	e8 29 03 00 00       	call   4d3 <munmap>
+  return t;
+ 1aa:	83 c4 10             	add    $0x10,%esp
+}
+ 1ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1b0:	89 f8                	mov    %edi,%eax
+ 1b2:	5b                   	pop    %ebx
+ 1b3:	5e                   	pop    %esi
+ 1b4:	5f                   	pop    %edi
+ 1b5:	5d                   	pop    %ebp
+ 1b6:	c3                   	ret
+ 1b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1be:	66 90                	xchg   %ax,%ax
+  for(r = 0; r < rounds; r++)
+ 1c0:	83 c1 01             	add    $0x1,%ecx
+ 1c3:	39 cf                	cmp    %ecx,%edi
+ 1c5:	74 ca                	je     191 <run+0x91>
+ 1c7:	83 c1 01             	add    $0x1,%ecx
+ 1ca:	39 cf                	cmp    %ecx,%edi
+ 1cc:	75 f2                	jne    1c0 <run+0xc0>
+ 1ce:	eb c1                	jmp    191 <run+0x91>
+    return -1;
+ 1d0:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+ 1d5:	eb d6                	jmp    1ad <run+0xad>
+ 1d7:	66 90                	xchg   %ax,%ax
+ 1d9:	66 90                	xchg   %ax,%ax
+ 1db:	66 90                	xchg   %ax,%ax
+ 1dd:	66 90                	xchg   %ax,%ax
+ 1df:	90                   	nop
+
+000001e0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 1e0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1e1:	31 c0                	xor    %eax,%eax
+{
+ 1e3:	89 e5                	mov    %esp,%ebp
+ 1e5:	53                   	push   %ebx
+ 1e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 1f0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1f4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1f7:	83 c0 01             	add    $0x1,%eax
+ 1fa:	84 d2                	test   %dl,%dl
+ 1fc:	75 f2                	jne    1f0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 1fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 201:	89 c8                	mov    %ecx,%eax
+ 203:	c9                   	leave
+ 204:	c3                   	ret
+ 205:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000210 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	53                   	push   %ebx
+ 214:	8b 55 08             	mov    0x8(%ebp),%edx
+ 217:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 21a:	0f b6 02             	movzbl (%edx),%eax
+ 21d:	84 c0                	test   %al,%al
+ 21f:	75 17                	jne    238 <strcmp+0x28>
+ 221:	eb 3a                	jmp    25d <strcmp+0x4d>
+ 223:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 227:	90                   	nop
+ 228:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 22c:	83 c2 01             	add    $0x1,%edx
+ 22f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 232:	84 c0                	test   %al,%al
+ 234:	74 1a                	je     250 <strcmp+0x40>
+    p++, q++;
+ 236:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 238:	0f b6 19             	movzbl (%ecx),%ebx
+ 23b:	38 c3                	cmp    %al,%bl
+ 23d:	74 e9                	je     228 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 23f:	29 d8                	sub    %ebx,%eax
+}
+ 241:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 244:	c9                   	leave
+ 245:	c3                   	ret
+ 246:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 250:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 254:	31 c0                	xor    %eax,%eax
+ 256:	29 d8                	sub    %ebx,%eax
+}
+ 258:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 25b:	c9                   	leave
+ 25c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 25d:	0f b6 19             	movzbl (%ecx),%ebx
+ 260:	31 c0                	xor    %eax,%eax
+ 262:	eb db                	jmp    23f <strcmp+0x2f>
+ 264:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 26f:	90                   	nop
+
+00000270 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 276:	80 3a 00             	cmpb   $0x0,(%edx)
+ 279:	74 15                	je     290 <strlen+0x20>
+ 27b:	31 c0                	xor    %eax,%eax
+ 27d:	8d 76 00             	lea    0x0(%esi),%esi
+ 280:	83 c0 01             	add    $0x1,%eax
+ 283:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 287:	89 c1                	mov    %eax,%ecx
+ 289:	75 f5                	jne    280 <strlen+0x10>
+    ;
+  return n;
+}
+ 28b:	89 c8                	mov    %ecx,%eax
+ 28d:	5d                   	pop    %ebp
+ 28e:	c3                   	ret
+ 28f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 290:	31 c9                	xor    %ecx,%ecx
+}
+ 292:	5d                   	pop    %ebp
+ 293:	89 c8                	mov    %ecx,%eax
+ 295:	c3                   	ret
+ 296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002a0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	57                   	push   %edi
+ 2a4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 2a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2ad:	89 d7                	mov    %edx,%edi
+ 2af:	fc                   	cld
+ 2b0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 2b2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 2b5:	89 d0                	mov    %edx,%eax
+ 2b7:	c9                   	leave
+ 2b8:	c3                   	ret
+ 2b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002c0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2ca:	0f b6 10             	movzbl (%eax),%edx
+ 2cd:	84 d2                	test   %dl,%dl
+ 2cf:	75 12                	jne    2e3 <strchr+0x23>
+ 2d1:	eb 1d                	jmp    2f0 <strchr+0x30>
+ 2d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2d7:	90                   	nop
+ 2d8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2dc:	83 c0 01             	add    $0x1,%eax
+ 2df:	84 d2                	test   %dl,%dl
+ 2e1:	74 0d                	je     2f0 <strchr+0x30>
+    if(*s == c)
+ 2e3:	38 d1                	cmp    %dl,%cl
+ 2e5:	75 f1                	jne    2d8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2e7:	5d                   	pop    %ebp
+ 2e8:	c3                   	ret
+ 2e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 2f0:	31 c0                	xor    %eax,%eax
+}
+ 2f2:	5d                   	pop    %ebp
+ 2f3:	c3                   	ret
+ 2f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ff:	90                   	nop
+
+00000300 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	57                   	push   %edi
+ 304:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 305:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 308:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 309:	31 db                	xor    %ebx,%ebx
+{
+ 30b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 30e:	eb 27                	jmp    337 <gets+0x37>
+    cc = read(0, &c, 1);
+ 310:	83 ec 04             	sub    $0x4,%esp
+ 313:	6a 01                	push   $0x1
+ 315:	56                   	push   %esi
+ 316:	6a 00                	push   $0x0
+ 318:	e8 1e 01 00 00       	call   43b <read>
+    if(cc < 1)
+ 31d:	83 c4 10             	add    $0x10,%esp
+ 320:	85 c0                	test   %eax,%eax
+ 322:	7e 1d                	jle    341 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 324:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 328:	8b 55 08             	mov    0x8(%ebp),%edx
+ 32b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 32f:	3c 0a                	cmp    $0xa,%al
+ 331:	74 10                	je     343 <gets+0x43>
+ 333:	3c 0d                	cmp    $0xd,%al
+ 335:	74 0c                	je     343 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 337:	89 df                	mov    %ebx,%edi
+ 339:	83 c3 01             	add    $0x1,%ebx
+ 33c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 33f:	7c cf                	jl     310 <gets+0x10>
+ 341:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 343:	8b 45 08             	mov    0x8(%ebp),%eax
+ 346:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 34a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 34d:	5b                   	pop    %ebx
+ 34e:	5e                   	pop    %esi
+ 34f:	5f                   	pop    %edi
+ 350:	5d                   	pop    %ebp
+ 351:	c3                   	ret
+ 352:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 359:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000360 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	56                   	push   %esi
+ 364:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 365:	83 ec 08             	sub    $0x8,%esp
+ 368:	6a 00                	push   $0x0
+ 36a:	ff 75 08             	push   0x8(%ebp)
+ 36d:	e8 f1 00 00 00       	call   463 <open>
+  if(fd < 0)
+ 372:	83 c4 10             	add    $0x10,%esp
+ 375:	85 c0                	test   %eax,%eax
+ 377:	78 27                	js     3a0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 379:	83 ec 08             	sub    $0x8,%esp
+ 37c:	ff 75 0c             	push   0xc(%ebp)
+ 37f:	89 c3                	mov    %eax,%ebx
+ 381:	50                   	push   %eax
+ 382:	e8 f4 00 00 00       	call   47b <fstat>
+  close(fd);
+ 387:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 38a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 38c:	e8 ba 00 00 00       	call   44b <close>
+  return r;
+ 391:	83 c4 10             	add    $0x10,%esp
+}
+ 394:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 397:	89 f0                	mov    %esi,%eax
+ 399:	5b                   	pop    %ebx
+ 39a:	5e                   	pop    %esi
+ 39b:	5d                   	pop    %ebp
+ 39c:	c3                   	ret
+ 39d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 3a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3a5:	eb ed                	jmp    394 <stat+0x34>
+ 3a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ae:	66 90                	xchg   %ax,%ax
+
+000003b0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	53                   	push   %ebx
+ 3b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 3b7:	0f be 02             	movsbl (%edx),%eax
+ 3ba:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 3bd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 3c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 3c5:	77 1e                	ja     3e5 <atoi+0x35>
+ 3c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ce:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3d0:	83 c2 01             	add    $0x1,%edx
+ 3d3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3d6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3da:	0f be 02             	movsbl (%edx),%eax
+ 3dd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3e0:	80 fb 09             	cmp    $0x9,%bl
+ 3e3:	76 eb                	jbe    3d0 <atoi+0x20>
+  return n;
+}
+ 3e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3e8:	89 c8                	mov    %ecx,%eax
+ 3ea:	c9                   	leave
+ 3eb:	c3                   	ret
+ 3ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003f0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	57                   	push   %edi
+ 3f4:	56                   	push   %esi
+ 3f5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 3fe:	85 c0                	test   %eax,%eax
+ 400:	7e 13                	jle    415 <memmove+0x25>
+ 402:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 404:	89 d7                	mov    %edx,%edi
+ 406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 410:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 411:	39 f8                	cmp    %edi,%eax
+ 413:	75 fb                	jne    410 <memmove+0x20>
+  return vdst;
+}
+ 415:	5e                   	pop    %esi
+ 416:	89 d0                	mov    %edx,%eax
+ 418:	5f                   	pop    %edi
+ 419:	5d                   	pop    %ebp
+ 41a:	c3                   	ret
+
+0000041b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 41b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <exit>:
+SYSCALL(exit)
+ 423:	b8 02 00 00 00       	mov    $0x2,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <wait>:
+SYSCALL(wait)
+ 42b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <pipe>:
+SYSCALL(pipe)
+ 433:	b8 04 00 00 00       	mov    $0x4,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <read>:
+SYSCALL(read)
+ 43b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <write>:
+SYSCALL(write)
+ 443:	b8 10 00 00 00       	mov    $0x10,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <close>:
+SYSCALL(close)
+ 44b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <kill>:
+SYSCALL(kill)
+ 453:	b8 06 00 00 00       	mov    $0x6,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <exec>:
+SYSCALL(exec)
+ 45b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <open>:
+SYSCALL(open)
+ 463:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <mknod>:
+SYSCALL(mknod)
+ 46b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <unlink>:
+SYSCALL(unlink)
+ 473:	b8 12 00 00 00       	mov    $0x12,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <fstat>:
+SYSCALL(fstat)
+ 47b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <link>:
+SYSCALL(link)
+ 483:	b8 13 00 00 00       	mov    $0x13,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <mkdir>:
+SYSCALL(mkdir)
+ 48b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <chdir>:
+SYSCALL(chdir)
+ 493:	b8 09 00 00 00       	mov    $0x9,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <dup>:
+SYSCALL(dup)
+ 49b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <getpid>:
+SYSCALL(getpid)
+ 4a3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <sbrk>:
+SYSCALL(sbrk)
+ 4ab:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <sleep>:
+SYSCALL(sleep)
+ 4b3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <uptime>:
+SYSCALL(uptime)
+ 4bb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <memstat>:
+SYSCALL(memstat)
+ 4c3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <mmap>:
+SYSCALL(mmap)
+ 4cb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <munmap>:
+SYSCALL(munmap)
+ 4d3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <shmget>:
+SYSCALL(shmget)
+ 4db:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <shmat>:
+SYSCALL(shmat)
+ 4e3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <shmdt>:
+SYSCALL(shmdt)
+ 4eb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <spawn>:
+SYSCALL(spawn)
+ 4f3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <setpriority>:
+SYSCALL(setpriority)
+ 4fb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <procinfo>:
+SYSCALL(procinfo)
+ 503:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <setaffinity>:
+SYSCALL(setaffinity)
+ 50b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <getaffinity>:
+SYSCALL(getaffinity)
+ 513:	b8 20 00 00 00       	mov    $0x20,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <shmrm>:
+SYSCALL(shmrm)
+ 51b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+ 523:	66 90                	xchg   %ax,%ax
+ 525:	66 90                	xchg   %ax,%ax
+ 527:	66 90                	xchg   %ax,%ax
+ 529:	66 90                	xchg   %ax,%ax
+ 52b:	66 90                	xchg   %ax,%ax
+ 52d:	66 90                	xchg   %ax,%ax
+ 52f:	90                   	nop
+
+00000530 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	57                   	push   %edi
+ 534:	56                   	push   %esi
+ 535:	53                   	push   %ebx
+ 536:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 538:	89 d1                	mov    %edx,%ecx
+{
+ 53a:	83 ec 3c             	sub    $0x3c,%esp
+ 53d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 540:	85 d2                	test   %edx,%edx
+ 542:	0f 89 80 00 00 00    	jns    5c8 <printint+0x98>
+ 548:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 54c:	74 7a                	je     5c8 <printint+0x98>
+    x = -xx;
+ 54e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 550:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 555:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 558:	31 f6                	xor    %esi,%esi
+ 55a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 560:	89 c8                	mov    %ecx,%eax
+ 562:	31 d2                	xor    %edx,%edx
+ 564:	89 f7                	mov    %esi,%edi
+ 566:	f7 f3                	div    %ebx
+ 568:	8d 76 01             	lea    0x1(%esi),%esi
+ 56b:	0f b6 92 f4 09 00 00 	movzbl 0x9f4(%edx),%edx
+ 572:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 576:	89 ca                	mov    %ecx,%edx
+ 578:	89 c1                	mov    %eax,%ecx
+ 57a:	39 da                	cmp    %ebx,%edx
+ 57c:	73 e2                	jae    560 <printint+0x30>
+  if(neg)
+ 57e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 581:	85 c0                	test   %eax,%eax
+ 583:	74 07                	je     58c <printint+0x5c>
+    buf[i++] = '-';
+ 585:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 58a:	89 f7                	mov    %esi,%edi
+ 58c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 58f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 592:	01 df                	add    %ebx,%edi
+ 594:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 598:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 59b:	83 ec 04             	sub    $0x4,%esp
+ 59e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 5a1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 5a4:	6a 01                	push   $0x1
+ 5a6:	50                   	push   %eax
+ 5a7:	56                   	push   %esi
+ 5a8:	e8 96 fe ff ff       	call   443 <write>
+  while(--i >= 0)
+ 5ad:	89 f8                	mov    %edi,%eax
+ 5af:	83 c4 10             	add    $0x10,%esp
+ 5b2:	83 ef 01             	sub    $0x1,%edi
+ 5b5:	39 d8                	cmp    %ebx,%eax
+ 5b7:	75 df                	jne    598 <printint+0x68>
+}
+ 5b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5bc:	5b                   	pop    %ebx
+ 5bd:	5e                   	pop    %esi
+ 5be:	5f                   	pop    %edi
+ 5bf:	5d                   	pop    %ebp
+ 5c0:	c3                   	ret
+ 5c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 5c8:	31 c0                	xor    %eax,%eax
+ 5ca:	eb 89                	jmp    555 <printint+0x25>
+ 5cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005d0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	89 e5                	mov    %esp,%ebp
+ 5d3:	57                   	push   %edi
+ 5d4:	56                   	push   %esi
+ 5d5:	53                   	push   %ebx
+ 5d6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 5d9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 5dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 5df:	0f b6 1e             	movzbl (%esi),%ebx
+ 5e2:	83 c6 01             	add    $0x1,%esi
+ 5e5:	84 db                	test   %bl,%bl
+ 5e7:	74 67                	je     650 <printf+0x80>
+ 5e9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 5ec:	31 d2                	xor    %edx,%edx
+ 5ee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 5f1:	eb 34                	jmp    627 <printf+0x57>
+ 5f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5f7:	90                   	nop
+ 5f8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 5fb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 600:	83 f8 25             	cmp    $0x25,%eax
+ 603:	74 18                	je     61d <printf+0x4d>
+  write(fd, &c, 1);
+ 605:	83 ec 04             	sub    $0x4,%esp
+ 608:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 60b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 60e:	6a 01                	push   $0x1
+ 610:	50                   	push   %eax
+ 611:	57                   	push   %edi
+ 612:	e8 2c fe ff ff       	call   443 <write>
+ 617:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 61a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 61d:	0f b6 1e             	movzbl (%esi),%ebx
+ 620:	83 c6 01             	add    $0x1,%esi
+ 623:	84 db                	test   %bl,%bl
+ 625:	74 29                	je     650 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 627:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 62a:	85 d2                	test   %edx,%edx
+ 62c:	74 ca                	je     5f8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 62e:	83 fa 25             	cmp    $0x25,%edx
+ 631:	75 ea                	jne    61d <printf+0x4d>
+      if(c == 'd'){
+ 633:	83 f8 25             	cmp    $0x25,%eax
+ 636:	0f 84 24 01 00 00    	je     760 <printf+0x190>
+ 63c:	83 e8 63             	sub    $0x63,%eax
+ 63f:	83 f8 15             	cmp    $0x15,%eax
+ 642:	77 1c                	ja     660 <printf+0x90>
+ 644:	ff 24 85 9c 09 00 00 	jmp    *0x99c(,%eax,4)
+ 64b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 64f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 650:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 653:	5b                   	pop    %ebx
+ 654:	5e                   	pop    %esi
+ 655:	5f                   	pop    %edi
+ 656:	5d                   	pop    %ebp
+ 657:	c3                   	ret
+ 658:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 65f:	90                   	nop
+  write(fd, &c, 1);
+ 660:	83 ec 04             	sub    $0x4,%esp
+ 663:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 666:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 66a:	6a 01                	push   $0x1
+ 66c:	52                   	push   %edx
+ 66d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 670:	57                   	push   %edi
+ 671:	e8 cd fd ff ff       	call   443 <write>
+ 676:	83 c4 0c             	add    $0xc,%esp
+ 679:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 67c:	6a 01                	push   $0x1
+ 67e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 681:	52                   	push   %edx
+ 682:	57                   	push   %edi
+ 683:	e8 bb fd ff ff       	call   443 <write>
+        putc(fd, c);
+ 688:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 68b:	31 d2                	xor    %edx,%edx
+ 68d:	eb 8e                	jmp    61d <printf+0x4d>
+ 68f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 690:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 693:	83 ec 0c             	sub    $0xc,%esp
+ 696:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 69b:	8b 13                	mov    (%ebx),%edx
+ 69d:	6a 00                	push   $0x0
+ 69f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 6a1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 6a4:	e8 87 fe ff ff       	call   530 <printint>
+        ap++;
+ 6a9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6ac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6af:	31 d2                	xor    %edx,%edx
+ 6b1:	e9 67 ff ff ff       	jmp    61d <printf+0x4d>
+ 6b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6bd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 6c0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6c3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 6c5:	83 c0 04             	add    $0x4,%eax
+ 6c8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 6cb:	85 db                	test   %ebx,%ebx
+ 6cd:	0f 84 9d 00 00 00    	je     770 <printf+0x1a0>
+        while(*s != 0){
+ 6d3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 6d6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 6d8:	84 c0                	test   %al,%al
+ 6da:	0f 84 3d ff ff ff    	je     61d <printf+0x4d>
+ 6e0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6e3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 6e6:	89 de                	mov    %ebx,%esi
+ 6e8:	89 d3                	mov    %edx,%ebx
+ 6ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 6f0:	83 ec 04             	sub    $0x4,%esp
+ 6f3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 6f6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 6f9:	6a 01                	push   $0x1
+ 6fb:	53                   	push   %ebx
+ 6fc:	57                   	push   %edi
+ 6fd:	e8 41 fd ff ff       	call   443 <write>
+        while(*s != 0){
+ 702:	0f b6 06             	movzbl (%esi),%eax
+ 705:	83 c4 10             	add    $0x10,%esp
+ 708:	84 c0                	test   %al,%al
+ 70a:	75 e4                	jne    6f0 <printf+0x120>
+      state = 0;
+ 70c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 70f:	31 d2                	xor    %edx,%edx
+ 711:	e9 07 ff ff ff       	jmp    61d <printf+0x4d>
+ 716:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 71d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 720:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 723:	83 ec 0c             	sub    $0xc,%esp
+ 726:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 72b:	8b 13                	mov    (%ebx),%edx
+ 72d:	6a 01                	push   $0x1
+ 72f:	e9 6b ff ff ff       	jmp    69f <printf+0xcf>
+ 734:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 738:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 73b:	83 ec 04             	sub    $0x4,%esp
+ 73e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 741:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 743:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 746:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 749:	6a 01                	push   $0x1
+ 74b:	52                   	push   %edx
+ 74c:	57                   	push   %edi
+ 74d:	e8 f1 fc ff ff       	call   443 <write>
+        ap++;
+ 752:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 755:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 758:	31 d2                	xor    %edx,%edx
+ 75a:	e9 be fe ff ff       	jmp    61d <printf+0x4d>
+ 75f:	90                   	nop
+  write(fd, &c, 1);
+ 760:	83 ec 04             	sub    $0x4,%esp
+ 763:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 766:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 769:	6a 01                	push   $0x1
+ 76b:	e9 11 ff ff ff       	jmp    681 <printf+0xb1>
+ 770:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 775:	bb 95 09 00 00       	mov    $0x995,%ebx
+ 77a:	e9 61 ff ff ff       	jmp    6e0 <printf+0x110>
+ 77f:	90                   	nop
+
+00000780 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 780:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 781:	a1 00 10 00 00       	mov    0x1000,%eax
+{
+ 786:	89 e5                	mov    %esp,%ebp
+ 788:	57                   	push   %edi
+ 789:	56                   	push   %esi
+ 78a:	53                   	push   %ebx
+ 78b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 78e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 791:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 798:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 79a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 79c:	39 ca                	cmp    %ecx,%edx
+ 79e:	73 30                	jae    7d0 <free+0x50>
+ 7a0:	39 c1                	cmp    %eax,%ecx
+ 7a2:	72 04                	jb     7a8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7a4:	39 c2                	cmp    %eax,%edx
+ 7a6:	72 f0                	jb     798 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7a8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 7ab:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 7ae:	39 f8                	cmp    %edi,%eax
+ 7b0:	74 2e                	je     7e0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7b2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 7b5:	8b 42 04             	mov    0x4(%edx),%eax
+ 7b8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7bb:	39 f1                	cmp    %esi,%ecx
+ 7bd:	74 38                	je     7f7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 7bf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 7c1:	5b                   	pop    %ebx
+  freep = p;
+ 7c2:	89 15 00 10 00 00    	mov    %edx,0x1000
+}
+ 7c8:	5e                   	pop    %esi
+ 7c9:	5f                   	pop    %edi
+ 7ca:	5d                   	pop    %ebp
+ 7cb:	c3                   	ret
+ 7cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7d0:	39 c1                	cmp    %eax,%ecx
+ 7d2:	72 d0                	jb     7a4 <free+0x24>
+ 7d4:	eb c2                	jmp    798 <free+0x18>
+ 7d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7dd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 7e0:	03 70 04             	add    0x4(%eax),%esi
+ 7e3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7e6:	8b 02                	mov    (%edx),%eax
+ 7e8:	8b 00                	mov    (%eax),%eax
+ 7ea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 7ed:	8b 42 04             	mov    0x4(%edx),%eax
+ 7f0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7f3:	39 f1                	cmp    %esi,%ecx
+ 7f5:	75 c8                	jne    7bf <free+0x3f>
+    p->s.size += bp->s.size;
+ 7f7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 7fa:	89 15 00 10 00 00    	mov    %edx,0x1000
+    p->s.size += bp->s.size;
+ 800:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 803:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 806:	89 0a                	mov    %ecx,(%edx)
+}
+ 808:	5b                   	pop    %ebx
+ 809:	5e                   	pop    %esi
+ 80a:	5f                   	pop    %edi
+ 80b:	5d                   	pop    %ebp
+ 80c:	c3                   	ret
+ 80d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000810 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 810:	55                   	push   %ebp
+ 811:	89 e5                	mov    %esp,%ebp
+ 813:	57                   	push   %edi
+ 814:	56                   	push   %esi
+ 815:	53                   	push   %ebx
+ 816:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 819:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 81c:	8b 15 00 10 00 00    	mov    0x1000,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 822:	8d 78 07             	lea    0x7(%eax),%edi
+ 825:	c1 ef 03             	shr    $0x3,%edi
+ 828:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 82b:	85 d2                	test   %edx,%edx
+ 82d:	0f 84 8d 00 00 00    	je     8c0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 833:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 835:	8b 48 04             	mov    0x4(%eax),%ecx
+ 838:	39 f9                	cmp    %edi,%ecx
+ 83a:	73 64                	jae    8a0 <malloc+0x90>
+  if(nu < 4096)
+ 83c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 841:	39 df                	cmp    %ebx,%edi
+ 843:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 846:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 84d:	eb 0a                	jmp    859 <malloc+0x49>
+ 84f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 850:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 852:	8b 48 04             	mov    0x4(%eax),%ecx
+ 855:	39 f9                	cmp    %edi,%ecx
+ 857:	73 47                	jae    8a0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 859:	89 c2                	mov    %eax,%edx
+ 85b:	39 05 00 10 00 00    	cmp    %eax,0x1000
+ 861:	75 ed                	jne    850 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 863:	83 ec 0c             	sub    $0xc,%esp
+ 866:	56                   	push   %esi
+ 867:	e8 3f fc ff ff       	call   4ab <sbrk>
+  if(p == (char*)-1)
+ 86c:	83 c4 10             	add    $0x10,%esp
+ 86f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 872:	74 1c                	je     890 <malloc+0x80>
+  hp->s.size = nu;
+ 874:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 877:	83 ec 0c             	sub    $0xc,%esp
+ 87a:	83 c0 08             	add    $0x8,%eax
+ 87d:	50                   	push   %eax
+ 87e:	e8 fd fe ff ff       	call   780 <free>
+  return freep;
+ 883:	8b 15 00 10 00 00    	mov    0x1000,%edx
+      if((p = morecore(nunits)) == 0)
+ 889:	83 c4 10             	add    $0x10,%esp
+ 88c:	85 d2                	test   %edx,%edx
+ 88e:	75 c0                	jne    850 <malloc+0x40>
+        return 0;
+  }
+}
+ 890:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 893:	31 c0                	xor    %eax,%eax
+}
+ 895:	5b                   	pop    %ebx
+ 896:	5e                   	pop    %esi
+ 897:	5f                   	pop    %edi
+ 898:	5d                   	pop    %ebp
+ 899:	c3                   	ret
+ 89a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 8a0:	39 cf                	cmp    %ecx,%edi
+ 8a2:	74 4c                	je     8f0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 8a4:	29 f9                	sub    %edi,%ecx
+ 8a6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 8a9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 8ac:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 8af:	89 15 00 10 00 00    	mov    %edx,0x1000
+}
+ 8b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 8b8:	83 c0 08             	add    $0x8,%eax
+}
+ 8bb:	5b                   	pop    %ebx
+ 8bc:	5e                   	pop    %esi
+ 8bd:	5f                   	pop    %edi
+ 8be:	5d                   	pop    %ebp
+ 8bf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 8c0:	c7 05 00 10 00 00 04 	movl   $0x1004,0x1000
+ 8c7:	10 00 00 
+    base.s.size = 0;
+ 8ca:	b8 04 10 00 00       	mov    $0x1004,%eax
+    base.s.ptr = freep = prevp = &base;
+ 8cf:	c7 05 04 10 00 00 04 	movl   $0x1004,0x1004
+ 8d6:	10 00 00 
+    base.s.size = 0;
+ 8d9:	c7 05 08 10 00 00 00 	movl   $0x0,0x1008
+ 8e0:	00 00 00 
+    if(p->s.size >= nunits){
+ 8e3:	e9 54 ff ff ff       	jmp    83c <malloc+0x2c>
+ 8e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 8f0:	8b 08                	mov    (%eax),%ecx
+ 8f2:	89 0a                	mov    %ecx,(%edx)
+ 8f4:	eb b9                	jmp    8af <malloc+0x9f>
@@ -0,0 +1,63 @@
+// Compare a loop bound by TLB misses on ordinary 4KB pages
+// with the same loop on 4MB pages (mmap with MAP_LARGE).
+//
+// usage: tlbbench [megabytes [rounds]]
+//
+// The loop reads one word from each page of the region in turn,
+// so with 4KB pages nearly every read needs a page table walk,
+// while the 4MB pages of even a large region fit in the TLB.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "mman.h"
+
+#define PGSIZE 4096
+
+// Touch every page of an n-byte region with the given mmap
+// flags once, then time rounds passes over it. Returns the
+// time in ticks, or -1 if the region cannot be mapped.
+int
+run(uint n, int flags, int rounds)
+{
+  volatile char *p;
+  uint i;
+  int r, t;
+
+  p = mmap(0, n, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS|flags, -1, 0);
+  if(p == MAP_FAILED)
+    return -1;
+  for(i = 0; i < n; i += PGSIZE)
+    p[i] = i;
+  t = uptime();
+  for(r = 0; r < rounds; r++)
+    for(i = 0; i < n; i += PGSIZE)
+      p[i]++;
+  t = uptime() - t;
+  munmap((void*)p, n);
+  return t;
+}
+
+int
+main(int argc, char *argv[])
+{
+  uint mb;
+  int rounds, small, large;
+
+  mb = argc > 1 ? atoi(argv[1]) : 64;
+  rounds = argc > 2 ? atoi(argv[2]) : 500;
+  if(mb == 0 || mb % 4 || rounds <= 0){
+    printf(2, "usage: tlbbench [megabytes [rounds]]\n");
+    printf(2, "megabytes must be a multiple of 4\n");
+    exit();
+  }
+  small = run(mb << 20, 0, rounds);
+  large = run(mb << 20, MAP_LARGE, rounds);
+  if(small < 0 || large < 0){
+    printf(2, "tlbbench: mmap failed\n");
+    exit();
+  }
+  printf(1, "%d MB, %d rounds: 4KB pages %d ticks, 4MB pages %d ticks\n",
+         mb, rounds, small, large);
+  exit();
+}
@@ -36,6 +36,9 @@ idtinit(void)
 void
 trap(struct trapframe *tf)
 {
+  uint va;
+  int r;
+
   if(tf->trapno == T_SYSCALL){
     if(myproc()->killed)
       exit();
@@ -53,6 +56,8 @@ trap(struct trapframe *tf)
       ticks++;
       wakeup(&ticks);
       release(&tickslock);
+      if(ticks % BOOSTTICKS == 0)
+        boost();
     }
     lapiceoi();
     break;
@@ -67,6 +72,10 @@ trap(struct trapframe *tf)
     kbdintr();
     lapiceoi();
     break;
+  case T_IRQ0 + IRQ_WAKEUP:
+    // An idle CPU halted in scheduler() has work (see kick).
+    lapiceoi();
+    break;
   case T_IRQ0 + IRQ_COM1:
     uartintr();
     lapiceoi();
@@ -77,6 +86,20 @@ trap(struct trapframe *tf)
             cpuid(), tf->cs, tf->eip);
     lapiceoi();
     break;
+  case T_PGFLT:
+    // Faults on pages not yet present and copy-on-write faults
+    // are resolved and the access retried. Anything else is an
+    // ordinary bad trap. A fault from user code is handled with
+    // interrupts on, as a system call would be, since getting a
+    // page may have to swap others out, which sleeps.
+    va = rcr2();
+    if((tf->cs&3) == DPL_USER)
+      sti();
+    r = myproc() ? pagefault(va, tf->err) : -1;
+    cli();
+    if(r == 0)
+      break;
+    // fall through
 
   //PAGEBREAK: 13
   default:
@@ -100,10 +123,11 @@ trap(struct trapframe *tf)
   if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
     exit();
 
-  // Force process to give up CPU on clock tick.
+  // Charge the clock tick to the process, which gives up the
+  // CPU when its time slice is over (see slicetick).
   // If interrupts were on while locks held, would need to check nlock.
   if(myproc() && myproc()->state == RUNNING &&
-     tf->trapno == T_IRQ0+IRQ_TIMER)
+     tf->trapno == T_IRQ0+IRQ_TIMER && slicetick())
     yield();
 
   // Check if the process has been killed since we yielded
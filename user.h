@@ -1,5 +1,7 @@
 struct stat;
 struct rtcdate;
+struct memstat;
+struct procinfo;
 
 // system calls
 int fork(void);
@@ -23,6 +25,18 @@ int getpid(void);
 char* sbrk(int);
 int sleep(int);
 int uptime(void);
+int memstat(struct memstat*);
+void* mmap(void*, uint, int, int, int, uint);
+int munmap(void*, uint);
+int shmget(int, uint);
+void* shmat(int);
+int shmdt(void*);
+int shmrm(int);
+int spawn(char*, char**, int*);
+int setpriority(int, int);
+int procinfo(struct procinfo*, int);
+int setaffinity(int, uint);
+int getaffinity(int);
 
 // ulib.c
 int stat(const char*, struct stat*);
@@ -0,0 +1,9043 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return randstate;
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "usertests starting\n");
+      11:	68 c1 69 00 00       	push   $0x69c1
+      16:	6a 01                	push   $0x1
+      18:	e8 93 52 00 00       	call   52b0 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+      1d:	59                   	pop    %ecx
+      1e:	58                   	pop    %eax
+      1f:	6a 00                	push   $0x0
+      21:	68 d5 69 00 00       	push   $0x69d5
+      26:	e8 18 51 00 00       	call   5143 <open>
+      2b:	83 c4 10             	add    $0x10,%esp
+      2e:	85 c0                	test   %eax,%eax
+      30:	78 13                	js     45 <main+0x45>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+      32:	52                   	push   %edx
+      33:	52                   	push   %edx
+      34:	68 00 77 00 00       	push   $0x7700
+      39:	6a 01                	push   $0x1
+      3b:	e8 70 52 00 00       	call   52b0 <printf>
+    exit();
+      40:	e8 be 50 00 00       	call   5103 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+      45:	50                   	push   %eax
+      46:	50                   	push   %eax
+      47:	68 00 02 00 00       	push   $0x200
+      4c:	68 d5 69 00 00       	push   $0x69d5
+      51:	e8 ed 50 00 00       	call   5143 <open>
+      56:	89 04 24             	mov    %eax,(%esp)
+      59:	e8 cd 50 00 00       	call   512b <close>
+
+  argptest();
+      5e:	e8 cd 4d 00 00       	call   4e30 <argptest>
+  createdelete();
+      63:	e8 58 28 00 00       	call   28c0 <createdelete>
+  linkunlink();
+      68:	e8 f3 30 00 00       	call   3160 <linkunlink>
+  concreate();
+      6d:	e8 ee 2d 00 00       	call   2e60 <concreate>
+  fourfiles();
+      72:	e8 49 26 00 00       	call   26c0 <fourfiles>
+  sharedfd();
+      77:	e8 84 24 00 00       	call   2500 <sharedfd>
+
+  bigargtest();
+      7c:	e8 6f 4a 00 00       	call   4af0 <bigargtest>
+  bigwrite();
+      81:	e8 fa 39 00 00       	call   3a80 <bigwrite>
+  bigargtest();
+      86:	e8 65 4a 00 00       	call   4af0 <bigargtest>
+  bsstest();
+      8b:	e8 f0 49 00 00       	call   4a80 <bsstest>
+  sbrktest();
+      90:	e8 2b 43 00 00       	call   43c0 <sbrktest>
+  lazysbrktest();
+      95:	e8 66 47 00 00       	call   4800 <lazysbrktest>
+  validatetest();
+      9a:	e8 31 49 00 00       	call   49d0 <validatetest>
+
+  opentest();
+      9f:	e8 5c 05 00 00       	call   600 <opentest>
+  writetest();
+      a4:	e8 e7 05 00 00       	call   690 <writetest>
+  writetest1();
+      a9:	e8 c2 07 00 00       	call   870 <writetest1>
+  createtest();
+      ae:	e8 8d 09 00 00       	call   a40 <createtest>
+
+  openiputtest();
+      b3:	e8 48 04 00 00       	call   500 <openiputtest>
+  exitiputtest();
+      b8:	e8 43 03 00 00       	call   400 <exitiputtest>
+  iputtest();
+      bd:	e8 5e 02 00 00       	call   320 <iputtest>
+
+  mem();
+      c2:	e8 d9 0e 00 00       	call   fa0 <mem>
+  cowtest();
+      c7:	e8 a4 0f 00 00       	call   1070 <cowtest>
+  pcachetest();
+      cc:	e8 7f 00 00 00       	call   150 <pcachetest>
+  mmaptest();
+      d1:	e8 6a 11 00 00       	call   1240 <mmaptest>
+  swaptest();
+      d6:	e8 e5 15 00 00       	call   16c0 <swaptest>
+  shmtest();
+      db:	e8 70 18 00 00       	call   1950 <shmtest>
+  spawntest();
+      e0:	e8 bb 1a 00 00       	call   1ba0 <spawntest>
+  lgpagetest();
+      e5:	e8 46 1c 00 00       	call   1d30 <lgpagetest>
+  stacktest();
+      ea:	e8 a1 1e 00 00       	call   1f90 <stacktest>
+  priotest();
+      ef:	e8 ec 1f 00 00       	call   20e0 <priotest>
+  affinitytest();
+      f4:	e8 f7 21 00 00       	call   22f0 <affinitytest>
+  pipe1();
+      f9:	e8 22 0b 00 00       	call   c20 <pipe1>
+  preempt();
+      fe:	e8 bd 0c 00 00       	call   dc0 <preempt>
+  exitwait();
+     103:	e8 18 0e 00 00       	call   f20 <exitwait>
+
+  rmdot();
+     108:	e8 63 3d 00 00       	call   3e70 <rmdot>
+  fourteen();
+     10d:	e8 1e 3c 00 00       	call   3d30 <fourteen>
+  bigfile();
+     112:	e8 49 3a 00 00       	call   3b60 <bigfile>
+  subdir();
+     117:	e8 84 32 00 00       	call   33a0 <subdir>
+  linktest();
+     11c:	e8 2f 2b 00 00       	call   2c50 <linktest>
+  unlinkread();
+     121:	e8 9a 29 00 00       	call   2ac0 <unlinkread>
+  dirfile();
+     126:	e8 c5 3e 00 00       	call   3ff0 <dirfile>
+  iref();
+     12b:	e8 c0 40 00 00       	call   41f0 <iref>
+  forktest();
+     130:	e8 db 41 00 00       	call   4310 <forktest>
+  bigdir(); // slow
+     135:	e8 36 31 00 00       	call   3270 <bigdir>
+
+  uio();
+     13a:	e8 81 4c 00 00       	call   4dc0 <uio>
+
+  exectest();
+     13f:	e8 8c 0a 00 00       	call   bd0 <exectest>
+
+  exit();
+     144:	e8 ba 4f 00 00       	call   5103 <exit>
+     149:	66 90                	xchg   %ax,%ax
+     14b:	66 90                	xchg   %ax,%ax
+     14d:	66 90                	xchg   %ax,%ax
+     14f:	90                   	nop
+
+00000150 <pcachetest>:
+{
+     150:	55                   	push   %ebp
+     151:	89 e5                	mov    %esp,%ebp
+     153:	56                   	push   %esi
+     154:	53                   	push   %ebx
+    memstat(&ms1);
+     155:	8d b5 f0 fe ff ff    	lea    -0x110(%ebp),%esi
+{
+     15b:	81 ec 28 01 00 00    	sub    $0x128,%esp
+  char *args[] = { "echo", "pcache", "echo", 0 };
+     161:	c7 85 e0 fe ff ff d8 	movl   $0x55d8,-0x120(%ebp)
+     168:	55 00 00 
+     16b:	c7 85 e4 fe ff ff dd 	movl   $0x55dd,-0x11c(%ebp)
+     172:	55 00 00 
+     175:	c7 85 e8 fe ff ff d8 	movl   $0x55d8,-0x118(%ebp)
+     17c:	55 00 00 
+     17f:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+     186:	00 00 00 
+  printf(1, "pcache test\n");
+     189:	68 e4 55 00 00       	push   $0x55e4
+     18e:	6a 01                	push   $0x1
+     190:	e8 1b 51 00 00       	call   52b0 <printf>
+    memstat(&ms1);
+     195:	89 34 24             	mov    %esi,(%esp)
+     198:	e8 06 50 00 00       	call   51a3 <memstat>
+    pid = fork();
+     19d:	e8 59 4f 00 00       	call   50fb <fork>
+    if(pid < 0){
+     1a2:	83 c4 10             	add    $0x10,%esp
+     1a5:	85 c0                	test   %eax,%eax
+     1a7:	0f 88 e8 00 00 00    	js     295 <pcachetest+0x145>
+    if(pid == 0){
+     1ad:	0f 84 1d 01 00 00    	je     2d0 <pcachetest+0x180>
+    wait();
+     1b3:	e8 53 4f 00 00       	call   510b <wait>
+    memstat(&ms2);
+     1b8:	8d 9d 74 ff ff ff    	lea    -0x8c(%ebp),%ebx
+     1be:	83 ec 0c             	sub    $0xc,%esp
+     1c1:	53                   	push   %ebx
+     1c2:	e8 dc 4f 00 00       	call   51a3 <memstat>
+    memstat(&ms1);
+     1c7:	89 34 24             	mov    %esi,(%esp)
+     1ca:	e8 d4 4f 00 00       	call   51a3 <memstat>
+    pid = fork();
+     1cf:	e8 27 4f 00 00       	call   50fb <fork>
+    if(pid < 0){
+     1d4:	83 c4 10             	add    $0x10,%esp
+     1d7:	85 c0                	test   %eax,%eax
+     1d9:	0f 88 b6 00 00 00    	js     295 <pcachetest+0x145>
+    if(pid == 0){
+     1df:	0f 84 eb 00 00 00    	je     2d0 <pcachetest+0x180>
+    wait();
+     1e5:	e8 21 4f 00 00       	call   510b <wait>
+    memstat(&ms2);
+     1ea:	83 ec 0c             	sub    $0xc,%esp
+     1ed:	53                   	push   %ebx
+     1ee:	e8 b0 4f 00 00       	call   51a3 <memstat>
+  if(ms2.pcmisses != ms1.pcmisses || ms2.pchits == ms1.pchits){
+     1f3:	8b 85 20 ff ff ff    	mov    -0xe0(%ebp),%eax
+     1f9:	83 c4 10             	add    $0x10,%esp
+     1fc:	39 45 a4             	cmp    %eax,-0x5c(%ebp)
+     1ff:	0f 85 b8 00 00 00    	jne    2bd <pcachetest+0x16d>
+     205:	8b 85 1c ff ff ff    	mov    -0xe4(%ebp),%eax
+     20b:	39 45 a0             	cmp    %eax,-0x60(%ebp)
+     20e:	0f 84 a9 00 00 00    	je     2bd <pcachetest+0x16d>
+  fd = open("echo", O_RDONLY);
+     214:	83 ec 08             	sub    $0x8,%esp
+     217:	6a 00                	push   $0x0
+     219:	68 d8 55 00 00       	push   $0x55d8
+     21e:	e8 20 4f 00 00       	call   5143 <open>
+  if(fd < 0 || read(fd, (char*)pcachetest, 16) != -1 ||
+     223:	83 c4 10             	add    $0x10,%esp
+  fd = open("echo", O_RDONLY);
+     226:	89 c3                	mov    %eax,%ebx
+  if(fd < 0 || read(fd, (char*)pcachetest, 16) != -1 ||
+     228:	85 c0                	test   %eax,%eax
+     22a:	78 7d                	js     2a9 <pcachetest+0x159>
+     22c:	83 ec 04             	sub    $0x4,%esp
+     22f:	6a 10                	push   $0x10
+     231:	68 50 01 00 00       	push   $0x150
+     236:	50                   	push   %eax
+     237:	e8 df 4e 00 00       	call   511b <read>
+     23c:	83 c4 10             	add    $0x10,%esp
+     23f:	83 f8 ff             	cmp    $0xffffffff,%eax
+     242:	75 65                	jne    2a9 <pcachetest+0x159>
+     pipe((int*)pcachetest) != -1){
+     244:	83 ec 0c             	sub    $0xc,%esp
+     247:	68 50 01 00 00       	push   $0x150
+     24c:	e8 c2 4e 00 00       	call   5113 <pipe>
+  if(fd < 0 || read(fd, (char*)pcachetest, 16) != -1 ||
+     251:	83 c4 10             	add    $0x10,%esp
+     254:	83 f8 ff             	cmp    $0xffffffff,%eax
+     257:	75 50                	jne    2a9 <pcachetest+0x159>
+  close(fd);
+     259:	83 ec 0c             	sub    $0xc,%esp
+     25c:	53                   	push   %ebx
+     25d:	e8 c9 4e 00 00       	call   512b <close>
+  ppid = getpid();
+     262:	e8 1c 4f 00 00       	call   5183 <getpid>
+     267:	89 c3                	mov    %eax,%ebx
+  pid = fork();
+     269:	e8 8d 4e 00 00       	call   50fb <fork>
+  if(pid < 0){
+     26e:	83 c4 10             	add    $0x10,%esp
+     271:	85 c0                	test   %eax,%eax
+     273:	78 20                	js     295 <pcachetest+0x145>
+  if(pid == 0){
+     275:	74 7f                	je     2f6 <pcachetest+0x1a6>
+  wait();
+     277:	e8 8f 4e 00 00       	call   510b <wait>
+  printf(1, "pcache test ok\n");
+     27c:	83 ec 08             	sub    $0x8,%esp
+     27f:	68 27 56 00 00       	push   $0x5627
+     284:	6a 01                	push   $0x1
+     286:	e8 25 50 00 00       	call   52b0 <printf>
+}
+     28b:	83 c4 10             	add    $0x10,%esp
+     28e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     291:	5b                   	pop    %ebx
+     292:	5e                   	pop    %esi
+     293:	5d                   	pop    %ebp
+     294:	c3                   	ret
+      printf(1, "pcache test: fork failed\n");
+     295:	83 ec 08             	sub    $0x8,%esp
+     298:	68 f1 55 00 00       	push   $0x55f1
+     29d:	6a 01                	push   $0x1
+     29f:	e8 0c 50 00 00       	call   52b0 <printf>
+      exit();
+     2a4:	e8 5a 4e 00 00       	call   5103 <exit>
+    printf(1, "pcache test: kernel wrote to text\n");
+     2a9:	83 ec 08             	sub    $0x8,%esp
+     2ac:	68 44 6a 00 00       	push   $0x6a44
+     2b1:	6a 01                	push   $0x1
+     2b3:	e8 f8 4f 00 00       	call   52b0 <printf>
+    exit();
+     2b8:	e8 46 4e 00 00       	call   5103 <exit>
+    printf(1, "pcache test: second echo did not use the cache\n");
+     2bd:	52                   	push   %edx
+     2be:	52                   	push   %edx
+     2bf:	68 14 6a 00 00       	push   $0x6a14
+     2c4:	6a 01                	push   $0x1
+     2c6:	e8 e5 4f 00 00       	call   52b0 <printf>
+    exit();
+     2cb:	e8 33 4e 00 00       	call   5103 <exit>
+      exec("echo", args);
+     2d0:	8d 85 e0 fe ff ff    	lea    -0x120(%ebp),%eax
+     2d6:	51                   	push   %ecx
+     2d7:	51                   	push   %ecx
+     2d8:	50                   	push   %eax
+     2d9:	68 d8 55 00 00       	push   $0x55d8
+     2de:	e8 58 4e 00 00       	call   513b <exec>
+      printf(1, "pcache test: exec echo failed\n");
+     2e3:	5b                   	pop    %ebx
+     2e4:	5e                   	pop    %esi
+     2e5:	68 f4 69 00 00       	push   $0x69f4
+     2ea:	6a 01                	push   $0x1
+     2ec:	e8 bf 4f 00 00       	call   52b0 <printf>
+      exit();
+     2f1:	e8 0d 4e 00 00       	call   5103 <exit>
+    *(char*)pcachetest = 0;
+     2f6:	c6 05 50 01 00 00 00 	movb   $0x0,0x150
+    printf(1, "pcache test: wrote to text\n");
+     2fd:	50                   	push   %eax
+     2fe:	50                   	push   %eax
+     2ff:	68 0b 56 00 00       	push   $0x560b
+     304:	6a 01                	push   $0x1
+     306:	e8 a5 4f 00 00       	call   52b0 <printf>
+    kill(ppid);
+     30b:	89 1c 24             	mov    %ebx,(%esp)
+     30e:	e8 20 4e 00 00       	call   5133 <kill>
+    exit();
+     313:	e8 eb 4d 00 00       	call   5103 <exit>
+     318:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     31f:	90                   	nop
+
+00000320 <iputtest>:
+{
+     320:	55                   	push   %ebp
+     321:	89 e5                	mov    %esp,%ebp
+     323:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "iput test\n");
+     326:	68 cb 56 00 00       	push   $0x56cb
+     32b:	ff 35 04 90 00 00    	push   0x9004
+     331:	e8 7a 4f 00 00       	call   52b0 <printf>
+  if(mkdir("iputdir") < 0){
+     336:	c7 04 24 5e 56 00 00 	movl   $0x565e,(%esp)
+     33d:	e8 29 4e 00 00       	call   516b <mkdir>
+     342:	83 c4 10             	add    $0x10,%esp
+     345:	85 c0                	test   %eax,%eax
+     347:	78 58                	js     3a1 <iputtest+0x81>
+  if(chdir("iputdir") < 0){
+     349:	83 ec 0c             	sub    $0xc,%esp
+     34c:	68 5e 56 00 00       	push   $0x565e
+     351:	e8 1d 4e 00 00       	call   5173 <chdir>
+     356:	83 c4 10             	add    $0x10,%esp
+     359:	85 c0                	test   %eax,%eax
+     35b:	0f 88 85 00 00 00    	js     3e6 <iputtest+0xc6>
+  if(unlink("../iputdir") < 0){
+     361:	83 ec 0c             	sub    $0xc,%esp
+     364:	68 5b 56 00 00       	push   $0x565b
+     369:	e8 e5 4d 00 00       	call   5153 <unlink>
+     36e:	83 c4 10             	add    $0x10,%esp
+     371:	85 c0                	test   %eax,%eax
+     373:	78 5a                	js     3cf <iputtest+0xaf>
+  if(chdir("/") < 0){
+     375:	83 ec 0c             	sub    $0xc,%esp
+     378:	68 80 56 00 00       	push   $0x5680
+     37d:	e8 f1 4d 00 00       	call   5173 <chdir>
+     382:	83 c4 10             	add    $0x10,%esp
+     385:	85 c0                	test   %eax,%eax
+     387:	78 2f                	js     3b8 <iputtest+0x98>
+  printf(stdout, "iput test ok\n");
+     389:	83 ec 08             	sub    $0x8,%esp
+     38c:	68 03 57 00 00       	push   $0x5703
+     391:	ff 35 04 90 00 00    	push   0x9004
+     397:	e8 14 4f 00 00       	call   52b0 <printf>
+}
+     39c:	83 c4 10             	add    $0x10,%esp
+     39f:	c9                   	leave
+     3a0:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     3a1:	50                   	push   %eax
+     3a2:	50                   	push   %eax
+     3a3:	68 37 56 00 00       	push   $0x5637
+     3a8:	ff 35 04 90 00 00    	push   0x9004
+     3ae:	e8 fd 4e 00 00       	call   52b0 <printf>
+    exit();
+     3b3:	e8 4b 4d 00 00       	call   5103 <exit>
+    printf(stdout, "chdir / failed\n");
+     3b8:	50                   	push   %eax
+     3b9:	50                   	push   %eax
+     3ba:	68 82 56 00 00       	push   $0x5682
+     3bf:	ff 35 04 90 00 00    	push   0x9004
+     3c5:	e8 e6 4e 00 00       	call   52b0 <printf>
+    exit();
+     3ca:	e8 34 4d 00 00       	call   5103 <exit>
+    printf(stdout, "unlink ../iputdir failed\n");
+     3cf:	52                   	push   %edx
+     3d0:	52                   	push   %edx
+     3d1:	68 66 56 00 00       	push   $0x5666
+     3d6:	ff 35 04 90 00 00    	push   0x9004
+     3dc:	e8 cf 4e 00 00       	call   52b0 <printf>
+    exit();
+     3e1:	e8 1d 4d 00 00       	call   5103 <exit>
+    printf(stdout, "chdir iputdir failed\n");
+     3e6:	51                   	push   %ecx
+     3e7:	51                   	push   %ecx
+     3e8:	68 45 56 00 00       	push   $0x5645
+     3ed:	ff 35 04 90 00 00    	push   0x9004
+     3f3:	e8 b8 4e 00 00       	call   52b0 <printf>
+    exit();
+     3f8:	e8 06 4d 00 00       	call   5103 <exit>
+     3fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000400 <exitiputtest>:
+{
+     400:	55                   	push   %ebp
+     401:	89 e5                	mov    %esp,%ebp
+     403:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exitiput test\n");
+     406:	68 92 56 00 00       	push   $0x5692
+     40b:	ff 35 04 90 00 00    	push   0x9004
+     411:	e8 9a 4e 00 00       	call   52b0 <printf>
+  pid = fork();
+     416:	e8 e0 4c 00 00       	call   50fb <fork>
+  if(pid < 0){
+     41b:	83 c4 10             	add    $0x10,%esp
+     41e:	85 c0                	test   %eax,%eax
+     420:	0f 88 8a 00 00 00    	js     4b0 <exitiputtest+0xb0>
+  if(pid == 0){
+     426:	75 50                	jne    478 <exitiputtest+0x78>
+    if(mkdir("iputdir") < 0){
+     428:	83 ec 0c             	sub    $0xc,%esp
+     42b:	68 5e 56 00 00       	push   $0x565e
+     430:	e8 36 4d 00 00       	call   516b <mkdir>
+     435:	83 c4 10             	add    $0x10,%esp
+     438:	85 c0                	test   %eax,%eax
+     43a:	0f 88 87 00 00 00    	js     4c7 <exitiputtest+0xc7>
+    if(chdir("iputdir") < 0){
+     440:	83 ec 0c             	sub    $0xc,%esp
+     443:	68 5e 56 00 00       	push   $0x565e
+     448:	e8 26 4d 00 00       	call   5173 <chdir>
+     44d:	83 c4 10             	add    $0x10,%esp
+     450:	85 c0                	test   %eax,%eax
+     452:	0f 88 86 00 00 00    	js     4de <exitiputtest+0xde>
+    if(unlink("../iputdir") < 0){
+     458:	83 ec 0c             	sub    $0xc,%esp
+     45b:	68 5b 56 00 00       	push   $0x565b
+     460:	e8 ee 4c 00 00       	call   5153 <unlink>
+     465:	83 c4 10             	add    $0x10,%esp
+     468:	85 c0                	test   %eax,%eax
+     46a:	78 2c                	js     498 <exitiputtest+0x98>
+    exit();
+     46c:	e8 92 4c 00 00       	call   5103 <exit>
+     471:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  wait();
+     478:	e8 8e 4c 00 00       	call   510b <wait>
+  printf(stdout, "exitiput test ok\n");
+     47d:	83 ec 08             	sub    $0x8,%esp
+     480:	68 b5 56 00 00       	push   $0x56b5
+     485:	ff 35 04 90 00 00    	push   0x9004
+     48b:	e8 20 4e 00 00       	call   52b0 <printf>
+}
+     490:	83 c4 10             	add    $0x10,%esp
+     493:	c9                   	leave
+     494:	c3                   	ret
+     495:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(stdout, "unlink ../iputdir failed\n");
+     498:	83 ec 08             	sub    $0x8,%esp
+     49b:	68 66 56 00 00       	push   $0x5666
+     4a0:	ff 35 04 90 00 00    	push   0x9004
+     4a6:	e8 05 4e 00 00       	call   52b0 <printf>
+      exit();
+     4ab:	e8 53 4c 00 00       	call   5103 <exit>
+    printf(stdout, "fork failed\n");
+     4b0:	51                   	push   %ecx
+     4b1:	51                   	push   %ecx
+     4b2:	68 c9 5c 00 00       	push   $0x5cc9
+     4b7:	ff 35 04 90 00 00    	push   0x9004
+     4bd:	e8 ee 4d 00 00       	call   52b0 <printf>
+    exit();
+     4c2:	e8 3c 4c 00 00       	call   5103 <exit>
+      printf(stdout, "mkdir failed\n");
+     4c7:	52                   	push   %edx
+     4c8:	52                   	push   %edx
+     4c9:	68 37 56 00 00       	push   $0x5637
+     4ce:	ff 35 04 90 00 00    	push   0x9004
+     4d4:	e8 d7 4d 00 00       	call   52b0 <printf>
+      exit();
+     4d9:	e8 25 4c 00 00       	call   5103 <exit>
+      printf(stdout, "child chdir failed\n");
+     4de:	50                   	push   %eax
+     4df:	50                   	push   %eax
+     4e0:	68 a1 56 00 00       	push   $0x56a1
+     4e5:	ff 35 04 90 00 00    	push   0x9004
+     4eb:	e8 c0 4d 00 00       	call   52b0 <printf>
+      exit();
+     4f0:	e8 0e 4c 00 00       	call   5103 <exit>
+     4f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000500 <openiputtest>:
+{
+     500:	55                   	push   %ebp
+     501:	89 e5                	mov    %esp,%ebp
+     503:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "openiput test\n");
+     506:	68 c7 56 00 00       	push   $0x56c7
+     50b:	ff 35 04 90 00 00    	push   0x9004
+     511:	e8 9a 4d 00 00       	call   52b0 <printf>
+  if(mkdir("oidir") < 0){
+     516:	c7 04 24 d6 56 00 00 	movl   $0x56d6,(%esp)
+     51d:	e8 49 4c 00 00       	call   516b <mkdir>
+     522:	83 c4 10             	add    $0x10,%esp
+     525:	85 c0                	test   %eax,%eax
+     527:	0f 88 9f 00 00 00    	js     5cc <openiputtest+0xcc>
+  pid = fork();
+     52d:	e8 c9 4b 00 00       	call   50fb <fork>
+  if(pid < 0){
+     532:	85 c0                	test   %eax,%eax
+     534:	78 7f                	js     5b5 <openiputtest+0xb5>
+  if(pid == 0){
+     536:	75 38                	jne    570 <openiputtest+0x70>
+    int fd = open("oidir", O_RDWR);
+     538:	83 ec 08             	sub    $0x8,%esp
+     53b:	6a 02                	push   $0x2
+     53d:	68 d6 56 00 00       	push   $0x56d6
+     542:	e8 fc 4b 00 00       	call   5143 <open>
+    if(fd >= 0){
+     547:	83 c4 10             	add    $0x10,%esp
+     54a:	85 c0                	test   %eax,%eax
+     54c:	78 62                	js     5b0 <openiputtest+0xb0>
+      printf(stdout, "open directory for write succeeded\n");
+     54e:	83 ec 08             	sub    $0x8,%esp
+     551:	68 68 6a 00 00       	push   $0x6a68
+     556:	ff 35 04 90 00 00    	push   0x9004
+     55c:	e8 4f 4d 00 00       	call   52b0 <printf>
+      exit();
+     561:	e8 9d 4b 00 00       	call   5103 <exit>
+     566:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     56d:	8d 76 00             	lea    0x0(%esi),%esi
+  sleep(1);
+     570:	83 ec 0c             	sub    $0xc,%esp
+     573:	6a 01                	push   $0x1
+     575:	e8 19 4c 00 00       	call   5193 <sleep>
+  if(unlink("oidir") != 0){
+     57a:	c7 04 24 d6 56 00 00 	movl   $0x56d6,(%esp)
+     581:	e8 cd 4b 00 00       	call   5153 <unlink>
+     586:	83 c4 10             	add    $0x10,%esp
+     589:	85 c0                	test   %eax,%eax
+     58b:	75 56                	jne    5e3 <openiputtest+0xe3>
+  wait();
+     58d:	e8 79 4b 00 00       	call   510b <wait>
+  printf(stdout, "openiput test ok\n");
+     592:	83 ec 08             	sub    $0x8,%esp
+     595:	68 ff 56 00 00       	push   $0x56ff
+     59a:	ff 35 04 90 00 00    	push   0x9004
+     5a0:	e8 0b 4d 00 00       	call   52b0 <printf>
+}
+     5a5:	83 c4 10             	add    $0x10,%esp
+     5a8:	c9                   	leave
+     5a9:	c3                   	ret
+     5aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    exit();
+     5b0:	e8 4e 4b 00 00       	call   5103 <exit>
+    printf(stdout, "fork failed\n");
+     5b5:	52                   	push   %edx
+     5b6:	52                   	push   %edx
+     5b7:	68 c9 5c 00 00       	push   $0x5cc9
+     5bc:	ff 35 04 90 00 00    	push   0x9004
+     5c2:	e8 e9 4c 00 00       	call   52b0 <printf>
+    exit();
+     5c7:	e8 37 4b 00 00       	call   5103 <exit>
+    printf(stdout, "mkdir oidir failed\n");
+     5cc:	51                   	push   %ecx
+     5cd:	51                   	push   %ecx
+     5ce:	68 dc 56 00 00       	push   $0x56dc
+     5d3:	ff 35 04 90 00 00    	push   0x9004
+     5d9:	e8 d2 4c 00 00       	call   52b0 <printf>
+    exit();
+     5de:	e8 20 4b 00 00       	call   5103 <exit>
+    printf(stdout, "unlink failed\n");
+     5e3:	50                   	push   %eax
+     5e4:	50                   	push   %eax
+     5e5:	68 f0 56 00 00       	push   $0x56f0
+     5ea:	ff 35 04 90 00 00    	push   0x9004
+     5f0:	e8 bb 4c 00 00       	call   52b0 <printf>
+    exit();
+     5f5:	e8 09 4b 00 00       	call   5103 <exit>
+     5fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000600 <opentest>:
+{
+     600:	55                   	push   %ebp
+     601:	89 e5                	mov    %esp,%ebp
+     603:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "open test\n");
+     606:	68 11 57 00 00       	push   $0x5711
+     60b:	ff 35 04 90 00 00    	push   0x9004
+     611:	e8 9a 4c 00 00       	call   52b0 <printf>
+  fd = open("echo", 0);
+     616:	58                   	pop    %eax
+     617:	5a                   	pop    %edx
+     618:	6a 00                	push   $0x0
+     61a:	68 d8 55 00 00       	push   $0x55d8
+     61f:	e8 1f 4b 00 00       	call   5143 <open>
+  if(fd < 0){
+     624:	83 c4 10             	add    $0x10,%esp
+     627:	85 c0                	test   %eax,%eax
+     629:	78 36                	js     661 <opentest+0x61>
+  close(fd);
+     62b:	83 ec 0c             	sub    $0xc,%esp
+     62e:	50                   	push   %eax
+     62f:	e8 f7 4a 00 00       	call   512b <close>
+  fd = open("doesnotexist", 0);
+     634:	5a                   	pop    %edx
+     635:	59                   	pop    %ecx
+     636:	6a 00                	push   $0x0
+     638:	68 2f 57 00 00       	push   $0x572f
+     63d:	e8 01 4b 00 00       	call   5143 <open>
+  if(fd >= 0){
+     642:	83 c4 10             	add    $0x10,%esp
+     645:	85 c0                	test   %eax,%eax
+     647:	79 2f                	jns    678 <opentest+0x78>
+  printf(stdout, "open test ok\n");
+     649:	83 ec 08             	sub    $0x8,%esp
+     64c:	68 5a 57 00 00       	push   $0x575a
+     651:	ff 35 04 90 00 00    	push   0x9004
+     657:	e8 54 4c 00 00       	call   52b0 <printf>
+}
+     65c:	83 c4 10             	add    $0x10,%esp
+     65f:	c9                   	leave
+     660:	c3                   	ret
+    printf(stdout, "open echo failed!\n");
+     661:	50                   	push   %eax
+     662:	50                   	push   %eax
+     663:	68 1c 57 00 00       	push   $0x571c
+     668:	ff 35 04 90 00 00    	push   0x9004
+     66e:	e8 3d 4c 00 00       	call   52b0 <printf>
+    exit();
+     673:	e8 8b 4a 00 00       	call   5103 <exit>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     678:	50                   	push   %eax
+     679:	50                   	push   %eax
+     67a:	68 3c 57 00 00       	push   $0x573c
+     67f:	ff 35 04 90 00 00    	push   0x9004
+     685:	e8 26 4c 00 00       	call   52b0 <printf>
+    exit();
+     68a:	e8 74 4a 00 00       	call   5103 <exit>
+     68f:	90                   	nop
+
+00000690 <writetest>:
+{
+     690:	55                   	push   %ebp
+     691:	89 e5                	mov    %esp,%ebp
+     693:	56                   	push   %esi
+     694:	53                   	push   %ebx
+  printf(stdout, "small file test\n");
+     695:	83 ec 08             	sub    $0x8,%esp
+     698:	68 68 57 00 00       	push   $0x5768
+     69d:	ff 35 04 90 00 00    	push   0x9004
+     6a3:	e8 08 4c 00 00       	call   52b0 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     6a8:	58                   	pop    %eax
+     6a9:	5a                   	pop    %edx
+     6aa:	68 02 02 00 00       	push   $0x202
+     6af:	68 79 57 00 00       	push   $0x5779
+     6b4:	e8 8a 4a 00 00       	call   5143 <open>
+  if(fd >= 0){
+     6b9:	83 c4 10             	add    $0x10,%esp
+     6bc:	85 c0                	test   %eax,%eax
+     6be:	0f 88 88 01 00 00    	js     84c <writetest+0x1bc>
+    printf(stdout, "creat small succeeded; ok\n");
+     6c4:	83 ec 08             	sub    $0x8,%esp
+     6c7:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 100; i++){
+     6c9:	31 db                	xor    %ebx,%ebx
+    printf(stdout, "creat small succeeded; ok\n");
+     6cb:	68 7f 57 00 00       	push   $0x577f
+     6d0:	ff 35 04 90 00 00    	push   0x9004
+     6d6:	e8 d5 4b 00 00       	call   52b0 <printf>
+     6db:	83 c4 10             	add    $0x10,%esp
+     6de:	66 90                	xchg   %ax,%ax
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     6e0:	83 ec 04             	sub    $0x4,%esp
+     6e3:	6a 0a                	push   $0xa
+     6e5:	68 b6 57 00 00       	push   $0x57b6
+     6ea:	56                   	push   %esi
+     6eb:	e8 33 4a 00 00       	call   5123 <write>
+     6f0:	83 c4 10             	add    $0x10,%esp
+     6f3:	83 f8 0a             	cmp    $0xa,%eax
+     6f6:	0f 85 d9 00 00 00    	jne    7d5 <writetest+0x145>
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     6fc:	83 ec 04             	sub    $0x4,%esp
+     6ff:	6a 0a                	push   $0xa
+     701:	68 c1 57 00 00       	push   $0x57c1
+     706:	56                   	push   %esi
+     707:	e8 17 4a 00 00       	call   5123 <write>
+     70c:	83 c4 10             	add    $0x10,%esp
+     70f:	83 f8 0a             	cmp    $0xa,%eax
+     712:	0f 85 d6 00 00 00    	jne    7ee <writetest+0x15e>
+  for(i = 0; i < 100; i++){
+     718:	83 c3 01             	add    $0x1,%ebx
+     71b:	83 fb 64             	cmp    $0x64,%ebx
+     71e:	75 c0                	jne    6e0 <writetest+0x50>
+  printf(stdout, "writes ok\n");
+     720:	83 ec 08             	sub    $0x8,%esp
+     723:	68 cc 57 00 00       	push   $0x57cc
+     728:	ff 35 04 90 00 00    	push   0x9004
+     72e:	e8 7d 4b 00 00       	call   52b0 <printf>
+  close(fd);
+     733:	89 34 24             	mov    %esi,(%esp)
+     736:	e8 f0 49 00 00       	call   512b <close>
+  fd = open("small", O_RDONLY);
+     73b:	5b                   	pop    %ebx
+     73c:	5e                   	pop    %esi
+     73d:	6a 00                	push   $0x0
+     73f:	68 79 57 00 00       	push   $0x5779
+     744:	e8 fa 49 00 00       	call   5143 <open>
+  if(fd >= 0){
+     749:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     74c:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     74e:	85 c0                	test   %eax,%eax
+     750:	0f 88 b1 00 00 00    	js     807 <writetest+0x177>
+    printf(stdout, "open small succeeded ok\n");
+     756:	83 ec 08             	sub    $0x8,%esp
+     759:	68 d7 57 00 00       	push   $0x57d7
+     75e:	ff 35 04 90 00 00    	push   0x9004
+     764:	e8 47 4b 00 00       	call   52b0 <printf>
+  i = read(fd, buf, 2000);
+     769:	83 c4 0c             	add    $0xc,%esp
+     76c:	68 d0 07 00 00       	push   $0x7d0
+     771:	68 40 b7 00 00       	push   $0xb740
+     776:	53                   	push   %ebx
+     777:	e8 9f 49 00 00       	call   511b <read>
+  if(i == 2000){
+     77c:	83 c4 10             	add    $0x10,%esp
+     77f:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     784:	0f 85 94 00 00 00    	jne    81e <writetest+0x18e>
+    printf(stdout, "read succeeded ok\n");
+     78a:	83 ec 08             	sub    $0x8,%esp
+     78d:	68 0b 58 00 00       	push   $0x580b
+     792:	ff 35 04 90 00 00    	push   0x9004
+     798:	e8 13 4b 00 00       	call   52b0 <printf>
+  close(fd);
+     79d:	89 1c 24             	mov    %ebx,(%esp)
+     7a0:	e8 86 49 00 00       	call   512b <close>
+  if(unlink("small") < 0){
+     7a5:	c7 04 24 79 57 00 00 	movl   $0x5779,(%esp)
+     7ac:	e8 a2 49 00 00       	call   5153 <unlink>
+     7b1:	83 c4 10             	add    $0x10,%esp
+     7b4:	85 c0                	test   %eax,%eax
+     7b6:	78 7d                	js     835 <writetest+0x1a5>
+  printf(stdout, "small file test ok\n");
+     7b8:	83 ec 08             	sub    $0x8,%esp
+     7bb:	68 33 58 00 00       	push   $0x5833
+     7c0:	ff 35 04 90 00 00    	push   0x9004
+     7c6:	e8 e5 4a 00 00       	call   52b0 <printf>
+}
+     7cb:	83 c4 10             	add    $0x10,%esp
+     7ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     7d1:	5b                   	pop    %ebx
+     7d2:	5e                   	pop    %esi
+     7d3:	5d                   	pop    %ebp
+     7d4:	c3                   	ret
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     7d5:	83 ec 04             	sub    $0x4,%esp
+     7d8:	53                   	push   %ebx
+     7d9:	68 8c 6a 00 00       	push   $0x6a8c
+     7de:	ff 35 04 90 00 00    	push   0x9004
+     7e4:	e8 c7 4a 00 00       	call   52b0 <printf>
+      exit();
+     7e9:	e8 15 49 00 00       	call   5103 <exit>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     7ee:	83 ec 04             	sub    $0x4,%esp
+     7f1:	53                   	push   %ebx
+     7f2:	68 b0 6a 00 00       	push   $0x6ab0
+     7f7:	ff 35 04 90 00 00    	push   0x9004
+     7fd:	e8 ae 4a 00 00       	call   52b0 <printf>
+      exit();
+     802:	e8 fc 48 00 00       	call   5103 <exit>
+    printf(stdout, "error: open small failed!\n");
+     807:	51                   	push   %ecx
+     808:	51                   	push   %ecx
+     809:	68 f0 57 00 00       	push   $0x57f0
+     80e:	ff 35 04 90 00 00    	push   0x9004
+     814:	e8 97 4a 00 00       	call   52b0 <printf>
+    exit();
+     819:	e8 e5 48 00 00       	call   5103 <exit>
+    printf(stdout, "read failed\n");
+     81e:	52                   	push   %edx
+     81f:	52                   	push   %edx
+     820:	68 a3 5e 00 00       	push   $0x5ea3
+     825:	ff 35 04 90 00 00    	push   0x9004
+     82b:	e8 80 4a 00 00       	call   52b0 <printf>
+    exit();
+     830:	e8 ce 48 00 00       	call   5103 <exit>
+    printf(stdout, "unlink small failed\n");
+     835:	50                   	push   %eax
+     836:	50                   	push   %eax
+     837:	68 1e 58 00 00       	push   $0x581e
+     83c:	ff 35 04 90 00 00    	push   0x9004
+     842:	e8 69 4a 00 00       	call   52b0 <printf>
+    exit();
+     847:	e8 b7 48 00 00       	call   5103 <exit>
+    printf(stdout, "error: creat small failed!\n");
+     84c:	50                   	push   %eax
+     84d:	50                   	push   %eax
+     84e:	68 9a 57 00 00       	push   $0x579a
+     853:	ff 35 04 90 00 00    	push   0x9004
+     859:	e8 52 4a 00 00       	call   52b0 <printf>
+    exit();
+     85e:	e8 a0 48 00 00       	call   5103 <exit>
+     863:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     86a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000870 <writetest1>:
+{
+     870:	55                   	push   %ebp
+     871:	89 e5                	mov    %esp,%ebp
+     873:	56                   	push   %esi
+     874:	53                   	push   %ebx
+  printf(stdout, "big files test\n");
+     875:	83 ec 08             	sub    $0x8,%esp
+     878:	68 47 58 00 00       	push   $0x5847
+     87d:	ff 35 04 90 00 00    	push   0x9004
+     883:	e8 28 4a 00 00       	call   52b0 <printf>
+  fd = open("big", O_CREATE|O_RDWR);
+     888:	58                   	pop    %eax
+     889:	5a                   	pop    %edx
+     88a:	68 02 02 00 00       	push   $0x202
+     88f:	68 c1 58 00 00       	push   $0x58c1
+     894:	e8 aa 48 00 00       	call   5143 <open>
+  if(fd < 0){
+     899:	83 c4 10             	add    $0x10,%esp
+     89c:	85 c0                	test   %eax,%eax
+     89e:	0f 88 61 01 00 00    	js     a05 <writetest1+0x195>
+     8a4:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < MAXFILE; i++){
+     8a6:	31 db                	xor    %ebx,%ebx
+     8a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8af:	90                   	nop
+    if(write(fd, buf, 512) != 512){
+     8b0:	83 ec 04             	sub    $0x4,%esp
+    ((int*)buf)[0] = i;
+     8b3:	89 1d 40 b7 00 00    	mov    %ebx,0xb740
+    if(write(fd, buf, 512) != 512){
+     8b9:	68 00 02 00 00       	push   $0x200
+     8be:	68 40 b7 00 00       	push   $0xb740
+     8c3:	56                   	push   %esi
+     8c4:	e8 5a 48 00 00       	call   5123 <write>
+     8c9:	83 c4 10             	add    $0x10,%esp
+     8cc:	3d 00 02 00 00       	cmp    $0x200,%eax
+     8d1:	0f 85 b3 00 00 00    	jne    98a <writetest1+0x11a>
+  for(i = 0; i < MAXFILE; i++){
+     8d7:	83 c3 01             	add    $0x1,%ebx
+     8da:	81 fb 8c 00 00 00    	cmp    $0x8c,%ebx
+     8e0:	75 ce                	jne    8b0 <writetest1+0x40>
+  close(fd);
+     8e2:	83 ec 0c             	sub    $0xc,%esp
+     8e5:	56                   	push   %esi
+     8e6:	e8 40 48 00 00       	call   512b <close>
+  fd = open("big", O_RDONLY);
+     8eb:	5b                   	pop    %ebx
+     8ec:	5e                   	pop    %esi
+     8ed:	6a 00                	push   $0x0
+     8ef:	68 c1 58 00 00       	push   $0x58c1
+     8f4:	e8 4a 48 00 00       	call   5143 <open>
+  if(fd < 0){
+     8f9:	83 c4 10             	add    $0x10,%esp
+  fd = open("big", O_RDONLY);
+     8fc:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+     8fe:	85 c0                	test   %eax,%eax
+     900:	0f 88 e8 00 00 00    	js     9ee <writetest1+0x17e>
+  n = 0;
+     906:	31 f6                	xor    %esi,%esi
+     908:	eb 1d                	jmp    927 <writetest1+0xb7>
+     90a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    } else if(i != 512){
+     910:	3d 00 02 00 00       	cmp    $0x200,%eax
+     915:	0f 85 9f 00 00 00    	jne    9ba <writetest1+0x14a>
+    if(((int*)buf)[0] != n){
+     91b:	a1 40 b7 00 00       	mov    0xb740,%eax
+     920:	39 f0                	cmp    %esi,%eax
+     922:	75 7f                	jne    9a3 <writetest1+0x133>
+    n++;
+     924:	83 c6 01             	add    $0x1,%esi
+    i = read(fd, buf, 512);
+     927:	83 ec 04             	sub    $0x4,%esp
+     92a:	68 00 02 00 00       	push   $0x200
+     92f:	68 40 b7 00 00       	push   $0xb740
+     934:	53                   	push   %ebx
+     935:	e8 e1 47 00 00       	call   511b <read>
+    if(i == 0){
+     93a:	83 c4 10             	add    $0x10,%esp
+     93d:	85 c0                	test   %eax,%eax
+     93f:	75 cf                	jne    910 <writetest1+0xa0>
+      if(n == MAXFILE - 1){
+     941:	81 fe 8b 00 00 00    	cmp    $0x8b,%esi
+     947:	0f 84 86 00 00 00    	je     9d3 <writetest1+0x163>
+  close(fd);
+     94d:	83 ec 0c             	sub    $0xc,%esp
+     950:	53                   	push   %ebx
+     951:	e8 d5 47 00 00       	call   512b <close>
+  if(unlink("big") < 0){
+     956:	c7 04 24 c1 58 00 00 	movl   $0x58c1,(%esp)
+     95d:	e8 f1 47 00 00       	call   5153 <unlink>
+     962:	83 c4 10             	add    $0x10,%esp
+     965:	85 c0                	test   %eax,%eax
+     967:	0f 88 af 00 00 00    	js     a1c <writetest1+0x1ac>
+  printf(stdout, "big files ok\n");
+     96d:	83 ec 08             	sub    $0x8,%esp
+     970:	68 e8 58 00 00       	push   $0x58e8
+     975:	ff 35 04 90 00 00    	push   0x9004
+     97b:	e8 30 49 00 00       	call   52b0 <printf>
+}
+     980:	83 c4 10             	add    $0x10,%esp
+     983:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     986:	5b                   	pop    %ebx
+     987:	5e                   	pop    %esi
+     988:	5d                   	pop    %ebp
+     989:	c3                   	ret
+      printf(stdout, "error: write big file failed\n", i);
+     98a:	83 ec 04             	sub    $0x4,%esp
+     98d:	53                   	push   %ebx
+     98e:	68 71 58 00 00       	push   $0x5871
+     993:	ff 35 04 90 00 00    	push   0x9004
+     999:	e8 12 49 00 00       	call   52b0 <printf>
+      exit();
+     99e:	e8 60 47 00 00       	call   5103 <exit>
+      printf(stdout, "read content of block %d is %d\n",
+     9a3:	50                   	push   %eax
+     9a4:	56                   	push   %esi
+     9a5:	68 d4 6a 00 00       	push   $0x6ad4
+     9aa:	ff 35 04 90 00 00    	push   0x9004
+     9b0:	e8 fb 48 00 00       	call   52b0 <printf>
+      exit();
+     9b5:	e8 49 47 00 00       	call   5103 <exit>
+      printf(stdout, "read failed %d\n", i);
+     9ba:	83 ec 04             	sub    $0x4,%esp
+     9bd:	50                   	push   %eax
+     9be:	68 c5 58 00 00       	push   $0x58c5
+     9c3:	ff 35 04 90 00 00    	push   0x9004
+     9c9:	e8 e2 48 00 00       	call   52b0 <printf>
+      exit();
+     9ce:	e8 30 47 00 00       	call   5103 <exit>
+        printf(stdout, "read only %d blocks from big", n);
+     9d3:	52                   	push   %edx
+     9d4:	68 8b 00 00 00       	push   $0x8b
+     9d9:	68 a8 58 00 00       	push   $0x58a8
+     9de:	ff 35 04 90 00 00    	push   0x9004
+     9e4:	e8 c7 48 00 00       	call   52b0 <printf>
+        exit();
+     9e9:	e8 15 47 00 00       	call   5103 <exit>
+    printf(stdout, "error: open big failed!\n");
+     9ee:	51                   	push   %ecx
+     9ef:	51                   	push   %ecx
+     9f0:	68 8f 58 00 00       	push   $0x588f
+     9f5:	ff 35 04 90 00 00    	push   0x9004
+     9fb:	e8 b0 48 00 00       	call   52b0 <printf>
+    exit();
+     a00:	e8 fe 46 00 00       	call   5103 <exit>
+    printf(stdout, "error: creat big failed!\n");
+     a05:	50                   	push   %eax
+     a06:	50                   	push   %eax
+     a07:	68 57 58 00 00       	push   $0x5857
+     a0c:	ff 35 04 90 00 00    	push   0x9004
+     a12:	e8 99 48 00 00       	call   52b0 <printf>
+    exit();
+     a17:	e8 e7 46 00 00       	call   5103 <exit>
+    printf(stdout, "unlink big failed\n");
+     a1c:	50                   	push   %eax
+     a1d:	50                   	push   %eax
+     a1e:	68 d5 58 00 00       	push   $0x58d5
+     a23:	ff 35 04 90 00 00    	push   0x9004
+     a29:	e8 82 48 00 00       	call   52b0 <printf>
+    exit();
+     a2e:	e8 d0 46 00 00       	call   5103 <exit>
+     a33:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000a40 <createtest>:
+{
+     a40:	55                   	push   %ebp
+     a41:	89 e5                	mov    %esp,%ebp
+     a43:	53                   	push   %ebx
+  name[2] = '\0';
+     a44:	bb 30 00 00 00       	mov    $0x30,%ebx
+{
+     a49:	83 ec 0c             	sub    $0xc,%esp
+  printf(stdout, "many creates, followed by unlink test\n");
+     a4c:	68 f4 6a 00 00       	push   $0x6af4
+     a51:	ff 35 04 90 00 00    	push   0x9004
+     a57:	e8 54 48 00 00       	call   52b0 <printf>
+  name[0] = 'a';
+     a5c:	c6 05 30 b7 00 00 61 	movb   $0x61,0xb730
+  name[2] = '\0';
+     a63:	83 c4 10             	add    $0x10,%esp
+     a66:	c6 05 32 b7 00 00 00 	movb   $0x0,0xb732
+  for(i = 0; i < 52; i++){
+     a6d:	8d 76 00             	lea    0x0(%esi),%esi
+    fd = open(name, O_CREATE|O_RDWR);
+     a70:	83 ec 08             	sub    $0x8,%esp
+    name[1] = '0' + i;
+     a73:	88 1d 31 b7 00 00    	mov    %bl,0xb731
+  for(i = 0; i < 52; i++){
+     a79:	83 c3 01             	add    $0x1,%ebx
+    fd = open(name, O_CREATE|O_RDWR);
+     a7c:	68 02 02 00 00       	push   $0x202
+     a81:	68 30 b7 00 00       	push   $0xb730
+     a86:	e8 b8 46 00 00       	call   5143 <open>
+    close(fd);
+     a8b:	89 04 24             	mov    %eax,(%esp)
+     a8e:	e8 98 46 00 00       	call   512b <close>
+  for(i = 0; i < 52; i++){
+     a93:	83 c4 10             	add    $0x10,%esp
+     a96:	80 fb 64             	cmp    $0x64,%bl
+     a99:	75 d5                	jne    a70 <createtest+0x30>
+  name[0] = 'a';
+     a9b:	c6 05 30 b7 00 00 61 	movb   $0x61,0xb730
+  name[2] = '\0';
+     aa2:	bb 30 00 00 00       	mov    $0x30,%ebx
+     aa7:	c6 05 32 b7 00 00 00 	movb   $0x0,0xb732
+  for(i = 0; i < 52; i++){
+     aae:	66 90                	xchg   %ax,%ax
+    unlink(name);
+     ab0:	83 ec 0c             	sub    $0xc,%esp
+    name[1] = '0' + i;
+     ab3:	88 1d 31 b7 00 00    	mov    %bl,0xb731
+  for(i = 0; i < 52; i++){
+     ab9:	83 c3 01             	add    $0x1,%ebx
+    unlink(name);
+     abc:	68 30 b7 00 00       	push   $0xb730
+     ac1:	e8 8d 46 00 00       	call   5153 <unlink>
+  for(i = 0; i < 52; i++){
+     ac6:	83 c4 10             	add    $0x10,%esp
+     ac9:	80 fb 64             	cmp    $0x64,%bl
+     acc:	75 e2                	jne    ab0 <createtest+0x70>
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     ace:	83 ec 08             	sub    $0x8,%esp
+     ad1:	68 1c 6b 00 00       	push   $0x6b1c
+     ad6:	ff 35 04 90 00 00    	push   0x9004
+     adc:	e8 cf 47 00 00       	call   52b0 <printf>
+}
+     ae1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ae4:	83 c4 10             	add    $0x10,%esp
+     ae7:	c9                   	leave
+     ae8:	c3                   	ret
+     ae9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000af0 <dirtest>:
+{
+     af0:	55                   	push   %ebp
+     af1:	89 e5                	mov    %esp,%ebp
+     af3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "mkdir test\n");
+     af6:	68 f6 58 00 00       	push   $0x58f6
+     afb:	ff 35 04 90 00 00    	push   0x9004
+     b01:	e8 aa 47 00 00       	call   52b0 <printf>
+  if(mkdir("dir0") < 0){
+     b06:	c7 04 24 02 59 00 00 	movl   $0x5902,(%esp)
+     b0d:	e8 59 46 00 00       	call   516b <mkdir>
+     b12:	83 c4 10             	add    $0x10,%esp
+     b15:	85 c0                	test   %eax,%eax
+     b17:	78 58                	js     b71 <dirtest+0x81>
+  if(chdir("dir0") < 0){
+     b19:	83 ec 0c             	sub    $0xc,%esp
+     b1c:	68 02 59 00 00       	push   $0x5902
+     b21:	e8 4d 46 00 00       	call   5173 <chdir>
+     b26:	83 c4 10             	add    $0x10,%esp
+     b29:	85 c0                	test   %eax,%eax
+     b2b:	0f 88 85 00 00 00    	js     bb6 <dirtest+0xc6>
+  if(chdir("..") < 0){
+     b31:	83 ec 0c             	sub    $0xc,%esp
+     b34:	68 13 62 00 00       	push   $0x6213
+     b39:	e8 35 46 00 00       	call   5173 <chdir>
+     b3e:	83 c4 10             	add    $0x10,%esp
+     b41:	85 c0                	test   %eax,%eax
+     b43:	78 5a                	js     b9f <dirtest+0xaf>
+  if(unlink("dir0") < 0){
+     b45:	83 ec 0c             	sub    $0xc,%esp
+     b48:	68 02 59 00 00       	push   $0x5902
+     b4d:	e8 01 46 00 00       	call   5153 <unlink>
+     b52:	83 c4 10             	add    $0x10,%esp
+     b55:	85 c0                	test   %eax,%eax
+     b57:	78 2f                	js     b88 <dirtest+0x98>
+  printf(stdout, "mkdir test ok\n");
+     b59:	83 ec 08             	sub    $0x8,%esp
+     b5c:	68 3f 59 00 00       	push   $0x593f
+     b61:	ff 35 04 90 00 00    	push   0x9004
+     b67:	e8 44 47 00 00       	call   52b0 <printf>
+}
+     b6c:	83 c4 10             	add    $0x10,%esp
+     b6f:	c9                   	leave
+     b70:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     b71:	50                   	push   %eax
+     b72:	50                   	push   %eax
+     b73:	68 37 56 00 00       	push   $0x5637
+     b78:	ff 35 04 90 00 00    	push   0x9004
+     b7e:	e8 2d 47 00 00       	call   52b0 <printf>
+    exit();
+     b83:	e8 7b 45 00 00       	call   5103 <exit>
+    printf(stdout, "unlink dir0 failed\n");
+     b88:	50                   	push   %eax
+     b89:	50                   	push   %eax
+     b8a:	68 2b 59 00 00       	push   $0x592b
+     b8f:	ff 35 04 90 00 00    	push   0x9004
+     b95:	e8 16 47 00 00       	call   52b0 <printf>
+    exit();
+     b9a:	e8 64 45 00 00       	call   5103 <exit>
+    printf(stdout, "chdir .. failed\n");
+     b9f:	52                   	push   %edx
+     ba0:	52                   	push   %edx
+     ba1:	68 1a 59 00 00       	push   $0x591a
+     ba6:	ff 35 04 90 00 00    	push   0x9004
+     bac:	e8 ff 46 00 00       	call   52b0 <printf>
+    exit();
+     bb1:	e8 4d 45 00 00       	call   5103 <exit>
+    printf(stdout, "chdir dir0 failed\n");
+     bb6:	51                   	push   %ecx
+     bb7:	51                   	push   %ecx
+     bb8:	68 07 59 00 00       	push   $0x5907
+     bbd:	ff 35 04 90 00 00    	push   0x9004
+     bc3:	e8 e8 46 00 00       	call   52b0 <printf>
+    exit();
+     bc8:	e8 36 45 00 00       	call   5103 <exit>
+     bcd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000bd0 <exectest>:
+{
+     bd0:	55                   	push   %ebp
+     bd1:	89 e5                	mov    %esp,%ebp
+     bd3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exec test\n");
+     bd6:	68 4e 59 00 00       	push   $0x594e
+     bdb:	ff 35 04 90 00 00    	push   0x9004
+     be1:	e8 ca 46 00 00       	call   52b0 <printf>
+  if(exec("echo", echoargv) < 0){
+     be6:	5a                   	pop    %edx
+     be7:	59                   	pop    %ecx
+     be8:	68 08 90 00 00       	push   $0x9008
+     bed:	68 d8 55 00 00       	push   $0x55d8
+     bf2:	e8 44 45 00 00       	call   513b <exec>
+     bf7:	83 c4 10             	add    $0x10,%esp
+     bfa:	85 c0                	test   %eax,%eax
+     bfc:	78 02                	js     c00 <exectest+0x30>
+}
+     bfe:	c9                   	leave
+     bff:	c3                   	ret
+    printf(stdout, "exec echo failed\n");
+     c00:	50                   	push   %eax
+     c01:	50                   	push   %eax
+     c02:	68 59 59 00 00       	push   $0x5959
+     c07:	ff 35 04 90 00 00    	push   0x9004
+     c0d:	e8 9e 46 00 00       	call   52b0 <printf>
+    exit();
+     c12:	e8 ec 44 00 00       	call   5103 <exit>
+     c17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c1e:	66 90                	xchg   %ax,%ax
+
+00000c20 <pipe1>:
+{
+     c20:	55                   	push   %ebp
+     c21:	89 e5                	mov    %esp,%ebp
+     c23:	57                   	push   %edi
+     c24:	56                   	push   %esi
+  if(pipe(fds) != 0){
+     c25:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+     c28:	53                   	push   %ebx
+     c29:	83 ec 28             	sub    $0x28,%esp
+  if(pipe(fds) != 0){
+     c2c:	50                   	push   %eax
+     c2d:	e8 e1 44 00 00       	call   5113 <pipe>
+     c32:	83 c4 10             	add    $0x10,%esp
+     c35:	85 c0                	test   %eax,%eax
+     c37:	0f 85 41 01 00 00    	jne    d7e <pipe1+0x15e>
+     c3d:	89 c6                	mov    %eax,%esi
+  pid = fork();
+     c3f:	e8 b7 44 00 00       	call   50fb <fork>
+  if(pid == 0){
+     c44:	85 c0                	test   %eax,%eax
+     c46:	0f 84 92 00 00 00    	je     cde <pipe1+0xbe>
+  } else if(pid > 0){
+     c4c:	0f 8e 3f 01 00 00    	jle    d91 <pipe1+0x171>
+    close(fds[1]);
+     c52:	83 ec 0c             	sub    $0xc,%esp
+     c55:	ff 75 e4             	push   -0x1c(%ebp)
+    total = 0;
+     c58:	31 db                	xor    %ebx,%ebx
+    cc = 1;
+     c5a:	bf 01 00 00 00       	mov    $0x1,%edi
+    close(fds[1]);
+     c5f:	e8 c7 44 00 00       	call   512b <close>
+    while((n = read(fds[0], buf, cc)) > 0){
+     c64:	83 c4 10             	add    $0x10,%esp
+     c67:	83 ec 04             	sub    $0x4,%esp
+     c6a:	57                   	push   %edi
+     c6b:	68 40 b7 00 00       	push   $0xb740
+     c70:	ff 75 e0             	push   -0x20(%ebp)
+     c73:	e8 a3 44 00 00       	call   511b <read>
+     c78:	83 c4 10             	add    $0x10,%esp
+     c7b:	89 c1                	mov    %eax,%ecx
+     c7d:	85 c0                	test   %eax,%eax
+     c7f:	0f 8e b8 00 00 00    	jle    d3d <pipe1+0x11d>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     c85:	89 f0                	mov    %esi,%eax
+     c87:	32 05 40 b7 00 00    	xor    0xb740,%al
+     c8d:	0f b6 c0             	movzbl %al,%eax
+     c90:	85 c0                	test   %eax,%eax
+     c92:	75 30                	jne    cc4 <pipe1+0xa4>
+     c94:	83 c6 01             	add    $0x1,%esi
+     c97:	eb 0f                	jmp    ca8 <pipe1+0x88>
+     c99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ca0:	38 90 40 b7 00 00    	cmp    %dl,0xb740(%eax)
+     ca6:	75 1c                	jne    cc4 <pipe1+0xa4>
+     ca8:	8d 14 06             	lea    (%esi,%eax,1),%edx
+      for(i = 0; i < n; i++){
+     cab:	83 c0 01             	add    $0x1,%eax
+     cae:	39 c1                	cmp    %eax,%ecx
+     cb0:	75 ee                	jne    ca0 <pipe1+0x80>
+      cc = cc * 2;
+     cb2:	01 ff                	add    %edi,%edi
+      if(cc > sizeof(buf))
+     cb4:	b8 00 20 00 00       	mov    $0x2000,%eax
+      total += n;
+     cb9:	01 cb                	add    %ecx,%ebx
+      if(cc > sizeof(buf))
+     cbb:	89 d6                	mov    %edx,%esi
+     cbd:	39 c7                	cmp    %eax,%edi
+     cbf:	0f 4f f8             	cmovg  %eax,%edi
+     cc2:	eb a3                	jmp    c67 <pipe1+0x47>
+          printf(1, "pipe1 oops 2\n");
+     cc4:	83 ec 08             	sub    $0x8,%esp
+     cc7:	68 79 59 00 00       	push   $0x5979
+     ccc:	6a 01                	push   $0x1
+     cce:	e8 dd 45 00 00       	call   52b0 <printf>
+     cd3:	83 c4 10             	add    $0x10,%esp
+}
+     cd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cd9:	5b                   	pop    %ebx
+     cda:	5e                   	pop    %esi
+     cdb:	5f                   	pop    %edi
+     cdc:	5d                   	pop    %ebp
+     cdd:	c3                   	ret
+    close(fds[0]);
+     cde:	83 ec 0c             	sub    $0xc,%esp
+     ce1:	ff 75 e0             	push   -0x20(%ebp)
+  seq = 0;
+     ce4:	31 db                	xor    %ebx,%ebx
+    close(fds[0]);
+     ce6:	e8 40 44 00 00       	call   512b <close>
+     ceb:	83 c4 10             	add    $0x10,%esp
+     cee:	66 90                	xchg   %ax,%ax
+      for(i = 0; i < 1033; i++)
+     cf0:	31 c0                	xor    %eax,%eax
+     cf2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        buf[i] = seq++;
+     cf8:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+      for(i = 0; i < 1033; i++)
+     cfb:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+     cfe:	88 90 3f b7 00 00    	mov    %dl,0xb73f(%eax)
+      for(i = 0; i < 1033; i++)
+     d04:	3d 09 04 00 00       	cmp    $0x409,%eax
+     d09:	75 ed                	jne    cf8 <pipe1+0xd8>
+      if(write(fds[1], buf, 1033) != 1033){
+     d0b:	83 ec 04             	sub    $0x4,%esp
+        buf[i] = seq++;
+     d0e:	81 c3 09 04 00 00    	add    $0x409,%ebx
+      if(write(fds[1], buf, 1033) != 1033){
+     d14:	68 09 04 00 00       	push   $0x409
+     d19:	68 40 b7 00 00       	push   $0xb740
+     d1e:	ff 75 e4             	push   -0x1c(%ebp)
+     d21:	e8 fd 43 00 00       	call   5123 <write>
+     d26:	83 c4 10             	add    $0x10,%esp
+     d29:	3d 09 04 00 00       	cmp    $0x409,%eax
+     d2e:	75 74                	jne    da4 <pipe1+0x184>
+    for(n = 0; n < 5; n++){
+     d30:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     d36:	75 b8                	jne    cf0 <pipe1+0xd0>
+    exit();
+     d38:	e8 c6 43 00 00       	call   5103 <exit>
+    if(total != 5 * 1033){
+     d3d:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     d43:	75 26                	jne    d6b <pipe1+0x14b>
+    close(fds[0]);
+     d45:	83 ec 0c             	sub    $0xc,%esp
+     d48:	ff 75 e0             	push   -0x20(%ebp)
+     d4b:	e8 db 43 00 00       	call   512b <close>
+    wait();
+     d50:	e8 b6 43 00 00       	call   510b <wait>
+  printf(1, "pipe1 ok\n");
+     d55:	5a                   	pop    %edx
+     d56:	59                   	pop    %ecx
+     d57:	68 9e 59 00 00       	push   $0x599e
+     d5c:	6a 01                	push   $0x1
+     d5e:	e8 4d 45 00 00       	call   52b0 <printf>
+     d63:	83 c4 10             	add    $0x10,%esp
+     d66:	e9 6b ff ff ff       	jmp    cd6 <pipe1+0xb6>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     d6b:	56                   	push   %esi
+     d6c:	53                   	push   %ebx
+     d6d:	68 87 59 00 00       	push   $0x5987
+     d72:	6a 01                	push   $0x1
+     d74:	e8 37 45 00 00       	call   52b0 <printf>
+      exit();
+     d79:	e8 85 43 00 00       	call   5103 <exit>
+    printf(1, "pipe() failed\n");
+     d7e:	50                   	push   %eax
+     d7f:	50                   	push   %eax
+     d80:	68 63 5a 00 00       	push   $0x5a63
+     d85:	6a 01                	push   $0x1
+     d87:	e8 24 45 00 00       	call   52b0 <printf>
+    exit();
+     d8c:	e8 72 43 00 00       	call   5103 <exit>
+    printf(1, "fork() failed\n");
+     d91:	50                   	push   %eax
+     d92:	50                   	push   %eax
+     d93:	68 a8 59 00 00       	push   $0x59a8
+     d98:	6a 01                	push   $0x1
+     d9a:	e8 11 45 00 00       	call   52b0 <printf>
+    exit();
+     d9f:	e8 5f 43 00 00       	call   5103 <exit>
+        printf(1, "pipe1 oops 1\n");
+     da4:	57                   	push   %edi
+     da5:	57                   	push   %edi
+     da6:	68 6b 59 00 00       	push   $0x596b
+     dab:	6a 01                	push   $0x1
+     dad:	e8 fe 44 00 00       	call   52b0 <printf>
+        exit();
+     db2:	e8 4c 43 00 00       	call   5103 <exit>
+     db7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dbe:	66 90                	xchg   %ax,%ax
+
+00000dc0 <preempt>:
+{
+     dc0:	55                   	push   %ebp
+     dc1:	89 e5                	mov    %esp,%ebp
+     dc3:	57                   	push   %edi
+     dc4:	56                   	push   %esi
+     dc5:	53                   	push   %ebx
+     dc6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "preempt: ");
+     dc9:	68 b7 59 00 00       	push   $0x59b7
+     dce:	6a 01                	push   $0x1
+     dd0:	e8 db 44 00 00       	call   52b0 <printf>
+  pid1 = fork();
+     dd5:	e8 21 43 00 00       	call   50fb <fork>
+  if(pid1 == 0)
+     dda:	83 c4 10             	add    $0x10,%esp
+     ddd:	85 c0                	test   %eax,%eax
+     ddf:	75 07                	jne    de8 <preempt+0x28>
+    for(;;)
+     de1:	eb fe                	jmp    de1 <preempt+0x21>
+     de3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     de7:	90                   	nop
+     de8:	89 c3                	mov    %eax,%ebx
+  pid2 = fork();
+     dea:	e8 0c 43 00 00       	call   50fb <fork>
+     def:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+     df1:	85 c0                	test   %eax,%eax
+     df3:	75 0b                	jne    e00 <preempt+0x40>
+    for(;;)
+     df5:	eb fe                	jmp    df5 <preempt+0x35>
+     df7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dfe:	66 90                	xchg   %ax,%ax
+  pipe(pfds);
+     e00:	83 ec 0c             	sub    $0xc,%esp
+     e03:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     e06:	50                   	push   %eax
+     e07:	e8 07 43 00 00       	call   5113 <pipe>
+  pid3 = fork();
+     e0c:	e8 ea 42 00 00       	call   50fb <fork>
+  if(pid3 == 0){
+     e11:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+     e14:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+     e16:	85 c0                	test   %eax,%eax
+     e18:	75 3e                	jne    e58 <preempt+0x98>
+    close(pfds[0]);
+     e1a:	83 ec 0c             	sub    $0xc,%esp
+     e1d:	ff 75 e0             	push   -0x20(%ebp)
+     e20:	e8 06 43 00 00       	call   512b <close>
+    if(write(pfds[1], "x", 1) != 1)
+     e25:	83 c4 0c             	add    $0xc,%esp
+     e28:	6a 01                	push   $0x1
+     e2a:	68 f7 62 00 00       	push   $0x62f7
+     e2f:	ff 75 e4             	push   -0x1c(%ebp)
+     e32:	e8 ec 42 00 00       	call   5123 <write>
+     e37:	83 c4 10             	add    $0x10,%esp
+     e3a:	83 f8 01             	cmp    $0x1,%eax
+     e3d:	0f 85 b8 00 00 00    	jne    efb <preempt+0x13b>
+    close(pfds[1]);
+     e43:	83 ec 0c             	sub    $0xc,%esp
+     e46:	ff 75 e4             	push   -0x1c(%ebp)
+     e49:	e8 dd 42 00 00       	call   512b <close>
+     e4e:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+     e51:	eb fe                	jmp    e51 <preempt+0x91>
+     e53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e57:	90                   	nop
+  close(pfds[1]);
+     e58:	83 ec 0c             	sub    $0xc,%esp
+     e5b:	ff 75 e4             	push   -0x1c(%ebp)
+     e5e:	e8 c8 42 00 00       	call   512b <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+     e63:	83 c4 0c             	add    $0xc,%esp
+     e66:	68 00 20 00 00       	push   $0x2000
+     e6b:	68 40 b7 00 00       	push   $0xb740
+     e70:	ff 75 e0             	push   -0x20(%ebp)
+     e73:	e8 a3 42 00 00       	call   511b <read>
+     e78:	83 c4 10             	add    $0x10,%esp
+     e7b:	83 f8 01             	cmp    $0x1,%eax
+     e7e:	75 67                	jne    ee7 <preempt+0x127>
+  close(pfds[0]);
+     e80:	83 ec 0c             	sub    $0xc,%esp
+     e83:	ff 75 e0             	push   -0x20(%ebp)
+     e86:	e8 a0 42 00 00       	call   512b <close>
+  printf(1, "kill... ");
+     e8b:	58                   	pop    %eax
+     e8c:	5a                   	pop    %edx
+     e8d:	68 e8 59 00 00       	push   $0x59e8
+     e92:	6a 01                	push   $0x1
+     e94:	e8 17 44 00 00       	call   52b0 <printf>
+  kill(pid1);
+     e99:	89 1c 24             	mov    %ebx,(%esp)
+     e9c:	e8 92 42 00 00       	call   5133 <kill>
+  kill(pid2);
+     ea1:	89 34 24             	mov    %esi,(%esp)
+     ea4:	e8 8a 42 00 00       	call   5133 <kill>
+  kill(pid3);
+     ea9:	89 3c 24             	mov    %edi,(%esp)
+     eac:	e8 82 42 00 00       	call   5133 <kill>
+  printf(1, "wait... ");
+     eb1:	59                   	pop    %ecx
+     eb2:	5b                   	pop    %ebx
+     eb3:	68 f1 59 00 00       	push   $0x59f1
+     eb8:	6a 01                	push   $0x1
+     eba:	e8 f1 43 00 00       	call   52b0 <printf>
+  wait();
+     ebf:	e8 47 42 00 00       	call   510b <wait>
+  wait();
+     ec4:	e8 42 42 00 00       	call   510b <wait>
+  wait();
+     ec9:	e8 3d 42 00 00       	call   510b <wait>
+  printf(1, "preempt ok\n");
+     ece:	5e                   	pop    %esi
+     ecf:	5f                   	pop    %edi
+     ed0:	68 fa 59 00 00       	push   $0x59fa
+     ed5:	6a 01                	push   $0x1
+     ed7:	e8 d4 43 00 00       	call   52b0 <printf>
+     edc:	83 c4 10             	add    $0x10,%esp
+}
+     edf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ee2:	5b                   	pop    %ebx
+     ee3:	5e                   	pop    %esi
+     ee4:	5f                   	pop    %edi
+     ee5:	5d                   	pop    %ebp
+     ee6:	c3                   	ret
+    printf(1, "preempt read error");
+     ee7:	83 ec 08             	sub    $0x8,%esp
+     eea:	68 d5 59 00 00       	push   $0x59d5
+     eef:	6a 01                	push   $0x1
+     ef1:	e8 ba 43 00 00       	call   52b0 <printf>
+     ef6:	83 c4 10             	add    $0x10,%esp
+     ef9:	eb e4                	jmp    edf <preempt+0x11f>
+      printf(1, "preempt write error");
+     efb:	83 ec 08             	sub    $0x8,%esp
+     efe:	68 c1 59 00 00       	push   $0x59c1
+     f03:	6a 01                	push   $0x1
+     f05:	e8 a6 43 00 00       	call   52b0 <printf>
+     f0a:	83 c4 10             	add    $0x10,%esp
+     f0d:	e9 31 ff ff ff       	jmp    e43 <preempt+0x83>
+     f12:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000f20 <exitwait>:
+{
+     f20:	55                   	push   %ebp
+     f21:	89 e5                	mov    %esp,%ebp
+     f23:	56                   	push   %esi
+     f24:	be 64 00 00 00       	mov    $0x64,%esi
+     f29:	53                   	push   %ebx
+     f2a:	eb 14                	jmp    f40 <exitwait+0x20>
+     f2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(pid){
+     f30:	74 68                	je     f9a <exitwait+0x7a>
+      if(wait() != pid){
+     f32:	e8 d4 41 00 00       	call   510b <wait>
+     f37:	39 d8                	cmp    %ebx,%eax
+     f39:	75 2d                	jne    f68 <exitwait+0x48>
+  for(i = 0; i < 100; i++){
+     f3b:	83 ee 01             	sub    $0x1,%esi
+     f3e:	74 41                	je     f81 <exitwait+0x61>
+    pid = fork();
+     f40:	e8 b6 41 00 00       	call   50fb <fork>
+     f45:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+     f47:	85 c0                	test   %eax,%eax
+     f49:	79 e5                	jns    f30 <exitwait+0x10>
+      printf(1, "fork failed\n");
+     f4b:	83 ec 08             	sub    $0x8,%esp
+     f4e:	68 c9 5c 00 00       	push   $0x5cc9
+     f53:	6a 01                	push   $0x1
+     f55:	e8 56 43 00 00       	call   52b0 <printf>
+      return;
+     f5a:	83 c4 10             	add    $0x10,%esp
+}
+     f5d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f60:	5b                   	pop    %ebx
+     f61:	5e                   	pop    %esi
+     f62:	5d                   	pop    %ebp
+     f63:	c3                   	ret
+     f64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "wait wrong pid\n");
+     f68:	83 ec 08             	sub    $0x8,%esp
+     f6b:	68 06 5a 00 00       	push   $0x5a06
+     f70:	6a 01                	push   $0x1
+     f72:	e8 39 43 00 00       	call   52b0 <printf>
+        return;
+     f77:	83 c4 10             	add    $0x10,%esp
+}
+     f7a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f7d:	5b                   	pop    %ebx
+     f7e:	5e                   	pop    %esi
+     f7f:	5d                   	pop    %ebp
+     f80:	c3                   	ret
+  printf(1, "exitwait ok\n");
+     f81:	83 ec 08             	sub    $0x8,%esp
+     f84:	68 16 5a 00 00       	push   $0x5a16
+     f89:	6a 01                	push   $0x1
+     f8b:	e8 20 43 00 00       	call   52b0 <printf>
+     f90:	83 c4 10             	add    $0x10,%esp
+}
+     f93:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f96:	5b                   	pop    %ebx
+     f97:	5e                   	pop    %esi
+     f98:	5d                   	pop    %ebp
+     f99:	c3                   	ret
+      exit();
+     f9a:	e8 64 41 00 00       	call   5103 <exit>
+     f9f:	90                   	nop
+
+00000fa0 <mem>:
+{
+     fa0:	55                   	push   %ebp
+     fa1:	89 e5                	mov    %esp,%ebp
+     fa3:	56                   	push   %esi
+     fa4:	31 f6                	xor    %esi,%esi
+     fa6:	53                   	push   %ebx
+  printf(1, "mem test\n");
+     fa7:	83 ec 08             	sub    $0x8,%esp
+     faa:	68 23 5a 00 00       	push   $0x5a23
+     faf:	6a 01                	push   $0x1
+     fb1:	e8 fa 42 00 00       	call   52b0 <printf>
+  ppid = getpid();
+     fb6:	e8 c8 41 00 00       	call   5183 <getpid>
+     fbb:	89 c3                	mov    %eax,%ebx
+  if((pid = fork()) == 0){
+     fbd:	e8 39 41 00 00       	call   50fb <fork>
+     fc2:	83 c4 10             	add    $0x10,%esp
+     fc5:	85 c0                	test   %eax,%eax
+     fc7:	74 0b                	je     fd4 <mem+0x34>
+     fc9:	e9 8a 00 00 00       	jmp    1058 <mem+0xb8>
+     fce:	66 90                	xchg   %ax,%ax
+      *(char**)m2 = m1;
+     fd0:	89 30                	mov    %esi,(%eax)
+     fd2:	89 c6                	mov    %eax,%esi
+    while((m2 = malloc(10001)) != 0){
+     fd4:	83 ec 0c             	sub    $0xc,%esp
+     fd7:	68 11 27 00 00       	push   $0x2711
+     fdc:	e8 0f 45 00 00       	call   54f0 <malloc>
+     fe1:	83 c4 10             	add    $0x10,%esp
+     fe4:	85 c0                	test   %eax,%eax
+     fe6:	75 e8                	jne    fd0 <mem+0x30>
+    while(m1){
+     fe8:	85 f6                	test   %esi,%esi
+     fea:	74 18                	je     1004 <mem+0x64>
+     fec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      m2 = *(char**)m1;
+     ff0:	89 f0                	mov    %esi,%eax
+      free(m1);
+     ff2:	83 ec 0c             	sub    $0xc,%esp
+      m2 = *(char**)m1;
+     ff5:	8b 36                	mov    (%esi),%esi
+      free(m1);
+     ff7:	50                   	push   %eax
+     ff8:	e8 63 44 00 00       	call   5460 <free>
+    while(m1){
+     ffd:	83 c4 10             	add    $0x10,%esp
+    1000:	85 f6                	test   %esi,%esi
+    1002:	75 ec                	jne    ff0 <mem+0x50>
+    m1 = malloc(1024*20);
+    1004:	83 ec 0c             	sub    $0xc,%esp
+    1007:	68 00 50 00 00       	push   $0x5000
+    100c:	e8 df 44 00 00       	call   54f0 <malloc>
+    if(m1 == 0){
+    1011:	83 c4 10             	add    $0x10,%esp
+    1014:	85 c0                	test   %eax,%eax
+    1016:	74 20                	je     1038 <mem+0x98>
+    free(m1);
+    1018:	83 ec 0c             	sub    $0xc,%esp
+    101b:	50                   	push   %eax
+    101c:	e8 3f 44 00 00       	call   5460 <free>
+    printf(1, "mem ok\n");
+    1021:	58                   	pop    %eax
+    1022:	5a                   	pop    %edx
+    1023:	68 47 5a 00 00       	push   $0x5a47
+    1028:	6a 01                	push   $0x1
+    102a:	e8 81 42 00 00       	call   52b0 <printf>
+    exit();
+    102f:	e8 cf 40 00 00       	call   5103 <exit>
+    1034:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "couldn't allocate mem?!!\n");
+    1038:	83 ec 08             	sub    $0x8,%esp
+    103b:	68 2d 5a 00 00       	push   $0x5a2d
+    1040:	6a 01                	push   $0x1
+    1042:	e8 69 42 00 00       	call   52b0 <printf>
+      kill(ppid);
+    1047:	89 1c 24             	mov    %ebx,(%esp)
+    104a:	e8 e4 40 00 00       	call   5133 <kill>
+      exit();
+    104f:	e8 af 40 00 00       	call   5103 <exit>
+    1054:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    1058:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    105b:	5b                   	pop    %ebx
+    105c:	5e                   	pop    %esi
+    105d:	5d                   	pop    %ebp
+    wait();
+    105e:	e9 a8 40 00 00       	jmp    510b <wait>
+    1063:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    106a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001070 <cowtest>:
+{
+    1070:	55                   	push   %ebp
+    1071:	89 e5                	mov    %esp,%ebp
+    1073:	57                   	push   %edi
+    1074:	56                   	push   %esi
+    1075:	53                   	push   %ebx
+    1076:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "cow test\n");
+    1079:	68 4f 5a 00 00       	push   $0x5a4f
+    107e:	6a 01                	push   $0x1
+    1080:	e8 2b 42 00 00       	call   52b0 <printf>
+  p = sbrk(4*4096);
+    1085:	c7 04 24 00 40 00 00 	movl   $0x4000,(%esp)
+    108c:	e8 fa 40 00 00       	call   518b <sbrk>
+    1091:	83 c4 10             	add    $0x10,%esp
+    1094:	89 c2                	mov    %eax,%edx
+  for(i = 0; i < 4*4096; i++)
+    1096:	89 c6                	mov    %eax,%esi
+    1098:	8d b8 00 40 00 00    	lea    0x4000(%eax),%edi
+    109e:	66 90                	xchg   %ax,%ax
+    p[i] = 'p';
+    10a0:	c6 00 70             	movb   $0x70,(%eax)
+  for(i = 0; i < 4*4096; i++)
+    10a3:	83 c0 01             	add    $0x1,%eax
+    10a6:	39 f8                	cmp    %edi,%eax
+    10a8:	75 f6                	jne    10a0 <cowtest+0x30>
+  if(pipe(fds) != 0){
+    10aa:	83 ec 0c             	sub    $0xc,%esp
+    10ad:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    10b0:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    10b3:	50                   	push   %eax
+    10b4:	e8 5a 40 00 00       	call   5113 <pipe>
+    10b9:	83 c4 10             	add    $0x10,%esp
+    10bc:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    10bf:	85 c0                	test   %eax,%eax
+    10c1:	0f 85 60 01 00 00    	jne    1227 <cowtest+0x1b7>
+    10c7:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  pid = fork();
+    10ca:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    10cd:	e8 29 40 00 00       	call   50fb <fork>
+  if(pid < 0){
+    10d2:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    10d5:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+    10d8:	85 c0                	test   %eax,%eax
+  pid = fork();
+    10da:	89 c3                	mov    %eax,%ebx
+  if(pid < 0){
+    10dc:	0f 88 32 01 00 00    	js     1214 <cowtest+0x1a4>
+  if(pid == 0){
+    10e2:	0f 85 89 00 00 00    	jne    1171 <cowtest+0x101>
+    10e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10ef:	90                   	nop
+      p[i] = 'c';
+    10f0:	c6 06 63             	movb   $0x63,(%esi)
+    for(i = 0; i < 4*4096; i += 2)
+    10f3:	83 c6 02             	add    $0x2,%esi
+    10f6:	39 fe                	cmp    %edi,%esi
+    10f8:	75 f6                	jne    10f0 <cowtest+0x80>
+    read(fds[0], p + 4096 + 1, 1);
+    10fa:	83 ec 04             	sub    $0x4,%esp
+    10fd:	8d 82 01 10 00 00    	lea    0x1001(%edx),%eax
+    1103:	6a 01                	push   $0x1
+    1105:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1108:	50                   	push   %eax
+    1109:	ff 75 e0             	push   -0x20(%ebp)
+    110c:	e8 0a 40 00 00       	call   511b <read>
+    1111:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    1114:	83 c4 10             	add    $0x10,%esp
+    1117:	eb 27                	jmp    1140 <cowtest+0xd0>
+    1119:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p[i] != (i % 2 == 0 ? 'c' : (i == 4096 + 1 ? 'x' : 'p'))){
+    1120:	b9 70 00 00 00       	mov    $0x70,%ecx
+    1125:	81 fb 01 10 00 00    	cmp    $0x1001,%ebx
+    112b:	74 23                	je     1150 <cowtest+0xe0>
+    112d:	39 c1                	cmp    %eax,%ecx
+    112f:	0f 85 b5 00 00 00    	jne    11ea <cowtest+0x17a>
+    for(i = 0; i < 4*4096; i++){
+    1135:	83 c3 01             	add    $0x1,%ebx
+    1138:	81 fb 00 40 00 00    	cmp    $0x4000,%ebx
+    113e:	74 2c                	je     116c <cowtest+0xfc>
+      if(p[i] != (i % 2 == 0 ? 'c' : (i == 4096 + 1 ? 'x' : 'p'))){
+    1140:	0f be 04 1a          	movsbl (%edx,%ebx,1),%eax
+    1144:	f6 c3 01             	test   $0x1,%bl
+    1147:	75 d7                	jne    1120 <cowtest+0xb0>
+    1149:	b9 63 00 00 00       	mov    $0x63,%ecx
+    114e:	eb dd                	jmp    112d <cowtest+0xbd>
+    1150:	83 f8 78             	cmp    $0x78,%eax
+    1153:	0f 85 91 00 00 00    	jne    11ea <cowtest+0x17a>
+    1159:	0f be 82 02 10 00 00 	movsbl 0x1002(%edx),%eax
+    for(i = 0; i < 4*4096; i++){
+    1160:	bb 02 10 00 00       	mov    $0x1002,%ebx
+      if(p[i] != (i % 2 == 0 ? 'c' : (i == 4096 + 1 ? 'x' : 'p'))){
+    1165:	b9 63 00 00 00       	mov    $0x63,%ecx
+    116a:	eb c1                	jmp    112d <cowtest+0xbd>
+    exit();
+    116c:	e8 92 3f 00 00       	call   5103 <exit>
+  write(fds[1], "x", 1);
+    1171:	83 ec 04             	sub    $0x4,%esp
+    1174:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1177:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    117a:	6a 01                	push   $0x1
+    117c:	68 f7 62 00 00       	push   $0x62f7
+    1181:	ff 75 e4             	push   -0x1c(%ebp)
+    1184:	e8 9a 3f 00 00       	call   5123 <write>
+  wait();
+    1189:	e8 7d 3f 00 00       	call   510b <wait>
+    118e:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+    1191:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    1194:	83 c4 10             	add    $0x10,%esp
+    1197:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    119e:	66 90                	xchg   %ax,%ax
+    if(p[i] != 'p'){
+    11a0:	80 3c 0a 70          	cmpb   $0x70,(%edx,%ecx,1)
+    11a4:	75 59                	jne    11ff <cowtest+0x18f>
+  for(i = 0; i < 4*4096; i++){
+    11a6:	83 c1 01             	add    $0x1,%ecx
+    11a9:	81 f9 00 40 00 00    	cmp    $0x4000,%ecx
+    11af:	75 ef                	jne    11a0 <cowtest+0x130>
+  close(fds[0]);
+    11b1:	83 ec 0c             	sub    $0xc,%esp
+    11b4:	ff 75 e0             	push   -0x20(%ebp)
+    11b7:	e8 6f 3f 00 00       	call   512b <close>
+  close(fds[1]);
+    11bc:	58                   	pop    %eax
+    11bd:	ff 75 e4             	push   -0x1c(%ebp)
+    11c0:	e8 66 3f 00 00       	call   512b <close>
+  sbrk(-4*4096);
+    11c5:	c7 04 24 00 c0 ff ff 	movl   $0xffffc000,(%esp)
+    11cc:	e8 ba 3f 00 00       	call   518b <sbrk>
+  printf(1, "cow test ok\n");
+    11d1:	5a                   	pop    %edx
+    11d2:	59                   	pop    %ecx
+    11d3:	68 89 5a 00 00       	push   $0x5a89
+    11d8:	6a 01                	push   $0x1
+    11da:	e8 d1 40 00 00       	call   52b0 <printf>
+}
+    11df:	83 c4 10             	add    $0x10,%esp
+    11e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11e5:	5b                   	pop    %ebx
+    11e6:	5e                   	pop    %esi
+    11e7:	5f                   	pop    %edi
+    11e8:	5d                   	pop    %ebp
+    11e9:	c3                   	ret
+        printf(1, "cow test: child sees wrong data at %d\n", i);
+    11ea:	83 ec 04             	sub    $0x4,%esp
+    11ed:	53                   	push   %ebx
+    11ee:	68 44 6b 00 00       	push   $0x6b44
+    11f3:	6a 01                	push   $0x1
+    11f5:	e8 b6 40 00 00       	call   52b0 <printf>
+        exit();
+    11fa:	e8 04 3f 00 00       	call   5103 <exit>
+      printf(1, "cow test: parent sees child's write at %d\n", i);
+    11ff:	83 ec 04             	sub    $0x4,%esp
+    1202:	51                   	push   %ecx
+    1203:	68 6c 6b 00 00       	push   $0x6b6c
+    1208:	6a 01                	push   $0x1
+    120a:	e8 a1 40 00 00       	call   52b0 <printf>
+      exit();
+    120f:	e8 ef 3e 00 00       	call   5103 <exit>
+    printf(1, "cow test: fork failed\n");
+    1214:	53                   	push   %ebx
+    1215:	53                   	push   %ebx
+    1216:	68 72 5a 00 00       	push   $0x5a72
+    121b:	6a 01                	push   $0x1
+    121d:	e8 8e 40 00 00       	call   52b0 <printf>
+    exit();
+    1222:	e8 dc 3e 00 00       	call   5103 <exit>
+    printf(1, "cow test: pipe() failed\n");
+    1227:	56                   	push   %esi
+    1228:	56                   	push   %esi
+    1229:	68 59 5a 00 00       	push   $0x5a59
+    122e:	6a 01                	push   $0x1
+    1230:	e8 7b 40 00 00       	call   52b0 <printf>
+    exit();
+    1235:	e8 c9 3e 00 00       	call   5103 <exit>
+    123a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001240 <mmaptest>:
+{
+    1240:	55                   	push   %ebp
+    1241:	89 e5                	mov    %esp,%ebp
+    1243:	57                   	push   %edi
+    1244:	56                   	push   %esi
+    1245:	53                   	push   %ebx
+    buf[i] = 'a' + i % 23;
+    1246:	bb c9 42 16 b2       	mov    $0xb21642c9,%ebx
+{
+    124b:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "mmap test\n");
+    124e:	68 96 5a 00 00       	push   $0x5a96
+    1253:	6a 01                	push   $0x1
+    1255:	e8 56 40 00 00       	call   52b0 <printf>
+  fd = open("mmapfile", O_CREATE|O_RDWR);
+    125a:	58                   	pop    %eax
+    125b:	5a                   	pop    %edx
+    125c:	68 02 02 00 00       	push   $0x202
+    1261:	68 a1 5a 00 00       	push   $0x5aa1
+    1266:	e8 d8 3e 00 00       	call   5143 <open>
+    126b:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < N; i++)
+    126e:	31 c9                	xor    %ecx,%ecx
+  fd = open("mmapfile", O_CREATE|O_RDWR);
+    1270:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(i = 0; i < N; i++)
+    1273:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1277:	90                   	nop
+    buf[i] = 'a' + i % 23;
+    1278:	89 c8                	mov    %ecx,%eax
+    127a:	f7 e3                	mul    %ebx
+    127c:	89 c8                	mov    %ecx,%eax
+  for(i = 0; i < N; i++)
+    127e:	83 c1 01             	add    $0x1,%ecx
+    buf[i] = 'a' + i % 23;
+    1281:	c1 ea 04             	shr    $0x4,%edx
+    1284:	6b d2 17             	imul   $0x17,%edx,%edx
+    1287:	29 d0                	sub    %edx,%eax
+    1289:	83 c0 61             	add    $0x61,%eax
+    128c:	88 81 3f b7 00 00    	mov    %al,0xb73f(%ecx)
+  for(i = 0; i < N; i++)
+    1292:	81 f9 64 10 00 00    	cmp    $0x1064,%ecx
+    1298:	75 de                	jne    1278 <mmaptest+0x38>
+  if(fd < 0 || write(fd, buf, N) != N){
+    129a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    129d:	85 c0                	test   %eax,%eax
+    129f:	0f 88 00 03 00 00    	js     15a5 <mmaptest+0x365>
+    12a5:	83 ec 04             	sub    $0x4,%esp
+    12a8:	68 64 10 00 00       	push   $0x1064
+    12ad:	68 40 b7 00 00       	push   $0xb740
+    12b2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    12b5:	57                   	push   %edi
+    12b6:	e8 68 3e 00 00       	call   5123 <write>
+    12bb:	83 c4 10             	add    $0x10,%esp
+    12be:	3d 64 10 00 00       	cmp    $0x1064,%eax
+    12c3:	0f 85 dc 02 00 00    	jne    15a5 <mmaptest+0x365>
+  p = mmap(0, N, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+    12c9:	83 ec 08             	sub    $0x8,%esp
+    12cc:	6a 00                	push   $0x0
+    12ce:	57                   	push   %edi
+    12cf:	6a 02                	push   $0x2
+    12d1:	6a 03                	push   $0x3
+    12d3:	68 64 10 00 00       	push   $0x1064
+    12d8:	6a 00                	push   $0x0
+    12da:	e8 cc 3e 00 00       	call   51ab <mmap>
+  if(p == MAP_FAILED){
+    12df:	83 c4 20             	add    $0x20,%esp
+  p = mmap(0, N, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+    12e2:	89 c6                	mov    %eax,%esi
+  if(p == MAP_FAILED){
+    12e4:	83 f8 ff             	cmp    $0xffffffff,%eax
+    12e7:	0f 84 a5 02 00 00    	je     1592 <mmaptest+0x352>
+  for(i = 0; i < 2*4096; i++){
+    12ed:	31 c9                	xor    %ecx,%ecx
+    if(p[i] != (i < N ? 'a' + i % 23 : 0)){
+    12ef:	bf c9 42 16 b2       	mov    $0xb21642c9,%edi
+    12f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12f8:	0f be 1c 0e          	movsbl (%esi,%ecx,1),%ebx
+    12fc:	81 f9 63 10 00 00    	cmp    $0x1063,%ecx
+    1302:	7f 28                	jg     132c <mmaptest+0xec>
+    1304:	89 c8                	mov    %ecx,%eax
+    1306:	f7 e7                	mul    %edi
+    1308:	89 c8                	mov    %ecx,%eax
+    130a:	c1 ea 04             	shr    $0x4,%edx
+    130d:	6b d2 17             	imul   $0x17,%edx,%edx
+    1310:	29 d0                	sub    %edx,%eax
+    1312:	83 c0 61             	add    $0x61,%eax
+    1315:	39 c3                	cmp    %eax,%ebx
+    1317:	0f 85 60 02 00 00    	jne    157d <mmaptest+0x33d>
+  for(i = 0; i < 2*4096; i++){
+    131d:	83 c1 01             	add    $0x1,%ecx
+    if(p[i] != (i < N ? 'a' + i % 23 : 0)){
+    1320:	0f be 1c 0e          	movsbl (%esi,%ecx,1),%ebx
+    1324:	81 f9 63 10 00 00    	cmp    $0x1063,%ecx
+    132a:	7e d8                	jle    1304 <mmaptest+0xc4>
+    132c:	85 db                	test   %ebx,%ebx
+    132e:	0f 85 49 02 00 00    	jne    157d <mmaptest+0x33d>
+  for(i = 0; i < 2*4096; i++){
+    1334:	83 c1 01             	add    $0x1,%ecx
+    1337:	81 f9 00 20 00 00    	cmp    $0x2000,%ecx
+    133d:	75 b9                	jne    12f8 <mmaptest+0xb8>
+  if(munmap(p, N) < 0){
+    133f:	83 ec 08             	sub    $0x8,%esp
+  p[0] = 'X';
+    1342:	c6 06 58             	movb   $0x58,(%esi)
+  if(munmap(p, N) < 0){
+    1345:	68 64 10 00 00       	push   $0x1064
+    134a:	56                   	push   %esi
+    134b:	e8 63 3e 00 00       	call   51b3 <munmap>
+    1350:	83 c4 10             	add    $0x10,%esp
+    1353:	85 c0                	test   %eax,%eax
+    1355:	0f 88 24 03 00 00    	js     167f <mmaptest+0x43f>
+  close(fd);
+    135b:	83 ec 0c             	sub    $0xc,%esp
+    135e:	ff 75 e4             	push   -0x1c(%ebp)
+    1361:	e8 c5 3d 00 00       	call   512b <close>
+  fd = open("mmapfile", O_RDWR);
+    1366:	5e                   	pop    %esi
+    1367:	5f                   	pop    %edi
+    1368:	6a 02                	push   $0x2
+    136a:	68 a1 5a 00 00       	push   $0x5aa1
+    136f:	e8 cf 3d 00 00       	call   5143 <open>
+  if(read(fd, buf, 1) != 1 || buf[0] != 'a'){
+    1374:	83 c4 0c             	add    $0xc,%esp
+    1377:	6a 01                	push   $0x1
+  fd = open("mmapfile", O_RDWR);
+    1379:	89 c3                	mov    %eax,%ebx
+  if(read(fd, buf, 1) != 1 || buf[0] != 'a'){
+    137b:	68 40 b7 00 00       	push   $0xb740
+    1380:	50                   	push   %eax
+    1381:	e8 95 3d 00 00       	call   511b <read>
+    1386:	83 c4 10             	add    $0x10,%esp
+    1389:	83 f8 01             	cmp    $0x1,%eax
+    138c:	0f 85 da 02 00 00    	jne    166c <mmaptest+0x42c>
+    1392:	80 3d 40 b7 00 00 61 	cmpb   $0x61,0xb740
+    1399:	0f 85 cd 02 00 00    	jne    166c <mmaptest+0x42c>
+  p = mmap(0, N, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+    139f:	83 ec 08             	sub    $0x8,%esp
+    13a2:	6a 00                	push   $0x0
+    13a4:	53                   	push   %ebx
+    13a5:	6a 01                	push   $0x1
+    13a7:	6a 03                	push   $0x3
+    13a9:	68 64 10 00 00       	push   $0x1064
+    13ae:	6a 00                	push   $0x0
+    13b0:	e8 f6 3d 00 00       	call   51ab <mmap>
+  if(p == MAP_FAILED){
+    13b5:	83 c4 20             	add    $0x20,%esp
+    13b8:	83 f8 ff             	cmp    $0xffffffff,%eax
+    13bb:	0f 84 98 02 00 00    	je     1659 <mmaptest+0x419>
+  munmap(p, N);
+    13c1:	83 ec 08             	sub    $0x8,%esp
+  p[0] = 'Y';
+    13c4:	c6 00 59             	movb   $0x59,(%eax)
+  p[N-1] = 'Z';
+    13c7:	c6 80 63 10 00 00 5a 	movb   $0x5a,0x1063(%eax)
+  munmap(p, N);
+    13ce:	68 64 10 00 00       	push   $0x1064
+    13d3:	50                   	push   %eax
+    13d4:	e8 da 3d 00 00       	call   51b3 <munmap>
+  close(fd);
+    13d9:	89 1c 24             	mov    %ebx,(%esp)
+    13dc:	e8 4a 3d 00 00       	call   512b <close>
+  fd = open("mmapfile", O_RDWR);
+    13e1:	58                   	pop    %eax
+    13e2:	5a                   	pop    %edx
+    13e3:	6a 02                	push   $0x2
+    13e5:	68 a1 5a 00 00       	push   $0x5aa1
+    13ea:	e8 54 3d 00 00       	call   5143 <open>
+  if(read(fd, buf, N) != N || buf[0] != 'Y' || buf[N-1] != 'Z'){
+    13ef:	83 c4 0c             	add    $0xc,%esp
+    13f2:	68 64 10 00 00       	push   $0x1064
+  fd = open("mmapfile", O_RDWR);
+    13f7:	89 c3                	mov    %eax,%ebx
+  if(read(fd, buf, N) != N || buf[0] != 'Y' || buf[N-1] != 'Z'){
+    13f9:	68 40 b7 00 00       	push   $0xb740
+    13fe:	50                   	push   %eax
+    13ff:	e8 17 3d 00 00       	call   511b <read>
+    1404:	83 c4 10             	add    $0x10,%esp
+    1407:	3d 64 10 00 00       	cmp    $0x1064,%eax
+    140c:	0f 85 33 02 00 00    	jne    1645 <mmaptest+0x405>
+    1412:	80 3d 40 b7 00 00 59 	cmpb   $0x59,0xb740
+    1419:	0f 85 26 02 00 00    	jne    1645 <mmaptest+0x405>
+    141f:	80 3d a3 c7 00 00 5a 	cmpb   $0x5a,0xc7a3
+    1426:	0f 85 19 02 00 00    	jne    1645 <mmaptest+0x405>
+  close(fd);
+    142c:	83 ec 0c             	sub    $0xc,%esp
+    142f:	53                   	push   %ebx
+    1430:	e8 f6 3c 00 00       	call   512b <close>
+  fd = open("mmapfile", O_RDWR);
+    1435:	59                   	pop    %ecx
+    1436:	5b                   	pop    %ebx
+    1437:	6a 02                	push   $0x2
+    1439:	68 a1 5a 00 00       	push   $0x5aa1
+    143e:	e8 00 3d 00 00       	call   5143 <open>
+  p = mmap(0, N, PROT_READ, MAP_SHARED, fd, 0);
+    1443:	5f                   	pop    %edi
+  fd = open("mmapfile", O_RDWR);
+    1444:	89 c6                	mov    %eax,%esi
+  p = mmap(0, N, PROT_READ, MAP_SHARED, fd, 0);
+    1446:	58                   	pop    %eax
+    1447:	6a 00                	push   $0x0
+    1449:	56                   	push   %esi
+    144a:	6a 01                	push   $0x1
+    144c:	6a 01                	push   $0x1
+    144e:	68 64 10 00 00       	push   $0x1064
+    1453:	6a 00                	push   $0x0
+    1455:	e8 51 3d 00 00       	call   51ab <mmap>
+  if(p == MAP_FAILED || read(fd, p, 10) != -1 || p[0] != 'Y'){
+    145a:	83 c4 20             	add    $0x20,%esp
+  p = mmap(0, N, PROT_READ, MAP_SHARED, fd, 0);
+    145d:	89 c3                	mov    %eax,%ebx
+  if(p == MAP_FAILED || read(fd, p, 10) != -1 || p[0] != 'Y'){
+    145f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1462:	0f 84 c9 01 00 00    	je     1631 <mmaptest+0x3f1>
+    1468:	83 ec 04             	sub    $0x4,%esp
+    146b:	6a 0a                	push   $0xa
+    146d:	50                   	push   %eax
+    146e:	56                   	push   %esi
+    146f:	e8 a7 3c 00 00       	call   511b <read>
+    1474:	83 c4 10             	add    $0x10,%esp
+    1477:	83 f8 ff             	cmp    $0xffffffff,%eax
+    147a:	0f 85 b1 01 00 00    	jne    1631 <mmaptest+0x3f1>
+    1480:	80 3b 59             	cmpb   $0x59,(%ebx)
+    1483:	0f 85 a8 01 00 00    	jne    1631 <mmaptest+0x3f1>
+  munmap(p, N);
+    1489:	83 ec 08             	sub    $0x8,%esp
+    148c:	68 64 10 00 00       	push   $0x1064
+    1491:	53                   	push   %ebx
+    1492:	e8 1c 3d 00 00       	call   51b3 <munmap>
+  close(fd);
+    1497:	89 34 24             	mov    %esi,(%esp)
+    149a:	e8 8c 3c 00 00       	call   512b <close>
+  unlink("mmapfile");
+    149f:	c7 04 24 a1 5a 00 00 	movl   $0x5aa1,(%esp)
+    14a6:	e8 a8 3c 00 00       	call   5153 <unlink>
+  p = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+    14ab:	58                   	pop    %eax
+    14ac:	5a                   	pop    %edx
+    14ad:	6a 00                	push   $0x0
+    14af:	6a ff                	push   $0xffffffff
+    14b1:	6a 22                	push   $0x22
+    14b3:	6a 03                	push   $0x3
+    14b5:	68 00 10 00 00       	push   $0x1000
+    14ba:	6a 00                	push   $0x0
+    14bc:	e8 ea 3c 00 00       	call   51ab <mmap>
+  q = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+    14c1:	83 c4 18             	add    $0x18,%esp
+    14c4:	6a 00                	push   $0x0
+  p = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+    14c6:	89 c3                	mov    %eax,%ebx
+  q = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+    14c8:	6a ff                	push   $0xffffffff
+    14ca:	6a 21                	push   $0x21
+    14cc:	6a 03                	push   $0x3
+    14ce:	68 00 10 00 00       	push   $0x1000
+    14d3:	6a 00                	push   $0x0
+    14d5:	e8 d1 3c 00 00       	call   51ab <mmap>
+  if(p == MAP_FAILED || q == MAP_FAILED || p[0] != 0 || q[0] != 0){
+    14da:	83 c4 20             	add    $0x20,%esp
+  q = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+    14dd:	89 c6                	mov    %eax,%esi
+  if(p == MAP_FAILED || q == MAP_FAILED || p[0] != 0 || q[0] != 0){
+    14df:	83 fb ff             	cmp    $0xffffffff,%ebx
+    14e2:	0f 84 35 01 00 00    	je     161d <mmaptest+0x3dd>
+    14e8:	83 f8 ff             	cmp    $0xffffffff,%eax
+    14eb:	0f 84 2c 01 00 00    	je     161d <mmaptest+0x3dd>
+    14f1:	80 3b 00             	cmpb   $0x0,(%ebx)
+    14f4:	0f 85 23 01 00 00    	jne    161d <mmaptest+0x3dd>
+    14fa:	80 38 00             	cmpb   $0x0,(%eax)
+    14fd:	0f 85 1a 01 00 00    	jne    161d <mmaptest+0x3dd>
+  p[0] = 'p';
+    1503:	c6 03 70             	movb   $0x70,(%ebx)
+  pid = fork();
+    1506:	e8 f0 3b 00 00       	call   50fb <fork>
+  if(pid < 0){
+    150b:	85 c0                	test   %eax,%eax
+    150d:	0f 88 f7 00 00 00    	js     160a <mmaptest+0x3ca>
+  if(pid == 0){
+    1513:	0f 84 d0 00 00 00    	je     15e9 <mmaptest+0x3a9>
+  wait();
+    1519:	e8 ed 3b 00 00       	call   510b <wait>
+  if(p[0] != 'p' || q[0] != 'c'){
+    151e:	80 3b 70             	cmpb   $0x70,(%ebx)
+    1521:	0f 85 af 00 00 00    	jne    15d6 <mmaptest+0x396>
+    1527:	80 3e 63             	cmpb   $0x63,(%esi)
+    152a:	0f 85 a6 00 00 00    	jne    15d6 <mmaptest+0x396>
+  munmap(p, 4096);
+    1530:	83 ec 08             	sub    $0x8,%esp
+    1533:	68 00 10 00 00       	push   $0x1000
+    1538:	53                   	push   %ebx
+    1539:	e8 75 3c 00 00       	call   51b3 <munmap>
+  munmap(q, 4096);
+    153e:	5a                   	pop    %edx
+    153f:	59                   	pop    %ecx
+    1540:	68 00 10 00 00       	push   $0x1000
+    1545:	56                   	push   %esi
+    1546:	e8 68 3c 00 00       	call   51b3 <munmap>
+  ppid = getpid();
+    154b:	e8 33 3c 00 00       	call   5183 <getpid>
+    1550:	89 c6                	mov    %eax,%esi
+  pid = fork();
+    1552:	e8 a4 3b 00 00       	call   50fb <fork>
+  if(pid == 0){
+    1557:	83 c4 10             	add    $0x10,%esp
+    155a:	85 c0                	test   %eax,%eax
+    155c:	74 5a                	je     15b8 <mmaptest+0x378>
+  wait();
+    155e:	e8 a8 3b 00 00       	call   510b <wait>
+  printf(1, "mmap test ok\n");
+    1563:	83 ec 08             	sub    $0x8,%esp
+    1566:	68 f9 5a 00 00       	push   $0x5af9
+    156b:	6a 01                	push   $0x1
+    156d:	e8 3e 3d 00 00       	call   52b0 <printf>
+}
+    1572:	83 c4 10             	add    $0x10,%esp
+    1575:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1578:	5b                   	pop    %ebx
+    1579:	5e                   	pop    %esi
+    157a:	5f                   	pop    %edi
+    157b:	5d                   	pop    %ebp
+    157c:	c3                   	ret
+      printf(1, "mmap test: wrong data at %d\n", i);
+    157d:	83 ec 04             	sub    $0x4,%esp
+    1580:	51                   	push   %ecx
+    1581:	68 aa 5a 00 00       	push   $0x5aaa
+    1586:	6a 01                	push   $0x1
+    1588:	e8 23 3d 00 00       	call   52b0 <printf>
+      exit();
+    158d:	e8 71 3b 00 00       	call   5103 <exit>
+    printf(1, "mmap test: mmap private failed\n");
+    1592:	50                   	push   %eax
+    1593:	50                   	push   %eax
+    1594:	68 bc 6b 00 00       	push   $0x6bbc
+    1599:	6a 01                	push   $0x1
+    159b:	e8 10 3d 00 00       	call   52b0 <printf>
+    exit();
+    15a0:	e8 5e 3b 00 00       	call   5103 <exit>
+    printf(1, "mmap test: cannot write mmapfile\n");
+    15a5:	50                   	push   %eax
+    15a6:	50                   	push   %eax
+    15a7:	68 98 6b 00 00       	push   $0x6b98
+    15ac:	6a 01                	push   $0x1
+    15ae:	e8 fd 3c 00 00       	call   52b0 <printf>
+    exit();
+    15b3:	e8 4b 3b 00 00       	call   5103 <exit>
+    p[0] = 'x';
+    15b8:	c6 03 78             	movb   $0x78,(%ebx)
+    printf(1, "mmap test: wrote to unmapped memory\n");
+    15bb:	50                   	push   %eax
+    15bc:	50                   	push   %eax
+    15bd:	68 ec 6c 00 00       	push   $0x6cec
+    15c2:	6a 01                	push   $0x1
+    15c4:	e8 e7 3c 00 00       	call   52b0 <printf>
+    kill(ppid);
+    15c9:	89 34 24             	mov    %esi,(%esp)
+    15cc:	e8 62 3b 00 00       	call   5133 <kill>
+    exit();
+    15d1:	e8 2d 3b 00 00       	call   5103 <exit>
+    printf(1, "mmap test: fork sharing wrong\n");
+    15d6:	53                   	push   %ebx
+    15d7:	53                   	push   %ebx
+    15d8:	68 cc 6c 00 00       	push   $0x6ccc
+    15dd:	6a 01                	push   $0x1
+    15df:	e8 cc 3c 00 00       	call   52b0 <printf>
+    exit();
+    15e4:	e8 1a 3b 00 00       	call   5103 <exit>
+    if(p[0] != 'p')
+    15e9:	80 3b 70             	cmpb   $0x70,(%ebx)
+    15ec:	74 11                	je     15ff <mmaptest+0x3bf>
+      printf(1, "mmap test: child lost private data\n");
+    15ee:	57                   	push   %edi
+    15ef:	57                   	push   %edi
+    15f0:	68 a8 6c 00 00       	push   $0x6ca8
+    15f5:	6a 01                	push   $0x1
+    15f7:	e8 b4 3c 00 00       	call   52b0 <printf>
+    15fc:	83 c4 10             	add    $0x10,%esp
+    p[0] = 'c';
+    15ff:	c6 03 63             	movb   $0x63,(%ebx)
+    q[0] = 'c';
+    1602:	c6 06 63             	movb   $0x63,(%esi)
+    exit();
+    1605:	e8 f9 3a 00 00       	call   5103 <exit>
+    printf(1, "mmap test: fork failed\n");
+    160a:	50                   	push   %eax
+    160b:	50                   	push   %eax
+    160c:	68 e1 5a 00 00       	push   $0x5ae1
+    1611:	6a 01                	push   $0x1
+    1613:	e8 98 3c 00 00       	call   52b0 <printf>
+    exit();
+    1618:	e8 e6 3a 00 00       	call   5103 <exit>
+    printf(1, "mmap test: anonymous mmap failed\n");
+    161d:	83 ec 08             	sub    $0x8,%esp
+    1620:	68 84 6c 00 00       	push   $0x6c84
+    1625:	6a 01                	push   $0x1
+    1627:	e8 84 3c 00 00       	call   52b0 <printf>
+    exit();
+    162c:	e8 d2 3a 00 00       	call   5103 <exit>
+    printf(1, "mmap test: read into a read-only mapping\n");
+    1631:	83 ec 08             	sub    $0x8,%esp
+    1634:	68 58 6c 00 00       	push   $0x6c58
+    1639:	6a 01                	push   $0x1
+    163b:	e8 70 3c 00 00       	call   52b0 <printf>
+    exit();
+    1640:	e8 be 3a 00 00       	call   5103 <exit>
+    printf(1, "mmap test: shared write did not reach the file\n");
+    1645:	83 ec 08             	sub    $0x8,%esp
+    1648:	68 28 6c 00 00       	push   $0x6c28
+    164d:	6a 01                	push   $0x1
+    164f:	e8 5c 3c 00 00       	call   52b0 <printf>
+    exit();
+    1654:	e8 aa 3a 00 00       	call   5103 <exit>
+    printf(1, "mmap test: mmap shared failed\n");
+    1659:	51                   	push   %ecx
+    165a:	51                   	push   %ecx
+    165b:	68 08 6c 00 00       	push   $0x6c08
+    1660:	6a 01                	push   $0x1
+    1662:	e8 49 3c 00 00       	call   52b0 <printf>
+    exit();
+    1667:	e8 97 3a 00 00       	call   5103 <exit>
+    printf(1, "mmap test: private write reached the file\n");
+    166c:	53                   	push   %ebx
+    166d:	53                   	push   %ebx
+    166e:	68 dc 6b 00 00       	push   $0x6bdc
+    1673:	6a 01                	push   $0x1
+    1675:	e8 36 3c 00 00       	call   52b0 <printf>
+    exit();
+    167a:	e8 84 3a 00 00       	call   5103 <exit>
+    printf(1, "mmap test: munmap failed\n");
+    167f:	50                   	push   %eax
+    1680:	50                   	push   %eax
+    1681:	68 c7 5a 00 00       	push   $0x5ac7
+    1686:	6a 01                	push   $0x1
+    1688:	e8 23 3c 00 00       	call   52b0 <printf>
+    exit();
+    168d:	e8 71 3a 00 00       	call   5103 <exit>
+    1692:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1699:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000016a0 <swapbyte>:
+{
+    16a0:	55                   	push   %ebp
+    16a1:	89 e5                	mov    %esp,%ebp
+    16a3:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(i % 2 == 0)
+    16a6:	a8 01                	test   $0x1,%al
+    16a8:	74 0f                	je     16b9 <swapbyte+0x19>
+  return ((uint)(i*4096 + j) * 1103515245) >> 16;
+    16aa:	c1 e0 0c             	shl    $0xc,%eax
+    16ad:	03 45 0c             	add    0xc(%ebp),%eax
+    16b0:	69 c0 6d 4e c6 41    	imul   $0x41c64e6d,%eax,%eax
+    16b6:	c1 e8 10             	shr    $0x10,%eax
+}
+    16b9:	5d                   	pop    %ebp
+    16ba:	c3                   	ret
+    16bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    16bf:	90                   	nop
+
+000016c0 <swaptest>:
+{
+    16c0:	55                   	push   %ebp
+    16c1:	89 e5                	mov    %esp,%ebp
+    16c3:	57                   	push   %edi
+    16c4:	56                   	push   %esi
+    16c5:	53                   	push   %ebx
+    16c6:	81 ec 44 01 00 00    	sub    $0x144,%esp
+  printf(1, "swap test\n");
+    16cc:	68 07 5b 00 00       	push   $0x5b07
+    16d1:	6a 01                	push   $0x1
+    16d3:	e8 d8 3b 00 00       	call   52b0 <printf>
+  memstat(&ms1);
+    16d8:	8d 85 64 ff ff ff    	lea    -0x9c(%ebp),%eax
+    16de:	89 04 24             	mov    %eax,(%esp)
+    16e1:	e8 bd 3a 00 00       	call   51a3 <memstat>
+  if(ms1.swappages == 0){
+    16e6:	8b 45 c8             	mov    -0x38(%ebp),%eax
+    16e9:	83 c4 10             	add    $0x10,%esp
+    16ec:	85 c0                	test   %eax,%eax
+    16ee:	0f 84 9b 01 00 00    	je     188f <swaptest+0x1cf>
+  if(pipe(fds) != 0){
+    16f4:	83 ec 0c             	sub    $0xc,%esp
+    16f7:	8d 85 d8 fe ff ff    	lea    -0x128(%ebp),%eax
+    16fd:	50                   	push   %eax
+    16fe:	e8 10 3a 00 00       	call   5113 <pipe>
+    1703:	83 c4 10             	add    $0x10,%esp
+    1706:	89 85 bc fe ff ff    	mov    %eax,-0x144(%ebp)
+    170c:	85 c0                	test   %eax,%eax
+    170e:	0f 85 1b 02 00 00    	jne    192f <swaptest+0x26f>
+  pid = fork();
+    1714:	e8 e2 39 00 00       	call   50fb <fork>
+    1719:	89 c3                	mov    %eax,%ebx
+  if(pid < 0){
+    171b:	85 c0                	test   %eax,%eax
+    171d:	0f 88 f9 01 00 00    	js     191c <swaptest+0x25c>
+  if(pid == 0){
+    1723:	0f 84 8c 01 00 00    	je     18b5 <swaptest+0x1f5>
+  p = sbrk(N*4096);
+    1729:	83 ec 0c             	sub    $0xc,%esp
+    172c:	bb 00 d0 e6 64       	mov    $0x64e6d000,%ebx
+    1731:	68 00 00 04 00       	push   $0x40000
+    1736:	e8 50 3a 00 00       	call   518b <sbrk>
+    173b:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < N; i++)
+    173e:	31 d2                	xor    %edx,%edx
+  p = sbrk(N*4096);
+    1740:	89 85 c0 fe ff ff    	mov    %eax,-0x140(%ebp)
+  for(i = 0; i < N; i++)
+    1746:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    174d:	8d 76 00             	lea    0x0(%esi),%esi
+    for(j = 0; j < 4096; j++)
+    1750:	8b 85 c0 fe ff ff    	mov    -0x140(%ebp),%eax
+    1756:	89 d1                	mov    %edx,%ecx
+  return ((uint)(i*4096 + j) * 1103515245) >> 16;
+    1758:	89 95 c4 fe ff ff    	mov    %edx,-0x13c(%ebp)
+    175e:	89 d7                	mov    %edx,%edi
+    1760:	c1 e1 0c             	shl    $0xc,%ecx
+    1763:	83 e7 01             	and    $0x1,%edi
+    1766:	89 d6                	mov    %edx,%esi
+    1768:	01 c1                	add    %eax,%ecx
+    176a:	8d 83 00 30 19 9b    	lea    -0x64e6d000(%ebx),%eax
+    1770:	89 c2                	mov    %eax,%edx
+    1772:	c1 ea 10             	shr    $0x10,%edx
+    1775:	85 ff                	test   %edi,%edi
+    1777:	0f 44 d6             	cmove  %esi,%edx
+    for(j = 0; j < 4096; j++)
+    177a:	05 6d 4e c6 41       	add    $0x41c64e6d,%eax
+    177f:	83 c1 01             	add    $0x1,%ecx
+      p[i*4096 + j] = swapbyte(i, j);
+    1782:	88 51 ff             	mov    %dl,-0x1(%ecx)
+    for(j = 0; j < 4096; j++)
+    1785:	39 c3                	cmp    %eax,%ebx
+    1787:	75 e7                	jne    1770 <swaptest+0xb0>
+  for(i = 0; i < N; i++)
+    1789:	8b 95 c4 fe ff ff    	mov    -0x13c(%ebp),%edx
+    178f:	81 c3 00 d0 e6 64    	add    $0x64e6d000,%ebx
+    1795:	83 c2 01             	add    $0x1,%edx
+    1798:	83 fa 40             	cmp    $0x40,%edx
+    179b:	75 b3                	jne    1750 <swaptest+0x90>
+  write(fds[1], "x", 1);
+    179d:	83 ec 04             	sub    $0x4,%esp
+    17a0:	6a 01                	push   $0x1
+    17a2:	68 f7 62 00 00       	push   $0x62f7
+    17a7:	ff b5 dc fe ff ff    	push   -0x124(%ebp)
+    17ad:	e8 71 39 00 00       	call   5123 <write>
+  wait();
+    17b2:	e8 54 39 00 00       	call   510b <wait>
+  close(fds[0]);
+    17b7:	5b                   	pop    %ebx
+    17b8:	ff b5 d8 fe ff ff    	push   -0x128(%ebp)
+    17be:	e8 68 39 00 00       	call   512b <close>
+  close(fds[1]);
+    17c3:	5e                   	pop    %esi
+    17c4:	ff b5 dc fe ff ff    	push   -0x124(%ebp)
+    17ca:	e8 5c 39 00 00       	call   512b <close>
+  memstat(&ms);
+    17cf:	8d 85 e0 fe ff ff    	lea    -0x120(%ebp),%eax
+    17d5:	89 04 24             	mov    %eax,(%esp)
+    17d8:	e8 c6 39 00 00       	call   51a3 <memstat>
+  if(ms.swapouts == ms1.swapouts){
+    17dd:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    17e0:	83 c4 10             	add    $0x10,%esp
+    17e3:	39 85 4c ff ff ff    	cmp    %eax,-0xb4(%ebp)
+    17e9:	0f 84 b3 00 00 00    	je     18a2 <swaptest+0x1e2>
+    17ef:	8b 95 bc fe ff ff    	mov    -0x144(%ebp),%edx
+    17f5:	bb 00 d0 e6 64       	mov    $0x64e6d000,%ebx
+    for(j = 0; j < 4096; j++){
+    17fa:	8b 85 c0 fe ff ff    	mov    -0x140(%ebp),%eax
+    1800:	89 d1                	mov    %edx,%ecx
+    1802:	89 95 c4 fe ff ff    	mov    %edx,-0x13c(%ebp)
+    1808:	89 d7                	mov    %edx,%edi
+    180a:	c1 e1 0c             	shl    $0xc,%ecx
+    180d:	83 e7 01             	and    $0x1,%edi
+    return i;
+    1810:	89 d6                	mov    %edx,%esi
+    1812:	01 c1                	add    %eax,%ecx
+    1814:	8d 83 00 30 19 9b    	lea    -0x64e6d000(%ebx),%eax
+    181a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1820:	89 c2                	mov    %eax,%edx
+    1822:	c1 ea 10             	shr    $0x10,%edx
+    1825:	85 ff                	test   %edi,%edi
+    1827:	0f 44 d6             	cmove  %esi,%edx
+      if(p[i*4096 + j] != swapbyte(i, j)){
+    182a:	38 11                	cmp    %dl,(%ecx)
+    182c:	75 46                	jne    1874 <swaptest+0x1b4>
+    for(j = 0; j < 4096; j++){
+    182e:	05 6d 4e c6 41       	add    $0x41c64e6d,%eax
+    1833:	83 c1 01             	add    $0x1,%ecx
+    1836:	39 d8                	cmp    %ebx,%eax
+    1838:	75 e6                	jne    1820 <swaptest+0x160>
+  for(i = 0; i < N; i++){
+    183a:	8b 95 c4 fe ff ff    	mov    -0x13c(%ebp),%edx
+    1840:	8d 98 00 d0 e6 64    	lea    0x64e6d000(%eax),%ebx
+    1846:	83 c2 01             	add    $0x1,%edx
+    1849:	83 fa 40             	cmp    $0x40,%edx
+    184c:	75 ac                	jne    17fa <swaptest+0x13a>
+  sbrk(-N*4096);
+    184e:	83 ec 0c             	sub    $0xc,%esp
+    1851:	68 00 00 fc ff       	push   $0xfffc0000
+    1856:	e8 30 39 00 00       	call   518b <sbrk>
+  printf(1, "swap test ok\n");
+    185b:	58                   	pop    %eax
+    185c:	5a                   	pop    %edx
+    185d:	68 7a 5b 00 00       	push   $0x5b7a
+    1862:	6a 01                	push   $0x1
+    1864:	e8 47 3a 00 00       	call   52b0 <printf>
+}
+    1869:	83 c4 10             	add    $0x10,%esp
+    186c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    186f:	5b                   	pop    %ebx
+    1870:	5e                   	pop    %esi
+    1871:	5f                   	pop    %edi
+    1872:	5d                   	pop    %ebp
+    1873:	c3                   	ret
+        printf(1, "swap test: page %d corrupted\n", i);
+    1874:	8b 85 c4 fe ff ff    	mov    -0x13c(%ebp),%eax
+    187a:	83 ec 04             	sub    $0x4,%esp
+    187d:	50                   	push   %eax
+    187e:	68 5c 5b 00 00       	push   $0x5b5c
+    1883:	6a 01                	push   $0x1
+    1885:	e8 26 3a 00 00       	call   52b0 <printf>
+        exit();
+    188a:	e8 74 38 00 00       	call   5103 <exit>
+    printf(1, "swap test: no swap space\n");
+    188f:	50                   	push   %eax
+    1890:	50                   	push   %eax
+    1891:	68 12 5b 00 00       	push   $0x5b12
+    1896:	6a 01                	push   $0x1
+    1898:	e8 13 3a 00 00       	call   52b0 <printf>
+    exit();
+    189d:	e8 61 38 00 00       	call   5103 <exit>
+    printf(1, "swap test: nothing was swapped out\n");
+    18a2:	51                   	push   %ecx
+    18a3:	51                   	push   %ecx
+    18a4:	68 14 6d 00 00       	push   $0x6d14
+    18a9:	6a 01                	push   $0x1
+    18ab:	e8 00 3a 00 00       	call   52b0 <printf>
+    exit();
+    18b0:	e8 4e 38 00 00       	call   5103 <exit>
+    read(fds[0], &c, 1);
+    18b5:	8d 85 d7 fe ff ff    	lea    -0x129(%ebp),%eax
+    18bb:	57                   	push   %edi
+      if(i % 256 == 0 && memstat(&ms) == 0 &&
+    18bc:	8d b5 e0 fe ff ff    	lea    -0x120(%ebp),%esi
+    read(fds[0], &c, 1);
+    18c2:	6a 01                	push   $0x1
+    18c4:	50                   	push   %eax
+    18c5:	ff b5 d8 fe ff ff    	push   -0x128(%ebp)
+    18cb:	e8 4b 38 00 00       	call   511b <read>
+    18d0:	83 c4 10             	add    $0x10,%esp
+    18d3:	eb 06                	jmp    18db <swaptest+0x21b>
+    18d5:	8d 76 00             	lea    0x0(%esi),%esi
+    for(i = 0; ; i++){
+    18d8:	83 c3 01             	add    $0x1,%ebx
+      if((q = sbrk(4096)) == (char*)0xffffffff)
+    18db:	83 ec 0c             	sub    $0xc,%esp
+    18de:	68 00 10 00 00       	push   $0x1000
+    18e3:	e8 a3 38 00 00       	call   518b <sbrk>
+    18e8:	83 c4 10             	add    $0x10,%esp
+    18eb:	83 f8 ff             	cmp    $0xffffffff,%eax
+    18ee:	74 27                	je     1917 <swaptest+0x257>
+      *q = 1;
+    18f0:	c6 00 01             	movb   $0x1,(%eax)
+      if(i % 256 == 0 && memstat(&ms) == 0 &&
+    18f3:	84 db                	test   %bl,%bl
+    18f5:	75 e1                	jne    18d8 <swaptest+0x218>
+    18f7:	83 ec 0c             	sub    $0xc,%esp
+    18fa:	56                   	push   %esi
+    18fb:	e8 a3 38 00 00       	call   51a3 <memstat>
+    1900:	83 c4 10             	add    $0x10,%esp
+    1903:	85 c0                	test   %eax,%eax
+    1905:	75 d1                	jne    18d8 <swaptest+0x218>
+         ms.swapouts - ms1.swapouts >= 4096)
+    1907:	8b 85 4c ff ff ff    	mov    -0xb4(%ebp),%eax
+    190d:	2b 45 d0             	sub    -0x30(%ebp),%eax
+      if(i % 256 == 0 && memstat(&ms) == 0 &&
+    1910:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+    1915:	76 c1                	jbe    18d8 <swaptest+0x218>
+    exit();
+    1917:	e8 e7 37 00 00       	call   5103 <exit>
+    printf(1, "swap test: fork failed\n");
+    191c:	50                   	push   %eax
+    191d:	50                   	push   %eax
+    191e:	68 44 5b 00 00       	push   $0x5b44
+    1923:	6a 01                	push   $0x1
+    1925:	e8 86 39 00 00       	call   52b0 <printf>
+    exit();
+    192a:	e8 d4 37 00 00       	call   5103 <exit>
+    printf(1, "swap test: pipe failed\n");
+    192f:	50                   	push   %eax
+    1930:	50                   	push   %eax
+    1931:	68 2c 5b 00 00       	push   $0x5b2c
+    1936:	6a 01                	push   $0x1
+    1938:	e8 73 39 00 00       	call   52b0 <printf>
+    exit();
+    193d:	e8 c1 37 00 00       	call   5103 <exit>
+    1942:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1949:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001950 <shmtest>:
+{
+    1950:	55                   	push   %ebp
+    1951:	89 e5                	mov    %esp,%ebp
+    1953:	56                   	push   %esi
+    1954:	53                   	push   %ebx
+  printf(1, "shm test\n");
+    1955:	83 ec 08             	sub    $0x8,%esp
+    1958:	68 88 5b 00 00       	push   $0x5b88
+    195d:	6a 01                	push   $0x1
+    195f:	e8 4c 39 00 00       	call   52b0 <printf>
+  if((id = shmget(4321, 8192)) < 0 || (p = shmat(id)) == (char*)-1){
+    1964:	58                   	pop    %eax
+    1965:	5a                   	pop    %edx
+    1966:	68 00 20 00 00       	push   $0x2000
+    196b:	68 e1 10 00 00       	push   $0x10e1
+    1970:	e8 46 38 00 00       	call   51bb <shmget>
+    1975:	83 c4 10             	add    $0x10,%esp
+    1978:	85 c0                	test   %eax,%eax
+    197a:	0f 88 a3 01 00 00    	js     1b23 <shmtest+0x1d3>
+    1980:	83 ec 0c             	sub    $0xc,%esp
+    1983:	89 c6                	mov    %eax,%esi
+    1985:	50                   	push   %eax
+    1986:	e8 38 38 00 00       	call   51c3 <shmat>
+    198b:	83 c4 10             	add    $0x10,%esp
+    198e:	89 c3                	mov    %eax,%ebx
+    1990:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1993:	0f 84 8a 01 00 00    	je     1b23 <shmtest+0x1d3>
+  p[0] = 'a';
+    1999:	c6 00 61             	movb   $0x61,(%eax)
+  p[8191] = 'b';
+    199c:	c6 80 ff 1f 00 00 62 	movb   $0x62,0x1fff(%eax)
+  pid = fork();
+    19a3:	e8 53 37 00 00       	call   50fb <fork>
+  if(pid < 0){
+    19a8:	85 c0                	test   %eax,%eax
+    19aa:	0f 88 86 01 00 00    	js     1b36 <shmtest+0x1e6>
+  if(pid == 0){
+    19b0:	0f 84 ea 00 00 00    	je     1aa0 <shmtest+0x150>
+  wait();
+    19b6:	e8 50 37 00 00       	call   510b <wait>
+  if(p[1] != 'c' || p[2] != 'd'){
+    19bb:	80 7b 01 63          	cmpb   $0x63,0x1(%ebx)
+    19bf:	0f 85 84 01 00 00    	jne    1b49 <shmtest+0x1f9>
+    19c5:	80 7b 02 64          	cmpb   $0x64,0x2(%ebx)
+    19c9:	0f 85 7a 01 00 00    	jne    1b49 <shmtest+0x1f9>
+  if(shmdt(p) != 0 || shmdt(p) == 0){
+    19cf:	83 ec 0c             	sub    $0xc,%esp
+    19d2:	53                   	push   %ebx
+    19d3:	e8 f3 37 00 00       	call   51cb <shmdt>
+    19d8:	83 c4 10             	add    $0x10,%esp
+    19db:	85 c0                	test   %eax,%eax
+    19dd:	0f 85 79 01 00 00    	jne    1b5c <shmtest+0x20c>
+    19e3:	83 ec 0c             	sub    $0xc,%esp
+    19e6:	53                   	push   %ebx
+    19e7:	e8 df 37 00 00       	call   51cb <shmdt>
+    19ec:	83 c4 10             	add    $0x10,%esp
+    19ef:	85 c0                	test   %eax,%eax
+    19f1:	0f 84 65 01 00 00    	je     1b5c <shmtest+0x20c>
+  if(shmget(4321, 0) >= 0){
+    19f7:	83 ec 08             	sub    $0x8,%esp
+    19fa:	6a 00                	push   $0x0
+    19fc:	68 e1 10 00 00       	push   $0x10e1
+    1a01:	e8 b5 37 00 00       	call   51bb <shmget>
+    1a06:	83 c4 10             	add    $0x10,%esp
+    1a09:	85 c0                	test   %eax,%eax
+    1a0b:	0f 89 5e 01 00 00    	jns    1b6f <shmtest+0x21f>
+    1a11:	be 20 00 00 00       	mov    $0x20,%esi
+    1a16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a1d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((id = shmget(0, 4096)) < 0 || shmrm(id) != 0 || shmrm(id) == 0 ||
+    1a20:	83 ec 08             	sub    $0x8,%esp
+    1a23:	68 00 10 00 00       	push   $0x1000
+    1a28:	6a 00                	push   $0x0
+    1a2a:	e8 8c 37 00 00       	call   51bb <shmget>
+    1a2f:	83 c4 10             	add    $0x10,%esp
+    1a32:	89 c3                	mov    %eax,%ebx
+    1a34:	85 c0                	test   %eax,%eax
+    1a36:	0f 88 d3 00 00 00    	js     1b0f <shmtest+0x1bf>
+    1a3c:	83 ec 0c             	sub    $0xc,%esp
+    1a3f:	50                   	push   %eax
+    1a40:	e8 b6 37 00 00       	call   51fb <shmrm>
+    1a45:	83 c4 10             	add    $0x10,%esp
+    1a48:	85 c0                	test   %eax,%eax
+    1a4a:	0f 85 bf 00 00 00    	jne    1b0f <shmtest+0x1bf>
+    1a50:	83 ec 0c             	sub    $0xc,%esp
+    1a53:	53                   	push   %ebx
+    1a54:	e8 a2 37 00 00       	call   51fb <shmrm>
+    1a59:	83 c4 10             	add    $0x10,%esp
+    1a5c:	85 c0                	test   %eax,%eax
+    1a5e:	0f 84 ab 00 00 00    	je     1b0f <shmtest+0x1bf>
+       shmat(id) != (char*)-1){
+    1a64:	83 ec 0c             	sub    $0xc,%esp
+    1a67:	53                   	push   %ebx
+    1a68:	e8 56 37 00 00       	call   51c3 <shmat>
+    if((id = shmget(0, 4096)) < 0 || shmrm(id) != 0 || shmrm(id) == 0 ||
+    1a6d:	83 c4 10             	add    $0x10,%esp
+    1a70:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1a73:	0f 85 96 00 00 00    	jne    1b0f <shmtest+0x1bf>
+  for(i = 0; i < 2*NSHM; i++){
+    1a79:	83 ee 01             	sub    $0x1,%esi
+    1a7c:	75 a2                	jne    1a20 <shmtest+0xd0>
+  printf(1, "shm test ok\n");
+    1a7e:	83 ec 08             	sub    $0x8,%esp
+    1a81:	68 f2 5b 00 00       	push   $0x5bf2
+    1a86:	6a 01                	push   $0x1
+    1a88:	e8 23 38 00 00       	call   52b0 <printf>
+}
+    1a8d:	83 c4 10             	add    $0x10,%esp
+    1a90:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1a93:	5b                   	pop    %ebx
+    1a94:	5e                   	pop    %esi
+    1a95:	5d                   	pop    %ebp
+    1a96:	c3                   	ret
+    1a97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a9e:	66 90                	xchg   %ax,%ax
+    if(shmget(4321, 0) != id || (q = shmat(id)) == (char*)-1 || q == p){
+    1aa0:	83 ec 08             	sub    $0x8,%esp
+    1aa3:	6a 00                	push   $0x0
+    1aa5:	68 e1 10 00 00       	push   $0x10e1
+    1aaa:	e8 0c 37 00 00       	call   51bb <shmget>
+    1aaf:	83 c4 10             	add    $0x10,%esp
+    1ab2:	39 f0                	cmp    %esi,%eax
+    1ab4:	0f 85 c8 00 00 00    	jne    1b82 <shmtest+0x232>
+    1aba:	83 ec 0c             	sub    $0xc,%esp
+    1abd:	50                   	push   %eax
+    1abe:	e8 00 37 00 00       	call   51c3 <shmat>
+    1ac3:	83 c4 10             	add    $0x10,%esp
+    1ac6:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1ac9:	0f 84 b3 00 00 00    	je     1b82 <shmtest+0x232>
+    1acf:	39 c3                	cmp    %eax,%ebx
+    1ad1:	0f 84 ab 00 00 00    	je     1b82 <shmtest+0x232>
+    if(q[0] != 'a' || q[8191] != 'b'){
+    1ad7:	80 38 61             	cmpb   $0x61,(%eax)
+    1ada:	75 09                	jne    1ae5 <shmtest+0x195>
+    1adc:	80 b8 ff 1f 00 00 62 	cmpb   $0x62,0x1fff(%eax)
+    1ae3:	74 14                	je     1af9 <shmtest+0x1a9>
+      printf(1, "shm test: child sees wrong data\n");
+    1ae5:	83 ec 08             	sub    $0x8,%esp
+    1ae8:	68 58 6d 00 00       	push   $0x6d58
+    1aed:	6a 01                	push   $0x1
+    1aef:	e8 bc 37 00 00       	call   52b0 <printf>
+      exit();
+    1af4:	e8 0a 36 00 00       	call   5103 <exit>
+    shmdt(q);
+    1af9:	83 ec 0c             	sub    $0xc,%esp
+    q[1] = 'c';
+    1afc:	c6 40 01 63          	movb   $0x63,0x1(%eax)
+    shmdt(q);
+    1b00:	50                   	push   %eax
+    1b01:	e8 c5 36 00 00       	call   51cb <shmdt>
+    p[2] = 'd';
+    1b06:	c6 43 02 64          	movb   $0x64,0x2(%ebx)
+    exit();
+    1b0a:	e8 f4 35 00 00       	call   5103 <exit>
+      printf(1, "shm test: shmrm failed\n");
+    1b0f:	83 ec 08             	sub    $0x8,%esp
+    1b12:	68 da 5b 00 00       	push   $0x5bda
+    1b17:	6a 01                	push   $0x1
+    1b19:	e8 92 37 00 00       	call   52b0 <printf>
+      exit();
+    1b1e:	e8 e0 35 00 00       	call   5103 <exit>
+    printf(1, "shm test: cannot attach\n");
+    1b23:	50                   	push   %eax
+    1b24:	50                   	push   %eax
+    1b25:	68 92 5b 00 00       	push   $0x5b92
+    1b2a:	6a 01                	push   $0x1
+    1b2c:	e8 7f 37 00 00       	call   52b0 <printf>
+    exit();
+    1b31:	e8 cd 35 00 00       	call   5103 <exit>
+    printf(1, "shm test: fork failed\n");
+    1b36:	56                   	push   %esi
+    1b37:	56                   	push   %esi
+    1b38:	68 ab 5b 00 00       	push   $0x5bab
+    1b3d:	6a 01                	push   $0x1
+    1b3f:	e8 6c 37 00 00       	call   52b0 <printf>
+    exit();
+    1b44:	e8 ba 35 00 00       	call   5103 <exit>
+    printf(1, "shm test: parent does not see child's writes\n");
+    1b49:	51                   	push   %ecx
+    1b4a:	51                   	push   %ecx
+    1b4b:	68 7c 6d 00 00       	push   $0x6d7c
+    1b50:	6a 01                	push   $0x1
+    1b52:	e8 59 37 00 00       	call   52b0 <printf>
+    exit();
+    1b57:	e8 a7 35 00 00       	call   5103 <exit>
+    printf(1, "shm test: shmdt failed\n");
+    1b5c:	52                   	push   %edx
+    1b5d:	52                   	push   %edx
+    1b5e:	68 c2 5b 00 00       	push   $0x5bc2
+    1b63:	6a 01                	push   $0x1
+    1b65:	e8 46 37 00 00       	call   52b0 <printf>
+    exit();
+    1b6a:	e8 94 35 00 00       	call   5103 <exit>
+    printf(1, "shm test: segment outlived its last detach\n");
+    1b6f:	50                   	push   %eax
+    1b70:	50                   	push   %eax
+    1b71:	68 ac 6d 00 00       	push   $0x6dac
+    1b76:	6a 01                	push   $0x1
+    1b78:	e8 33 37 00 00       	call   52b0 <printf>
+    exit();
+    1b7d:	e8 81 35 00 00       	call   5103 <exit>
+      printf(1, "shm test: child cannot attach\n");
+    1b82:	53                   	push   %ebx
+    1b83:	53                   	push   %ebx
+    1b84:	68 38 6d 00 00       	push   $0x6d38
+    1b89:	6a 01                	push   $0x1
+    1b8b:	e8 20 37 00 00       	call   52b0 <printf>
+      exit();
+    1b90:	e8 6e 35 00 00       	call   5103 <exit>
+    1b95:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001ba0 <spawntest>:
+{
+    1ba0:	55                   	push   %ebp
+    1ba1:	89 e5                	mov    %esp,%ebp
+    1ba3:	57                   	push   %edi
+    1ba4:	56                   	push   %esi
+    1ba5:	53                   	push   %ebx
+    1ba6:	83 ec 64             	sub    $0x64,%esp
+  char *args[] = { "echo", "spawned", 0 };
+    1ba9:	c7 45 b0 d8 55 00 00 	movl   $0x55d8,-0x50(%ebp)
+    1bb0:	c7 45 b4 ff 5b 00 00 	movl   $0x5bff,-0x4c(%ebp)
+    1bb7:	c7 45 b8 00 00 00 00 	movl   $0x0,-0x48(%ebp)
+  printf(1, "spawn test\n");
+    1bbe:	68 07 5c 00 00       	push   $0x5c07
+    1bc3:	6a 01                	push   $0x1
+    1bc5:	e8 e6 36 00 00       	call   52b0 <printf>
+  if(pipe(p) != 0){
+    1bca:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    1bcd:	89 04 24             	mov    %eax,(%esp)
+    1bd0:	e8 3e 35 00 00       	call   5113 <pipe>
+    1bd5:	83 c4 10             	add    $0x10,%esp
+    1bd8:	85 c0                	test   %eax,%eax
+    1bda:	0f 85 31 01 00 00    	jne    1d11 <spawntest+0x171>
+    1be0:	89 c7                	mov    %eax,%edi
+  fds[1] = p[1];
+    1be2:	8b 45 ac             	mov    -0x54(%ebp),%eax
+  pid = spawn("echo", args, fds);
+    1be5:	83 ec 04             	sub    $0x4,%esp
+  fds[0] = -1;
+    1be8:	c7 45 bc ff ff ff ff 	movl   $0xffffffff,-0x44(%ebp)
+  fds[2] = 2;
+    1bef:	c7 45 c4 02 00 00 00 	movl   $0x2,-0x3c(%ebp)
+  fds[1] = p[1];
+    1bf6:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  pid = spawn("echo", args, fds);
+    1bf9:	8d 45 bc             	lea    -0x44(%ebp),%eax
+    1bfc:	50                   	push   %eax
+    1bfd:	8d 45 b0             	lea    -0x50(%ebp),%eax
+    1c00:	50                   	push   %eax
+    1c01:	68 d8 55 00 00       	push   $0x55d8
+    1c06:	e8 c8 35 00 00       	call   51d3 <spawn>
+    1c0b:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  close(p[1]);
+    1c0e:	5b                   	pop    %ebx
+  pid = spawn("echo", args, fds);
+    1c0f:	89 c6                	mov    %eax,%esi
+  close(p[1]);
+    1c11:	ff 75 ac             	push   -0x54(%ebp)
+    1c14:	e8 12 35 00 00       	call   512b <close>
+  if(pid < 0){
+    1c19:	83 c4 10             	add    $0x10,%esp
+    1c1c:	85 f6                	test   %esi,%esi
+    1c1e:	0f 88 da 00 00 00    	js     1cfe <spawntest+0x15e>
+    1c24:	8d 5d c8             	lea    -0x38(%ebp),%ebx
+  while((m = read(p[0], buf + n, sizeof(buf) - 1 - n)) > 0)
+    1c27:	be 1f 00 00 00       	mov    $0x1f,%esi
+    1c2c:	eb 04                	jmp    1c32 <spawntest+0x92>
+    1c2e:	66 90                	xchg   %ax,%ax
+    n += m;
+    1c30:	01 c7                	add    %eax,%edi
+  while((m = read(p[0], buf + n, sizeof(buf) - 1 - n)) > 0)
+    1c32:	89 f0                	mov    %esi,%eax
+    1c34:	83 ec 04             	sub    $0x4,%esp
+    1c37:	29 f8                	sub    %edi,%eax
+    1c39:	50                   	push   %eax
+    1c3a:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+    1c3d:	50                   	push   %eax
+    1c3e:	ff 75 a8             	push   -0x58(%ebp)
+    1c41:	e8 d5 34 00 00       	call   511b <read>
+    1c46:	83 c4 10             	add    $0x10,%esp
+    1c49:	85 c0                	test   %eax,%eax
+    1c4b:	7f e3                	jg     1c30 <spawntest+0x90>
+  close(p[0]);
+    1c4d:	83 ec 0c             	sub    $0xc,%esp
+    1c50:	ff 75 a8             	push   -0x58(%ebp)
+    1c53:	e8 d3 34 00 00       	call   512b <close>
+  buf[n] = 0;
+    1c58:	c6 44 3d c8 00       	movb   $0x0,-0x38(%ebp,%edi,1)
+  if(wait() != pid || strcmp(buf, "spawned\n") != 0){
+    1c5d:	e8 a9 34 00 00       	call   510b <wait>
+    1c62:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+    1c65:	83 c4 10             	add    $0x10,%esp
+    1c68:	39 d0                	cmp    %edx,%eax
+    1c6a:	75 6c                	jne    1cd8 <spawntest+0x138>
+    1c6c:	83 ec 08             	sub    $0x8,%esp
+    1c6f:	68 63 5c 00 00       	push   $0x5c63
+    1c74:	53                   	push   %ebx
+    1c75:	e8 76 32 00 00       	call   4ef0 <strcmp>
+    1c7a:	83 c4 10             	add    $0x10,%esp
+    1c7d:	85 c0                	test   %eax,%eax
+    1c7f:	75 57                	jne    1cd8 <spawntest+0x138>
+  if(spawn("nosuchprogram", args, 0) >= 0 || spawn("echo", args, fds) >= 0){
+    1c81:	83 ec 04             	sub    $0x4,%esp
+    1c84:	8d 45 b0             	lea    -0x50(%ebp),%eax
+  fds[1] = NOFILE;
+    1c87:	c7 45 c0 10 00 00 00 	movl   $0x10,-0x40(%ebp)
+  if(spawn("nosuchprogram", args, 0) >= 0 || spawn("echo", args, fds) >= 0){
+    1c8e:	6a 00                	push   $0x0
+    1c90:	50                   	push   %eax
+    1c91:	68 6c 5c 00 00       	push   $0x5c6c
+    1c96:	e8 38 35 00 00       	call   51d3 <spawn>
+    1c9b:	83 c4 10             	add    $0x10,%esp
+    1c9e:	85 c0                	test   %eax,%eax
+    1ca0:	79 49                	jns    1ceb <spawntest+0x14b>
+    1ca2:	83 ec 04             	sub    $0x4,%esp
+    1ca5:	8d 45 bc             	lea    -0x44(%ebp),%eax
+    1ca8:	50                   	push   %eax
+    1ca9:	8d 45 b0             	lea    -0x50(%ebp),%eax
+    1cac:	50                   	push   %eax
+    1cad:	68 d8 55 00 00       	push   $0x55d8
+    1cb2:	e8 1c 35 00 00       	call   51d3 <spawn>
+    1cb7:	83 c4 10             	add    $0x10,%esp
+    1cba:	85 c0                	test   %eax,%eax
+    1cbc:	79 2d                	jns    1ceb <spawntest+0x14b>
+  printf(1, "spawn test ok\n");
+    1cbe:	83 ec 08             	sub    $0x8,%esp
+    1cc1:	68 7a 5c 00 00       	push   $0x5c7a
+    1cc6:	6a 01                	push   $0x1
+    1cc8:	e8 e3 35 00 00       	call   52b0 <printf>
+}
+    1ccd:	83 c4 10             	add    $0x10,%esp
+    1cd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1cd3:	5b                   	pop    %ebx
+    1cd4:	5e                   	pop    %esi
+    1cd5:	5f                   	pop    %edi
+    1cd6:	5d                   	pop    %ebp
+    1cd7:	c3                   	ret
+    printf(1, "spawn test: wrong output %s\n", buf);
+    1cd8:	52                   	push   %edx
+    1cd9:	53                   	push   %ebx
+    1cda:	68 46 5c 00 00       	push   $0x5c46
+    1cdf:	6a 01                	push   $0x1
+    1ce1:	e8 ca 35 00 00       	call   52b0 <printf>
+    exit();
+    1ce6:	e8 18 34 00 00       	call   5103 <exit>
+    printf(1, "spawn test: bad spawn succeeded\n");
+    1ceb:	50                   	push   %eax
+    1cec:	50                   	push   %eax
+    1ced:	68 d8 6d 00 00       	push   $0x6dd8
+    1cf2:	6a 01                	push   $0x1
+    1cf4:	e8 b7 35 00 00       	call   52b0 <printf>
+    exit();
+    1cf9:	e8 05 34 00 00       	call   5103 <exit>
+    printf(1, "spawn test: spawn failed\n");
+    1cfe:	51                   	push   %ecx
+    1cff:	51                   	push   %ecx
+    1d00:	68 2c 5c 00 00       	push   $0x5c2c
+    1d05:	6a 01                	push   $0x1
+    1d07:	e8 a4 35 00 00       	call   52b0 <printf>
+    exit();
+    1d0c:	e8 f2 33 00 00       	call   5103 <exit>
+    printf(1, "spawn test: pipe failed\n");
+    1d11:	56                   	push   %esi
+    1d12:	56                   	push   %esi
+    1d13:	68 13 5c 00 00       	push   $0x5c13
+    1d18:	6a 01                	push   $0x1
+    1d1a:	e8 91 35 00 00       	call   52b0 <printf>
+    exit();
+    1d1f:	e8 df 33 00 00       	call   5103 <exit>
+    1d24:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1d2f:	90                   	nop
+
+00001d30 <lgpagetest>:
+{
+    1d30:	55                   	push   %ebp
+    1d31:	89 e5                	mov    %esp,%ebp
+    1d33:	53                   	push   %ebx
+    1d34:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "large page test\n");
+    1d37:	68 89 5c 00 00       	push   $0x5c89
+    1d3c:	6a 01                	push   $0x1
+    1d3e:	e8 6d 35 00 00       	call   52b0 <printf>
+  if(mmap(0, LPG, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_LARGE, 0, 0) != MAP_FAILED){
+    1d43:	58                   	pop    %eax
+    1d44:	5a                   	pop    %edx
+    1d45:	6a 00                	push   $0x0
+    1d47:	6a 00                	push   $0x0
+    1d49:	68 02 00 04 00       	push   $0x40002
+    1d4e:	6a 03                	push   $0x3
+    1d50:	68 00 00 40 00       	push   $0x400000
+    1d55:	6a 00                	push   $0x0
+    1d57:	e8 4f 34 00 00       	call   51ab <mmap>
+    1d5c:	83 c4 20             	add    $0x20,%esp
+    1d5f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1d62:	0f 85 5a 01 00 00    	jne    1ec2 <lgpagetest+0x192>
+  p = mmap(0, 2*LPG, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS|MAP_LARGE, -1, 0);
+    1d68:	83 ec 08             	sub    $0x8,%esp
+    1d6b:	6a 00                	push   $0x0
+    1d6d:	6a ff                	push   $0xffffffff
+    1d6f:	68 22 00 04 00       	push   $0x40022
+    1d74:	6a 03                	push   $0x3
+    1d76:	68 00 00 80 00       	push   $0x800000
+    1d7b:	6a 00                	push   $0x0
+    1d7d:	e8 29 34 00 00       	call   51ab <mmap>
+  if(p == MAP_FAILED || (uint)p % LPG != 0){
+    1d82:	83 c4 20             	add    $0x20,%esp
+  p = mmap(0, 2*LPG, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS|MAP_LARGE, -1, 0);
+    1d85:	89 c3                	mov    %eax,%ebx
+  if(p == MAP_FAILED || (uint)p % LPG != 0){
+    1d87:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1d8a:	0f 84 1f 01 00 00    	je     1eaf <lgpagetest+0x17f>
+    1d90:	a9 ff ff 3f 00       	test   $0x3fffff,%eax
+    1d95:	0f 85 14 01 00 00    	jne    1eaf <lgpagetest+0x17f>
+  for(i = 0; i < 2*LPG; i += 4096)
+    1d9b:	31 c0                	xor    %eax,%eax
+    1d9d:	8d 76 00             	lea    0x0(%esi),%esi
+    p[i] = i / 4096;
+    1da0:	89 c2                	mov    %eax,%edx
+    1da2:	c1 fa 0c             	sar    $0xc,%edx
+    1da5:	88 14 03             	mov    %dl,(%ebx,%eax,1)
+  for(i = 0; i < 2*LPG; i += 4096)
+    1da8:	05 00 10 00 00       	add    $0x1000,%eax
+    1dad:	3d 00 00 80 00       	cmp    $0x800000,%eax
+    1db2:	75 ec                	jne    1da0 <lgpagetest+0x70>
+  pid = fork();
+    1db4:	e8 42 33 00 00       	call   50fb <fork>
+  if(pid < 0){
+    1db9:	85 c0                	test   %eax,%eax
+    1dbb:	0f 88 14 01 00 00    	js     1ed5 <lgpagetest+0x1a5>
+  if(pid == 0){
+    1dc1:	75 28                	jne    1deb <lgpagetest+0xbb>
+    1dc3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1dc7:	90                   	nop
+      if(p[i] != (char)(i / 4096)){
+    1dc8:	89 c2                	mov    %eax,%edx
+    1dca:	c1 fa 0c             	sar    $0xc,%edx
+    1dcd:	38 14 03             	cmp    %dl,(%ebx,%eax,1)
+    1dd0:	0f 85 b1 00 00 00    	jne    1e87 <lgpagetest+0x157>
+      p[i] = 0;
+    1dd6:	c6 04 03 00          	movb   $0x0,(%ebx,%eax,1)
+    for(i = 0; i < 2*LPG; i += 4096){
+    1dda:	05 00 10 00 00       	add    $0x1000,%eax
+    1ddf:	3d 00 00 80 00       	cmp    $0x800000,%eax
+    1de4:	75 e2                	jne    1dc8 <lgpagetest+0x98>
+    exit();
+    1de6:	e8 18 33 00 00       	call   5103 <exit>
+  wait();
+    1deb:	e8 1b 33 00 00       	call   510b <wait>
+  for(i = 0; i < 2*LPG; i += 4096){
+    1df0:	31 c0                	xor    %eax,%eax
+    1df2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p[i] != (char)(i / 4096)){
+    1df8:	89 c2                	mov    %eax,%edx
+    1dfa:	c1 fa 0c             	sar    $0xc,%edx
+    1dfd:	38 14 03             	cmp    %dl,(%ebx,%eax,1)
+    1e00:	0f 85 95 00 00 00    	jne    1e9b <lgpagetest+0x16b>
+  for(i = 0; i < 2*LPG; i += 4096){
+    1e06:	05 00 10 00 00       	add    $0x1000,%eax
+    1e0b:	3d 00 00 80 00       	cmp    $0x800000,%eax
+    1e10:	75 e6                	jne    1df8 <lgpagetest+0xc8>
+  if(munmap(p, 4096) == 0 || munmap(p + LPG, LPG) != 0){
+    1e12:	83 ec 08             	sub    $0x8,%esp
+    1e15:	68 00 10 00 00       	push   $0x1000
+    1e1a:	53                   	push   %ebx
+    1e1b:	e8 93 33 00 00       	call   51b3 <munmap>
+    1e20:	83 c4 10             	add    $0x10,%esp
+    1e23:	85 c0                	test   %eax,%eax
+    1e25:	0f 84 bd 00 00 00    	je     1ee8 <lgpagetest+0x1b8>
+    1e2b:	83 ec 08             	sub    $0x8,%esp
+    1e2e:	8d 83 00 00 40 00    	lea    0x400000(%ebx),%eax
+    1e34:	68 00 00 40 00       	push   $0x400000
+    1e39:	50                   	push   %eax
+    1e3a:	e8 74 33 00 00       	call   51b3 <munmap>
+    1e3f:	83 c4 10             	add    $0x10,%esp
+    1e42:	85 c0                	test   %eax,%eax
+    1e44:	0f 85 9e 00 00 00    	jne    1ee8 <lgpagetest+0x1b8>
+  if(p[LPG - 4096] != (char)(LPG/4096 - 1) || munmap(p, LPG) != 0){
+    1e4a:	80 bb 00 f0 3f 00 ff 	cmpb   $0xff,0x3ff000(%ebx)
+    1e51:	0f 85 a4 00 00 00    	jne    1efb <lgpagetest+0x1cb>
+    1e57:	83 ec 08             	sub    $0x8,%esp
+    1e5a:	68 00 00 40 00       	push   $0x400000
+    1e5f:	53                   	push   %ebx
+    1e60:	e8 4e 33 00 00       	call   51b3 <munmap>
+    1e65:	83 c4 10             	add    $0x10,%esp
+    1e68:	85 c0                	test   %eax,%eax
+    1e6a:	0f 85 8b 00 00 00    	jne    1efb <lgpagetest+0x1cb>
+  printf(1, "large page test ok\n");
+    1e70:	83 ec 08             	sub    $0x8,%esp
+    1e73:	68 d6 5c 00 00       	push   $0x5cd6
+    1e78:	6a 01                	push   $0x1
+    1e7a:	e8 31 34 00 00       	call   52b0 <printf>
+}
+    1e7f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1e82:	83 c4 10             	add    $0x10,%esp
+    1e85:	c9                   	leave
+    1e86:	c3                   	ret
+        printf(1, "large page test: child sees wrong data\n");
+    1e87:	83 ec 08             	sub    $0x8,%esp
+    1e8a:	68 28 6e 00 00       	push   $0x6e28
+    1e8f:	6a 01                	push   $0x1
+    1e91:	e8 1a 34 00 00       	call   52b0 <printf>
+        exit();
+    1e96:	e8 68 32 00 00       	call   5103 <exit>
+      printf(1, "large page test: child's writes leaked\n");
+    1e9b:	83 ec 08             	sub    $0x8,%esp
+    1e9e:	68 50 6e 00 00       	push   $0x6e50
+    1ea3:	6a 01                	push   $0x1
+    1ea5:	e8 06 34 00 00       	call   52b0 <printf>
+      exit();
+    1eaa:	e8 54 32 00 00       	call   5103 <exit>
+    printf(1, "large page test: mmap failed\n");
+    1eaf:	53                   	push   %ebx
+    1eb0:	53                   	push   %ebx
+    1eb1:	68 9a 5c 00 00       	push   $0x5c9a
+    1eb6:	6a 01                	push   $0x1
+    1eb8:	e8 f3 33 00 00       	call   52b0 <printf>
+    exit();
+    1ebd:	e8 41 32 00 00       	call   5103 <exit>
+    printf(1, "large page test: file mapping succeeded\n");
+    1ec2:	50                   	push   %eax
+    1ec3:	50                   	push   %eax
+    1ec4:	68 fc 6d 00 00       	push   $0x6dfc
+    1ec9:	6a 01                	push   $0x1
+    1ecb:	e8 e0 33 00 00       	call   52b0 <printf>
+    exit();
+    1ed0:	e8 2e 32 00 00       	call   5103 <exit>
+    printf(1, "large page test: fork failed\n");
+    1ed5:	51                   	push   %ecx
+    1ed6:	51                   	push   %ecx
+    1ed7:	68 b8 5c 00 00       	push   $0x5cb8
+    1edc:	6a 01                	push   $0x1
+    1ede:	e8 cd 33 00 00       	call   52b0 <printf>
+    exit();
+    1ee3:	e8 1b 32 00 00       	call   5103 <exit>
+    printf(1, "large page test: munmap wrong\n");
+    1ee8:	52                   	push   %edx
+    1ee9:	52                   	push   %edx
+    1eea:	68 78 6e 00 00       	push   $0x6e78
+    1eef:	6a 01                	push   $0x1
+    1ef1:	e8 ba 33 00 00       	call   52b0 <printf>
+    exit();
+    1ef6:	e8 08 32 00 00       	call   5103 <exit>
+    printf(1, "large page test: munmap failed\n");
+    1efb:	50                   	push   %eax
+    1efc:	50                   	push   %eax
+    1efd:	68 98 6e 00 00       	push   $0x6e98
+    1f02:	6a 01                	push   $0x1
+    1f04:	e8 a7 33 00 00       	call   52b0 <printf>
+    exit();
+    1f09:	e8 f5 31 00 00       	call   5103 <exit>
+    1f0e:	66 90                	xchg   %ax,%ax
+
+00001f10 <stackdepth>:
+{
+    1f10:	55                   	push   %ebp
+    1f11:	89 e5                	mov    %esp,%ebp
+    1f13:	81 ec a8 0f 00 00    	sub    $0xfa8,%esp
+    1f19:	8b 45 08             	mov    0x8(%ebp),%eax
+  buf[0] = n;
+    1f1c:	88 85 58 f0 ff ff    	mov    %al,-0xfa8(%ebp)
+  if(n == 0)
+    1f22:	85 c0                	test   %eax,%eax
+    1f24:	75 0a                	jne    1f30 <stackdepth+0x20>
+}
+    1f26:	c9                   	leave
+    1f27:	c3                   	ret
+    1f28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f2f:	90                   	nop
+  return stackdepth(n - 1) + buf[0];
+    1f30:	8d 50 ff             	lea    -0x1(%eax),%edx
+  buf[0] = n;
+    1f33:	88 95 40 f4 ff ff    	mov    %dl,-0xbc0(%ebp)
+  if(n == 0)
+    1f39:	85 d2                	test   %edx,%edx
+    1f3b:	74 16                	je     1f53 <stackdepth+0x43>
+  return stackdepth(n - 1) + buf[0];
+    1f3d:	8d 48 fe             	lea    -0x2(%eax),%ecx
+  buf[0] = n;
+    1f40:	88 8d 28 f8 ff ff    	mov    %cl,-0x7d8(%ebp)
+  if(n == 0)
+    1f46:	85 c9                	test   %ecx,%ecx
+    1f48:	75 16                	jne    1f60 <stackdepth+0x50>
+  return stackdepth(n - 1) + buf[0];
+    1f4a:	0f be 95 40 f4 ff ff 	movsbl -0xbc0(%ebp),%edx
+    1f51:	01 ca                	add    %ecx,%edx
+    1f53:	0f be 85 58 f0 ff ff 	movsbl -0xfa8(%ebp),%eax
+}
+    1f5a:	c9                   	leave
+  return stackdepth(n - 1) + buf[0];
+    1f5b:	01 d0                	add    %edx,%eax
+}
+    1f5d:	c3                   	ret
+    1f5e:	66 90                	xchg   %ax,%ax
+  return stackdepth(n - 1) + buf[0];
+    1f60:	8d 50 fd             	lea    -0x3(%eax),%edx
+  buf[0] = n;
+    1f63:	88 95 10 fc ff ff    	mov    %dl,-0x3f0(%ebp)
+  if(n == 0)
+    1f69:	85 d2                	test   %edx,%edx
+    1f6b:	74 18                	je     1f85 <stackdepth+0x75>
+  return stackdepth(n - 1) + buf[0];
+    1f6d:	83 ec 0c             	sub    $0xc,%esp
+    1f70:	83 e8 04             	sub    $0x4,%eax
+    1f73:	50                   	push   %eax
+    1f74:	e8 97 ff ff ff       	call   1f10 <stackdepth>
+    1f79:	0f be 95 10 fc ff ff 	movsbl -0x3f0(%ebp),%edx
+    1f80:	83 c4 10             	add    $0x10,%esp
+    1f83:	01 c2                	add    %eax,%edx
+    1f85:	0f be 8d 28 f8 ff ff 	movsbl -0x7d8(%ebp),%ecx
+    1f8c:	01 d1                	add    %edx,%ecx
+    1f8e:	eb ba                	jmp    1f4a <stackdepth+0x3a>
+
+00001f90 <stacktest>:
+{
+    1f90:	55                   	push   %ebp
+    1f91:	89 e5                	mov    %esp,%ebp
+    1f93:	53                   	push   %ebx
+    1f94:	83 ec 1c             	sub    $0x1c,%esp
+  printf(1, "stack test\n");
+    1f97:	68 ea 5c 00 00       	push   $0x5cea
+    1f9c:	6a 01                	push   $0x1
+    1f9e:	e8 0d 33 00 00       	call   52b0 <printf>
+  if(pipe(fd) != 0){
+    1fa3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    1fa6:	89 04 24             	mov    %eax,(%esp)
+    1fa9:	e8 65 31 00 00       	call   5113 <pipe>
+    1fae:	83 c4 10             	add    $0x10,%esp
+    1fb1:	85 c0                	test   %eax,%eax
+    1fb3:	0f 85 e5 00 00 00    	jne    209e <stacktest+0x10e>
+  pid = fork();
+    1fb9:	e8 3d 31 00 00       	call   50fb <fork>
+  if(pid == 0){
+    1fbe:	85 c0                	test   %eax,%eax
+    1fc0:	0f 84 eb 00 00 00    	je     20b1 <stacktest+0x121>
+  if(pid < 0){
+    1fc6:	78 79                	js     2041 <stacktest+0xb1>
+  wait();
+    1fc8:	e8 3e 31 00 00       	call   510b <wait>
+  pid = fork();
+    1fcd:	e8 29 31 00 00       	call   50fb <fork>
+  if(pid == 0){
+    1fd2:	85 c0                	test   %eax,%eax
+    1fd4:	0f 84 8d 00 00 00    	je     2067 <stacktest+0xd7>
+  if(pid < 0){
+    1fda:	78 65                	js     2041 <stacktest+0xb1>
+  wait();
+    1fdc:	e8 2a 31 00 00       	call   510b <wait>
+  close(fd[1]);
+    1fe1:	83 ec 0c             	sub    $0xc,%esp
+    1fe4:	ff 75 f4             	push   -0xc(%ebp)
+  if(read(fd[0], &c, 1) != 1 || c != 'x'){
+    1fe7:	8d 5d ef             	lea    -0x11(%ebp),%ebx
+  close(fd[1]);
+    1fea:	e8 3c 31 00 00       	call   512b <close>
+  if(read(fd[0], &c, 1) != 1 || c != 'x'){
+    1fef:	83 c4 0c             	add    $0xc,%esp
+    1ff2:	6a 01                	push   $0x1
+    1ff4:	53                   	push   %ebx
+    1ff5:	ff 75 f0             	push   -0x10(%ebp)
+    1ff8:	e8 1e 31 00 00       	call   511b <read>
+    1ffd:	83 c4 10             	add    $0x10,%esp
+    2000:	83 f8 01             	cmp    $0x1,%eax
+    2003:	75 4f                	jne    2054 <stacktest+0xc4>
+    2005:	80 7d ef 78          	cmpb   $0x78,-0x11(%ebp)
+    2009:	75 49                	jne    2054 <stacktest+0xc4>
+  if(read(fd[0], &c, 1) != 0){
+    200b:	83 ec 04             	sub    $0x4,%esp
+    200e:	6a 01                	push   $0x1
+    2010:	53                   	push   %ebx
+    2011:	ff 75 f0             	push   -0x10(%ebp)
+    2014:	e8 02 31 00 00       	call   511b <read>
+    2019:	83 c4 10             	add    $0x10,%esp
+    201c:	85 c0                	test   %eax,%eax
+    201e:	75 6b                	jne    208b <stacktest+0xfb>
+  close(fd[0]);
+    2020:	83 ec 0c             	sub    $0xc,%esp
+    2023:	ff 75 f0             	push   -0x10(%ebp)
+    2026:	e8 00 31 00 00       	call   512b <close>
+  printf(1, "stack test ok\n");
+    202b:	58                   	pop    %eax
+    202c:	5a                   	pop    %edx
+    202d:	68 28 5d 00 00       	push   $0x5d28
+    2032:	6a 01                	push   $0x1
+    2034:	e8 77 32 00 00       	call   52b0 <printf>
+}
+    2039:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    203c:	83 c4 10             	add    $0x10,%esp
+    203f:	c9                   	leave
+    2040:	c3                   	ret
+    printf(1, "stack test: fork failed\n");
+    2041:	50                   	push   %eax
+    2042:	50                   	push   %eax
+    2043:	68 0f 5d 00 00       	push   $0x5d0f
+    2048:	6a 01                	push   $0x1
+    204a:	e8 61 32 00 00       	call   52b0 <printf>
+    exit();
+    204f:	e8 af 30 00 00       	call   5103 <exit>
+    printf(1, "stack test: deep recursion failed\n");
+    2054:	53                   	push   %ebx
+    2055:	53                   	push   %ebx
+    2056:	68 b8 6e 00 00       	push   $0x6eb8
+    205b:	6a 01                	push   $0x1
+    205d:	e8 4e 32 00 00       	call   52b0 <printf>
+    exit();
+    2062:	e8 9c 30 00 00       	call   5103 <exit>
+    stackdepth(USTACKSIZE/1000 + 16);
+    2067:	83 ec 0c             	sub    $0xc,%esp
+    206a:	68 28 04 00 00       	push   $0x428
+    206f:	e8 9c fe ff ff       	call   1f10 <stackdepth>
+    write(fd[1], "y", 1);
+    2074:	83 c4 0c             	add    $0xc,%esp
+    2077:	6a 01                	push   $0x1
+    2079:	68 ea 5e 00 00       	push   $0x5eea
+    207e:	ff 75 f4             	push   -0xc(%ebp)
+    2081:	e8 9d 30 00 00       	call   5123 <write>
+    exit();
+    2086:	e8 78 30 00 00       	call   5103 <exit>
+    printf(1, "stack test: stack overflow not caught\n");
+    208b:	51                   	push   %ecx
+    208c:	51                   	push   %ecx
+    208d:	68 dc 6e 00 00       	push   $0x6edc
+    2092:	6a 01                	push   $0x1
+    2094:	e8 17 32 00 00       	call   52b0 <printf>
+    exit();
+    2099:	e8 65 30 00 00       	call   5103 <exit>
+    printf(1, "stack test: pipe failed\n");
+    209e:	50                   	push   %eax
+    209f:	50                   	push   %eax
+    20a0:	68 f6 5c 00 00       	push   $0x5cf6
+    20a5:	6a 01                	push   $0x1
+    20a7:	e8 04 32 00 00       	call   52b0 <printf>
+    exit();
+    20ac:	e8 52 30 00 00       	call   5103 <exit>
+    stackdepth(USTACKSIZE/1024/2);
+    20b1:	83 ec 0c             	sub    $0xc,%esp
+    20b4:	68 00 02 00 00       	push   $0x200
+    20b9:	e8 52 fe ff ff       	call   1f10 <stackdepth>
+    write(fd[1], "x", 1);
+    20be:	83 c4 0c             	add    $0xc,%esp
+    20c1:	6a 01                	push   $0x1
+    20c3:	68 f7 62 00 00       	push   $0x62f7
+    20c8:	ff 75 f4             	push   -0xc(%ebp)
+    20cb:	e8 53 30 00 00       	call   5123 <write>
+    exit();
+    20d0:	e8 2e 30 00 00       	call   5103 <exit>
+    20d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    20dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000020e0 <priotest>:
+{
+    20e0:	55                   	push   %ebp
+    20e1:	89 e5                	mov    %esp,%ebp
+    20e3:	57                   	push   %edi
+    20e4:	56                   	push   %esi
+    20e5:	53                   	push   %ebx
+    20e6:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "priority test\n");
+    20e9:	68 37 5d 00 00       	push   $0x5d37
+    20ee:	6a 01                	push   $0x1
+    20f0:	e8 bb 31 00 00       	call   52b0 <printf>
+  if(setpriority(0, -1) == 0 || setpriority(0, NPRIO) == 0 ||
+    20f5:	58                   	pop    %eax
+    20f6:	5a                   	pop    %edx
+    20f7:	6a ff                	push   $0xffffffff
+    20f9:	6a 00                	push   $0x0
+    20fb:	e8 db 30 00 00       	call   51db <setpriority>
+    2100:	83 c4 10             	add    $0x10,%esp
+    2103:	85 c0                	test   %eax,%eax
+    2105:	0f 84 34 01 00 00    	je     223f <priotest+0x15f>
+    210b:	83 ec 08             	sub    $0x8,%esp
+    210e:	6a 04                	push   $0x4
+    2110:	6a 00                	push   $0x0
+    2112:	e8 c4 30 00 00       	call   51db <setpriority>
+    2117:	83 c4 10             	add    $0x10,%esp
+    211a:	85 c0                	test   %eax,%eax
+    211c:	0f 84 1d 01 00 00    	je     223f <priotest+0x15f>
+     setpriority(1 << 30, 0) == 0){
+    2122:	83 ec 08             	sub    $0x8,%esp
+    2125:	6a 00                	push   $0x0
+    2127:	68 00 00 00 40       	push   $0x40000000
+    212c:	e8 aa 30 00 00       	call   51db <setpriority>
+  if(setpriority(0, -1) == 0 || setpriority(0, NPRIO) == 0 ||
+    2131:	83 c4 10             	add    $0x10,%esp
+    2134:	85 c0                	test   %eax,%eax
+    2136:	0f 84 03 01 00 00    	je     223f <priotest+0x15f>
+  if(setpriority(0, NPRIO-1) != 0){
+    213c:	83 ec 08             	sub    $0x8,%esp
+    213f:	6a 03                	push   $0x3
+    2141:	6a 00                	push   $0x0
+    2143:	e8 93 30 00 00       	call   51db <setpriority>
+    2148:	83 c4 10             	add    $0x10,%esp
+    214b:	89 c6                	mov    %eax,%esi
+    214d:	85 c0                	test   %eax,%eax
+    214f:	0f 85 20 01 00 00    	jne    2275 <priotest+0x195>
+  pid = fork();
+    2155:	e8 a1 2f 00 00       	call   50fb <fork>
+    215a:	89 c3                	mov    %eax,%ebx
+  if(pid == 0){
+    215c:	85 c0                	test   %eax,%eax
+    215e:	0f 84 02 01 00 00    	je     2266 <priotest+0x186>
+  if(pid < 0){
+    2164:	0f 88 e9 00 00 00    	js     2253 <priotest+0x173>
+  me = getpid();
+    216a:	e8 14 30 00 00       	call   5183 <getpid>
+  n = procinfo(pi, NPROC);
+    216f:	83 ec 08             	sub    $0x8,%esp
+    2172:	6a 40                	push   $0x40
+  me = getpid();
+    2174:	89 c7                	mov    %eax,%edi
+  n = procinfo(pi, NPROC);
+    2176:	68 c0 e4 00 00       	push   $0xe4c0
+    217b:	e8 63 30 00 00       	call   51e3 <procinfo>
+  for(i = 0; i < n; i++){
+    2180:	83 c4 10             	add    $0x10,%esp
+    2183:	85 c0                	test   %eax,%eax
+    2185:	0f 8e 85 00 00 00    	jle    2210 <priotest+0x130>
+    218b:	6b c0 34             	imul   $0x34,%eax,%eax
+    218e:	ba c0 e4 00 00       	mov    $0xe4c0,%edx
+    2193:	8d 0c 10             	lea    (%eax,%edx,1),%ecx
+    2196:	eb 13                	jmp    21ab <priotest+0xcb>
+    2198:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    219f:	90                   	nop
+    if((pi[i].pid == me || pi[i].pid == pid) && pi[i].nice == NPRIO-1)
+    21a0:	39 c7                	cmp    %eax,%edi
+    21a2:	74 0d                	je     21b1 <priotest+0xd1>
+  for(i = 0; i < n; i++){
+    21a4:	83 c2 34             	add    $0x34,%edx
+    21a7:	39 ca                	cmp    %ecx,%edx
+    21a9:	74 25                	je     21d0 <priotest+0xf0>
+    if((pi[i].pid == me || pi[i].pid == pid) && pi[i].nice == NPRIO-1)
+    21ab:	8b 02                	mov    (%edx),%eax
+    21ad:	39 c3                	cmp    %eax,%ebx
+    21af:	75 ef                	jne    21a0 <priotest+0xc0>
+    21b1:	83 7a 14 03          	cmpl   $0x3,0x14(%edx)
+    21b5:	75 03                	jne    21ba <priotest+0xda>
+      seen++;
+    21b7:	83 c6 01             	add    $0x1,%esi
+    if(pi[i].pid == pid && pi[i].ppid != me)
+    21ba:	39 c3                	cmp    %eax,%ebx
+    21bc:	75 e6                	jne    21a4 <priotest+0xc4>
+      seen = -10;
+    21be:	3b 7a 04             	cmp    0x4(%edx),%edi
+    21c1:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+    21c6:	0f 45 f0             	cmovne %eax,%esi
+  for(i = 0; i < n; i++){
+    21c9:	83 c2 34             	add    $0x34,%edx
+    21cc:	39 ca                	cmp    %ecx,%edx
+    21ce:	75 db                	jne    21ab <priotest+0xcb>
+  kill(pid);
+    21d0:	83 ec 0c             	sub    $0xc,%esp
+    21d3:	53                   	push   %ebx
+    21d4:	e8 5a 2f 00 00       	call   5133 <kill>
+  wait();
+    21d9:	e8 2d 2f 00 00       	call   510b <wait>
+  setpriority(0, 0);
+    21de:	5a                   	pop    %edx
+    21df:	59                   	pop    %ecx
+    21e0:	6a 00                	push   $0x0
+    21e2:	6a 00                	push   $0x0
+    21e4:	e8 f2 2f 00 00       	call   51db <setpriority>
+  if(seen != 2){
+    21e9:	83 c4 10             	add    $0x10,%esp
+    21ec:	83 fe 02             	cmp    $0x2,%esi
+    21ef:	75 3b                	jne    222c <priotest+0x14c>
+  printf(1, "priority test ok\n");
+    21f1:	83 ec 08             	sub    $0x8,%esp
+    21f4:	68 62 5d 00 00       	push   $0x5d62
+    21f9:	6a 01                	push   $0x1
+    21fb:	e8 b0 30 00 00       	call   52b0 <printf>
+}
+    2200:	83 c4 10             	add    $0x10,%esp
+    2203:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2206:	5b                   	pop    %ebx
+    2207:	5e                   	pop    %esi
+    2208:	5f                   	pop    %edi
+    2209:	5d                   	pop    %ebp
+    220a:	c3                   	ret
+    220b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    220f:	90                   	nop
+  kill(pid);
+    2210:	83 ec 0c             	sub    $0xc,%esp
+    2213:	53                   	push   %ebx
+    2214:	e8 1a 2f 00 00       	call   5133 <kill>
+  wait();
+    2219:	e8 ed 2e 00 00       	call   510b <wait>
+  setpriority(0, 0);
+    221e:	5b                   	pop    %ebx
+    221f:	5e                   	pop    %esi
+    2220:	6a 00                	push   $0x0
+    2222:	6a 00                	push   $0x0
+    2224:	e8 b2 2f 00 00       	call   51db <setpriority>
+    2229:	83 c4 10             	add    $0x10,%esp
+    printf(1, "priority test: procinfo wrong\n");
+    222c:	50                   	push   %eax
+    222d:	50                   	push   %eax
+    222e:	68 54 6f 00 00       	push   $0x6f54
+    2233:	6a 01                	push   $0x1
+    2235:	e8 76 30 00 00       	call   52b0 <printf>
+    exit();
+    223a:	e8 c4 2e 00 00       	call   5103 <exit>
+    printf(1, "priority test: bad setpriority succeeded\n");
+    223f:	83 ec 08             	sub    $0x8,%esp
+    2242:	68 04 6f 00 00       	push   $0x6f04
+    2247:	6a 01                	push   $0x1
+    2249:	e8 62 30 00 00       	call   52b0 <printf>
+    exit();
+    224e:	e8 b0 2e 00 00       	call   5103 <exit>
+    printf(1, "priority test: fork failed\n");
+    2253:	57                   	push   %edi
+    2254:	57                   	push   %edi
+    2255:	68 46 5d 00 00       	push   $0x5d46
+    225a:	6a 01                	push   $0x1
+    225c:	e8 4f 30 00 00       	call   52b0 <printf>
+    exit();
+    2261:	e8 9d 2e 00 00       	call   5103 <exit>
+    sleep(100);
+    2266:	83 ec 0c             	sub    $0xc,%esp
+    2269:	6a 64                	push   $0x64
+    226b:	e8 23 2f 00 00       	call   5193 <sleep>
+    exit();
+    2270:	e8 8e 2e 00 00       	call   5103 <exit>
+    printf(1, "priority test: setpriority failed\n");
+    2275:	50                   	push   %eax
+    2276:	50                   	push   %eax
+    2277:	68 30 6f 00 00       	push   $0x6f30
+    227c:	6a 01                	push   $0x1
+    227e:	e8 2d 30 00 00       	call   52b0 <printf>
+    exit();
+    2283:	e8 7b 2e 00 00       	call   5103 <exit>
+    2288:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    228f:	90                   	nop
+
+00002290 <lastcpu>:
+{
+    2290:	55                   	push   %ebp
+    2291:	89 e5                	mov    %esp,%ebp
+    2293:	53                   	push   %ebx
+    2294:	83 ec 04             	sub    $0x4,%esp
+  me = getpid();
+    2297:	e8 e7 2e 00 00       	call   5183 <getpid>
+  n = procinfo(pi, NPROC);
+    229c:	83 ec 08             	sub    $0x8,%esp
+    229f:	6a 40                	push   $0x40
+  me = getpid();
+    22a1:	89 c3                	mov    %eax,%ebx
+  n = procinfo(pi, NPROC);
+    22a3:	68 c0 d7 00 00       	push   $0xd7c0
+    22a8:	e8 36 2f 00 00       	call   51e3 <procinfo>
+  for(i = 0; i < n; i++)
+    22ad:	83 c4 10             	add    $0x10,%esp
+    22b0:	85 c0                	test   %eax,%eax
+    22b2:	7e 2c                	jle    22e0 <lastcpu+0x50>
+    22b4:	31 d2                	xor    %edx,%edx
+    22b6:	eb 0f                	jmp    22c7 <lastcpu+0x37>
+    22b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    22bf:	90                   	nop
+    22c0:	83 c2 01             	add    $0x1,%edx
+    22c3:	39 d0                	cmp    %edx,%eax
+    22c5:	74 19                	je     22e0 <lastcpu+0x50>
+    if(pi[i].pid == me)
+    22c7:	6b ca 34             	imul   $0x34,%edx,%ecx
+    22ca:	39 99 c0 d7 00 00    	cmp    %ebx,0xd7c0(%ecx)
+    22d0:	75 ee                	jne    22c0 <lastcpu+0x30>
+      return pi[i].cpu;
+    22d2:	8b 81 d8 d7 00 00    	mov    0xd7d8(%ecx),%eax
+}
+    22d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    22db:	c9                   	leave
+    22dc:	c3                   	ret
+    22dd:	8d 76 00             	lea    0x0(%esi),%esi
+    22e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return -1;
+    22e3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    22e8:	c9                   	leave
+    22e9:	c3                   	ret
+    22ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000022f0 <affinitytest>:
+{
+    22f0:	55                   	push   %ebp
+    22f1:	89 e5                	mov    %esp,%ebp
+    22f3:	57                   	push   %edi
+    22f4:	56                   	push   %esi
+    22f5:	53                   	push   %ebx
+    22f6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "affinity test\n");
+    22f9:	68 74 5d 00 00       	push   $0x5d74
+    22fe:	6a 01                	push   $0x1
+    2300:	e8 ab 2f 00 00       	call   52b0 <printf>
+  all = getaffinity(0);
+    2305:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    230c:	e8 e2 2e 00 00       	call   51f3 <getaffinity>
+  if(all == 0 || (int)all < 0 || setaffinity(0, 0) == 0 ||
+    2311:	83 c4 10             	add    $0x10,%esp
+  all = getaffinity(0);
+    2314:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(all == 0 || (int)all < 0 || setaffinity(0, 0) == 0 ||
+    2317:	85 c0                	test   %eax,%eax
+    2319:	0f 8e ad 01 00 00    	jle    24cc <affinitytest+0x1dc>
+    231f:	83 ec 08             	sub    $0x8,%esp
+    2322:	6a 00                	push   $0x0
+    2324:	6a 00                	push   $0x0
+    2326:	e8 c0 2e 00 00       	call   51eb <setaffinity>
+    232b:	83 c4 10             	add    $0x10,%esp
+    232e:	85 c0                	test   %eax,%eax
+    2330:	0f 84 96 01 00 00    	je     24cc <affinitytest+0x1dc>
+     getaffinity(1 << 30) != -1){
+    2336:	83 ec 0c             	sub    $0xc,%esp
+    2339:	68 00 00 00 40       	push   $0x40000000
+    233e:	e8 b0 2e 00 00       	call   51f3 <getaffinity>
+  if(all == 0 || (int)all < 0 || setaffinity(0, 0) == 0 ||
+    2343:	83 c4 10             	add    $0x10,%esp
+    2346:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2349:	0f 85 7d 01 00 00    	jne    24cc <affinitytest+0x1dc>
+  one = all & -all;
+    234f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  for(cpu = 0; (one & (1 << cpu)) == 0; cpu++)
+    2352:	31 f6                	xor    %esi,%esi
+  one = all & -all;
+    2354:	89 c7                	mov    %eax,%edi
+    2356:	f7 df                	neg    %edi
+    2358:	21 c7                	and    %eax,%edi
+  for(cpu = 0; (one & (1 << cpu)) == 0; cpu++)
+    235a:	f7 c7 01 00 00 00    	test   $0x1,%edi
+    2360:	75 1b                	jne    237d <affinitytest+0x8d>
+    2362:	ba 01 00 00 00       	mov    $0x1,%edx
+    2367:	89 f1                	mov    %esi,%ecx
+    2369:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2370:	83 c1 01             	add    $0x1,%ecx
+    2373:	89 d0                	mov    %edx,%eax
+    2375:	d3 e0                	shl    %cl,%eax
+    2377:	85 f8                	test   %edi,%eax
+    2379:	74 f5                	je     2370 <affinitytest+0x80>
+    237b:	89 ce                	mov    %ecx,%esi
+  if(setaffinity(0, one) != 0 || getaffinity(0) != one || lastcpu() != cpu){
+    237d:	83 ec 08             	sub    $0x8,%esp
+    2380:	57                   	push   %edi
+    2381:	6a 00                	push   $0x0
+    2383:	e8 63 2e 00 00       	call   51eb <setaffinity>
+    2388:	83 c4 10             	add    $0x10,%esp
+    238b:	89 c3                	mov    %eax,%ebx
+    238d:	85 c0                	test   %eax,%eax
+    238f:	0f 85 23 01 00 00    	jne    24b8 <affinitytest+0x1c8>
+    2395:	83 ec 0c             	sub    $0xc,%esp
+    2398:	6a 00                	push   $0x0
+    239a:	e8 54 2e 00 00       	call   51f3 <getaffinity>
+    239f:	83 c4 10             	add    $0x10,%esp
+    23a2:	39 f8                	cmp    %edi,%eax
+    23a4:	0f 85 0e 01 00 00    	jne    24b8 <affinitytest+0x1c8>
+  me = getpid();
+    23aa:	e8 d4 2d 00 00       	call   5183 <getpid>
+  n = procinfo(pi, NPROC);
+    23af:	83 ec 08             	sub    $0x8,%esp
+  me = getpid();
+    23b2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  n = procinfo(pi, NPROC);
+    23b5:	6a 40                	push   $0x40
+    23b7:	68 c0 d7 00 00       	push   $0xd7c0
+    23bc:	e8 22 2e 00 00       	call   51e3 <procinfo>
+  for(i = 0; i < n; i++)
+    23c1:	83 c4 10             	add    $0x10,%esp
+  n = procinfo(pi, NPROC);
+    23c4:	89 c1                	mov    %eax,%ecx
+  for(i = 0; i < n; i++)
+    23c6:	85 c0                	test   %eax,%eax
+    23c8:	0f 8e ea 00 00 00    	jle    24b8 <affinitytest+0x1c8>
+    23ce:	8b 55 e0             	mov    -0x20(%ebp),%edx
+    23d1:	eb 10                	jmp    23e3 <affinitytest+0xf3>
+    23d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    23d7:	90                   	nop
+    23d8:	83 c3 01             	add    $0x1,%ebx
+    23db:	39 d9                	cmp    %ebx,%ecx
+    23dd:	0f 84 d5 00 00 00    	je     24b8 <affinitytest+0x1c8>
+    if(pi[i].pid == me)
+    23e3:	6b c3 34             	imul   $0x34,%ebx,%eax
+    23e6:	3b 90 c0 d7 00 00    	cmp    0xd7c0(%eax),%edx
+    23ec:	75 ea                	jne    23d8 <affinitytest+0xe8>
+  if(setaffinity(0, one) != 0 || getaffinity(0) != one || lastcpu() != cpu){
+    23ee:	39 b0 d8 d7 00 00    	cmp    %esi,0xd7d8(%eax)
+    23f4:	0f 85 be 00 00 00    	jne    24b8 <affinitytest+0x1c8>
+  pid = fork();
+    23fa:	e8 fc 2c 00 00       	call   50fb <fork>
+    23ff:	89 c3                	mov    %eax,%ebx
+  if(pid == 0){
+    2401:	85 c0                	test   %eax,%eax
+    2403:	74 3b                	je     2440 <affinitytest+0x150>
+  if(pid < 0){
+    2405:	0f 88 d5 00 00 00    	js     24e0 <affinitytest+0x1f0>
+  wait();
+    240b:	e8 fb 2c 00 00       	call   510b <wait>
+  setaffinity(0, all);
+    2410:	83 ec 08             	sub    $0x8,%esp
+    2413:	ff 75 e4             	push   -0x1c(%ebp)
+    2416:	6a 00                	push   $0x0
+    2418:	e8 ce 2d 00 00       	call   51eb <setaffinity>
+  printf(1, "affinity test ok\n");
+    241d:	58                   	pop    %eax
+    241e:	5a                   	pop    %edx
+    241f:	68 b8 5d 00 00       	push   $0x5db8
+    2424:	6a 01                	push   $0x1
+    2426:	e8 85 2e 00 00       	call   52b0 <printf>
+}
+    242b:	83 c4 10             	add    $0x10,%esp
+    242e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2431:	5b                   	pop    %ebx
+    2432:	5e                   	pop    %esi
+    2433:	5f                   	pop    %edi
+    2434:	5d                   	pop    %ebp
+    2435:	c3                   	ret
+    2436:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    243d:	8d 76 00             	lea    0x0(%esi),%esi
+    sleep(1);
+    2440:	83 ec 0c             	sub    $0xc,%esp
+    2443:	6a 01                	push   $0x1
+    2445:	e8 49 2d 00 00       	call   5193 <sleep>
+    if(getaffinity(0) != one || lastcpu() != cpu){
+    244a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2451:	e8 9d 2d 00 00       	call   51f3 <getaffinity>
+    2456:	83 c4 10             	add    $0x10,%esp
+    2459:	39 f8                	cmp    %edi,%eax
+    245b:	75 43                	jne    24a0 <affinitytest+0x1b0>
+  me = getpid();
+    245d:	e8 21 2d 00 00       	call   5183 <getpid>
+  n = procinfo(pi, NPROC);
+    2462:	83 ec 08             	sub    $0x8,%esp
+    2465:	6a 40                	push   $0x40
+  me = getpid();
+    2467:	89 c7                	mov    %eax,%edi
+  n = procinfo(pi, NPROC);
+    2469:	68 c0 d7 00 00       	push   $0xd7c0
+    246e:	e8 70 2d 00 00       	call   51e3 <procinfo>
+  for(i = 0; i < n; i++)
+    2473:	83 c4 10             	add    $0x10,%esp
+    2476:	85 c0                	test   %eax,%eax
+    2478:	7f 0d                	jg     2487 <affinitytest+0x197>
+    247a:	eb 24                	jmp    24a0 <affinitytest+0x1b0>
+    247c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2480:	83 c3 01             	add    $0x1,%ebx
+    2483:	39 d8                	cmp    %ebx,%eax
+    2485:	74 19                	je     24a0 <affinitytest+0x1b0>
+    if(pi[i].pid == me)
+    2487:	6b d3 34             	imul   $0x34,%ebx,%edx
+    248a:	3b ba c0 d7 00 00    	cmp    0xd7c0(%edx),%edi
+    2490:	75 ee                	jne    2480 <affinitytest+0x190>
+    if(getaffinity(0) != one || lastcpu() != cpu){
+    2492:	39 b2 d8 d7 00 00    	cmp    %esi,0xd7d8(%edx)
+    2498:	75 06                	jne    24a0 <affinitytest+0x1b0>
+    exit();
+    249a:	e8 64 2c 00 00       	call   5103 <exit>
+    249f:	90                   	nop
+      printf(1, "affinity test: child not pinned\n");
+    24a0:	83 ec 08             	sub    $0x8,%esp
+    24a3:	68 94 6f 00 00       	push   $0x6f94
+    24a8:	6a 01                	push   $0x1
+    24aa:	e8 01 2e 00 00       	call   52b0 <printf>
+      exit();
+    24af:	e8 4f 2c 00 00       	call   5103 <exit>
+    24b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    printf(1, "affinity test: pinning failed\n");
+    24b8:	83 ec 08             	sub    $0x8,%esp
+    24bb:	68 74 6f 00 00       	push   $0x6f74
+    24c0:	6a 01                	push   $0x1
+    24c2:	e8 e9 2d 00 00       	call   52b0 <printf>
+    exit();
+    24c7:	e8 37 2c 00 00       	call   5103 <exit>
+    printf(1, "affinity test: bad mask\n");
+    24cc:	83 ec 08             	sub    $0x8,%esp
+    24cf:	68 83 5d 00 00       	push   $0x5d83
+    24d4:	6a 01                	push   $0x1
+    24d6:	e8 d5 2d 00 00       	call   52b0 <printf>
+    exit();
+    24db:	e8 23 2c 00 00       	call   5103 <exit>
+    printf(1, "affinity test: fork failed\n");
+    24e0:	51                   	push   %ecx
+    24e1:	51                   	push   %ecx
+    24e2:	68 9c 5d 00 00       	push   $0x5d9c
+    24e7:	6a 01                	push   $0x1
+    24e9:	e8 c2 2d 00 00       	call   52b0 <printf>
+    exit();
+    24ee:	e8 10 2c 00 00       	call   5103 <exit>
+    24f3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    24fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00002500 <sharedfd>:
+{
+    2500:	55                   	push   %ebp
+    2501:	89 e5                	mov    %esp,%ebp
+    2503:	57                   	push   %edi
+    2504:	56                   	push   %esi
+    2505:	53                   	push   %ebx
+    2506:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "sharedfd test\n");
+    2509:	68 ca 5d 00 00       	push   $0x5dca
+    250e:	6a 01                	push   $0x1
+    2510:	e8 9b 2d 00 00       	call   52b0 <printf>
+  unlink("sharedfd");
+    2515:	c7 04 24 d9 5d 00 00 	movl   $0x5dd9,(%esp)
+    251c:	e8 32 2c 00 00       	call   5153 <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+    2521:	5b                   	pop    %ebx
+    2522:	5e                   	pop    %esi
+    2523:	68 02 02 00 00       	push   $0x202
+    2528:	68 d9 5d 00 00       	push   $0x5dd9
+    252d:	e8 11 2c 00 00       	call   5143 <open>
+  if(fd < 0){
+    2532:	83 c4 10             	add    $0x10,%esp
+    2535:	85 c0                	test   %eax,%eax
+    2537:	0f 88 2a 01 00 00    	js     2667 <sharedfd+0x167>
+    253d:	89 c7                	mov    %eax,%edi
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    253f:	8d 75 de             	lea    -0x22(%ebp),%esi
+    2542:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+  pid = fork();
+    2547:	e8 af 2b 00 00       	call   50fb <fork>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    254c:	83 f8 01             	cmp    $0x1,%eax
+  pid = fork();
+    254f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    2552:	19 c0                	sbb    %eax,%eax
+    2554:	83 ec 04             	sub    $0x4,%esp
+    2557:	83 e0 f3             	and    $0xfffffff3,%eax
+    255a:	6a 0a                	push   $0xa
+    255c:	83 c0 70             	add    $0x70,%eax
+    255f:	50                   	push   %eax
+    2560:	56                   	push   %esi
+    2561:	e8 1a 2a 00 00       	call   4f80 <memset>
+    2566:	83 c4 10             	add    $0x10,%esp
+    2569:	eb 0a                	jmp    2575 <sharedfd+0x75>
+    256b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    256f:	90                   	nop
+  for(i = 0; i < 1000; i++){
+    2570:	83 eb 01             	sub    $0x1,%ebx
+    2573:	74 26                	je     259b <sharedfd+0x9b>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    2575:	83 ec 04             	sub    $0x4,%esp
+    2578:	6a 0a                	push   $0xa
+    257a:	56                   	push   %esi
+    257b:	57                   	push   %edi
+    257c:	e8 a2 2b 00 00       	call   5123 <write>
+    2581:	83 c4 10             	add    $0x10,%esp
+    2584:	83 f8 0a             	cmp    $0xa,%eax
+    2587:	74 e7                	je     2570 <sharedfd+0x70>
+      printf(1, "fstests: write sharedfd failed\n");
+    2589:	83 ec 08             	sub    $0x8,%esp
+    258c:	68 e4 6f 00 00       	push   $0x6fe4
+    2591:	6a 01                	push   $0x1
+    2593:	e8 18 2d 00 00       	call   52b0 <printf>
+      break;
+    2598:	83 c4 10             	add    $0x10,%esp
+  if(pid == 0)
+    259b:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    259e:	85 c9                	test   %ecx,%ecx
+    25a0:	0f 84 f5 00 00 00    	je     269b <sharedfd+0x19b>
+    wait();
+    25a6:	e8 60 2b 00 00       	call   510b <wait>
+  close(fd);
+    25ab:	83 ec 0c             	sub    $0xc,%esp
+  nc = np = 0;
+    25ae:	31 db                	xor    %ebx,%ebx
+  close(fd);
+    25b0:	57                   	push   %edi
+    25b1:	8d 7d e8             	lea    -0x18(%ebp),%edi
+    25b4:	e8 72 2b 00 00       	call   512b <close>
+  fd = open("sharedfd", 0);
+    25b9:	58                   	pop    %eax
+    25ba:	5a                   	pop    %edx
+    25bb:	6a 00                	push   $0x0
+    25bd:	68 d9 5d 00 00       	push   $0x5dd9
+    25c2:	e8 7c 2b 00 00       	call   5143 <open>
+  if(fd < 0){
+    25c7:	83 c4 10             	add    $0x10,%esp
+  nc = np = 0;
+    25ca:	31 d2                	xor    %edx,%edx
+  fd = open("sharedfd", 0);
+    25cc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(fd < 0){
+    25cf:	85 c0                	test   %eax,%eax
+    25d1:	0f 88 aa 00 00 00    	js     2681 <sharedfd+0x181>
+    25d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    25de:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    25e0:	83 ec 04             	sub    $0x4,%esp
+    25e3:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    25e6:	6a 0a                	push   $0xa
+    25e8:	56                   	push   %esi
+    25e9:	ff 75 d0             	push   -0x30(%ebp)
+    25ec:	e8 2a 2b 00 00       	call   511b <read>
+    25f1:	83 c4 10             	add    $0x10,%esp
+    25f4:	85 c0                	test   %eax,%eax
+    25f6:	7e 28                	jle    2620 <sharedfd+0x120>
+    25f8:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    25fb:	89 f0                	mov    %esi,%eax
+    25fd:	eb 13                	jmp    2612 <sharedfd+0x112>
+    25ff:	90                   	nop
+        np++;
+    2600:	80 f9 70             	cmp    $0x70,%cl
+    2603:	0f 94 c1             	sete   %cl
+    2606:	0f b6 c9             	movzbl %cl,%ecx
+    2609:	01 cb                	add    %ecx,%ebx
+    for(i = 0; i < sizeof(buf); i++){
+    260b:	83 c0 01             	add    $0x1,%eax
+    260e:	39 f8                	cmp    %edi,%eax
+    2610:	74 ce                	je     25e0 <sharedfd+0xe0>
+      if(buf[i] == 'c')
+    2612:	0f b6 08             	movzbl (%eax),%ecx
+    2615:	80 f9 63             	cmp    $0x63,%cl
+    2618:	75 e6                	jne    2600 <sharedfd+0x100>
+        nc++;
+    261a:	83 c2 01             	add    $0x1,%edx
+      if(buf[i] == 'p')
+    261d:	eb ec                	jmp    260b <sharedfd+0x10b>
+    261f:	90                   	nop
+  close(fd);
+    2620:	83 ec 0c             	sub    $0xc,%esp
+    2623:	ff 75 d0             	push   -0x30(%ebp)
+    2626:	e8 00 2b 00 00       	call   512b <close>
+  unlink("sharedfd");
+    262b:	c7 04 24 d9 5d 00 00 	movl   $0x5dd9,(%esp)
+    2632:	e8 1c 2b 00 00       	call   5153 <unlink>
+  if(nc == 10000 && np == 10000){
+    2637:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    263a:	83 c4 10             	add    $0x10,%esp
+    263d:	81 fa 10 27 00 00    	cmp    $0x2710,%edx
+    2643:	75 5b                	jne    26a0 <sharedfd+0x1a0>
+    2645:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+    264b:	75 53                	jne    26a0 <sharedfd+0x1a0>
+    printf(1, "sharedfd ok\n");
+    264d:	83 ec 08             	sub    $0x8,%esp
+    2650:	68 e2 5d 00 00       	push   $0x5de2
+    2655:	6a 01                	push   $0x1
+    2657:	e8 54 2c 00 00       	call   52b0 <printf>
+    265c:	83 c4 10             	add    $0x10,%esp
+}
+    265f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2662:	5b                   	pop    %ebx
+    2663:	5e                   	pop    %esi
+    2664:	5f                   	pop    %edi
+    2665:	5d                   	pop    %ebp
+    2666:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for writing");
+    2667:	83 ec 08             	sub    $0x8,%esp
+    266a:	68 b8 6f 00 00       	push   $0x6fb8
+    266f:	6a 01                	push   $0x1
+    2671:	e8 3a 2c 00 00       	call   52b0 <printf>
+    return;
+    2676:	83 c4 10             	add    $0x10,%esp
+}
+    2679:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    267c:	5b                   	pop    %ebx
+    267d:	5e                   	pop    %esi
+    267e:	5f                   	pop    %edi
+    267f:	5d                   	pop    %ebp
+    2680:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    2681:	83 ec 08             	sub    $0x8,%esp
+    2684:	68 04 70 00 00       	push   $0x7004
+    2689:	6a 01                	push   $0x1
+    268b:	e8 20 2c 00 00       	call   52b0 <printf>
+    return;
+    2690:	83 c4 10             	add    $0x10,%esp
+}
+    2693:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2696:	5b                   	pop    %ebx
+    2697:	5e                   	pop    %esi
+    2698:	5f                   	pop    %edi
+    2699:	5d                   	pop    %ebp
+    269a:	c3                   	ret
+    exit();
+    269b:	e8 63 2a 00 00       	call   5103 <exit>
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    26a0:	53                   	push   %ebx
+    26a1:	52                   	push   %edx
+    26a2:	68 ef 5d 00 00       	push   $0x5def
+    26a7:	6a 01                	push   $0x1
+    26a9:	e8 02 2c 00 00       	call   52b0 <printf>
+    exit();
+    26ae:	e8 50 2a 00 00       	call   5103 <exit>
+    26b3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    26ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000026c0 <fourfiles>:
+{
+    26c0:	55                   	push   %ebp
+    26c1:	89 e5                	mov    %esp,%ebp
+    26c3:	57                   	push   %edi
+    26c4:	56                   	push   %esi
+    26c5:	53                   	push   %ebx
+  for(pi = 0; pi < 4; pi++){
+    26c6:	31 db                	xor    %ebx,%ebx
+{
+    26c8:	83 ec 34             	sub    $0x34,%esp
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    26cb:	c7 45 d8 04 5e 00 00 	movl   $0x5e04,-0x28(%ebp)
+    26d2:	c7 45 dc 4d 5f 00 00 	movl   $0x5f4d,-0x24(%ebp)
+    26d9:	c7 45 e0 51 5f 00 00 	movl   $0x5f51,-0x20(%ebp)
+    26e0:	c7 45 e4 07 5e 00 00 	movl   $0x5e07,-0x1c(%ebp)
+  printf(1, "fourfiles test\n");
+    26e7:	68 0a 5e 00 00       	push   $0x5e0a
+    26ec:	6a 01                	push   $0x1
+    26ee:	e8 bd 2b 00 00       	call   52b0 <printf>
+    26f3:	83 c4 10             	add    $0x10,%esp
+    fname = names[pi];
+    26f6:	8b 74 9d d8          	mov    -0x28(%ebp,%ebx,4),%esi
+    unlink(fname);
+    26fa:	83 ec 0c             	sub    $0xc,%esp
+    26fd:	56                   	push   %esi
+    26fe:	e8 50 2a 00 00       	call   5153 <unlink>
+    pid = fork();
+    2703:	e8 f3 29 00 00       	call   50fb <fork>
+    if(pid < 0){
+    2708:	83 c4 10             	add    $0x10,%esp
+    270b:	85 c0                	test   %eax,%eax
+    270d:	0f 88 65 01 00 00    	js     2878 <fourfiles+0x1b8>
+    if(pid == 0){
+    2713:	0f 84 eb 00 00 00    	je     2804 <fourfiles+0x144>
+  for(pi = 0; pi < 4; pi++){
+    2719:	83 c3 01             	add    $0x1,%ebx
+    271c:	83 fb 04             	cmp    $0x4,%ebx
+    271f:	75 d5                	jne    26f6 <fourfiles+0x36>
+    wait();
+    2721:	e8 e5 29 00 00       	call   510b <wait>
+  for(i = 0; i < 2; i++){
+    2726:	31 f6                	xor    %esi,%esi
+    wait();
+    2728:	e8 de 29 00 00       	call   510b <wait>
+    272d:	e8 d9 29 00 00       	call   510b <wait>
+    2732:	e8 d4 29 00 00       	call   510b <wait>
+    fname = names[i];
+    2737:	8b 5c b5 d8          	mov    -0x28(%ebp,%esi,4),%ebx
+    fd = open(fname, 0);
+    273b:	83 ec 08             	sub    $0x8,%esp
+    total = 0;
+    273e:	31 ff                	xor    %edi,%edi
+    fd = open(fname, 0);
+    2740:	6a 00                	push   $0x0
+    2742:	53                   	push   %ebx
+    2743:	e8 fb 29 00 00       	call   5143 <open>
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    2748:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    274b:	83 c4 10             	add    $0x10,%esp
+    274e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    2751:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2758:	83 ec 04             	sub    $0x4,%esp
+    275b:	68 00 20 00 00       	push   $0x2000
+    2760:	68 40 b7 00 00       	push   $0xb740
+    2765:	ff 75 d4             	push   -0x2c(%ebp)
+    2768:	e8 ae 29 00 00       	call   511b <read>
+    276d:	83 c4 10             	add    $0x10,%esp
+    2770:	89 c3                	mov    %eax,%ebx
+    2772:	85 c0                	test   %eax,%eax
+    2774:	7e 28                	jle    279e <fourfiles+0xde>
+      for(j = 0; j < n; j++){
+    2776:	31 c0                	xor    %eax,%eax
+    2778:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    277f:	90                   	nop
+        if(buf[j] != '0'+i){
+    2780:	83 fe 01             	cmp    $0x1,%esi
+    2783:	0f be 88 40 b7 00 00 	movsbl 0xb740(%eax),%ecx
+    278a:	19 d2                	sbb    %edx,%edx
+    278c:	83 c2 31             	add    $0x31,%edx
+    278f:	39 d1                	cmp    %edx,%ecx
+    2791:	75 5d                	jne    27f0 <fourfiles+0x130>
+      for(j = 0; j < n; j++){
+    2793:	83 c0 01             	add    $0x1,%eax
+    2796:	39 c3                	cmp    %eax,%ebx
+    2798:	75 e6                	jne    2780 <fourfiles+0xc0>
+      total += n;
+    279a:	01 df                	add    %ebx,%edi
+    279c:	eb ba                	jmp    2758 <fourfiles+0x98>
+    close(fd);
+    279e:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    27a1:	83 ec 0c             	sub    $0xc,%esp
+    27a4:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    27a7:	51                   	push   %ecx
+    27a8:	e8 7e 29 00 00       	call   512b <close>
+    if(total != 12*500){
+    27ad:	83 c4 10             	add    $0x10,%esp
+    27b0:	81 ff 70 17 00 00    	cmp    $0x1770,%edi
+    27b6:	0f 85 d0 00 00 00    	jne    288c <fourfiles+0x1cc>
+    unlink(fname);
+    27bc:	83 ec 0c             	sub    $0xc,%esp
+    27bf:	53                   	push   %ebx
+    27c0:	e8 8e 29 00 00       	call   5153 <unlink>
+  for(i = 0; i < 2; i++){
+    27c5:	83 c4 10             	add    $0x10,%esp
+    27c8:	85 f6                	test   %esi,%esi
+    27ca:	75 0a                	jne    27d6 <fourfiles+0x116>
+    27cc:	be 01 00 00 00       	mov    $0x1,%esi
+    27d1:	e9 61 ff ff ff       	jmp    2737 <fourfiles+0x77>
+  printf(1, "fourfiles ok\n");
+    27d6:	83 ec 08             	sub    $0x8,%esp
+    27d9:	68 48 5e 00 00       	push   $0x5e48
+    27de:	6a 01                	push   $0x1
+    27e0:	e8 cb 2a 00 00       	call   52b0 <printf>
+}
+    27e5:	83 c4 10             	add    $0x10,%esp
+    27e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    27eb:	5b                   	pop    %ebx
+    27ec:	5e                   	pop    %esi
+    27ed:	5f                   	pop    %edi
+    27ee:	5d                   	pop    %ebp
+    27ef:	c3                   	ret
+          printf(1, "wrong char\n");
+    27f0:	83 ec 08             	sub    $0x8,%esp
+    27f3:	68 2b 5e 00 00       	push   $0x5e2b
+    27f8:	6a 01                	push   $0x1
+    27fa:	e8 b1 2a 00 00       	call   52b0 <printf>
+          exit();
+    27ff:	e8 ff 28 00 00       	call   5103 <exit>
+      fd = open(fname, O_CREATE | O_RDWR);
+    2804:	83 ec 08             	sub    $0x8,%esp
+    2807:	68 02 02 00 00       	push   $0x202
+    280c:	56                   	push   %esi
+    280d:	e8 31 29 00 00       	call   5143 <open>
+      if(fd < 0){
+    2812:	83 c4 10             	add    $0x10,%esp
+      fd = open(fname, O_CREATE | O_RDWR);
+    2815:	89 c6                	mov    %eax,%esi
+      if(fd < 0){
+    2817:	85 c0                	test   %eax,%eax
+    2819:	78 45                	js     2860 <fourfiles+0x1a0>
+      memset(buf, '0'+pi, 512);
+    281b:	83 ec 04             	sub    $0x4,%esp
+    281e:	83 c3 30             	add    $0x30,%ebx
+    2821:	68 00 02 00 00       	push   $0x200
+    2826:	53                   	push   %ebx
+    2827:	bb 0c 00 00 00       	mov    $0xc,%ebx
+    282c:	68 40 b7 00 00       	push   $0xb740
+    2831:	e8 4a 27 00 00       	call   4f80 <memset>
+    2836:	83 c4 10             	add    $0x10,%esp
+        if((n = write(fd, buf, 500)) != 500){
+    2839:	83 ec 04             	sub    $0x4,%esp
+    283c:	68 f4 01 00 00       	push   $0x1f4
+    2841:	68 40 b7 00 00       	push   $0xb740
+    2846:	56                   	push   %esi
+    2847:	e8 d7 28 00 00       	call   5123 <write>
+    284c:	83 c4 10             	add    $0x10,%esp
+    284f:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+    2854:	75 49                	jne    289f <fourfiles+0x1df>
+      for(i = 0; i < 12; i++){
+    2856:	83 eb 01             	sub    $0x1,%ebx
+    2859:	75 de                	jne    2839 <fourfiles+0x179>
+      exit();
+    285b:	e8 a3 28 00 00       	call   5103 <exit>
+        printf(1, "create failed\n");
+    2860:	51                   	push   %ecx
+    2861:	51                   	push   %ecx
+    2862:	68 a5 60 00 00       	push   $0x60a5
+    2867:	6a 01                	push   $0x1
+    2869:	e8 42 2a 00 00       	call   52b0 <printf>
+        exit();
+    286e:	e8 90 28 00 00       	call   5103 <exit>
+    2873:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2877:	90                   	nop
+      printf(1, "fork failed\n");
+    2878:	83 ec 08             	sub    $0x8,%esp
+    287b:	68 c9 5c 00 00       	push   $0x5cc9
+    2880:	6a 01                	push   $0x1
+    2882:	e8 29 2a 00 00       	call   52b0 <printf>
+      exit();
+    2887:	e8 77 28 00 00       	call   5103 <exit>
+      printf(1, "wrong length %d\n", total);
+    288c:	50                   	push   %eax
+    288d:	57                   	push   %edi
+    288e:	68 37 5e 00 00       	push   $0x5e37
+    2893:	6a 01                	push   $0x1
+    2895:	e8 16 2a 00 00       	call   52b0 <printf>
+      exit();
+    289a:	e8 64 28 00 00       	call   5103 <exit>
+          printf(1, "write failed %d\n", n);
+    289f:	52                   	push   %edx
+    28a0:	50                   	push   %eax
+    28a1:	68 1a 5e 00 00       	push   $0x5e1a
+    28a6:	6a 01                	push   $0x1
+    28a8:	e8 03 2a 00 00       	call   52b0 <printf>
+          exit();
+    28ad:	e8 51 28 00 00       	call   5103 <exit>
+    28b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    28b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000028c0 <createdelete>:
+{
+    28c0:	55                   	push   %ebp
+    28c1:	89 e5                	mov    %esp,%ebp
+    28c3:	57                   	push   %edi
+    28c4:	56                   	push   %esi
+  for(pi = 0; pi < 4; pi++){
+    28c5:	31 f6                	xor    %esi,%esi
+{
+    28c7:	53                   	push   %ebx
+    28c8:	83 ec 44             	sub    $0x44,%esp
+  printf(1, "createdelete test\n");
+    28cb:	68 56 5e 00 00       	push   $0x5e56
+    28d0:	6a 01                	push   $0x1
+    28d2:	e8 d9 29 00 00       	call   52b0 <printf>
+    28d7:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    28da:	e8 1c 28 00 00       	call   50fb <fork>
+    28df:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    28e1:	85 c0                	test   %eax,%eax
+    28e3:	0f 88 ac 01 00 00    	js     2a95 <createdelete+0x1d5>
+    if(pid == 0){
+    28e9:	0f 84 01 01 00 00    	je     29f0 <createdelete+0x130>
+  for(pi = 0; pi < 4; pi++){
+    28ef:	83 c6 01             	add    $0x1,%esi
+    28f2:	83 fe 04             	cmp    $0x4,%esi
+    28f5:	75 e3                	jne    28da <createdelete+0x1a>
+    wait();
+    28f7:	e8 0f 28 00 00       	call   510b <wait>
+  for(i = 0; i < N; i++){
+    28fc:	31 ff                	xor    %edi,%edi
+    28fe:	8d 75 c8             	lea    -0x38(%ebp),%esi
+    wait();
+    2901:	e8 05 28 00 00       	call   510b <wait>
+    2906:	e8 00 28 00 00       	call   510b <wait>
+    290b:	e8 fb 27 00 00       	call   510b <wait>
+  name[0] = name[1] = name[2] = 0;
+    2910:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+  for(i = 0; i < N; i++){
+    2914:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if((i == 0 || i >= N/2) && fd < 0){
+    2918:	85 ff                	test   %edi,%edi
+      name[1] = '0' + i;
+    291a:	8d 47 30             	lea    0x30(%edi),%eax
+      if((i == 0 || i >= N/2) && fd < 0){
+    291d:	bb 70 00 00 00       	mov    $0x70,%ebx
+    2922:	0f 94 c2             	sete   %dl
+    2925:	83 ff 09             	cmp    $0x9,%edi
+      name[1] = '0' + i;
+    2928:	88 45 c6             	mov    %al,-0x3a(%ebp)
+      if((i == 0 || i >= N/2) && fd < 0){
+    292b:	0f 9f c0             	setg   %al
+    292e:	09 c2                	or     %eax,%edx
+    2930:	88 55 c7             	mov    %dl,-0x39(%ebp)
+      name[1] = '0' + i;
+    2933:	0f b6 45 c6          	movzbl -0x3a(%ebp),%eax
+      fd = open(name, 0);
+    2937:	83 ec 08             	sub    $0x8,%esp
+      name[0] = 'p' + pi;
+    293a:	88 5d c8             	mov    %bl,-0x38(%ebp)
+      name[1] = '0' + i;
+    293d:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    2940:	6a 00                	push   $0x0
+    2942:	56                   	push   %esi
+    2943:	e8 fb 27 00 00       	call   5143 <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+    2948:	83 c4 10             	add    $0x10,%esp
+    294b:	80 7d c7 00          	cmpb   $0x0,-0x39(%ebp)
+    294f:	74 7f                	je     29d0 <createdelete+0x110>
+    2951:	85 c0                	test   %eax,%eax
+    2953:	0f 88 27 01 00 00    	js     2a80 <createdelete+0x1c0>
+        close(fd);
+    2959:	83 ec 0c             	sub    $0xc,%esp
+    295c:	50                   	push   %eax
+    295d:	e8 c9 27 00 00       	call   512b <close>
+    2962:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    2965:	83 c3 01             	add    $0x1,%ebx
+    2968:	80 fb 74             	cmp    $0x74,%bl
+    296b:	75 c6                	jne    2933 <createdelete+0x73>
+  for(i = 0; i < N; i++){
+    296d:	83 c7 01             	add    $0x1,%edi
+    2970:	83 ff 14             	cmp    $0x14,%edi
+    2973:	75 a3                	jne    2918 <createdelete+0x58>
+    2975:	bf 70 00 00 00       	mov    $0x70,%edi
+    297a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      name[1] = '0' + i;
+    2980:	8d 47 c0             	lea    -0x40(%edi),%eax
+    2983:	bb 04 00 00 00       	mov    $0x4,%ebx
+    2988:	88 45 c7             	mov    %al,-0x39(%ebp)
+      name[0] = 'p' + i;
+    298b:	89 f8                	mov    %edi,%eax
+      unlink(name);
+    298d:	83 ec 0c             	sub    $0xc,%esp
+      name[0] = 'p' + i;
+    2990:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    2993:	0f b6 45 c7          	movzbl -0x39(%ebp),%eax
+    2997:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    299a:	56                   	push   %esi
+    299b:	e8 b3 27 00 00       	call   5153 <unlink>
+    for(pi = 0; pi < 4; pi++){
+    29a0:	83 c4 10             	add    $0x10,%esp
+    29a3:	83 eb 01             	sub    $0x1,%ebx
+    29a6:	75 e3                	jne    298b <createdelete+0xcb>
+  for(i = 0; i < N; i++){
+    29a8:	83 c7 01             	add    $0x1,%edi
+    29ab:	89 f8                	mov    %edi,%eax
+    29ad:	3c 84                	cmp    $0x84,%al
+    29af:	75 cf                	jne    2980 <createdelete+0xc0>
+  printf(1, "createdelete ok\n");
+    29b1:	83 ec 08             	sub    $0x8,%esp
+    29b4:	68 69 5e 00 00       	push   $0x5e69
+    29b9:	6a 01                	push   $0x1
+    29bb:	e8 f0 28 00 00       	call   52b0 <printf>
+}
+    29c0:	83 c4 10             	add    $0x10,%esp
+    29c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    29c6:	5b                   	pop    %ebx
+    29c7:	5e                   	pop    %esi
+    29c8:	5f                   	pop    %edi
+    29c9:	5d                   	pop    %ebp
+    29ca:	c3                   	ret
+    29cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    29cf:	90                   	nop
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    29d0:	85 c0                	test   %eax,%eax
+    29d2:	78 91                	js     2965 <createdelete+0xa5>
+        printf(1, "oops createdelete %s did exist\n", name);
+    29d4:	50                   	push   %eax
+    29d5:	56                   	push   %esi
+    29d6:	68 54 70 00 00       	push   $0x7054
+    29db:	6a 01                	push   $0x1
+    29dd:	e8 ce 28 00 00       	call   52b0 <printf>
+        exit();
+    29e2:	e8 1c 27 00 00       	call   5103 <exit>
+    29e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    29ee:	66 90                	xchg   %ax,%ax
+      name[0] = 'p' + pi;
+    29f0:	8d 46 70             	lea    0x70(%esi),%eax
+      name[2] = '\0';
+    29f3:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    29f7:	8d 75 c8             	lea    -0x38(%ebp),%esi
+      name[0] = 'p' + pi;
+    29fa:	88 45 c8             	mov    %al,-0x38(%ebp)
+      for(i = 0; i < N; i++){
+    29fd:	8d 76 00             	lea    0x0(%esi),%esi
+        fd = open(name, O_CREATE | O_RDWR);
+    2a00:	83 ec 08             	sub    $0x8,%esp
+        name[1] = '0' + i;
+    2a03:	8d 43 30             	lea    0x30(%ebx),%eax
+    2a06:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    2a09:	68 02 02 00 00       	push   $0x202
+    2a0e:	56                   	push   %esi
+    2a0f:	e8 2f 27 00 00       	call   5143 <open>
+        if(fd < 0){
+    2a14:	83 c4 10             	add    $0x10,%esp
+    2a17:	85 c0                	test   %eax,%eax
+    2a19:	0f 88 8a 00 00 00    	js     2aa9 <createdelete+0x1e9>
+        close(fd);
+    2a1f:	83 ec 0c             	sub    $0xc,%esp
+    2a22:	50                   	push   %eax
+    2a23:	e8 03 27 00 00       	call   512b <close>
+        if(i > 0 && (i % 2 ) == 0){
+    2a28:	83 c4 10             	add    $0x10,%esp
+    2a2b:	85 db                	test   %ebx,%ebx
+    2a2d:	74 19                	je     2a48 <createdelete+0x188>
+    2a2f:	f6 c3 01             	test   $0x1,%bl
+    2a32:	74 1b                	je     2a4f <createdelete+0x18f>
+      for(i = 0; i < N; i++){
+    2a34:	83 c3 01             	add    $0x1,%ebx
+    2a37:	83 fb 14             	cmp    $0x14,%ebx
+    2a3a:	75 c4                	jne    2a00 <createdelete+0x140>
+      exit();
+    2a3c:	e8 c2 26 00 00       	call   5103 <exit>
+    2a41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      for(i = 0; i < N; i++){
+    2a48:	bb 01 00 00 00       	mov    $0x1,%ebx
+    2a4d:	eb b1                	jmp    2a00 <createdelete+0x140>
+          name[1] = '0' + (i / 2);
+    2a4f:	89 d8                	mov    %ebx,%eax
+          if(unlink(name) < 0){
+    2a51:	83 ec 0c             	sub    $0xc,%esp
+          name[1] = '0' + (i / 2);
+    2a54:	d1 f8                	sar    %eax
+    2a56:	83 c0 30             	add    $0x30,%eax
+    2a59:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    2a5c:	56                   	push   %esi
+    2a5d:	e8 f1 26 00 00       	call   5153 <unlink>
+    2a62:	83 c4 10             	add    $0x10,%esp
+    2a65:	85 c0                	test   %eax,%eax
+    2a67:	79 cb                	jns    2a34 <createdelete+0x174>
+            printf(1, "unlink failed\n");
+    2a69:	52                   	push   %edx
+    2a6a:	52                   	push   %edx
+    2a6b:	68 f0 56 00 00       	push   $0x56f0
+    2a70:	6a 01                	push   $0x1
+    2a72:	e8 39 28 00 00       	call   52b0 <printf>
+            exit();
+    2a77:	e8 87 26 00 00       	call   5103 <exit>
+    2a7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    2a80:	83 ec 04             	sub    $0x4,%esp
+    2a83:	56                   	push   %esi
+    2a84:	68 30 70 00 00       	push   $0x7030
+    2a89:	6a 01                	push   $0x1
+    2a8b:	e8 20 28 00 00       	call   52b0 <printf>
+        exit();
+    2a90:	e8 6e 26 00 00       	call   5103 <exit>
+      printf(1, "fork failed\n");
+    2a95:	83 ec 08             	sub    $0x8,%esp
+    2a98:	68 c9 5c 00 00       	push   $0x5cc9
+    2a9d:	6a 01                	push   $0x1
+    2a9f:	e8 0c 28 00 00       	call   52b0 <printf>
+      exit();
+    2aa4:	e8 5a 26 00 00       	call   5103 <exit>
+          printf(1, "create failed\n");
+    2aa9:	83 ec 08             	sub    $0x8,%esp
+    2aac:	68 a5 60 00 00       	push   $0x60a5
+    2ab1:	6a 01                	push   $0x1
+    2ab3:	e8 f8 27 00 00       	call   52b0 <printf>
+          exit();
+    2ab8:	e8 46 26 00 00       	call   5103 <exit>
+    2abd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002ac0 <unlinkread>:
+{
+    2ac0:	55                   	push   %ebp
+    2ac1:	89 e5                	mov    %esp,%ebp
+    2ac3:	56                   	push   %esi
+    2ac4:	53                   	push   %ebx
+  printf(1, "unlinkread test\n");
+    2ac5:	83 ec 08             	sub    $0x8,%esp
+    2ac8:	68 7a 5e 00 00       	push   $0x5e7a
+    2acd:	6a 01                	push   $0x1
+    2acf:	e8 dc 27 00 00       	call   52b0 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    2ad4:	5b                   	pop    %ebx
+    2ad5:	5e                   	pop    %esi
+    2ad6:	68 02 02 00 00       	push   $0x202
+    2adb:	68 8b 5e 00 00       	push   $0x5e8b
+    2ae0:	e8 5e 26 00 00       	call   5143 <open>
+  if(fd < 0){
+    2ae5:	83 c4 10             	add    $0x10,%esp
+    2ae8:	85 c0                	test   %eax,%eax
+    2aea:	0f 88 e6 00 00 00    	js     2bd6 <unlinkread+0x116>
+  write(fd, "hello", 5);
+    2af0:	83 ec 04             	sub    $0x4,%esp
+    2af3:	89 c3                	mov    %eax,%ebx
+    2af5:	6a 05                	push   $0x5
+    2af7:	68 b0 5e 00 00       	push   $0x5eb0
+    2afc:	50                   	push   %eax
+    2afd:	e8 21 26 00 00       	call   5123 <write>
+  close(fd);
+    2b02:	89 1c 24             	mov    %ebx,(%esp)
+    2b05:	e8 21 26 00 00       	call   512b <close>
+  fd = open("unlinkread", O_RDWR);
+    2b0a:	58                   	pop    %eax
+    2b0b:	5a                   	pop    %edx
+    2b0c:	6a 02                	push   $0x2
+    2b0e:	68 8b 5e 00 00       	push   $0x5e8b
+    2b13:	e8 2b 26 00 00       	call   5143 <open>
+  if(fd < 0){
+    2b18:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_RDWR);
+    2b1b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2b1d:	85 c0                	test   %eax,%eax
+    2b1f:	0f 88 10 01 00 00    	js     2c35 <unlinkread+0x175>
+  if(unlink("unlinkread") != 0){
+    2b25:	83 ec 0c             	sub    $0xc,%esp
+    2b28:	68 8b 5e 00 00       	push   $0x5e8b
+    2b2d:	e8 21 26 00 00       	call   5153 <unlink>
+    2b32:	83 c4 10             	add    $0x10,%esp
+    2b35:	85 c0                	test   %eax,%eax
+    2b37:	0f 85 e5 00 00 00    	jne    2c22 <unlinkread+0x162>
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    2b3d:	83 ec 08             	sub    $0x8,%esp
+    2b40:	68 02 02 00 00       	push   $0x202
+    2b45:	68 8b 5e 00 00       	push   $0x5e8b
+    2b4a:	e8 f4 25 00 00       	call   5143 <open>
+  write(fd1, "yyy", 3);
+    2b4f:	83 c4 0c             	add    $0xc,%esp
+    2b52:	6a 03                	push   $0x3
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    2b54:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    2b56:	68 e8 5e 00 00       	push   $0x5ee8
+    2b5b:	50                   	push   %eax
+    2b5c:	e8 c2 25 00 00       	call   5123 <write>
+  close(fd1);
+    2b61:	89 34 24             	mov    %esi,(%esp)
+    2b64:	e8 c2 25 00 00       	call   512b <close>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    2b69:	83 c4 0c             	add    $0xc,%esp
+    2b6c:	68 00 20 00 00       	push   $0x2000
+    2b71:	68 40 b7 00 00       	push   $0xb740
+    2b76:	53                   	push   %ebx
+    2b77:	e8 9f 25 00 00       	call   511b <read>
+    2b7c:	83 c4 10             	add    $0x10,%esp
+    2b7f:	83 f8 05             	cmp    $0x5,%eax
+    2b82:	0f 85 87 00 00 00    	jne    2c0f <unlinkread+0x14f>
+  if(buf[0] != 'h'){
+    2b88:	80 3d 40 b7 00 00 68 	cmpb   $0x68,0xb740
+    2b8f:	75 6b                	jne    2bfc <unlinkread+0x13c>
+  if(write(fd, buf, 10) != 10){
+    2b91:	83 ec 04             	sub    $0x4,%esp
+    2b94:	6a 0a                	push   $0xa
+    2b96:	68 40 b7 00 00       	push   $0xb740
+    2b9b:	53                   	push   %ebx
+    2b9c:	e8 82 25 00 00       	call   5123 <write>
+    2ba1:	83 c4 10             	add    $0x10,%esp
+    2ba4:	83 f8 0a             	cmp    $0xa,%eax
+    2ba7:	75 40                	jne    2be9 <unlinkread+0x129>
+  close(fd);
+    2ba9:	83 ec 0c             	sub    $0xc,%esp
+    2bac:	53                   	push   %ebx
+    2bad:	e8 79 25 00 00       	call   512b <close>
+  unlink("unlinkread");
+    2bb2:	c7 04 24 8b 5e 00 00 	movl   $0x5e8b,(%esp)
+    2bb9:	e8 95 25 00 00       	call   5153 <unlink>
+  printf(1, "unlinkread ok\n");
+    2bbe:	58                   	pop    %eax
+    2bbf:	5a                   	pop    %edx
+    2bc0:	68 33 5f 00 00       	push   $0x5f33
+    2bc5:	6a 01                	push   $0x1
+    2bc7:	e8 e4 26 00 00       	call   52b0 <printf>
+}
+    2bcc:	83 c4 10             	add    $0x10,%esp
+    2bcf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2bd2:	5b                   	pop    %ebx
+    2bd3:	5e                   	pop    %esi
+    2bd4:	5d                   	pop    %ebp
+    2bd5:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    2bd6:	51                   	push   %ecx
+    2bd7:	51                   	push   %ecx
+    2bd8:	68 96 5e 00 00       	push   $0x5e96
+    2bdd:	6a 01                	push   $0x1
+    2bdf:	e8 cc 26 00 00       	call   52b0 <printf>
+    exit();
+    2be4:	e8 1a 25 00 00       	call   5103 <exit>
+    printf(1, "unlinkread write failed\n");
+    2be9:	51                   	push   %ecx
+    2bea:	51                   	push   %ecx
+    2beb:	68 1a 5f 00 00       	push   $0x5f1a
+    2bf0:	6a 01                	push   $0x1
+    2bf2:	e8 b9 26 00 00       	call   52b0 <printf>
+    exit();
+    2bf7:	e8 07 25 00 00       	call   5103 <exit>
+    printf(1, "unlinkread wrong data\n");
+    2bfc:	53                   	push   %ebx
+    2bfd:	53                   	push   %ebx
+    2bfe:	68 03 5f 00 00       	push   $0x5f03
+    2c03:	6a 01                	push   $0x1
+    2c05:	e8 a6 26 00 00       	call   52b0 <printf>
+    exit();
+    2c0a:	e8 f4 24 00 00       	call   5103 <exit>
+    printf(1, "unlinkread read failed");
+    2c0f:	56                   	push   %esi
+    2c10:	56                   	push   %esi
+    2c11:	68 ec 5e 00 00       	push   $0x5eec
+    2c16:	6a 01                	push   $0x1
+    2c18:	e8 93 26 00 00       	call   52b0 <printf>
+    exit();
+    2c1d:	e8 e1 24 00 00       	call   5103 <exit>
+    printf(1, "unlink unlinkread failed\n");
+    2c22:	50                   	push   %eax
+    2c23:	50                   	push   %eax
+    2c24:	68 ce 5e 00 00       	push   $0x5ece
+    2c29:	6a 01                	push   $0x1
+    2c2b:	e8 80 26 00 00       	call   52b0 <printf>
+    exit();
+    2c30:	e8 ce 24 00 00       	call   5103 <exit>
+    printf(1, "open unlinkread failed\n");
+    2c35:	50                   	push   %eax
+    2c36:	50                   	push   %eax
+    2c37:	68 b6 5e 00 00       	push   $0x5eb6
+    2c3c:	6a 01                	push   $0x1
+    2c3e:	e8 6d 26 00 00       	call   52b0 <printf>
+    exit();
+    2c43:	e8 bb 24 00 00       	call   5103 <exit>
+    2c48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2c4f:	90                   	nop
+
+00002c50 <linktest>:
+{
+    2c50:	55                   	push   %ebp
+    2c51:	89 e5                	mov    %esp,%ebp
+    2c53:	53                   	push   %ebx
+    2c54:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "linktest\n");
+    2c57:	68 42 5f 00 00       	push   $0x5f42
+    2c5c:	6a 01                	push   $0x1
+    2c5e:	e8 4d 26 00 00       	call   52b0 <printf>
+  unlink("lf1");
+    2c63:	c7 04 24 4c 5f 00 00 	movl   $0x5f4c,(%esp)
+    2c6a:	e8 e4 24 00 00       	call   5153 <unlink>
+  unlink("lf2");
+    2c6f:	c7 04 24 50 5f 00 00 	movl   $0x5f50,(%esp)
+    2c76:	e8 d8 24 00 00       	call   5153 <unlink>
+  fd = open("lf1", O_CREATE|O_RDWR);
+    2c7b:	58                   	pop    %eax
+    2c7c:	5a                   	pop    %edx
+    2c7d:	68 02 02 00 00       	push   $0x202
+    2c82:	68 4c 5f 00 00       	push   $0x5f4c
+    2c87:	e8 b7 24 00 00       	call   5143 <open>
+  if(fd < 0){
+    2c8c:	83 c4 10             	add    $0x10,%esp
+    2c8f:	85 c0                	test   %eax,%eax
+    2c91:	0f 88 1e 01 00 00    	js     2db5 <linktest+0x165>
+  if(write(fd, "hello", 5) != 5){
+    2c97:	83 ec 04             	sub    $0x4,%esp
+    2c9a:	89 c3                	mov    %eax,%ebx
+    2c9c:	6a 05                	push   $0x5
+    2c9e:	68 b0 5e 00 00       	push   $0x5eb0
+    2ca3:	50                   	push   %eax
+    2ca4:	e8 7a 24 00 00       	call   5123 <write>
+    2ca9:	83 c4 10             	add    $0x10,%esp
+    2cac:	83 f8 05             	cmp    $0x5,%eax
+    2caf:	0f 85 98 01 00 00    	jne    2e4d <linktest+0x1fd>
+  close(fd);
+    2cb5:	83 ec 0c             	sub    $0xc,%esp
+    2cb8:	53                   	push   %ebx
+    2cb9:	e8 6d 24 00 00       	call   512b <close>
+  if(link("lf1", "lf2") < 0){
+    2cbe:	5b                   	pop    %ebx
+    2cbf:	58                   	pop    %eax
+    2cc0:	68 50 5f 00 00       	push   $0x5f50
+    2cc5:	68 4c 5f 00 00       	push   $0x5f4c
+    2cca:	e8 94 24 00 00       	call   5163 <link>
+    2ccf:	83 c4 10             	add    $0x10,%esp
+    2cd2:	85 c0                	test   %eax,%eax
+    2cd4:	0f 88 60 01 00 00    	js     2e3a <linktest+0x1ea>
+  unlink("lf1");
+    2cda:	83 ec 0c             	sub    $0xc,%esp
+    2cdd:	68 4c 5f 00 00       	push   $0x5f4c
+    2ce2:	e8 6c 24 00 00       	call   5153 <unlink>
+  if(open("lf1", 0) >= 0){
+    2ce7:	58                   	pop    %eax
+    2ce8:	5a                   	pop    %edx
+    2ce9:	6a 00                	push   $0x0
+    2ceb:	68 4c 5f 00 00       	push   $0x5f4c
+    2cf0:	e8 4e 24 00 00       	call   5143 <open>
+    2cf5:	83 c4 10             	add    $0x10,%esp
+    2cf8:	85 c0                	test   %eax,%eax
+    2cfa:	0f 89 27 01 00 00    	jns    2e27 <linktest+0x1d7>
+  fd = open("lf2", 0);
+    2d00:	83 ec 08             	sub    $0x8,%esp
+    2d03:	6a 00                	push   $0x0
+    2d05:	68 50 5f 00 00       	push   $0x5f50
+    2d0a:	e8 34 24 00 00       	call   5143 <open>
+  if(fd < 0){
+    2d0f:	83 c4 10             	add    $0x10,%esp
+  fd = open("lf2", 0);
+    2d12:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2d14:	85 c0                	test   %eax,%eax
+    2d16:	0f 88 f8 00 00 00    	js     2e14 <linktest+0x1c4>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    2d1c:	83 ec 04             	sub    $0x4,%esp
+    2d1f:	68 00 20 00 00       	push   $0x2000
+    2d24:	68 40 b7 00 00       	push   $0xb740
+    2d29:	50                   	push   %eax
+    2d2a:	e8 ec 23 00 00       	call   511b <read>
+    2d2f:	83 c4 10             	add    $0x10,%esp
+    2d32:	83 f8 05             	cmp    $0x5,%eax
+    2d35:	0f 85 c6 00 00 00    	jne    2e01 <linktest+0x1b1>
+  close(fd);
+    2d3b:	83 ec 0c             	sub    $0xc,%esp
+    2d3e:	53                   	push   %ebx
+    2d3f:	e8 e7 23 00 00       	call   512b <close>
+  if(link("lf2", "lf2") >= 0){
+    2d44:	58                   	pop    %eax
+    2d45:	5a                   	pop    %edx
+    2d46:	68 50 5f 00 00       	push   $0x5f50
+    2d4b:	68 50 5f 00 00       	push   $0x5f50
+    2d50:	e8 0e 24 00 00       	call   5163 <link>
+    2d55:	83 c4 10             	add    $0x10,%esp
+    2d58:	85 c0                	test   %eax,%eax
+    2d5a:	0f 89 8e 00 00 00    	jns    2dee <linktest+0x19e>
+  unlink("lf2");
+    2d60:	83 ec 0c             	sub    $0xc,%esp
+    2d63:	68 50 5f 00 00       	push   $0x5f50
+    2d68:	e8 e6 23 00 00       	call   5153 <unlink>
+  if(link("lf2", "lf1") >= 0){
+    2d6d:	59                   	pop    %ecx
+    2d6e:	5b                   	pop    %ebx
+    2d6f:	68 4c 5f 00 00       	push   $0x5f4c
+    2d74:	68 50 5f 00 00       	push   $0x5f50
+    2d79:	e8 e5 23 00 00       	call   5163 <link>
+    2d7e:	83 c4 10             	add    $0x10,%esp
+    2d81:	85 c0                	test   %eax,%eax
+    2d83:	79 56                	jns    2ddb <linktest+0x18b>
+  if(link(".", "lf1") >= 0){
+    2d85:	83 ec 08             	sub    $0x8,%esp
+    2d88:	68 4c 5f 00 00       	push   $0x5f4c
+    2d8d:	68 14 62 00 00       	push   $0x6214
+    2d92:	e8 cc 23 00 00       	call   5163 <link>
+    2d97:	83 c4 10             	add    $0x10,%esp
+    2d9a:	85 c0                	test   %eax,%eax
+    2d9c:	79 2a                	jns    2dc8 <linktest+0x178>
+  printf(1, "linktest ok\n");
+    2d9e:	83 ec 08             	sub    $0x8,%esp
+    2da1:	68 ea 5f 00 00       	push   $0x5fea
+    2da6:	6a 01                	push   $0x1
+    2da8:	e8 03 25 00 00       	call   52b0 <printf>
+}
+    2dad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2db0:	83 c4 10             	add    $0x10,%esp
+    2db3:	c9                   	leave
+    2db4:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    2db5:	50                   	push   %eax
+    2db6:	50                   	push   %eax
+    2db7:	68 54 5f 00 00       	push   $0x5f54
+    2dbc:	6a 01                	push   $0x1
+    2dbe:	e8 ed 24 00 00       	call   52b0 <printf>
+    exit();
+    2dc3:	e8 3b 23 00 00       	call   5103 <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    2dc8:	50                   	push   %eax
+    2dc9:	50                   	push   %eax
+    2dca:	68 ce 5f 00 00       	push   $0x5fce
+    2dcf:	6a 01                	push   $0x1
+    2dd1:	e8 da 24 00 00       	call   52b0 <printf>
+    exit();
+    2dd6:	e8 28 23 00 00       	call   5103 <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    2ddb:	52                   	push   %edx
+    2ddc:	52                   	push   %edx
+    2ddd:	68 9c 70 00 00       	push   $0x709c
+    2de2:	6a 01                	push   $0x1
+    2de4:	e8 c7 24 00 00       	call   52b0 <printf>
+    exit();
+    2de9:	e8 15 23 00 00       	call   5103 <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    2dee:	50                   	push   %eax
+    2def:	50                   	push   %eax
+    2df0:	68 b0 5f 00 00       	push   $0x5fb0
+    2df5:	6a 01                	push   $0x1
+    2df7:	e8 b4 24 00 00       	call   52b0 <printf>
+    exit();
+    2dfc:	e8 02 23 00 00       	call   5103 <exit>
+    printf(1, "read lf2 failed\n");
+    2e01:	51                   	push   %ecx
+    2e02:	51                   	push   %ecx
+    2e03:	68 9f 5f 00 00       	push   $0x5f9f
+    2e08:	6a 01                	push   $0x1
+    2e0a:	e8 a1 24 00 00       	call   52b0 <printf>
+    exit();
+    2e0f:	e8 ef 22 00 00       	call   5103 <exit>
+    printf(1, "open lf2 failed\n");
+    2e14:	53                   	push   %ebx
+    2e15:	53                   	push   %ebx
+    2e16:	68 8e 5f 00 00       	push   $0x5f8e
+    2e1b:	6a 01                	push   $0x1
+    2e1d:	e8 8e 24 00 00       	call   52b0 <printf>
+    exit();
+    2e22:	e8 dc 22 00 00       	call   5103 <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    2e27:	50                   	push   %eax
+    2e28:	50                   	push   %eax
+    2e29:	68 74 70 00 00       	push   $0x7074
+    2e2e:	6a 01                	push   $0x1
+    2e30:	e8 7b 24 00 00       	call   52b0 <printf>
+    exit();
+    2e35:	e8 c9 22 00 00       	call   5103 <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    2e3a:	51                   	push   %ecx
+    2e3b:	51                   	push   %ecx
+    2e3c:	68 79 5f 00 00       	push   $0x5f79
+    2e41:	6a 01                	push   $0x1
+    2e43:	e8 68 24 00 00       	call   52b0 <printf>
+    exit();
+    2e48:	e8 b6 22 00 00       	call   5103 <exit>
+    printf(1, "write lf1 failed\n");
+    2e4d:	50                   	push   %eax
+    2e4e:	50                   	push   %eax
+    2e4f:	68 67 5f 00 00       	push   $0x5f67
+    2e54:	6a 01                	push   $0x1
+    2e56:	e8 55 24 00 00       	call   52b0 <printf>
+    exit();
+    2e5b:	e8 a3 22 00 00       	call   5103 <exit>
+
+00002e60 <concreate>:
+{
+    2e60:	55                   	push   %ebp
+    2e61:	89 e5                	mov    %esp,%ebp
+    2e63:	57                   	push   %edi
+    2e64:	56                   	push   %esi
+  for(i = 0; i < 40; i++){
+    2e65:	31 f6                	xor    %esi,%esi
+{
+    2e67:	53                   	push   %ebx
+    2e68:	8d 5d ad             	lea    -0x53(%ebp),%ebx
+    2e6b:	83 ec 64             	sub    $0x64,%esp
+  printf(1, "concreate test\n");
+    2e6e:	68 f7 5f 00 00       	push   $0x5ff7
+    2e73:	6a 01                	push   $0x1
+    2e75:	e8 36 24 00 00       	call   52b0 <printf>
+  file[0] = 'C';
+    2e7a:	c6 45 ad 43          	movb   $0x43,-0x53(%ebp)
+  file[2] = '\0';
+    2e7e:	83 c4 10             	add    $0x10,%esp
+    2e81:	c6 45 af 00          	movb   $0x0,-0x51(%ebp)
+  for(i = 0; i < 40; i++){
+    2e85:	eb 4c                	jmp    2ed3 <concreate+0x73>
+    2e87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2e8e:	66 90                	xchg   %ax,%ax
+    2e90:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+    if(pid && (i % 3) == 1){
+    2e96:	3d ab aa aa aa       	cmp    $0xaaaaaaab,%eax
+    2e9b:	0f 83 8f 00 00 00    	jae    2f30 <concreate+0xd0>
+      fd = open(file, O_CREATE | O_RDWR);
+    2ea1:	83 ec 08             	sub    $0x8,%esp
+    2ea4:	68 02 02 00 00       	push   $0x202
+    2ea9:	53                   	push   %ebx
+    2eaa:	e8 94 22 00 00       	call   5143 <open>
+      if(fd < 0){
+    2eaf:	83 c4 10             	add    $0x10,%esp
+    2eb2:	85 c0                	test   %eax,%eax
+    2eb4:	78 63                	js     2f19 <concreate+0xb9>
+      close(fd);
+    2eb6:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 40; i++){
+    2eb9:	83 c6 01             	add    $0x1,%esi
+      close(fd);
+    2ebc:	50                   	push   %eax
+    2ebd:	e8 69 22 00 00       	call   512b <close>
+    2ec2:	83 c4 10             	add    $0x10,%esp
+      wait();
+    2ec5:	e8 41 22 00 00       	call   510b <wait>
+  for(i = 0; i < 40; i++){
+    2eca:	83 fe 28             	cmp    $0x28,%esi
+    2ecd:	0f 84 7f 00 00 00    	je     2f52 <concreate+0xf2>
+    unlink(file);
+    2ed3:	83 ec 0c             	sub    $0xc,%esp
+    file[1] = '0' + i;
+    2ed6:	8d 46 30             	lea    0x30(%esi),%eax
+    2ed9:	88 45 ae             	mov    %al,-0x52(%ebp)
+    unlink(file);
+    2edc:	53                   	push   %ebx
+    2edd:	e8 71 22 00 00       	call   5153 <unlink>
+    pid = fork();
+    2ee2:	e8 14 22 00 00       	call   50fb <fork>
+    if(pid && (i % 3) == 1){
+    2ee7:	83 c4 10             	add    $0x10,%esp
+    2eea:	85 c0                	test   %eax,%eax
+    2eec:	75 a2                	jne    2e90 <concreate+0x30>
+      link("C0", file);
+    2eee:	69 f6 cd cc cc cc    	imul   $0xcccccccd,%esi,%esi
+    } else if(pid == 0 && (i % 5) == 1){
+    2ef4:	81 fe cd cc cc cc    	cmp    $0xcccccccd,%esi
+    2efa:	0f 83 d0 00 00 00    	jae    2fd0 <concreate+0x170>
+      fd = open(file, O_CREATE | O_RDWR);
+    2f00:	83 ec 08             	sub    $0x8,%esp
+    2f03:	68 02 02 00 00       	push   $0x202
+    2f08:	53                   	push   %ebx
+    2f09:	e8 35 22 00 00       	call   5143 <open>
+      if(fd < 0){
+    2f0e:	83 c4 10             	add    $0x10,%esp
+    2f11:	85 c0                	test   %eax,%eax
+    2f13:	0f 89 ea 01 00 00    	jns    3103 <concreate+0x2a3>
+        printf(1, "concreate create %s failed\n", file);
+    2f19:	83 ec 04             	sub    $0x4,%esp
+    2f1c:	53                   	push   %ebx
+    2f1d:	68 0a 60 00 00       	push   $0x600a
+    2f22:	6a 01                	push   $0x1
+    2f24:	e8 87 23 00 00       	call   52b0 <printf>
+        exit();
+    2f29:	e8 d5 21 00 00       	call   5103 <exit>
+    2f2e:	66 90                	xchg   %ax,%ax
+      link("C0", file);
+    2f30:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < 40; i++){
+    2f33:	83 c6 01             	add    $0x1,%esi
+      link("C0", file);
+    2f36:	53                   	push   %ebx
+    2f37:	68 07 60 00 00       	push   $0x6007
+    2f3c:	e8 22 22 00 00       	call   5163 <link>
+    2f41:	83 c4 10             	add    $0x10,%esp
+      wait();
+    2f44:	e8 c2 21 00 00       	call   510b <wait>
+  for(i = 0; i < 40; i++){
+    2f49:	83 fe 28             	cmp    $0x28,%esi
+    2f4c:	0f 85 81 ff ff ff    	jne    2ed3 <concreate+0x73>
+  memset(fa, 0, sizeof(fa));
+    2f52:	83 ec 04             	sub    $0x4,%esp
+    2f55:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    2f58:	6a 28                	push   $0x28
+    2f5a:	6a 00                	push   $0x0
+    2f5c:	50                   	push   %eax
+    2f5d:	e8 1e 20 00 00       	call   4f80 <memset>
+  fd = open(".", 0);
+    2f62:	5e                   	pop    %esi
+    2f63:	5f                   	pop    %edi
+    2f64:	6a 00                	push   $0x0
+    2f66:	68 14 62 00 00       	push   $0x6214
+    2f6b:	8d 7d b0             	lea    -0x50(%ebp),%edi
+    2f6e:	e8 d0 21 00 00       	call   5143 <open>
+  n = 0;
+    2f73:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    2f7a:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    2f7d:	89 c6                	mov    %eax,%esi
+  while(read(fd, &de, sizeof(de)) > 0){
+    2f7f:	90                   	nop
+    2f80:	83 ec 04             	sub    $0x4,%esp
+    2f83:	6a 10                	push   $0x10
+    2f85:	57                   	push   %edi
+    2f86:	56                   	push   %esi
+    2f87:	e8 8f 21 00 00       	call   511b <read>
+    2f8c:	83 c4 10             	add    $0x10,%esp
+    2f8f:	85 c0                	test   %eax,%eax
+    2f91:	7e 5d                	jle    2ff0 <concreate+0x190>
+    if(de.inum == 0)
+    2f93:	66 83 7d b0 00       	cmpw   $0x0,-0x50(%ebp)
+    2f98:	74 e6                	je     2f80 <concreate+0x120>
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    2f9a:	80 7d b2 43          	cmpb   $0x43,-0x4e(%ebp)
+    2f9e:	75 e0                	jne    2f80 <concreate+0x120>
+    2fa0:	80 7d b4 00          	cmpb   $0x0,-0x4c(%ebp)
+    2fa4:	75 da                	jne    2f80 <concreate+0x120>
+      i = de.name[1] - '0';
+    2fa6:	0f be 45 b3          	movsbl -0x4d(%ebp),%eax
+    2faa:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    2fad:	83 f8 27             	cmp    $0x27,%eax
+    2fb0:	0f 87 5e 01 00 00    	ja     3114 <concreate+0x2b4>
+      if(fa[i]){
+    2fb6:	80 7c 05 c0 00       	cmpb   $0x0,-0x40(%ebp,%eax,1)
+    2fbb:	0f 85 7e 01 00 00    	jne    313f <concreate+0x2df>
+      n++;
+    2fc1:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+      fa[i] = 1;
+    2fc5:	c6 44 05 c0 01       	movb   $0x1,-0x40(%ebp,%eax,1)
+      n++;
+    2fca:	eb b4                	jmp    2f80 <concreate+0x120>
+    2fcc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      link("C0", file);
+    2fd0:	83 ec 08             	sub    $0x8,%esp
+    2fd3:	53                   	push   %ebx
+    2fd4:	68 07 60 00 00       	push   $0x6007
+    2fd9:	e8 85 21 00 00       	call   5163 <link>
+    2fde:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2fe1:	e8 1d 21 00 00       	call   5103 <exit>
+    2fe6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2fed:	8d 76 00             	lea    0x0(%esi),%esi
+  close(fd);
+    2ff0:	83 ec 0c             	sub    $0xc,%esp
+    2ff3:	56                   	push   %esi
+    2ff4:	e8 32 21 00 00       	call   512b <close>
+  if(n != 40){
+    2ff9:	83 c4 10             	add    $0x10,%esp
+    2ffc:	83 7d a4 28          	cmpl   $0x28,-0x5c(%ebp)
+    3000:	0f 85 26 01 00 00    	jne    312c <concreate+0x2cc>
+  for(i = 0; i < 40; i++){
+    3006:	31 f6                	xor    %esi,%esi
+    3008:	eb 48                	jmp    3052 <concreate+0x1f2>
+    300a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+       ((i % 3) == 1 && pid != 0)){
+    3010:	85 ff                	test   %edi,%edi
+    3012:	74 05                	je     3019 <concreate+0x1b9>
+    3014:	83 f8 01             	cmp    $0x1,%eax
+    3017:	74 68                	je     3081 <concreate+0x221>
+      unlink(file);
+    3019:	83 ec 0c             	sub    $0xc,%esp
+    301c:	53                   	push   %ebx
+    301d:	e8 31 21 00 00       	call   5153 <unlink>
+      unlink(file);
+    3022:	89 1c 24             	mov    %ebx,(%esp)
+    3025:	e8 29 21 00 00       	call   5153 <unlink>
+      unlink(file);
+    302a:	89 1c 24             	mov    %ebx,(%esp)
+    302d:	e8 21 21 00 00       	call   5153 <unlink>
+      unlink(file);
+    3032:	89 1c 24             	mov    %ebx,(%esp)
+    3035:	e8 19 21 00 00       	call   5153 <unlink>
+    303a:	83 c4 10             	add    $0x10,%esp
+    if(pid == 0)
+    303d:	85 ff                	test   %edi,%edi
+    303f:	74 a0                	je     2fe1 <concreate+0x181>
+      wait();
+    3041:	e8 c5 20 00 00       	call   510b <wait>
+  for(i = 0; i < 40; i++){
+    3046:	83 c6 01             	add    $0x1,%esi
+    3049:	83 fe 28             	cmp    $0x28,%esi
+    304c:	0f 84 86 00 00 00    	je     30d8 <concreate+0x278>
+    file[1] = '0' + i;
+    3052:	8d 46 30             	lea    0x30(%esi),%eax
+    3055:	88 45 ae             	mov    %al,-0x52(%ebp)
+    pid = fork();
+    3058:	e8 9e 20 00 00       	call   50fb <fork>
+    305d:	89 c7                	mov    %eax,%edi
+    if(pid < 0){
+    305f:	85 c0                	test   %eax,%eax
+    3061:	0f 88 88 00 00 00    	js     30ef <concreate+0x28f>
+    if(((i % 3) == 0 && pid == 0) ||
+    3067:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+    306c:	f7 e6                	mul    %esi
+    306e:	89 d0                	mov    %edx,%eax
+    3070:	83 e2 fe             	and    $0xfffffffe,%edx
+    3073:	d1 e8                	shr    %eax
+    3075:	01 c2                	add    %eax,%edx
+    3077:	89 f0                	mov    %esi,%eax
+    3079:	29 d0                	sub    %edx,%eax
+    307b:	89 c1                	mov    %eax,%ecx
+    307d:	09 f9                	or     %edi,%ecx
+    307f:	75 8f                	jne    3010 <concreate+0x1b0>
+      close(open(file, 0));
+    3081:	83 ec 08             	sub    $0x8,%esp
+    3084:	6a 00                	push   $0x0
+    3086:	53                   	push   %ebx
+    3087:	e8 b7 20 00 00       	call   5143 <open>
+    308c:	89 04 24             	mov    %eax,(%esp)
+    308f:	e8 97 20 00 00       	call   512b <close>
+      close(open(file, 0));
+    3094:	58                   	pop    %eax
+    3095:	5a                   	pop    %edx
+    3096:	6a 00                	push   $0x0
+    3098:	53                   	push   %ebx
+    3099:	e8 a5 20 00 00       	call   5143 <open>
+    309e:	89 04 24             	mov    %eax,(%esp)
+    30a1:	e8 85 20 00 00       	call   512b <close>
+      close(open(file, 0));
+    30a6:	59                   	pop    %ecx
+    30a7:	58                   	pop    %eax
+    30a8:	6a 00                	push   $0x0
+    30aa:	53                   	push   %ebx
+    30ab:	e8 93 20 00 00       	call   5143 <open>
+    30b0:	89 04 24             	mov    %eax,(%esp)
+    30b3:	e8 73 20 00 00       	call   512b <close>
+      close(open(file, 0));
+    30b8:	58                   	pop    %eax
+    30b9:	5a                   	pop    %edx
+    30ba:	6a 00                	push   $0x0
+    30bc:	53                   	push   %ebx
+    30bd:	e8 81 20 00 00       	call   5143 <open>
+    30c2:	89 04 24             	mov    %eax,(%esp)
+    30c5:	e8 61 20 00 00       	call   512b <close>
+    30ca:	83 c4 10             	add    $0x10,%esp
+    30cd:	e9 6b ff ff ff       	jmp    303d <concreate+0x1dd>
+    30d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  printf(1, "concreate ok\n");
+    30d8:	83 ec 08             	sub    $0x8,%esp
+    30db:	68 5c 60 00 00       	push   $0x605c
+    30e0:	6a 01                	push   $0x1
+    30e2:	e8 c9 21 00 00       	call   52b0 <printf>
+}
+    30e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    30ea:	5b                   	pop    %ebx
+    30eb:	5e                   	pop    %esi
+    30ec:	5f                   	pop    %edi
+    30ed:	5d                   	pop    %ebp
+    30ee:	c3                   	ret
+      printf(1, "fork failed\n");
+    30ef:	83 ec 08             	sub    $0x8,%esp
+    30f2:	68 c9 5c 00 00       	push   $0x5cc9
+    30f7:	6a 01                	push   $0x1
+    30f9:	e8 b2 21 00 00       	call   52b0 <printf>
+      exit();
+    30fe:	e8 00 20 00 00       	call   5103 <exit>
+      close(fd);
+    3103:	83 ec 0c             	sub    $0xc,%esp
+    3106:	50                   	push   %eax
+    3107:	e8 1f 20 00 00       	call   512b <close>
+    310c:	83 c4 10             	add    $0x10,%esp
+    310f:	e9 cd fe ff ff       	jmp    2fe1 <concreate+0x181>
+        printf(1, "concreate weird file %s\n", de.name);
+    3114:	83 ec 04             	sub    $0x4,%esp
+    3117:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    311a:	50                   	push   %eax
+    311b:	68 26 60 00 00       	push   $0x6026
+    3120:	6a 01                	push   $0x1
+    3122:	e8 89 21 00 00       	call   52b0 <printf>
+        exit();
+    3127:	e8 d7 1f 00 00       	call   5103 <exit>
+    printf(1, "concreate not enough files in directory listing\n");
+    312c:	51                   	push   %ecx
+    312d:	51                   	push   %ecx
+    312e:	68 c0 70 00 00       	push   $0x70c0
+    3133:	6a 01                	push   $0x1
+    3135:	e8 76 21 00 00       	call   52b0 <printf>
+    exit();
+    313a:	e8 c4 1f 00 00       	call   5103 <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    313f:	83 ec 04             	sub    $0x4,%esp
+    3142:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    3145:	50                   	push   %eax
+    3146:	68 3f 60 00 00       	push   $0x603f
+    314b:	6a 01                	push   $0x1
+    314d:	e8 5e 21 00 00       	call   52b0 <printf>
+        exit();
+    3152:	e8 ac 1f 00 00       	call   5103 <exit>
+    3157:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    315e:	66 90                	xchg   %ax,%ax
+
+00003160 <linkunlink>:
+{
+    3160:	55                   	push   %ebp
+    3161:	89 e5                	mov    %esp,%ebp
+    3163:	57                   	push   %edi
+    3164:	56                   	push   %esi
+    3165:	53                   	push   %ebx
+    3166:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "linkunlink test\n");
+    3169:	68 6a 60 00 00       	push   $0x606a
+    316e:	6a 01                	push   $0x1
+    3170:	e8 3b 21 00 00       	call   52b0 <printf>
+  unlink("x");
+    3175:	c7 04 24 f7 62 00 00 	movl   $0x62f7,(%esp)
+    317c:	e8 d2 1f 00 00       	call   5153 <unlink>
+  pid = fork();
+    3181:	e8 75 1f 00 00       	call   50fb <fork>
+  if(pid < 0){
+    3186:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    3189:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(pid < 0){
+    318c:	85 c0                	test   %eax,%eax
+    318e:	0f 88 b6 00 00 00    	js     324a <linkunlink+0xea>
+  unsigned int x = (pid ? 1 : 97);
+    3194:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+    3198:	bb 64 00 00 00       	mov    $0x64,%ebx
+    if((x % 3) == 0){
+    319d:	be ab aa aa aa       	mov    $0xaaaaaaab,%esi
+  unsigned int x = (pid ? 1 : 97);
+    31a2:	19 ff                	sbb    %edi,%edi
+    31a4:	83 e7 60             	and    $0x60,%edi
+    31a7:	83 c7 01             	add    $0x1,%edi
+    31aa:	eb 1e                	jmp    31ca <linkunlink+0x6a>
+    31ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    } else if((x % 3) == 1){
+    31b0:	83 f8 01             	cmp    $0x1,%eax
+    31b3:	74 7b                	je     3230 <linkunlink+0xd0>
+      unlink("x");
+    31b5:	83 ec 0c             	sub    $0xc,%esp
+    31b8:	68 f7 62 00 00       	push   $0x62f7
+    31bd:	e8 91 1f 00 00       	call   5153 <unlink>
+    31c2:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    31c5:	83 eb 01             	sub    $0x1,%ebx
+    31c8:	74 41                	je     320b <linkunlink+0xab>
+    x = x * 1103515245 + 12345;
+    31ca:	69 cf 6d 4e c6 41    	imul   $0x41c64e6d,%edi,%ecx
+    31d0:	8d b9 39 30 00 00    	lea    0x3039(%ecx),%edi
+    if((x % 3) == 0){
+    31d6:	89 f8                	mov    %edi,%eax
+    31d8:	f7 e6                	mul    %esi
+    31da:	89 d0                	mov    %edx,%eax
+    31dc:	83 e2 fe             	and    $0xfffffffe,%edx
+    31df:	d1 e8                	shr    %eax
+    31e1:	01 c2                	add    %eax,%edx
+    31e3:	89 f8                	mov    %edi,%eax
+    31e5:	29 d0                	sub    %edx,%eax
+    31e7:	75 c7                	jne    31b0 <linkunlink+0x50>
+      close(open("x", O_RDWR | O_CREATE));
+    31e9:	83 ec 08             	sub    $0x8,%esp
+    31ec:	68 02 02 00 00       	push   $0x202
+    31f1:	68 f7 62 00 00       	push   $0x62f7
+    31f6:	e8 48 1f 00 00       	call   5143 <open>
+    31fb:	89 04 24             	mov    %eax,(%esp)
+    31fe:	e8 28 1f 00 00       	call   512b <close>
+    3203:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    3206:	83 eb 01             	sub    $0x1,%ebx
+    3209:	75 bf                	jne    31ca <linkunlink+0x6a>
+  if(pid)
+    320b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    320e:	85 c0                	test   %eax,%eax
+    3210:	74 4b                	je     325d <linkunlink+0xfd>
+    wait();
+    3212:	e8 f4 1e 00 00       	call   510b <wait>
+  printf(1, "linkunlink ok\n");
+    3217:	83 ec 08             	sub    $0x8,%esp
+    321a:	68 7f 60 00 00       	push   $0x607f
+    321f:	6a 01                	push   $0x1
+    3221:	e8 8a 20 00 00       	call   52b0 <printf>
+}
+    3226:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3229:	5b                   	pop    %ebx
+    322a:	5e                   	pop    %esi
+    322b:	5f                   	pop    %edi
+    322c:	5d                   	pop    %ebp
+    322d:	c3                   	ret
+    322e:	66 90                	xchg   %ax,%ax
+      link("cat", "x");
+    3230:	83 ec 08             	sub    $0x8,%esp
+    3233:	68 f7 62 00 00       	push   $0x62f7
+    3238:	68 7b 60 00 00       	push   $0x607b
+    323d:	e8 21 1f 00 00       	call   5163 <link>
+    3242:	83 c4 10             	add    $0x10,%esp
+    3245:	e9 7b ff ff ff       	jmp    31c5 <linkunlink+0x65>
+    printf(1, "fork failed\n");
+    324a:	52                   	push   %edx
+    324b:	52                   	push   %edx
+    324c:	68 c9 5c 00 00       	push   $0x5cc9
+    3251:	6a 01                	push   $0x1
+    3253:	e8 58 20 00 00       	call   52b0 <printf>
+    exit();
+    3258:	e8 a6 1e 00 00       	call   5103 <exit>
+    exit();
+    325d:	e8 a1 1e 00 00       	call   5103 <exit>
+    3262:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3269:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003270 <bigdir>:
+{
+    3270:	55                   	push   %ebp
+    3271:	89 e5                	mov    %esp,%ebp
+    3273:	57                   	push   %edi
+    3274:	56                   	push   %esi
+    3275:	53                   	push   %ebx
+    3276:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "bigdir test\n");
+    3279:	68 8e 60 00 00       	push   $0x608e
+    327e:	6a 01                	push   $0x1
+    3280:	e8 2b 20 00 00       	call   52b0 <printf>
+  unlink("bd");
+    3285:	c7 04 24 9b 60 00 00 	movl   $0x609b,(%esp)
+    328c:	e8 c2 1e 00 00       	call   5153 <unlink>
+  fd = open("bd", O_CREATE);
+    3291:	5a                   	pop    %edx
+    3292:	59                   	pop    %ecx
+    3293:	68 00 02 00 00       	push   $0x200
+    3298:	68 9b 60 00 00       	push   $0x609b
+    329d:	e8 a1 1e 00 00       	call   5143 <open>
+  if(fd < 0){
+    32a2:	83 c4 10             	add    $0x10,%esp
+    32a5:	85 c0                	test   %eax,%eax
+    32a7:	0f 88 de 00 00 00    	js     338b <bigdir+0x11b>
+  close(fd);
+    32ad:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 500; i++){
+    32b0:	31 f6                	xor    %esi,%esi
+    32b2:	8d 7d de             	lea    -0x22(%ebp),%edi
+  close(fd);
+    32b5:	50                   	push   %eax
+    32b6:	e8 70 1e 00 00       	call   512b <close>
+    32bb:	83 c4 10             	add    $0x10,%esp
+    32be:	66 90                	xchg   %ax,%ax
+    name[1] = '0' + (i / 64);
+    32c0:	89 f0                	mov    %esi,%eax
+    if(link("bd", name) != 0){
+    32c2:	83 ec 08             	sub    $0x8,%esp
+    name[0] = 'x';
+    32c5:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    32c9:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    32cc:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    32d0:	83 c0 30             	add    $0x30,%eax
+    32d3:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    32d6:	89 f0                	mov    %esi,%eax
+    32d8:	83 e0 3f             	and    $0x3f,%eax
+    32db:	83 c0 30             	add    $0x30,%eax
+    32de:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(link("bd", name) != 0){
+    32e1:	57                   	push   %edi
+    32e2:	68 9b 60 00 00       	push   $0x609b
+    32e7:	e8 77 1e 00 00       	call   5163 <link>
+    32ec:	83 c4 10             	add    $0x10,%esp
+    32ef:	89 c3                	mov    %eax,%ebx
+    32f1:	85 c0                	test   %eax,%eax
+    32f3:	75 6e                	jne    3363 <bigdir+0xf3>
+  for(i = 0; i < 500; i++){
+    32f5:	83 c6 01             	add    $0x1,%esi
+    32f8:	81 fe f4 01 00 00    	cmp    $0x1f4,%esi
+    32fe:	75 c0                	jne    32c0 <bigdir+0x50>
+  unlink("bd");
+    3300:	83 ec 0c             	sub    $0xc,%esp
+    3303:	68 9b 60 00 00       	push   $0x609b
+    3308:	e8 46 1e 00 00       	call   5153 <unlink>
+    330d:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + (i / 64);
+    3310:	89 d8                	mov    %ebx,%eax
+    if(unlink(name) != 0){
+    3312:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'x';
+    3315:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    3319:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    331c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    3320:	83 c0 30             	add    $0x30,%eax
+    3323:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    3326:	89 d8                	mov    %ebx,%eax
+    3328:	83 e0 3f             	and    $0x3f,%eax
+    332b:	83 c0 30             	add    $0x30,%eax
+    332e:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(unlink(name) != 0){
+    3331:	57                   	push   %edi
+    3332:	e8 1c 1e 00 00       	call   5153 <unlink>
+    3337:	83 c4 10             	add    $0x10,%esp
+    333a:	85 c0                	test   %eax,%eax
+    333c:	75 39                	jne    3377 <bigdir+0x107>
+  for(i = 0; i < 500; i++){
+    333e:	83 c3 01             	add    $0x1,%ebx
+    3341:	81 fb f4 01 00 00    	cmp    $0x1f4,%ebx
+    3347:	75 c7                	jne    3310 <bigdir+0xa0>
+  printf(1, "bigdir ok\n");
+    3349:	83 ec 08             	sub    $0x8,%esp
+    334c:	68 dd 60 00 00       	push   $0x60dd
+    3351:	6a 01                	push   $0x1
+    3353:	e8 58 1f 00 00       	call   52b0 <printf>
+    3358:	83 c4 10             	add    $0x10,%esp
+}
+    335b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    335e:	5b                   	pop    %ebx
+    335f:	5e                   	pop    %esi
+    3360:	5f                   	pop    %edi
+    3361:	5d                   	pop    %ebp
+    3362:	c3                   	ret
+      printf(1, "bigdir link failed\n");
+    3363:	83 ec 08             	sub    $0x8,%esp
+    3366:	68 b4 60 00 00       	push   $0x60b4
+    336b:	6a 01                	push   $0x1
+    336d:	e8 3e 1f 00 00       	call   52b0 <printf>
+      exit();
+    3372:	e8 8c 1d 00 00       	call   5103 <exit>
+      printf(1, "bigdir unlink failed");
+    3377:	83 ec 08             	sub    $0x8,%esp
+    337a:	68 c8 60 00 00       	push   $0x60c8
+    337f:	6a 01                	push   $0x1
+    3381:	e8 2a 1f 00 00       	call   52b0 <printf>
+      exit();
+    3386:	e8 78 1d 00 00       	call   5103 <exit>
+    printf(1, "bigdir create failed\n");
+    338b:	50                   	push   %eax
+    338c:	50                   	push   %eax
+    338d:	68 9e 60 00 00       	push   $0x609e
+    3392:	6a 01                	push   $0x1
+    3394:	e8 17 1f 00 00       	call   52b0 <printf>
+    exit();
+    3399:	e8 65 1d 00 00       	call   5103 <exit>
+    339e:	66 90                	xchg   %ax,%ax
+
+000033a0 <subdir>:
+{
+    33a0:	55                   	push   %ebp
+    33a1:	89 e5                	mov    %esp,%ebp
+    33a3:	53                   	push   %ebx
+    33a4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "subdir test\n");
+    33a7:	68 e8 60 00 00       	push   $0x60e8
+    33ac:	6a 01                	push   $0x1
+    33ae:	e8 fd 1e 00 00       	call   52b0 <printf>
+  unlink("ff");
+    33b3:	c7 04 24 71 61 00 00 	movl   $0x6171,(%esp)
+    33ba:	e8 94 1d 00 00       	call   5153 <unlink>
+  if(mkdir("dd") != 0){
+    33bf:	c7 04 24 0e 62 00 00 	movl   $0x620e,(%esp)
+    33c6:	e8 a0 1d 00 00       	call   516b <mkdir>
+    33cb:	83 c4 10             	add    $0x10,%esp
+    33ce:	85 c0                	test   %eax,%eax
+    33d0:	0f 85 b3 05 00 00    	jne    3989 <subdir+0x5e9>
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    33d6:	83 ec 08             	sub    $0x8,%esp
+    33d9:	68 02 02 00 00       	push   $0x202
+    33de:	68 47 61 00 00       	push   $0x6147
+    33e3:	e8 5b 1d 00 00       	call   5143 <open>
+  if(fd < 0){
+    33e8:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    33eb:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    33ed:	85 c0                	test   %eax,%eax
+    33ef:	0f 88 81 05 00 00    	js     3976 <subdir+0x5d6>
+  write(fd, "ff", 2);
+    33f5:	83 ec 04             	sub    $0x4,%esp
+    33f8:	6a 02                	push   $0x2
+    33fa:	68 71 61 00 00       	push   $0x6171
+    33ff:	50                   	push   %eax
+    3400:	e8 1e 1d 00 00       	call   5123 <write>
+  close(fd);
+    3405:	89 1c 24             	mov    %ebx,(%esp)
+    3408:	e8 1e 1d 00 00       	call   512b <close>
+  if(unlink("dd") >= 0){
+    340d:	c7 04 24 0e 62 00 00 	movl   $0x620e,(%esp)
+    3414:	e8 3a 1d 00 00       	call   5153 <unlink>
+    3419:	83 c4 10             	add    $0x10,%esp
+    341c:	85 c0                	test   %eax,%eax
+    341e:	0f 89 3f 05 00 00    	jns    3963 <subdir+0x5c3>
+  if(mkdir("/dd/dd") != 0){
+    3424:	83 ec 0c             	sub    $0xc,%esp
+    3427:	68 22 61 00 00       	push   $0x6122
+    342c:	e8 3a 1d 00 00       	call   516b <mkdir>
+    3431:	83 c4 10             	add    $0x10,%esp
+    3434:	85 c0                	test   %eax,%eax
+    3436:	0f 85 14 05 00 00    	jne    3950 <subdir+0x5b0>
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    343c:	83 ec 08             	sub    $0x8,%esp
+    343f:	68 02 02 00 00       	push   $0x202
+    3444:	68 44 61 00 00       	push   $0x6144
+    3449:	e8 f5 1c 00 00       	call   5143 <open>
+  if(fd < 0){
+    344e:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    3451:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    3453:	85 c0                	test   %eax,%eax
+    3455:	0f 88 24 04 00 00    	js     387f <subdir+0x4df>
+  write(fd, "FF", 2);
+    345b:	83 ec 04             	sub    $0x4,%esp
+    345e:	6a 02                	push   $0x2
+    3460:	68 65 61 00 00       	push   $0x6165
+    3465:	50                   	push   %eax
+    3466:	e8 b8 1c 00 00       	call   5123 <write>
+  close(fd);
+    346b:	89 1c 24             	mov    %ebx,(%esp)
+    346e:	e8 b8 1c 00 00       	call   512b <close>
+  fd = open("dd/dd/../ff", 0);
+    3473:	58                   	pop    %eax
+    3474:	5a                   	pop    %edx
+    3475:	6a 00                	push   $0x0
+    3477:	68 68 61 00 00       	push   $0x6168
+    347c:	e8 c2 1c 00 00       	call   5143 <open>
+  if(fd < 0){
+    3481:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/../ff", 0);
+    3484:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    3486:	85 c0                	test   %eax,%eax
+    3488:	0f 88 de 03 00 00    	js     386c <subdir+0x4cc>
+  cc = read(fd, buf, sizeof(buf));
+    348e:	83 ec 04             	sub    $0x4,%esp
+    3491:	68 00 20 00 00       	push   $0x2000
+    3496:	68 40 b7 00 00       	push   $0xb740
+    349b:	50                   	push   %eax
+    349c:	e8 7a 1c 00 00       	call   511b <read>
+  if(cc != 2 || buf[0] != 'f'){
+    34a1:	83 c4 10             	add    $0x10,%esp
+    34a4:	83 f8 02             	cmp    $0x2,%eax
+    34a7:	0f 85 3a 03 00 00    	jne    37e7 <subdir+0x447>
+    34ad:	80 3d 40 b7 00 00 66 	cmpb   $0x66,0xb740
+    34b4:	0f 85 2d 03 00 00    	jne    37e7 <subdir+0x447>
+  close(fd);
+    34ba:	83 ec 0c             	sub    $0xc,%esp
+    34bd:	53                   	push   %ebx
+    34be:	e8 68 1c 00 00       	call   512b <close>
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    34c3:	59                   	pop    %ecx
+    34c4:	5b                   	pop    %ebx
+    34c5:	68 a8 61 00 00       	push   $0x61a8
+    34ca:	68 44 61 00 00       	push   $0x6144
+    34cf:	e8 8f 1c 00 00       	call   5163 <link>
+    34d4:	83 c4 10             	add    $0x10,%esp
+    34d7:	85 c0                	test   %eax,%eax
+    34d9:	0f 85 c6 03 00 00    	jne    38a5 <subdir+0x505>
+  if(unlink("dd/dd/ff") != 0){
+    34df:	83 ec 0c             	sub    $0xc,%esp
+    34e2:	68 44 61 00 00       	push   $0x6144
+    34e7:	e8 67 1c 00 00       	call   5153 <unlink>
+    34ec:	83 c4 10             	add    $0x10,%esp
+    34ef:	85 c0                	test   %eax,%eax
+    34f1:	0f 85 16 03 00 00    	jne    380d <subdir+0x46d>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    34f7:	83 ec 08             	sub    $0x8,%esp
+    34fa:	6a 00                	push   $0x0
+    34fc:	68 44 61 00 00       	push   $0x6144
+    3501:	e8 3d 1c 00 00       	call   5143 <open>
+    3506:	83 c4 10             	add    $0x10,%esp
+    3509:	85 c0                	test   %eax,%eax
+    350b:	0f 89 2c 04 00 00    	jns    393d <subdir+0x59d>
+  if(chdir("dd") != 0){
+    3511:	83 ec 0c             	sub    $0xc,%esp
+    3514:	68 0e 62 00 00       	push   $0x620e
+    3519:	e8 55 1c 00 00       	call   5173 <chdir>
+    351e:	83 c4 10             	add    $0x10,%esp
+    3521:	85 c0                	test   %eax,%eax
+    3523:	0f 85 01 04 00 00    	jne    392a <subdir+0x58a>
+  if(chdir("dd/../../dd") != 0){
+    3529:	83 ec 0c             	sub    $0xc,%esp
+    352c:	68 dc 61 00 00       	push   $0x61dc
+    3531:	e8 3d 1c 00 00       	call   5173 <chdir>
+    3536:	83 c4 10             	add    $0x10,%esp
+    3539:	85 c0                	test   %eax,%eax
+    353b:	0f 85 b9 02 00 00    	jne    37fa <subdir+0x45a>
+  if(chdir("dd/../../../dd") != 0){
+    3541:	83 ec 0c             	sub    $0xc,%esp
+    3544:	68 02 62 00 00       	push   $0x6202
+    3549:	e8 25 1c 00 00       	call   5173 <chdir>
+    354e:	83 c4 10             	add    $0x10,%esp
+    3551:	85 c0                	test   %eax,%eax
+    3553:	0f 85 a1 02 00 00    	jne    37fa <subdir+0x45a>
+  if(chdir("./..") != 0){
+    3559:	83 ec 0c             	sub    $0xc,%esp
+    355c:	68 11 62 00 00       	push   $0x6211
+    3561:	e8 0d 1c 00 00       	call   5173 <chdir>
+    3566:	83 c4 10             	add    $0x10,%esp
+    3569:	85 c0                	test   %eax,%eax
+    356b:	0f 85 21 03 00 00    	jne    3892 <subdir+0x4f2>
+  fd = open("dd/dd/ffff", 0);
+    3571:	83 ec 08             	sub    $0x8,%esp
+    3574:	6a 00                	push   $0x0
+    3576:	68 a8 61 00 00       	push   $0x61a8
+    357b:	e8 c3 1b 00 00       	call   5143 <open>
+  if(fd < 0){
+    3580:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ffff", 0);
+    3583:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    3585:	85 c0                	test   %eax,%eax
+    3587:	0f 88 e0 04 00 00    	js     3a6d <subdir+0x6cd>
+  if(read(fd, buf, sizeof(buf)) != 2){
+    358d:	83 ec 04             	sub    $0x4,%esp
+    3590:	68 00 20 00 00       	push   $0x2000
+    3595:	68 40 b7 00 00       	push   $0xb740
+    359a:	50                   	push   %eax
+    359b:	e8 7b 1b 00 00       	call   511b <read>
+    35a0:	83 c4 10             	add    $0x10,%esp
+    35a3:	83 f8 02             	cmp    $0x2,%eax
+    35a6:	0f 85 ae 04 00 00    	jne    3a5a <subdir+0x6ba>
+  close(fd);
+    35ac:	83 ec 0c             	sub    $0xc,%esp
+    35af:	53                   	push   %ebx
+    35b0:	e8 76 1b 00 00       	call   512b <close>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    35b5:	58                   	pop    %eax
+    35b6:	5a                   	pop    %edx
+    35b7:	6a 00                	push   $0x0
+    35b9:	68 44 61 00 00       	push   $0x6144
+    35be:	e8 80 1b 00 00       	call   5143 <open>
+    35c3:	83 c4 10             	add    $0x10,%esp
+    35c6:	85 c0                	test   %eax,%eax
+    35c8:	0f 89 65 02 00 00    	jns    3833 <subdir+0x493>
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    35ce:	83 ec 08             	sub    $0x8,%esp
+    35d1:	68 02 02 00 00       	push   $0x202
+    35d6:	68 5c 62 00 00       	push   $0x625c
+    35db:	e8 63 1b 00 00       	call   5143 <open>
+    35e0:	83 c4 10             	add    $0x10,%esp
+    35e3:	85 c0                	test   %eax,%eax
+    35e5:	0f 89 35 02 00 00    	jns    3820 <subdir+0x480>
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    35eb:	83 ec 08             	sub    $0x8,%esp
+    35ee:	68 02 02 00 00       	push   $0x202
+    35f3:	68 81 62 00 00       	push   $0x6281
+    35f8:	e8 46 1b 00 00       	call   5143 <open>
+    35fd:	83 c4 10             	add    $0x10,%esp
+    3600:	85 c0                	test   %eax,%eax
+    3602:	0f 89 0f 03 00 00    	jns    3917 <subdir+0x577>
+  if(open("dd", O_CREATE) >= 0){
+    3608:	83 ec 08             	sub    $0x8,%esp
+    360b:	68 00 02 00 00       	push   $0x200
+    3610:	68 0e 62 00 00       	push   $0x620e
+    3615:	e8 29 1b 00 00       	call   5143 <open>
+    361a:	83 c4 10             	add    $0x10,%esp
+    361d:	85 c0                	test   %eax,%eax
+    361f:	0f 89 df 02 00 00    	jns    3904 <subdir+0x564>
+  if(open("dd", O_RDWR) >= 0){
+    3625:	83 ec 08             	sub    $0x8,%esp
+    3628:	6a 02                	push   $0x2
+    362a:	68 0e 62 00 00       	push   $0x620e
+    362f:	e8 0f 1b 00 00       	call   5143 <open>
+    3634:	83 c4 10             	add    $0x10,%esp
+    3637:	85 c0                	test   %eax,%eax
+    3639:	0f 89 b2 02 00 00    	jns    38f1 <subdir+0x551>
+  if(open("dd", O_WRONLY) >= 0){
+    363f:	83 ec 08             	sub    $0x8,%esp
+    3642:	6a 01                	push   $0x1
+    3644:	68 0e 62 00 00       	push   $0x620e
+    3649:	e8 f5 1a 00 00       	call   5143 <open>
+    364e:	83 c4 10             	add    $0x10,%esp
+    3651:	85 c0                	test   %eax,%eax
+    3653:	0f 89 85 02 00 00    	jns    38de <subdir+0x53e>
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    3659:	83 ec 08             	sub    $0x8,%esp
+    365c:	68 f0 62 00 00       	push   $0x62f0
+    3661:	68 5c 62 00 00       	push   $0x625c
+    3666:	e8 f8 1a 00 00       	call   5163 <link>
+    366b:	83 c4 10             	add    $0x10,%esp
+    366e:	85 c0                	test   %eax,%eax
+    3670:	0f 84 55 02 00 00    	je     38cb <subdir+0x52b>
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    3676:	83 ec 08             	sub    $0x8,%esp
+    3679:	68 f0 62 00 00       	push   $0x62f0
+    367e:	68 81 62 00 00       	push   $0x6281
+    3683:	e8 db 1a 00 00       	call   5163 <link>
+    3688:	83 c4 10             	add    $0x10,%esp
+    368b:	85 c0                	test   %eax,%eax
+    368d:	0f 84 25 02 00 00    	je     38b8 <subdir+0x518>
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    3693:	83 ec 08             	sub    $0x8,%esp
+    3696:	68 a8 61 00 00       	push   $0x61a8
+    369b:	68 47 61 00 00       	push   $0x6147
+    36a0:	e8 be 1a 00 00       	call   5163 <link>
+    36a5:	83 c4 10             	add    $0x10,%esp
+    36a8:	85 c0                	test   %eax,%eax
+    36aa:	0f 84 a9 01 00 00    	je     3859 <subdir+0x4b9>
+  if(mkdir("dd/ff/ff") == 0){
+    36b0:	83 ec 0c             	sub    $0xc,%esp
+    36b3:	68 5c 62 00 00       	push   $0x625c
+    36b8:	e8 ae 1a 00 00       	call   516b <mkdir>
+    36bd:	83 c4 10             	add    $0x10,%esp
+    36c0:	85 c0                	test   %eax,%eax
+    36c2:	0f 84 7e 01 00 00    	je     3846 <subdir+0x4a6>
+  if(mkdir("dd/xx/ff") == 0){
+    36c8:	83 ec 0c             	sub    $0xc,%esp
+    36cb:	68 81 62 00 00       	push   $0x6281
+    36d0:	e8 96 1a 00 00       	call   516b <mkdir>
+    36d5:	83 c4 10             	add    $0x10,%esp
+    36d8:	85 c0                	test   %eax,%eax
+    36da:	0f 84 67 03 00 00    	je     3a47 <subdir+0x6a7>
+  if(mkdir("dd/dd/ffff") == 0){
+    36e0:	83 ec 0c             	sub    $0xc,%esp
+    36e3:	68 a8 61 00 00       	push   $0x61a8
+    36e8:	e8 7e 1a 00 00       	call   516b <mkdir>
+    36ed:	83 c4 10             	add    $0x10,%esp
+    36f0:	85 c0                	test   %eax,%eax
+    36f2:	0f 84 3c 03 00 00    	je     3a34 <subdir+0x694>
+  if(unlink("dd/xx/ff") == 0){
+    36f8:	83 ec 0c             	sub    $0xc,%esp
+    36fb:	68 81 62 00 00       	push   $0x6281
+    3700:	e8 4e 1a 00 00       	call   5153 <unlink>
+    3705:	83 c4 10             	add    $0x10,%esp
+    3708:	85 c0                	test   %eax,%eax
+    370a:	0f 84 11 03 00 00    	je     3a21 <subdir+0x681>
+  if(unlink("dd/ff/ff") == 0){
+    3710:	83 ec 0c             	sub    $0xc,%esp
+    3713:	68 5c 62 00 00       	push   $0x625c
+    3718:	e8 36 1a 00 00       	call   5153 <unlink>
+    371d:	83 c4 10             	add    $0x10,%esp
+    3720:	85 c0                	test   %eax,%eax
+    3722:	0f 84 e6 02 00 00    	je     3a0e <subdir+0x66e>
+  if(chdir("dd/ff") == 0){
+    3728:	83 ec 0c             	sub    $0xc,%esp
+    372b:	68 47 61 00 00       	push   $0x6147
+    3730:	e8 3e 1a 00 00       	call   5173 <chdir>
+    3735:	83 c4 10             	add    $0x10,%esp
+    3738:	85 c0                	test   %eax,%eax
+    373a:	0f 84 bb 02 00 00    	je     39fb <subdir+0x65b>
+  if(chdir("dd/xx") == 0){
+    3740:	83 ec 0c             	sub    $0xc,%esp
+    3743:	68 f3 62 00 00       	push   $0x62f3
+    3748:	e8 26 1a 00 00       	call   5173 <chdir>
+    374d:	83 c4 10             	add    $0x10,%esp
+    3750:	85 c0                	test   %eax,%eax
+    3752:	0f 84 90 02 00 00    	je     39e8 <subdir+0x648>
+  if(unlink("dd/dd/ffff") != 0){
+    3758:	83 ec 0c             	sub    $0xc,%esp
+    375b:	68 a8 61 00 00       	push   $0x61a8
+    3760:	e8 ee 19 00 00       	call   5153 <unlink>
+    3765:	83 c4 10             	add    $0x10,%esp
+    3768:	85 c0                	test   %eax,%eax
+    376a:	0f 85 9d 00 00 00    	jne    380d <subdir+0x46d>
+  if(unlink("dd/ff") != 0){
+    3770:	83 ec 0c             	sub    $0xc,%esp
+    3773:	68 47 61 00 00       	push   $0x6147
+    3778:	e8 d6 19 00 00       	call   5153 <unlink>
+    377d:	83 c4 10             	add    $0x10,%esp
+    3780:	85 c0                	test   %eax,%eax
+    3782:	0f 85 4d 02 00 00    	jne    39d5 <subdir+0x635>
+  if(unlink("dd") == 0){
+    3788:	83 ec 0c             	sub    $0xc,%esp
+    378b:	68 0e 62 00 00       	push   $0x620e
+    3790:	e8 be 19 00 00       	call   5153 <unlink>
+    3795:	83 c4 10             	add    $0x10,%esp
+    3798:	85 c0                	test   %eax,%eax
+    379a:	0f 84 22 02 00 00    	je     39c2 <subdir+0x622>
+  if(unlink("dd/dd") < 0){
+    37a0:	83 ec 0c             	sub    $0xc,%esp
+    37a3:	68 23 61 00 00       	push   $0x6123
+    37a8:	e8 a6 19 00 00       	call   5153 <unlink>
+    37ad:	83 c4 10             	add    $0x10,%esp
+    37b0:	85 c0                	test   %eax,%eax
+    37b2:	0f 88 f7 01 00 00    	js     39af <subdir+0x60f>
+  if(unlink("dd") < 0){
+    37b8:	83 ec 0c             	sub    $0xc,%esp
+    37bb:	68 0e 62 00 00       	push   $0x620e
+    37c0:	e8 8e 19 00 00       	call   5153 <unlink>
+    37c5:	83 c4 10             	add    $0x10,%esp
+    37c8:	85 c0                	test   %eax,%eax
+    37ca:	0f 88 cc 01 00 00    	js     399c <subdir+0x5fc>
+  printf(1, "subdir ok\n");
+    37d0:	83 ec 08             	sub    $0x8,%esp
+    37d3:	68 f0 63 00 00       	push   $0x63f0
+    37d8:	6a 01                	push   $0x1
+    37da:	e8 d1 1a 00 00       	call   52b0 <printf>
+}
+    37df:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    37e2:	83 c4 10             	add    $0x10,%esp
+    37e5:	c9                   	leave
+    37e6:	c3                   	ret
+    printf(1, "dd/dd/../ff wrong content\n");
+    37e7:	50                   	push   %eax
+    37e8:	50                   	push   %eax
+    37e9:	68 8d 61 00 00       	push   $0x618d
+    37ee:	6a 01                	push   $0x1
+    37f0:	e8 bb 1a 00 00       	call   52b0 <printf>
+    exit();
+    37f5:	e8 09 19 00 00       	call   5103 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    37fa:	50                   	push   %eax
+    37fb:	50                   	push   %eax
+    37fc:	68 e8 61 00 00       	push   $0x61e8
+    3801:	6a 01                	push   $0x1
+    3803:	e8 a8 1a 00 00       	call   52b0 <printf>
+    exit();
+    3808:	e8 f6 18 00 00       	call   5103 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    380d:	50                   	push   %eax
+    380e:	50                   	push   %eax
+    380f:	68 b3 61 00 00       	push   $0x61b3
+    3814:	6a 01                	push   $0x1
+    3816:	e8 95 1a 00 00       	call   52b0 <printf>
+    exit();
+    381b:	e8 e3 18 00 00       	call   5103 <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    3820:	51                   	push   %ecx
+    3821:	51                   	push   %ecx
+    3822:	68 65 62 00 00       	push   $0x6265
+    3827:	6a 01                	push   $0x1
+    3829:	e8 82 1a 00 00       	call   52b0 <printf>
+    exit();
+    382e:	e8 d0 18 00 00       	call   5103 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    3833:	53                   	push   %ebx
+    3834:	53                   	push   %ebx
+    3835:	68 64 71 00 00       	push   $0x7164
+    383a:	6a 01                	push   $0x1
+    383c:	e8 6f 1a 00 00       	call   52b0 <printf>
+    exit();
+    3841:	e8 bd 18 00 00       	call   5103 <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    3846:	51                   	push   %ecx
+    3847:	51                   	push   %ecx
+    3848:	68 f9 62 00 00       	push   $0x62f9
+    384d:	6a 01                	push   $0x1
+    384f:	e8 5c 1a 00 00       	call   52b0 <printf>
+    exit();
+    3854:	e8 aa 18 00 00       	call   5103 <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    3859:	53                   	push   %ebx
+    385a:	53                   	push   %ebx
+    385b:	68 d4 71 00 00       	push   $0x71d4
+    3860:	6a 01                	push   $0x1
+    3862:	e8 49 1a 00 00       	call   52b0 <printf>
+    exit();
+    3867:	e8 97 18 00 00       	call   5103 <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    386c:	50                   	push   %eax
+    386d:	50                   	push   %eax
+    386e:	68 74 61 00 00       	push   $0x6174
+    3873:	6a 01                	push   $0x1
+    3875:	e8 36 1a 00 00       	call   52b0 <printf>
+    exit();
+    387a:	e8 84 18 00 00       	call   5103 <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    387f:	51                   	push   %ecx
+    3880:	51                   	push   %ecx
+    3881:	68 4d 61 00 00       	push   $0x614d
+    3886:	6a 01                	push   $0x1
+    3888:	e8 23 1a 00 00       	call   52b0 <printf>
+    exit();
+    388d:	e8 71 18 00 00       	call   5103 <exit>
+    printf(1, "chdir ./.. failed\n");
+    3892:	50                   	push   %eax
+    3893:	50                   	push   %eax
+    3894:	68 16 62 00 00       	push   $0x6216
+    3899:	6a 01                	push   $0x1
+    389b:	e8 10 1a 00 00       	call   52b0 <printf>
+    exit();
+    38a0:	e8 5e 18 00 00       	call   5103 <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    38a5:	52                   	push   %edx
+    38a6:	52                   	push   %edx
+    38a7:	68 1c 71 00 00       	push   $0x711c
+    38ac:	6a 01                	push   $0x1
+    38ae:	e8 fd 19 00 00       	call   52b0 <printf>
+    exit();
+    38b3:	e8 4b 18 00 00       	call   5103 <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    38b8:	50                   	push   %eax
+    38b9:	50                   	push   %eax
+    38ba:	68 b0 71 00 00       	push   $0x71b0
+    38bf:	6a 01                	push   $0x1
+    38c1:	e8 ea 19 00 00       	call   52b0 <printf>
+    exit();
+    38c6:	e8 38 18 00 00       	call   5103 <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    38cb:	50                   	push   %eax
+    38cc:	50                   	push   %eax
+    38cd:	68 8c 71 00 00       	push   $0x718c
+    38d2:	6a 01                	push   $0x1
+    38d4:	e8 d7 19 00 00       	call   52b0 <printf>
+    exit();
+    38d9:	e8 25 18 00 00       	call   5103 <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    38de:	50                   	push   %eax
+    38df:	50                   	push   %eax
+    38e0:	68 d5 62 00 00       	push   $0x62d5
+    38e5:	6a 01                	push   $0x1
+    38e7:	e8 c4 19 00 00       	call   52b0 <printf>
+    exit();
+    38ec:	e8 12 18 00 00       	call   5103 <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    38f1:	50                   	push   %eax
+    38f2:	50                   	push   %eax
+    38f3:	68 bc 62 00 00       	push   $0x62bc
+    38f8:	6a 01                	push   $0x1
+    38fa:	e8 b1 19 00 00       	call   52b0 <printf>
+    exit();
+    38ff:	e8 ff 17 00 00       	call   5103 <exit>
+    printf(1, "create dd succeeded!\n");
+    3904:	50                   	push   %eax
+    3905:	50                   	push   %eax
+    3906:	68 a6 62 00 00       	push   $0x62a6
+    390b:	6a 01                	push   $0x1
+    390d:	e8 9e 19 00 00       	call   52b0 <printf>
+    exit();
+    3912:	e8 ec 17 00 00       	call   5103 <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    3917:	52                   	push   %edx
+    3918:	52                   	push   %edx
+    3919:	68 8a 62 00 00       	push   $0x628a
+    391e:	6a 01                	push   $0x1
+    3920:	e8 8b 19 00 00       	call   52b0 <printf>
+    exit();
+    3925:	e8 d9 17 00 00       	call   5103 <exit>
+    printf(1, "chdir dd failed\n");
+    392a:	50                   	push   %eax
+    392b:	50                   	push   %eax
+    392c:	68 cb 61 00 00       	push   $0x61cb
+    3931:	6a 01                	push   $0x1
+    3933:	e8 78 19 00 00       	call   52b0 <printf>
+    exit();
+    3938:	e8 c6 17 00 00       	call   5103 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    393d:	50                   	push   %eax
+    393e:	50                   	push   %eax
+    393f:	68 40 71 00 00       	push   $0x7140
+    3944:	6a 01                	push   $0x1
+    3946:	e8 65 19 00 00       	call   52b0 <printf>
+    exit();
+    394b:	e8 b3 17 00 00       	call   5103 <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    3950:	53                   	push   %ebx
+    3951:	53                   	push   %ebx
+    3952:	68 29 61 00 00       	push   $0x6129
+    3957:	6a 01                	push   $0x1
+    3959:	e8 52 19 00 00       	call   52b0 <printf>
+    exit();
+    395e:	e8 a0 17 00 00       	call   5103 <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    3963:	50                   	push   %eax
+    3964:	50                   	push   %eax
+    3965:	68 f4 70 00 00       	push   $0x70f4
+    396a:	6a 01                	push   $0x1
+    396c:	e8 3f 19 00 00       	call   52b0 <printf>
+    exit();
+    3971:	e8 8d 17 00 00       	call   5103 <exit>
+    printf(1, "create dd/ff failed\n");
+    3976:	50                   	push   %eax
+    3977:	50                   	push   %eax
+    3978:	68 0d 61 00 00       	push   $0x610d
+    397d:	6a 01                	push   $0x1
+    397f:	e8 2c 19 00 00       	call   52b0 <printf>
+    exit();
+    3984:	e8 7a 17 00 00       	call   5103 <exit>
+    printf(1, "subdir mkdir dd failed\n");
+    3989:	50                   	push   %eax
+    398a:	50                   	push   %eax
+    398b:	68 f5 60 00 00       	push   $0x60f5
+    3990:	6a 01                	push   $0x1
+    3992:	e8 19 19 00 00       	call   52b0 <printf>
+    exit();
+    3997:	e8 67 17 00 00       	call   5103 <exit>
+    printf(1, "unlink dd failed\n");
+    399c:	50                   	push   %eax
+    399d:	50                   	push   %eax
+    399e:	68 de 63 00 00       	push   $0x63de
+    39a3:	6a 01                	push   $0x1
+    39a5:	e8 06 19 00 00       	call   52b0 <printf>
+    exit();
+    39aa:	e8 54 17 00 00       	call   5103 <exit>
+    printf(1, "unlink dd/dd failed\n");
+    39af:	52                   	push   %edx
+    39b0:	52                   	push   %edx
+    39b1:	68 c9 63 00 00       	push   $0x63c9
+    39b6:	6a 01                	push   $0x1
+    39b8:	e8 f3 18 00 00       	call   52b0 <printf>
+    exit();
+    39bd:	e8 41 17 00 00       	call   5103 <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    39c2:	51                   	push   %ecx
+    39c3:	51                   	push   %ecx
+    39c4:	68 f8 71 00 00       	push   $0x71f8
+    39c9:	6a 01                	push   $0x1
+    39cb:	e8 e0 18 00 00       	call   52b0 <printf>
+    exit();
+    39d0:	e8 2e 17 00 00       	call   5103 <exit>
+    printf(1, "unlink dd/ff failed\n");
+    39d5:	53                   	push   %ebx
+    39d6:	53                   	push   %ebx
+    39d7:	68 b4 63 00 00       	push   $0x63b4
+    39dc:	6a 01                	push   $0x1
+    39de:	e8 cd 18 00 00       	call   52b0 <printf>
+    exit();
+    39e3:	e8 1b 17 00 00       	call   5103 <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    39e8:	50                   	push   %eax
+    39e9:	50                   	push   %eax
+    39ea:	68 9c 63 00 00       	push   $0x639c
+    39ef:	6a 01                	push   $0x1
+    39f1:	e8 ba 18 00 00       	call   52b0 <printf>
+    exit();
+    39f6:	e8 08 17 00 00       	call   5103 <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    39fb:	50                   	push   %eax
+    39fc:	50                   	push   %eax
+    39fd:	68 84 63 00 00       	push   $0x6384
+    3a02:	6a 01                	push   $0x1
+    3a04:	e8 a7 18 00 00       	call   52b0 <printf>
+    exit();
+    3a09:	e8 f5 16 00 00       	call   5103 <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    3a0e:	50                   	push   %eax
+    3a0f:	50                   	push   %eax
+    3a10:	68 68 63 00 00       	push   $0x6368
+    3a15:	6a 01                	push   $0x1
+    3a17:	e8 94 18 00 00       	call   52b0 <printf>
+    exit();
+    3a1c:	e8 e2 16 00 00       	call   5103 <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    3a21:	50                   	push   %eax
+    3a22:	50                   	push   %eax
+    3a23:	68 4c 63 00 00       	push   $0x634c
+    3a28:	6a 01                	push   $0x1
+    3a2a:	e8 81 18 00 00       	call   52b0 <printf>
+    exit();
+    3a2f:	e8 cf 16 00 00       	call   5103 <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    3a34:	50                   	push   %eax
+    3a35:	50                   	push   %eax
+    3a36:	68 2f 63 00 00       	push   $0x632f
+    3a3b:	6a 01                	push   $0x1
+    3a3d:	e8 6e 18 00 00       	call   52b0 <printf>
+    exit();
+    3a42:	e8 bc 16 00 00       	call   5103 <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    3a47:	52                   	push   %edx
+    3a48:	52                   	push   %edx
+    3a49:	68 14 63 00 00       	push   $0x6314
+    3a4e:	6a 01                	push   $0x1
+    3a50:	e8 5b 18 00 00       	call   52b0 <printf>
+    exit();
+    3a55:	e8 a9 16 00 00       	call   5103 <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    3a5a:	51                   	push   %ecx
+    3a5b:	51                   	push   %ecx
+    3a5c:	68 41 62 00 00       	push   $0x6241
+    3a61:	6a 01                	push   $0x1
+    3a63:	e8 48 18 00 00       	call   52b0 <printf>
+    exit();
+    3a68:	e8 96 16 00 00       	call   5103 <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    3a6d:	53                   	push   %ebx
+    3a6e:	53                   	push   %ebx
+    3a6f:	68 29 62 00 00       	push   $0x6229
+    3a74:	6a 01                	push   $0x1
+    3a76:	e8 35 18 00 00       	call   52b0 <printf>
+    exit();
+    3a7b:	e8 83 16 00 00       	call   5103 <exit>
+
+00003a80 <bigwrite>:
+{
+    3a80:	55                   	push   %ebp
+    3a81:	89 e5                	mov    %esp,%ebp
+    3a83:	56                   	push   %esi
+    3a84:	53                   	push   %ebx
+  for(sz = 499; sz < 12*512; sz += 471){
+    3a85:	bb f3 01 00 00       	mov    $0x1f3,%ebx
+  printf(1, "bigwrite test\n");
+    3a8a:	83 ec 08             	sub    $0x8,%esp
+    3a8d:	68 fb 63 00 00       	push   $0x63fb
+    3a92:	6a 01                	push   $0x1
+    3a94:	e8 17 18 00 00       	call   52b0 <printf>
+  unlink("bigwrite");
+    3a99:	c7 04 24 0a 64 00 00 	movl   $0x640a,(%esp)
+    3aa0:	e8 ae 16 00 00       	call   5153 <unlink>
+    3aa5:	83 c4 10             	add    $0x10,%esp
+    3aa8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3aaf:	90                   	nop
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    3ab0:	83 ec 08             	sub    $0x8,%esp
+    3ab3:	68 02 02 00 00       	push   $0x202
+    3ab8:	68 0a 64 00 00       	push   $0x640a
+    3abd:	e8 81 16 00 00       	call   5143 <open>
+    if(fd < 0){
+    3ac2:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    3ac5:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    3ac7:	85 c0                	test   %eax,%eax
+    3ac9:	78 7e                	js     3b49 <bigwrite+0xc9>
+      int cc = write(fd, buf, sz);
+    3acb:	83 ec 04             	sub    $0x4,%esp
+    3ace:	53                   	push   %ebx
+    3acf:	68 40 b7 00 00       	push   $0xb740
+    3ad4:	50                   	push   %eax
+    3ad5:	e8 49 16 00 00       	call   5123 <write>
+      if(cc != sz){
+    3ada:	83 c4 10             	add    $0x10,%esp
+    3add:	39 d8                	cmp    %ebx,%eax
+    3adf:	75 55                	jne    3b36 <bigwrite+0xb6>
+      int cc = write(fd, buf, sz);
+    3ae1:	83 ec 04             	sub    $0x4,%esp
+    3ae4:	53                   	push   %ebx
+    3ae5:	68 40 b7 00 00       	push   $0xb740
+    3aea:	56                   	push   %esi
+    3aeb:	e8 33 16 00 00       	call   5123 <write>
+      if(cc != sz){
+    3af0:	83 c4 10             	add    $0x10,%esp
+    3af3:	39 c3                	cmp    %eax,%ebx
+    3af5:	75 3f                	jne    3b36 <bigwrite+0xb6>
+    close(fd);
+    3af7:	83 ec 0c             	sub    $0xc,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    3afa:	81 c3 d7 01 00 00    	add    $0x1d7,%ebx
+    close(fd);
+    3b00:	56                   	push   %esi
+    3b01:	e8 25 16 00 00       	call   512b <close>
+    unlink("bigwrite");
+    3b06:	c7 04 24 0a 64 00 00 	movl   $0x640a,(%esp)
+    3b0d:	e8 41 16 00 00       	call   5153 <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    3b12:	83 c4 10             	add    $0x10,%esp
+    3b15:	81 fb 07 18 00 00    	cmp    $0x1807,%ebx
+    3b1b:	75 93                	jne    3ab0 <bigwrite+0x30>
+  printf(1, "bigwrite ok\n");
+    3b1d:	83 ec 08             	sub    $0x8,%esp
+    3b20:	68 3d 64 00 00       	push   $0x643d
+    3b25:	6a 01                	push   $0x1
+    3b27:	e8 84 17 00 00       	call   52b0 <printf>
+}
+    3b2c:	83 c4 10             	add    $0x10,%esp
+    3b2f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3b32:	5b                   	pop    %ebx
+    3b33:	5e                   	pop    %esi
+    3b34:	5d                   	pop    %ebp
+    3b35:	c3                   	ret
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    3b36:	50                   	push   %eax
+    3b37:	53                   	push   %ebx
+    3b38:	68 2b 64 00 00       	push   $0x642b
+    3b3d:	6a 01                	push   $0x1
+    3b3f:	e8 6c 17 00 00       	call   52b0 <printf>
+        exit();
+    3b44:	e8 ba 15 00 00       	call   5103 <exit>
+      printf(1, "cannot create bigwrite\n");
+    3b49:	83 ec 08             	sub    $0x8,%esp
+    3b4c:	68 13 64 00 00       	push   $0x6413
+    3b51:	6a 01                	push   $0x1
+    3b53:	e8 58 17 00 00       	call   52b0 <printf>
+      exit();
+    3b58:	e8 a6 15 00 00       	call   5103 <exit>
+    3b5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003b60 <bigfile>:
+{
+    3b60:	55                   	push   %ebp
+    3b61:	89 e5                	mov    %esp,%ebp
+    3b63:	57                   	push   %edi
+    3b64:	56                   	push   %esi
+    3b65:	53                   	push   %ebx
+    3b66:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "bigfile test\n");
+    3b69:	68 4a 64 00 00       	push   $0x644a
+    3b6e:	6a 01                	push   $0x1
+    3b70:	e8 3b 17 00 00       	call   52b0 <printf>
+  unlink("bigfile");
+    3b75:	c7 04 24 66 64 00 00 	movl   $0x6466,(%esp)
+    3b7c:	e8 d2 15 00 00       	call   5153 <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    3b81:	58                   	pop    %eax
+    3b82:	5a                   	pop    %edx
+    3b83:	68 02 02 00 00       	push   $0x202
+    3b88:	68 66 64 00 00       	push   $0x6466
+    3b8d:	e8 b1 15 00 00       	call   5143 <open>
+  if(fd < 0){
+    3b92:	83 c4 10             	add    $0x10,%esp
+    3b95:	85 c0                	test   %eax,%eax
+    3b97:	0f 88 5e 01 00 00    	js     3cfb <bigfile+0x19b>
+    3b9d:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20; i++){
+    3b9f:	31 db                	xor    %ebx,%ebx
+    3ba1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    memset(buf, i, 600);
+    3ba8:	83 ec 04             	sub    $0x4,%esp
+    3bab:	68 58 02 00 00       	push   $0x258
+    3bb0:	53                   	push   %ebx
+    3bb1:	68 40 b7 00 00       	push   $0xb740
+    3bb6:	e8 c5 13 00 00       	call   4f80 <memset>
+    if(write(fd, buf, 600) != 600){
+    3bbb:	83 c4 0c             	add    $0xc,%esp
+    3bbe:	68 58 02 00 00       	push   $0x258
+    3bc3:	68 40 b7 00 00       	push   $0xb740
+    3bc8:	56                   	push   %esi
+    3bc9:	e8 55 15 00 00       	call   5123 <write>
+    3bce:	83 c4 10             	add    $0x10,%esp
+    3bd1:	3d 58 02 00 00       	cmp    $0x258,%eax
+    3bd6:	0f 85 f8 00 00 00    	jne    3cd4 <bigfile+0x174>
+  for(i = 0; i < 20; i++){
+    3bdc:	83 c3 01             	add    $0x1,%ebx
+    3bdf:	83 fb 14             	cmp    $0x14,%ebx
+    3be2:	75 c4                	jne    3ba8 <bigfile+0x48>
+  close(fd);
+    3be4:	83 ec 0c             	sub    $0xc,%esp
+    3be7:	56                   	push   %esi
+    3be8:	e8 3e 15 00 00       	call   512b <close>
+  fd = open("bigfile", 0);
+    3bed:	5e                   	pop    %esi
+    3bee:	5f                   	pop    %edi
+    3bef:	6a 00                	push   $0x0
+    3bf1:	68 66 64 00 00       	push   $0x6466
+    3bf6:	e8 48 15 00 00       	call   5143 <open>
+  if(fd < 0){
+    3bfb:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", 0);
+    3bfe:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+    3c00:	85 c0                	test   %eax,%eax
+    3c02:	0f 88 e0 00 00 00    	js     3ce8 <bigfile+0x188>
+  total = 0;
+    3c08:	31 db                	xor    %ebx,%ebx
+  for(i = 0; ; i++){
+    3c0a:	31 ff                	xor    %edi,%edi
+    3c0c:	eb 30                	jmp    3c3e <bigfile+0xde>
+    3c0e:	66 90                	xchg   %ax,%ax
+    if(cc != 300){
+    3c10:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    3c15:	0f 85 91 00 00 00    	jne    3cac <bigfile+0x14c>
+    if(buf[0] != i/2 || buf[299] != i/2){
+    3c1b:	89 fa                	mov    %edi,%edx
+    3c1d:	0f be 05 40 b7 00 00 	movsbl 0xb740,%eax
+    3c24:	d1 fa                	sar    %edx
+    3c26:	39 d0                	cmp    %edx,%eax
+    3c28:	75 6e                	jne    3c98 <bigfile+0x138>
+    3c2a:	0f be 15 6b b8 00 00 	movsbl 0xb86b,%edx
+    3c31:	39 d0                	cmp    %edx,%eax
+    3c33:	75 63                	jne    3c98 <bigfile+0x138>
+    total += cc;
+    3c35:	81 c3 2c 01 00 00    	add    $0x12c,%ebx
+  for(i = 0; ; i++){
+    3c3b:	83 c7 01             	add    $0x1,%edi
+    cc = read(fd, buf, 300);
+    3c3e:	83 ec 04             	sub    $0x4,%esp
+    3c41:	68 2c 01 00 00       	push   $0x12c
+    3c46:	68 40 b7 00 00       	push   $0xb740
+    3c4b:	56                   	push   %esi
+    3c4c:	e8 ca 14 00 00       	call   511b <read>
+    if(cc < 0){
+    3c51:	83 c4 10             	add    $0x10,%esp
+    3c54:	85 c0                	test   %eax,%eax
+    3c56:	78 68                	js     3cc0 <bigfile+0x160>
+    if(cc == 0)
+    3c58:	75 b6                	jne    3c10 <bigfile+0xb0>
+  close(fd);
+    3c5a:	83 ec 0c             	sub    $0xc,%esp
+    3c5d:	56                   	push   %esi
+    3c5e:	e8 c8 14 00 00       	call   512b <close>
+  if(total != 20*600){
+    3c63:	83 c4 10             	add    $0x10,%esp
+    3c66:	81 fb e0 2e 00 00    	cmp    $0x2ee0,%ebx
+    3c6c:	0f 85 9c 00 00 00    	jne    3d0e <bigfile+0x1ae>
+  unlink("bigfile");
+    3c72:	83 ec 0c             	sub    $0xc,%esp
+    3c75:	68 66 64 00 00       	push   $0x6466
+    3c7a:	e8 d4 14 00 00       	call   5153 <unlink>
+  printf(1, "bigfile test ok\n");
+    3c7f:	58                   	pop    %eax
+    3c80:	5a                   	pop    %edx
+    3c81:	68 f5 64 00 00       	push   $0x64f5
+    3c86:	6a 01                	push   $0x1
+    3c88:	e8 23 16 00 00       	call   52b0 <printf>
+}
+    3c8d:	83 c4 10             	add    $0x10,%esp
+    3c90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3c93:	5b                   	pop    %ebx
+    3c94:	5e                   	pop    %esi
+    3c95:	5f                   	pop    %edi
+    3c96:	5d                   	pop    %ebp
+    3c97:	c3                   	ret
+      printf(1, "read bigfile wrong data\n");
+    3c98:	83 ec 08             	sub    $0x8,%esp
+    3c9b:	68 c2 64 00 00       	push   $0x64c2
+    3ca0:	6a 01                	push   $0x1
+    3ca2:	e8 09 16 00 00       	call   52b0 <printf>
+      exit();
+    3ca7:	e8 57 14 00 00       	call   5103 <exit>
+      printf(1, "short read bigfile\n");
+    3cac:	83 ec 08             	sub    $0x8,%esp
+    3caf:	68 ae 64 00 00       	push   $0x64ae
+    3cb4:	6a 01                	push   $0x1
+    3cb6:	e8 f5 15 00 00       	call   52b0 <printf>
+      exit();
+    3cbb:	e8 43 14 00 00       	call   5103 <exit>
+      printf(1, "read bigfile failed\n");
+    3cc0:	83 ec 08             	sub    $0x8,%esp
+    3cc3:	68 99 64 00 00       	push   $0x6499
+    3cc8:	6a 01                	push   $0x1
+    3cca:	e8 e1 15 00 00       	call   52b0 <printf>
+      exit();
+    3ccf:	e8 2f 14 00 00       	call   5103 <exit>
+      printf(1, "write bigfile failed\n");
+    3cd4:	83 ec 08             	sub    $0x8,%esp
+    3cd7:	68 6e 64 00 00       	push   $0x646e
+    3cdc:	6a 01                	push   $0x1
+    3cde:	e8 cd 15 00 00       	call   52b0 <printf>
+      exit();
+    3ce3:	e8 1b 14 00 00       	call   5103 <exit>
+    printf(1, "cannot open bigfile\n");
+    3ce8:	53                   	push   %ebx
+    3ce9:	53                   	push   %ebx
+    3cea:	68 84 64 00 00       	push   $0x6484
+    3cef:	6a 01                	push   $0x1
+    3cf1:	e8 ba 15 00 00       	call   52b0 <printf>
+    exit();
+    3cf6:	e8 08 14 00 00       	call   5103 <exit>
+    printf(1, "cannot create bigfile");
+    3cfb:	50                   	push   %eax
+    3cfc:	50                   	push   %eax
+    3cfd:	68 58 64 00 00       	push   $0x6458
+    3d02:	6a 01                	push   $0x1
+    3d04:	e8 a7 15 00 00       	call   52b0 <printf>
+    exit();
+    3d09:	e8 f5 13 00 00       	call   5103 <exit>
+    printf(1, "read bigfile wrong total\n");
+    3d0e:	51                   	push   %ecx
+    3d0f:	51                   	push   %ecx
+    3d10:	68 db 64 00 00       	push   $0x64db
+    3d15:	6a 01                	push   $0x1
+    3d17:	e8 94 15 00 00       	call   52b0 <printf>
+    exit();
+    3d1c:	e8 e2 13 00 00       	call   5103 <exit>
+    3d21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3d28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3d2f:	90                   	nop
+
+00003d30 <fourteen>:
+{
+    3d30:	55                   	push   %ebp
+    3d31:	89 e5                	mov    %esp,%ebp
+    3d33:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "fourteen test\n");
+    3d36:	68 06 65 00 00       	push   $0x6506
+    3d3b:	6a 01                	push   $0x1
+    3d3d:	e8 6e 15 00 00       	call   52b0 <printf>
+  if(mkdir("12345678901234") != 0){
+    3d42:	c7 04 24 41 65 00 00 	movl   $0x6541,(%esp)
+    3d49:	e8 1d 14 00 00       	call   516b <mkdir>
+    3d4e:	83 c4 10             	add    $0x10,%esp
+    3d51:	85 c0                	test   %eax,%eax
+    3d53:	0f 85 97 00 00 00    	jne    3df0 <fourteen+0xc0>
+  if(mkdir("12345678901234/123456789012345") != 0){
+    3d59:	83 ec 0c             	sub    $0xc,%esp
+    3d5c:	68 18 72 00 00       	push   $0x7218
+    3d61:	e8 05 14 00 00       	call   516b <mkdir>
+    3d66:	83 c4 10             	add    $0x10,%esp
+    3d69:	85 c0                	test   %eax,%eax
+    3d6b:	0f 85 de 00 00 00    	jne    3e4f <fourteen+0x11f>
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    3d71:	83 ec 08             	sub    $0x8,%esp
+    3d74:	68 00 02 00 00       	push   $0x200
+    3d79:	68 68 72 00 00       	push   $0x7268
+    3d7e:	e8 c0 13 00 00       	call   5143 <open>
+  if(fd < 0){
+    3d83:	83 c4 10             	add    $0x10,%esp
+    3d86:	85 c0                	test   %eax,%eax
+    3d88:	0f 88 ae 00 00 00    	js     3e3c <fourteen+0x10c>
+  close(fd);
+    3d8e:	83 ec 0c             	sub    $0xc,%esp
+    3d91:	50                   	push   %eax
+    3d92:	e8 94 13 00 00       	call   512b <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    3d97:	58                   	pop    %eax
+    3d98:	5a                   	pop    %edx
+    3d99:	6a 00                	push   $0x0
+    3d9b:	68 d8 72 00 00       	push   $0x72d8
+    3da0:	e8 9e 13 00 00       	call   5143 <open>
+  if(fd < 0){
+    3da5:	83 c4 10             	add    $0x10,%esp
+    3da8:	85 c0                	test   %eax,%eax
+    3daa:	78 7d                	js     3e29 <fourteen+0xf9>
+  close(fd);
+    3dac:	83 ec 0c             	sub    $0xc,%esp
+    3daf:	50                   	push   %eax
+    3db0:	e8 76 13 00 00       	call   512b <close>
+  if(mkdir("12345678901234/12345678901234") == 0){
+    3db5:	c7 04 24 32 65 00 00 	movl   $0x6532,(%esp)
+    3dbc:	e8 aa 13 00 00       	call   516b <mkdir>
+    3dc1:	83 c4 10             	add    $0x10,%esp
+    3dc4:	85 c0                	test   %eax,%eax
+    3dc6:	74 4e                	je     3e16 <fourteen+0xe6>
+  if(mkdir("123456789012345/12345678901234") == 0){
+    3dc8:	83 ec 0c             	sub    $0xc,%esp
+    3dcb:	68 74 73 00 00       	push   $0x7374
+    3dd0:	e8 96 13 00 00       	call   516b <mkdir>
+    3dd5:	83 c4 10             	add    $0x10,%esp
+    3dd8:	85 c0                	test   %eax,%eax
+    3dda:	74 27                	je     3e03 <fourteen+0xd3>
+  printf(1, "fourteen ok\n");
+    3ddc:	83 ec 08             	sub    $0x8,%esp
+    3ddf:	68 50 65 00 00       	push   $0x6550
+    3de4:	6a 01                	push   $0x1
+    3de6:	e8 c5 14 00 00       	call   52b0 <printf>
+}
+    3deb:	83 c4 10             	add    $0x10,%esp
+    3dee:	c9                   	leave
+    3def:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    3df0:	50                   	push   %eax
+    3df1:	50                   	push   %eax
+    3df2:	68 15 65 00 00       	push   $0x6515
+    3df7:	6a 01                	push   $0x1
+    3df9:	e8 b2 14 00 00       	call   52b0 <printf>
+    exit();
+    3dfe:	e8 00 13 00 00       	call   5103 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    3e03:	50                   	push   %eax
+    3e04:	50                   	push   %eax
+    3e05:	68 94 73 00 00       	push   $0x7394
+    3e0a:	6a 01                	push   $0x1
+    3e0c:	e8 9f 14 00 00       	call   52b0 <printf>
+    exit();
+    3e11:	e8 ed 12 00 00       	call   5103 <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    3e16:	52                   	push   %edx
+    3e17:	52                   	push   %edx
+    3e18:	68 44 73 00 00       	push   $0x7344
+    3e1d:	6a 01                	push   $0x1
+    3e1f:	e8 8c 14 00 00       	call   52b0 <printf>
+    exit();
+    3e24:	e8 da 12 00 00       	call   5103 <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    3e29:	51                   	push   %ecx
+    3e2a:	51                   	push   %ecx
+    3e2b:	68 08 73 00 00       	push   $0x7308
+    3e30:	6a 01                	push   $0x1
+    3e32:	e8 79 14 00 00       	call   52b0 <printf>
+    exit();
+    3e37:	e8 c7 12 00 00       	call   5103 <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    3e3c:	51                   	push   %ecx
+    3e3d:	51                   	push   %ecx
+    3e3e:	68 98 72 00 00       	push   $0x7298
+    3e43:	6a 01                	push   $0x1
+    3e45:	e8 66 14 00 00       	call   52b0 <printf>
+    exit();
+    3e4a:	e8 b4 12 00 00       	call   5103 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    3e4f:	50                   	push   %eax
+    3e50:	50                   	push   %eax
+    3e51:	68 38 72 00 00       	push   $0x7238
+    3e56:	6a 01                	push   $0x1
+    3e58:	e8 53 14 00 00       	call   52b0 <printf>
+    exit();
+    3e5d:	e8 a1 12 00 00       	call   5103 <exit>
+    3e62:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3e69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003e70 <rmdot>:
+{
+    3e70:	55                   	push   %ebp
+    3e71:	89 e5                	mov    %esp,%ebp
+    3e73:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    3e76:	68 5d 65 00 00       	push   $0x655d
+    3e7b:	6a 01                	push   $0x1
+    3e7d:	e8 2e 14 00 00       	call   52b0 <printf>
+  if(mkdir("dots") != 0){
+    3e82:	c7 04 24 69 65 00 00 	movl   $0x6569,(%esp)
+    3e89:	e8 dd 12 00 00       	call   516b <mkdir>
+    3e8e:	83 c4 10             	add    $0x10,%esp
+    3e91:	85 c0                	test   %eax,%eax
+    3e93:	0f 85 b0 00 00 00    	jne    3f49 <rmdot+0xd9>
+  if(chdir("dots") != 0){
+    3e99:	83 ec 0c             	sub    $0xc,%esp
+    3e9c:	68 69 65 00 00       	push   $0x6569
+    3ea1:	e8 cd 12 00 00       	call   5173 <chdir>
+    3ea6:	83 c4 10             	add    $0x10,%esp
+    3ea9:	85 c0                	test   %eax,%eax
+    3eab:	0f 85 1d 01 00 00    	jne    3fce <rmdot+0x15e>
+  if(unlink(".") == 0){
+    3eb1:	83 ec 0c             	sub    $0xc,%esp
+    3eb4:	68 14 62 00 00       	push   $0x6214
+    3eb9:	e8 95 12 00 00       	call   5153 <unlink>
+    3ebe:	83 c4 10             	add    $0x10,%esp
+    3ec1:	85 c0                	test   %eax,%eax
+    3ec3:	0f 84 f2 00 00 00    	je     3fbb <rmdot+0x14b>
+  if(unlink("..") == 0){
+    3ec9:	83 ec 0c             	sub    $0xc,%esp
+    3ecc:	68 13 62 00 00       	push   $0x6213
+    3ed1:	e8 7d 12 00 00       	call   5153 <unlink>
+    3ed6:	83 c4 10             	add    $0x10,%esp
+    3ed9:	85 c0                	test   %eax,%eax
+    3edb:	0f 84 c7 00 00 00    	je     3fa8 <rmdot+0x138>
+  if(chdir("/") != 0){
+    3ee1:	83 ec 0c             	sub    $0xc,%esp
+    3ee4:	68 80 56 00 00       	push   $0x5680
+    3ee9:	e8 85 12 00 00       	call   5173 <chdir>
+    3eee:	83 c4 10             	add    $0x10,%esp
+    3ef1:	85 c0                	test   %eax,%eax
+    3ef3:	0f 85 9c 00 00 00    	jne    3f95 <rmdot+0x125>
+  if(unlink("dots/.") == 0){
+    3ef9:	83 ec 0c             	sub    $0xc,%esp
+    3efc:	68 b1 65 00 00       	push   $0x65b1
+    3f01:	e8 4d 12 00 00       	call   5153 <unlink>
+    3f06:	83 c4 10             	add    $0x10,%esp
+    3f09:	85 c0                	test   %eax,%eax
+    3f0b:	74 75                	je     3f82 <rmdot+0x112>
+  if(unlink("dots/..") == 0){
+    3f0d:	83 ec 0c             	sub    $0xc,%esp
+    3f10:	68 cf 65 00 00       	push   $0x65cf
+    3f15:	e8 39 12 00 00       	call   5153 <unlink>
+    3f1a:	83 c4 10             	add    $0x10,%esp
+    3f1d:	85 c0                	test   %eax,%eax
+    3f1f:	74 4e                	je     3f6f <rmdot+0xff>
+  if(unlink("dots") != 0){
+    3f21:	83 ec 0c             	sub    $0xc,%esp
+    3f24:	68 69 65 00 00       	push   $0x6569
+    3f29:	e8 25 12 00 00       	call   5153 <unlink>
+    3f2e:	83 c4 10             	add    $0x10,%esp
+    3f31:	85 c0                	test   %eax,%eax
+    3f33:	75 27                	jne    3f5c <rmdot+0xec>
+  printf(1, "rmdot ok\n");
+    3f35:	83 ec 08             	sub    $0x8,%esp
+    3f38:	68 04 66 00 00       	push   $0x6604
+    3f3d:	6a 01                	push   $0x1
+    3f3f:	e8 6c 13 00 00       	call   52b0 <printf>
+}
+    3f44:	83 c4 10             	add    $0x10,%esp
+    3f47:	c9                   	leave
+    3f48:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    3f49:	50                   	push   %eax
+    3f4a:	50                   	push   %eax
+    3f4b:	68 6e 65 00 00       	push   $0x656e
+    3f50:	6a 01                	push   $0x1
+    3f52:	e8 59 13 00 00       	call   52b0 <printf>
+    exit();
+    3f57:	e8 a7 11 00 00       	call   5103 <exit>
+    printf(1, "unlink dots failed!\n");
+    3f5c:	50                   	push   %eax
+    3f5d:	50                   	push   %eax
+    3f5e:	68 ef 65 00 00       	push   $0x65ef
+    3f63:	6a 01                	push   $0x1
+    3f65:	e8 46 13 00 00       	call   52b0 <printf>
+    exit();
+    3f6a:	e8 94 11 00 00       	call   5103 <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    3f6f:	52                   	push   %edx
+    3f70:	52                   	push   %edx
+    3f71:	68 d7 65 00 00       	push   $0x65d7
+    3f76:	6a 01                	push   $0x1
+    3f78:	e8 33 13 00 00       	call   52b0 <printf>
+    exit();
+    3f7d:	e8 81 11 00 00       	call   5103 <exit>
+    printf(1, "unlink dots/. worked!\n");
+    3f82:	51                   	push   %ecx
+    3f83:	51                   	push   %ecx
+    3f84:	68 b8 65 00 00       	push   $0x65b8
+    3f89:	6a 01                	push   $0x1
+    3f8b:	e8 20 13 00 00       	call   52b0 <printf>
+    exit();
+    3f90:	e8 6e 11 00 00       	call   5103 <exit>
+    printf(1, "chdir / failed\n");
+    3f95:	50                   	push   %eax
+    3f96:	50                   	push   %eax
+    3f97:	68 82 56 00 00       	push   $0x5682
+    3f9c:	6a 01                	push   $0x1
+    3f9e:	e8 0d 13 00 00       	call   52b0 <printf>
+    exit();
+    3fa3:	e8 5b 11 00 00       	call   5103 <exit>
+    printf(1, "rm .. worked!\n");
+    3fa8:	50                   	push   %eax
+    3fa9:	50                   	push   %eax
+    3faa:	68 a2 65 00 00       	push   $0x65a2
+    3faf:	6a 01                	push   $0x1
+    3fb1:	e8 fa 12 00 00       	call   52b0 <printf>
+    exit();
+    3fb6:	e8 48 11 00 00       	call   5103 <exit>
+    printf(1, "rm . worked!\n");
+    3fbb:	50                   	push   %eax
+    3fbc:	50                   	push   %eax
+    3fbd:	68 94 65 00 00       	push   $0x6594
+    3fc2:	6a 01                	push   $0x1
+    3fc4:	e8 e7 12 00 00       	call   52b0 <printf>
+    exit();
+    3fc9:	e8 35 11 00 00       	call   5103 <exit>
+    printf(1, "chdir dots failed\n");
+    3fce:	50                   	push   %eax
+    3fcf:	50                   	push   %eax
+    3fd0:	68 81 65 00 00       	push   $0x6581
+    3fd5:	6a 01                	push   $0x1
+    3fd7:	e8 d4 12 00 00       	call   52b0 <printf>
+    exit();
+    3fdc:	e8 22 11 00 00       	call   5103 <exit>
+    3fe1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3fe8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3fef:	90                   	nop
+
+00003ff0 <dirfile>:
+{
+    3ff0:	55                   	push   %ebp
+    3ff1:	89 e5                	mov    %esp,%ebp
+    3ff3:	53                   	push   %ebx
+    3ff4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "dir vs file\n");
+    3ff7:	68 0e 66 00 00       	push   $0x660e
+    3ffc:	6a 01                	push   $0x1
+    3ffe:	e8 ad 12 00 00       	call   52b0 <printf>
+  fd = open("dirfile", O_CREATE);
+    4003:	5b                   	pop    %ebx
+    4004:	58                   	pop    %eax
+    4005:	68 00 02 00 00       	push   $0x200
+    400a:	68 1b 66 00 00       	push   $0x661b
+    400f:	e8 2f 11 00 00       	call   5143 <open>
+  if(fd < 0){
+    4014:	83 c4 10             	add    $0x10,%esp
+    4017:	85 c0                	test   %eax,%eax
+    4019:	0f 88 43 01 00 00    	js     4162 <dirfile+0x172>
+  close(fd);
+    401f:	83 ec 0c             	sub    $0xc,%esp
+    4022:	50                   	push   %eax
+    4023:	e8 03 11 00 00       	call   512b <close>
+  if(chdir("dirfile") == 0){
+    4028:	c7 04 24 1b 66 00 00 	movl   $0x661b,(%esp)
+    402f:	e8 3f 11 00 00       	call   5173 <chdir>
+    4034:	83 c4 10             	add    $0x10,%esp
+    4037:	85 c0                	test   %eax,%eax
+    4039:	0f 84 10 01 00 00    	je     414f <dirfile+0x15f>
+  fd = open("dirfile/xx", 0);
+    403f:	83 ec 08             	sub    $0x8,%esp
+    4042:	6a 00                	push   $0x0
+    4044:	68 54 66 00 00       	push   $0x6654
+    4049:	e8 f5 10 00 00       	call   5143 <open>
+  if(fd >= 0){
+    404e:	83 c4 10             	add    $0x10,%esp
+    4051:	85 c0                	test   %eax,%eax
+    4053:	0f 89 e3 00 00 00    	jns    413c <dirfile+0x14c>
+  fd = open("dirfile/xx", O_CREATE);
+    4059:	83 ec 08             	sub    $0x8,%esp
+    405c:	68 00 02 00 00       	push   $0x200
+    4061:	68 54 66 00 00       	push   $0x6654
+    4066:	e8 d8 10 00 00       	call   5143 <open>
+  if(fd >= 0){
+    406b:	83 c4 10             	add    $0x10,%esp
+    406e:	85 c0                	test   %eax,%eax
+    4070:	0f 89 c6 00 00 00    	jns    413c <dirfile+0x14c>
+  if(mkdir("dirfile/xx") == 0){
+    4076:	83 ec 0c             	sub    $0xc,%esp
+    4079:	68 54 66 00 00       	push   $0x6654
+    407e:	e8 e8 10 00 00       	call   516b <mkdir>
+    4083:	83 c4 10             	add    $0x10,%esp
+    4086:	85 c0                	test   %eax,%eax
+    4088:	0f 84 46 01 00 00    	je     41d4 <dirfile+0x1e4>
+  if(unlink("dirfile/xx") == 0){
+    408e:	83 ec 0c             	sub    $0xc,%esp
+    4091:	68 54 66 00 00       	push   $0x6654
+    4096:	e8 b8 10 00 00       	call   5153 <unlink>
+    409b:	83 c4 10             	add    $0x10,%esp
+    409e:	85 c0                	test   %eax,%eax
+    40a0:	0f 84 1b 01 00 00    	je     41c1 <dirfile+0x1d1>
+  if(link("README", "dirfile/xx") == 0){
+    40a6:	83 ec 08             	sub    $0x8,%esp
+    40a9:	68 54 66 00 00       	push   $0x6654
+    40ae:	68 b8 66 00 00       	push   $0x66b8
+    40b3:	e8 ab 10 00 00       	call   5163 <link>
+    40b8:	83 c4 10             	add    $0x10,%esp
+    40bb:	85 c0                	test   %eax,%eax
+    40bd:	0f 84 eb 00 00 00    	je     41ae <dirfile+0x1be>
+  if(unlink("dirfile") != 0){
+    40c3:	83 ec 0c             	sub    $0xc,%esp
+    40c6:	68 1b 66 00 00       	push   $0x661b
+    40cb:	e8 83 10 00 00       	call   5153 <unlink>
+    40d0:	83 c4 10             	add    $0x10,%esp
+    40d3:	85 c0                	test   %eax,%eax
+    40d5:	0f 85 c0 00 00 00    	jne    419b <dirfile+0x1ab>
+  fd = open(".", O_RDWR);
+    40db:	83 ec 08             	sub    $0x8,%esp
+    40de:	6a 02                	push   $0x2
+    40e0:	68 14 62 00 00       	push   $0x6214
+    40e5:	e8 59 10 00 00       	call   5143 <open>
+  if(fd >= 0){
+    40ea:	83 c4 10             	add    $0x10,%esp
+    40ed:	85 c0                	test   %eax,%eax
+    40ef:	0f 89 93 00 00 00    	jns    4188 <dirfile+0x198>
+  fd = open(".", 0);
+    40f5:	83 ec 08             	sub    $0x8,%esp
+    40f8:	6a 00                	push   $0x0
+    40fa:	68 14 62 00 00       	push   $0x6214
+    40ff:	e8 3f 10 00 00       	call   5143 <open>
+  if(write(fd, "x", 1) > 0){
+    4104:	83 c4 0c             	add    $0xc,%esp
+    4107:	6a 01                	push   $0x1
+  fd = open(".", 0);
+    4109:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    410b:	68 f7 62 00 00       	push   $0x62f7
+    4110:	50                   	push   %eax
+    4111:	e8 0d 10 00 00       	call   5123 <write>
+    4116:	83 c4 10             	add    $0x10,%esp
+    4119:	85 c0                	test   %eax,%eax
+    411b:	7f 58                	jg     4175 <dirfile+0x185>
+  close(fd);
+    411d:	83 ec 0c             	sub    $0xc,%esp
+    4120:	53                   	push   %ebx
+    4121:	e8 05 10 00 00       	call   512b <close>
+  printf(1, "dir vs file OK\n");
+    4126:	58                   	pop    %eax
+    4127:	5a                   	pop    %edx
+    4128:	68 eb 66 00 00       	push   $0x66eb
+    412d:	6a 01                	push   $0x1
+    412f:	e8 7c 11 00 00       	call   52b0 <printf>
+}
+    4134:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4137:	83 c4 10             	add    $0x10,%esp
+    413a:	c9                   	leave
+    413b:	c3                   	ret
+    printf(1, "create dirfile/xx succeeded!\n");
+    413c:	50                   	push   %eax
+    413d:	50                   	push   %eax
+    413e:	68 5f 66 00 00       	push   $0x665f
+    4143:	6a 01                	push   $0x1
+    4145:	e8 66 11 00 00       	call   52b0 <printf>
+    exit();
+    414a:	e8 b4 0f 00 00       	call   5103 <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    414f:	52                   	push   %edx
+    4150:	52                   	push   %edx
+    4151:	68 3a 66 00 00       	push   $0x663a
+    4156:	6a 01                	push   $0x1
+    4158:	e8 53 11 00 00       	call   52b0 <printf>
+    exit();
+    415d:	e8 a1 0f 00 00       	call   5103 <exit>
+    printf(1, "create dirfile failed\n");
+    4162:	51                   	push   %ecx
+    4163:	51                   	push   %ecx
+    4164:	68 23 66 00 00       	push   $0x6623
+    4169:	6a 01                	push   $0x1
+    416b:	e8 40 11 00 00       	call   52b0 <printf>
+    exit();
+    4170:	e8 8e 0f 00 00       	call   5103 <exit>
+    printf(1, "write . succeeded!\n");
+    4175:	51                   	push   %ecx
+    4176:	51                   	push   %ecx
+    4177:	68 d7 66 00 00       	push   $0x66d7
+    417c:	6a 01                	push   $0x1
+    417e:	e8 2d 11 00 00       	call   52b0 <printf>
+    exit();
+    4183:	e8 7b 0f 00 00       	call   5103 <exit>
+    printf(1, "open . for writing succeeded!\n");
+    4188:	53                   	push   %ebx
+    4189:	53                   	push   %ebx
+    418a:	68 e8 73 00 00       	push   $0x73e8
+    418f:	6a 01                	push   $0x1
+    4191:	e8 1a 11 00 00       	call   52b0 <printf>
+    exit();
+    4196:	e8 68 0f 00 00       	call   5103 <exit>
+    printf(1, "unlink dirfile failed!\n");
+    419b:	50                   	push   %eax
+    419c:	50                   	push   %eax
+    419d:	68 bf 66 00 00       	push   $0x66bf
+    41a2:	6a 01                	push   $0x1
+    41a4:	e8 07 11 00 00       	call   52b0 <printf>
+    exit();
+    41a9:	e8 55 0f 00 00       	call   5103 <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    41ae:	50                   	push   %eax
+    41af:	50                   	push   %eax
+    41b0:	68 c8 73 00 00       	push   $0x73c8
+    41b5:	6a 01                	push   $0x1
+    41b7:	e8 f4 10 00 00       	call   52b0 <printf>
+    exit();
+    41bc:	e8 42 0f 00 00       	call   5103 <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    41c1:	50                   	push   %eax
+    41c2:	50                   	push   %eax
+    41c3:	68 9a 66 00 00       	push   $0x669a
+    41c8:	6a 01                	push   $0x1
+    41ca:	e8 e1 10 00 00       	call   52b0 <printf>
+    exit();
+    41cf:	e8 2f 0f 00 00       	call   5103 <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    41d4:	50                   	push   %eax
+    41d5:	50                   	push   %eax
+    41d6:	68 7d 66 00 00       	push   $0x667d
+    41db:	6a 01                	push   $0x1
+    41dd:	e8 ce 10 00 00       	call   52b0 <printf>
+    exit();
+    41e2:	e8 1c 0f 00 00       	call   5103 <exit>
+    41e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    41ee:	66 90                	xchg   %ax,%ax
+
+000041f0 <iref>:
+{
+    41f0:	55                   	push   %ebp
+    41f1:	89 e5                	mov    %esp,%ebp
+    41f3:	53                   	push   %ebx
+  printf(1, "empty file name\n");
+    41f4:	bb 33 00 00 00       	mov    $0x33,%ebx
+{
+    41f9:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "empty file name\n");
+    41fc:	68 fb 66 00 00       	push   $0x66fb
+    4201:	6a 01                	push   $0x1
+    4203:	e8 a8 10 00 00       	call   52b0 <printf>
+    4208:	83 c4 10             	add    $0x10,%esp
+    420b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    420f:	90                   	nop
+    if(mkdir("irefd") != 0){
+    4210:	83 ec 0c             	sub    $0xc,%esp
+    4213:	68 0c 67 00 00       	push   $0x670c
+    4218:	e8 4e 0f 00 00       	call   516b <mkdir>
+    421d:	83 c4 10             	add    $0x10,%esp
+    4220:	85 c0                	test   %eax,%eax
+    4222:	0f 85 bb 00 00 00    	jne    42e3 <iref+0xf3>
+    if(chdir("irefd") != 0){
+    4228:	83 ec 0c             	sub    $0xc,%esp
+    422b:	68 0c 67 00 00       	push   $0x670c
+    4230:	e8 3e 0f 00 00       	call   5173 <chdir>
+    4235:	83 c4 10             	add    $0x10,%esp
+    4238:	85 c0                	test   %eax,%eax
+    423a:	0f 85 b7 00 00 00    	jne    42f7 <iref+0x107>
+    mkdir("");
+    4240:	83 ec 0c             	sub    $0xc,%esp
+    4243:	68 46 5a 00 00       	push   $0x5a46
+    4248:	e8 1e 0f 00 00       	call   516b <mkdir>
+    link("README", "");
+    424d:	59                   	pop    %ecx
+    424e:	58                   	pop    %eax
+    424f:	68 46 5a 00 00       	push   $0x5a46
+    4254:	68 b8 66 00 00       	push   $0x66b8
+    4259:	e8 05 0f 00 00       	call   5163 <link>
+    fd = open("", O_CREATE);
+    425e:	58                   	pop    %eax
+    425f:	5a                   	pop    %edx
+    4260:	68 00 02 00 00       	push   $0x200
+    4265:	68 46 5a 00 00       	push   $0x5a46
+    426a:	e8 d4 0e 00 00       	call   5143 <open>
+    if(fd >= 0)
+    426f:	83 c4 10             	add    $0x10,%esp
+    4272:	85 c0                	test   %eax,%eax
+    4274:	78 0c                	js     4282 <iref+0x92>
+      close(fd);
+    4276:	83 ec 0c             	sub    $0xc,%esp
+    4279:	50                   	push   %eax
+    427a:	e8 ac 0e 00 00       	call   512b <close>
+    427f:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    4282:	83 ec 08             	sub    $0x8,%esp
+    4285:	68 00 02 00 00       	push   $0x200
+    428a:	68 f6 62 00 00       	push   $0x62f6
+    428f:	e8 af 0e 00 00       	call   5143 <open>
+    if(fd >= 0)
+    4294:	83 c4 10             	add    $0x10,%esp
+    4297:	85 c0                	test   %eax,%eax
+    4299:	78 0c                	js     42a7 <iref+0xb7>
+      close(fd);
+    429b:	83 ec 0c             	sub    $0xc,%esp
+    429e:	50                   	push   %eax
+    429f:	e8 87 0e 00 00       	call   512b <close>
+    42a4:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    42a7:	83 ec 0c             	sub    $0xc,%esp
+    42aa:	68 f6 62 00 00       	push   $0x62f6
+    42af:	e8 9f 0e 00 00       	call   5153 <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    42b4:	83 c4 10             	add    $0x10,%esp
+    42b7:	83 eb 01             	sub    $0x1,%ebx
+    42ba:	0f 85 50 ff ff ff    	jne    4210 <iref+0x20>
+  chdir("/");
+    42c0:	83 ec 0c             	sub    $0xc,%esp
+    42c3:	68 80 56 00 00       	push   $0x5680
+    42c8:	e8 a6 0e 00 00       	call   5173 <chdir>
+  printf(1, "empty file name OK\n");
+    42cd:	58                   	pop    %eax
+    42ce:	5a                   	pop    %edx
+    42cf:	68 3a 67 00 00       	push   $0x673a
+    42d4:	6a 01                	push   $0x1
+    42d6:	e8 d5 0f 00 00       	call   52b0 <printf>
+}
+    42db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    42de:	83 c4 10             	add    $0x10,%esp
+    42e1:	c9                   	leave
+    42e2:	c3                   	ret
+      printf(1, "mkdir irefd failed\n");
+    42e3:	83 ec 08             	sub    $0x8,%esp
+    42e6:	68 12 67 00 00       	push   $0x6712
+    42eb:	6a 01                	push   $0x1
+    42ed:	e8 be 0f 00 00       	call   52b0 <printf>
+      exit();
+    42f2:	e8 0c 0e 00 00       	call   5103 <exit>
+      printf(1, "chdir irefd failed\n");
+    42f7:	83 ec 08             	sub    $0x8,%esp
+    42fa:	68 26 67 00 00       	push   $0x6726
+    42ff:	6a 01                	push   $0x1
+    4301:	e8 aa 0f 00 00       	call   52b0 <printf>
+      exit();
+    4306:	e8 f8 0d 00 00       	call   5103 <exit>
+    430b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    430f:	90                   	nop
+
+00004310 <forktest>:
+{
+    4310:	55                   	push   %ebp
+    4311:	89 e5                	mov    %esp,%ebp
+    4313:	53                   	push   %ebx
+  for(n=0; n<1000; n++){
+    4314:	31 db                	xor    %ebx,%ebx
+{
+    4316:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "fork test\n");
+    4319:	68 4e 67 00 00       	push   $0x674e
+    431e:	6a 01                	push   $0x1
+    4320:	e8 8b 0f 00 00       	call   52b0 <printf>
+    4325:	83 c4 10             	add    $0x10,%esp
+    4328:	eb 13                	jmp    433d <forktest+0x2d>
+    432a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(pid == 0)
+    4330:	74 4d                	je     437f <forktest+0x6f>
+  for(n=0; n<1000; n++){
+    4332:	83 c3 01             	add    $0x1,%ebx
+    4335:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    433b:	74 6e                	je     43ab <forktest+0x9b>
+    pid = fork();
+    433d:	e8 b9 0d 00 00       	call   50fb <fork>
+    if(pid < 0)
+    4342:	85 c0                	test   %eax,%eax
+    4344:	79 ea                	jns    4330 <forktest+0x20>
+  for(; n > 0; n--){
+    4346:	85 db                	test   %ebx,%ebx
+    4348:	74 14                	je     435e <forktest+0x4e>
+    434a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(wait() < 0){
+    4350:	e8 b6 0d 00 00       	call   510b <wait>
+    4355:	85 c0                	test   %eax,%eax
+    4357:	78 2b                	js     4384 <forktest+0x74>
+  for(; n > 0; n--){
+    4359:	83 eb 01             	sub    $0x1,%ebx
+    435c:	75 f2                	jne    4350 <forktest+0x40>
+  if(wait() != -1){
+    435e:	e8 a8 0d 00 00       	call   510b <wait>
+    4363:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4366:	75 30                	jne    4398 <forktest+0x88>
+  printf(1, "fork test OK\n");
+    4368:	83 ec 08             	sub    $0x8,%esp
+    436b:	68 80 67 00 00       	push   $0x6780
+    4370:	6a 01                	push   $0x1
+    4372:	e8 39 0f 00 00       	call   52b0 <printf>
+}
+    4377:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    437a:	83 c4 10             	add    $0x10,%esp
+    437d:	c9                   	leave
+    437e:	c3                   	ret
+      exit();
+    437f:	e8 7f 0d 00 00       	call   5103 <exit>
+      printf(1, "wait stopped early\n");
+    4384:	83 ec 08             	sub    $0x8,%esp
+    4387:	68 59 67 00 00       	push   $0x6759
+    438c:	6a 01                	push   $0x1
+    438e:	e8 1d 0f 00 00       	call   52b0 <printf>
+      exit();
+    4393:	e8 6b 0d 00 00       	call   5103 <exit>
+    printf(1, "wait got too many\n");
+    4398:	50                   	push   %eax
+    4399:	50                   	push   %eax
+    439a:	68 6d 67 00 00       	push   $0x676d
+    439f:	6a 01                	push   $0x1
+    43a1:	e8 0a 0f 00 00       	call   52b0 <printf>
+    exit();
+    43a6:	e8 58 0d 00 00       	call   5103 <exit>
+    printf(1, "fork claimed to work 1000 times!\n");
+    43ab:	52                   	push   %edx
+    43ac:	52                   	push   %edx
+    43ad:	68 08 74 00 00       	push   $0x7408
+    43b2:	6a 01                	push   $0x1
+    43b4:	e8 f7 0e 00 00       	call   52b0 <printf>
+    exit();
+    43b9:	e8 45 0d 00 00       	call   5103 <exit>
+    43be:	66 90                	xchg   %ax,%ax
+
+000043c0 <sbrktest>:
+{
+    43c0:	55                   	push   %ebp
+    43c1:	89 e5                	mov    %esp,%ebp
+    43c3:	57                   	push   %edi
+    43c4:	56                   	push   %esi
+  for(i = 0; i < 5000; i++){
+    43c5:	31 f6                	xor    %esi,%esi
+{
+    43c7:	53                   	push   %ebx
+    43c8:	83 ec 64             	sub    $0x64,%esp
+  printf(stdout, "sbrk test\n");
+    43cb:	68 3e 68 00 00       	push   $0x683e
+    43d0:	ff 35 04 90 00 00    	push   0x9004
+    43d6:	e8 d5 0e 00 00       	call   52b0 <printf>
+  oldbrk = sbrk(0);
+    43db:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    43e2:	e8 a4 0d 00 00       	call   518b <sbrk>
+    43e7:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  a = sbrk(0);
+    43ea:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    43f1:	e8 95 0d 00 00       	call   518b <sbrk>
+    43f6:	83 c4 10             	add    $0x10,%esp
+    43f9:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < 5000; i++){
+    43fb:	eb 05                	jmp    4402 <sbrktest+0x42>
+    43fd:	8d 76 00             	lea    0x0(%esi),%esi
+    a = b + 1;
+    4400:	89 c3                	mov    %eax,%ebx
+    b = sbrk(1);
+    4402:	83 ec 0c             	sub    $0xc,%esp
+    4405:	6a 01                	push   $0x1
+    4407:	e8 7f 0d 00 00       	call   518b <sbrk>
+    if(b != a){
+    440c:	83 c4 10             	add    $0x10,%esp
+    440f:	39 d8                	cmp    %ebx,%eax
+    4411:	0f 85 9c 02 00 00    	jne    46b3 <sbrktest+0x2f3>
+  for(i = 0; i < 5000; i++){
+    4417:	83 c6 01             	add    $0x1,%esi
+    *b = 1;
+    441a:	c6 03 01             	movb   $0x1,(%ebx)
+    a = b + 1;
+    441d:	8d 43 01             	lea    0x1(%ebx),%eax
+  for(i = 0; i < 5000; i++){
+    4420:	81 fe 88 13 00 00    	cmp    $0x1388,%esi
+    4426:	75 d8                	jne    4400 <sbrktest+0x40>
+  pid = fork();
+    4428:	e8 ce 0c 00 00       	call   50fb <fork>
+    442d:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+    442f:	85 c0                	test   %eax,%eax
+    4431:	0f 88 02 03 00 00    	js     4739 <sbrktest+0x379>
+  c = sbrk(1);
+    4437:	83 ec 0c             	sub    $0xc,%esp
+  if(c != a + 1){
+    443a:	83 c3 02             	add    $0x2,%ebx
+  c = sbrk(1);
+    443d:	6a 01                	push   $0x1
+    443f:	e8 47 0d 00 00       	call   518b <sbrk>
+  c = sbrk(1);
+    4444:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    444b:	e8 3b 0d 00 00       	call   518b <sbrk>
+  if(c != a + 1){
+    4450:	83 c4 10             	add    $0x10,%esp
+    4453:	39 c3                	cmp    %eax,%ebx
+    4455:	0f 85 3b 03 00 00    	jne    4796 <sbrktest+0x3d6>
+  if(pid == 0)
+    445b:	85 f6                	test   %esi,%esi
+    445d:	0f 84 2e 03 00 00    	je     4791 <sbrktest+0x3d1>
+  wait();
+    4463:	e8 a3 0c 00 00       	call   510b <wait>
+  a = sbrk(0);
+    4468:	83 ec 0c             	sub    $0xc,%esp
+    446b:	6a 00                	push   $0x0
+    446d:	e8 19 0d 00 00       	call   518b <sbrk>
+    4472:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    4474:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    4479:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    447b:	89 04 24             	mov    %eax,(%esp)
+    447e:	e8 08 0d 00 00       	call   518b <sbrk>
+  if (p != a) {
+    4483:	83 c4 10             	add    $0x10,%esp
+    4486:	39 c3                	cmp    %eax,%ebx
+    4488:	0f 85 94 02 00 00    	jne    4722 <sbrktest+0x362>
+  a = sbrk(0);
+    448e:	83 ec 0c             	sub    $0xc,%esp
+  *lastaddr = 99;
+    4491:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+  a = sbrk(0);
+    4498:	6a 00                	push   $0x0
+    449a:	e8 ec 0c 00 00       	call   518b <sbrk>
+  c = sbrk(-4096);
+    449f:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+  a = sbrk(0);
+    44a6:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    44a8:	e8 de 0c 00 00       	call   518b <sbrk>
+  if(c == (char*)0xffffffff){
+    44ad:	83 c4 10             	add    $0x10,%esp
+    44b0:	83 f8 ff             	cmp    $0xffffffff,%eax
+    44b3:	0f 84 22 03 00 00    	je     47db <sbrktest+0x41b>
+  c = sbrk(0);
+    44b9:	83 ec 0c             	sub    $0xc,%esp
+    44bc:	6a 00                	push   $0x0
+    44be:	e8 c8 0c 00 00       	call   518b <sbrk>
+  if(c != a - 4096){
+    44c3:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    44c9:	83 c4 10             	add    $0x10,%esp
+    44cc:	39 d0                	cmp    %edx,%eax
+    44ce:	0f 85 f0 02 00 00    	jne    47c4 <sbrktest+0x404>
+  a = sbrk(0);
+    44d4:	83 ec 0c             	sub    $0xc,%esp
+    44d7:	6a 00                	push   $0x0
+    44d9:	e8 ad 0c 00 00       	call   518b <sbrk>
+  c = sbrk(4096);
+    44de:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+  a = sbrk(0);
+    44e5:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    44e7:	e8 9f 0c 00 00       	call   518b <sbrk>
+  if(c != a || sbrk(0) != a + 4096){
+    44ec:	83 c4 10             	add    $0x10,%esp
+  c = sbrk(4096);
+    44ef:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    44f1:	39 c3                	cmp    %eax,%ebx
+    44f3:	0f 85 b4 02 00 00    	jne    47ad <sbrktest+0x3ed>
+    44f9:	83 ec 0c             	sub    $0xc,%esp
+    44fc:	6a 00                	push   $0x0
+    44fe:	e8 88 0c 00 00       	call   518b <sbrk>
+    4503:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    4509:	83 c4 10             	add    $0x10,%esp
+    450c:	39 c2                	cmp    %eax,%edx
+    450e:	0f 85 99 02 00 00    	jne    47ad <sbrktest+0x3ed>
+  if(*lastaddr == 99){
+    4514:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    451b:	0f 84 2f 02 00 00    	je     4750 <sbrktest+0x390>
+  a = sbrk(0);
+    4521:	83 ec 0c             	sub    $0xc,%esp
+    4524:	6a 00                	push   $0x0
+    4526:	e8 60 0c 00 00       	call   518b <sbrk>
+  c = sbrk(-(sbrk(0) - oldbrk));
+    452b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  a = sbrk(0);
+    4532:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    4534:	e8 52 0c 00 00       	call   518b <sbrk>
+    4539:	89 c2                	mov    %eax,%edx
+    453b:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    453e:	29 d0                	sub    %edx,%eax
+    4540:	89 04 24             	mov    %eax,(%esp)
+    4543:	e8 43 0c 00 00       	call   518b <sbrk>
+  if(c != a){
+    4548:	83 c4 10             	add    $0x10,%esp
+    454b:	39 c3                	cmp    %eax,%ebx
+    454d:	0f 85 b8 01 00 00    	jne    470b <sbrktest+0x34b>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    4553:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    4558:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    455f:	90                   	nop
+    ppid = getpid();
+    4560:	e8 1e 0c 00 00       	call   5183 <getpid>
+    4565:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    4567:	e8 8f 0b 00 00       	call   50fb <fork>
+    if(pid < 0){
+    456c:	85 c0                	test   %eax,%eax
+    456e:	0f 88 5d 01 00 00    	js     46d1 <sbrktest+0x311>
+    if(pid == 0){
+    4574:	0f 84 6f 01 00 00    	je     46e9 <sbrktest+0x329>
+    wait();
+    457a:	e8 8c 0b 00 00       	call   510b <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    457f:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    4585:	81 fb 80 84 1e 80    	cmp    $0x801e8480,%ebx
+    458b:	75 d3                	jne    4560 <sbrktest+0x1a0>
+  if(pipe(fds) != 0){
+    458d:	83 ec 0c             	sub    $0xc,%esp
+    4590:	8d 45 b8             	lea    -0x48(%ebp),%eax
+    4593:	50                   	push   %eax
+    4594:	e8 7a 0b 00 00       	call   5113 <pipe>
+    4599:	83 c4 10             	add    $0x10,%esp
+    459c:	85 c0                	test   %eax,%eax
+    459e:	0f 85 da 01 00 00    	jne    477e <sbrktest+0x3be>
+    45a4:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+    45a7:	8d 75 e8             	lea    -0x18(%ebp),%esi
+    45aa:	89 df                	mov    %ebx,%edi
+    45ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((pids[i] = fork()) == 0){
+    45b0:	e8 46 0b 00 00       	call   50fb <fork>
+    45b5:	89 07                	mov    %eax,(%edi)
+    45b7:	85 c0                	test   %eax,%eax
+    45b9:	0f 84 91 00 00 00    	je     4650 <sbrktest+0x290>
+    if(pids[i] != -1)
+    45bf:	83 f8 ff             	cmp    $0xffffffff,%eax
+    45c2:	74 14                	je     45d8 <sbrktest+0x218>
+      read(fds[0], &scratch, 1);
+    45c4:	83 ec 04             	sub    $0x4,%esp
+    45c7:	8d 45 b7             	lea    -0x49(%ebp),%eax
+    45ca:	6a 01                	push   $0x1
+    45cc:	50                   	push   %eax
+    45cd:	ff 75 b8             	push   -0x48(%ebp)
+    45d0:	e8 46 0b 00 00       	call   511b <read>
+    45d5:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    45d8:	83 c7 04             	add    $0x4,%edi
+    45db:	39 f7                	cmp    %esi,%edi
+    45dd:	75 d1                	jne    45b0 <sbrktest+0x1f0>
+  c = sbrk(4096);
+    45df:	83 ec 0c             	sub    $0xc,%esp
+    45e2:	68 00 10 00 00       	push   $0x1000
+    45e7:	e8 9f 0b 00 00       	call   518b <sbrk>
+    45ec:	83 c4 10             	add    $0x10,%esp
+    45ef:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    45f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(pids[i] == -1)
+    45f8:	8b 03                	mov    (%ebx),%eax
+    45fa:	83 f8 ff             	cmp    $0xffffffff,%eax
+    45fd:	74 11                	je     4610 <sbrktest+0x250>
+    kill(pids[i]);
+    45ff:	83 ec 0c             	sub    $0xc,%esp
+    4602:	50                   	push   %eax
+    4603:	e8 2b 0b 00 00       	call   5133 <kill>
+    wait();
+    4608:	e8 fe 0a 00 00       	call   510b <wait>
+    460d:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    4610:	83 c3 04             	add    $0x4,%ebx
+    4613:	39 f3                	cmp    %esi,%ebx
+    4615:	75 e1                	jne    45f8 <sbrktest+0x238>
+  if(c == (char*)0xffffffff){
+    4617:	83 ff ff             	cmp    $0xffffffff,%edi
+    461a:	0f 84 47 01 00 00    	je     4767 <sbrktest+0x3a7>
+  if(sbrk(0) > oldbrk)
+    4620:	83 ec 0c             	sub    $0xc,%esp
+    4623:	6a 00                	push   $0x0
+    4625:	e8 61 0b 00 00       	call   518b <sbrk>
+    462a:	83 c4 10             	add    $0x10,%esp
+    462d:	39 45 a4             	cmp    %eax,-0x5c(%ebp)
+    4630:	72 60                	jb     4692 <sbrktest+0x2d2>
+  printf(stdout, "sbrk test OK\n");
+    4632:	83 ec 08             	sub    $0x8,%esp
+    4635:	68 2b 68 00 00       	push   $0x682b
+    463a:	ff 35 04 90 00 00    	push   0x9004
+    4640:	e8 6b 0c 00 00       	call   52b0 <printf>
+}
+    4645:	83 c4 10             	add    $0x10,%esp
+    4648:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    464b:	5b                   	pop    %ebx
+    464c:	5e                   	pop    %esi
+    464d:	5f                   	pop    %edi
+    464e:	5d                   	pop    %ebp
+    464f:	c3                   	ret
+      sbrk(BIG - (uint)sbrk(0));
+    4650:	83 ec 0c             	sub    $0xc,%esp
+    4653:	6a 00                	push   $0x0
+    4655:	e8 31 0b 00 00       	call   518b <sbrk>
+    465a:	89 c2                	mov    %eax,%edx
+    465c:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    4661:	29 d0                	sub    %edx,%eax
+    4663:	89 04 24             	mov    %eax,(%esp)
+    4666:	e8 20 0b 00 00       	call   518b <sbrk>
+      write(fds[1], "x", 1);
+    466b:	83 c4 0c             	add    $0xc,%esp
+    466e:	6a 01                	push   $0x1
+    4670:	68 f7 62 00 00       	push   $0x62f7
+    4675:	ff 75 bc             	push   -0x44(%ebp)
+    4678:	e8 a6 0a 00 00       	call   5123 <write>
+    467d:	83 c4 10             	add    $0x10,%esp
+      for(;;) sleep(1000);
+    4680:	83 ec 0c             	sub    $0xc,%esp
+    4683:	68 e8 03 00 00       	push   $0x3e8
+    4688:	e8 06 0b 00 00       	call   5193 <sleep>
+    468d:	83 c4 10             	add    $0x10,%esp
+    4690:	eb ee                	jmp    4680 <sbrktest+0x2c0>
+    sbrk(-(sbrk(0) - oldbrk));
+    4692:	83 ec 0c             	sub    $0xc,%esp
+    4695:	6a 00                	push   $0x0
+    4697:	e8 ef 0a 00 00       	call   518b <sbrk>
+    469c:	89 c2                	mov    %eax,%edx
+    469e:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    46a1:	29 d0                	sub    %edx,%eax
+    46a3:	89 04 24             	mov    %eax,(%esp)
+    46a6:	e8 e0 0a 00 00       	call   518b <sbrk>
+    46ab:	83 c4 10             	add    $0x10,%esp
+    46ae:	e9 7f ff ff ff       	jmp    4632 <sbrktest+0x272>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    46b3:	83 ec 0c             	sub    $0xc,%esp
+    46b6:	50                   	push   %eax
+    46b7:	53                   	push   %ebx
+    46b8:	56                   	push   %esi
+    46b9:	68 8e 67 00 00       	push   $0x678e
+    46be:	ff 35 04 90 00 00    	push   0x9004
+    46c4:	e8 e7 0b 00 00       	call   52b0 <printf>
+      exit();
+    46c9:	83 c4 20             	add    $0x20,%esp
+    46cc:	e8 32 0a 00 00       	call   5103 <exit>
+      printf(stdout, "fork failed\n");
+    46d1:	83 ec 08             	sub    $0x8,%esp
+    46d4:	68 c9 5c 00 00       	push   $0x5cc9
+    46d9:	ff 35 04 90 00 00    	push   0x9004
+    46df:	e8 cc 0b 00 00       	call   52b0 <printf>
+      exit();
+    46e4:	e8 1a 0a 00 00       	call   5103 <exit>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    46e9:	0f be 03             	movsbl (%ebx),%eax
+    46ec:	50                   	push   %eax
+    46ed:	53                   	push   %ebx
+    46ee:	68 f7 67 00 00       	push   $0x67f7
+    46f3:	ff 35 04 90 00 00    	push   0x9004
+    46f9:	e8 b2 0b 00 00       	call   52b0 <printf>
+      kill(ppid);
+    46fe:	89 34 24             	mov    %esi,(%esp)
+    4701:	e8 2d 0a 00 00       	call   5133 <kill>
+      exit();
+    4706:	e8 f8 09 00 00       	call   5103 <exit>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    470b:	50                   	push   %eax
+    470c:	53                   	push   %ebx
+    470d:	68 fc 74 00 00       	push   $0x74fc
+    4712:	ff 35 04 90 00 00    	push   0x9004
+    4718:	e8 93 0b 00 00       	call   52b0 <printf>
+    exit();
+    471d:	e8 e1 09 00 00       	call   5103 <exit>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    4722:	56                   	push   %esi
+    4723:	56                   	push   %esi
+    4724:	68 2c 74 00 00       	push   $0x742c
+    4729:	ff 35 04 90 00 00    	push   0x9004
+    472f:	e8 7c 0b 00 00       	call   52b0 <printf>
+    exit();
+    4734:	e8 ca 09 00 00       	call   5103 <exit>
+    printf(stdout, "sbrk test fork failed\n");
+    4739:	50                   	push   %eax
+    473a:	50                   	push   %eax
+    473b:	68 a9 67 00 00       	push   $0x67a9
+    4740:	ff 35 04 90 00 00    	push   0x9004
+    4746:	e8 65 0b 00 00       	call   52b0 <printf>
+    exit();
+    474b:	e8 b3 09 00 00       	call   5103 <exit>
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    4750:	51                   	push   %ecx
+    4751:	51                   	push   %ecx
+    4752:	68 cc 74 00 00       	push   $0x74cc
+    4757:	ff 35 04 90 00 00    	push   0x9004
+    475d:	e8 4e 0b 00 00       	call   52b0 <printf>
+    exit();
+    4762:	e8 9c 09 00 00       	call   5103 <exit>
+    printf(stdout, "failed sbrk leaked memory\n");
+    4767:	50                   	push   %eax
+    4768:	50                   	push   %eax
+    4769:	68 10 68 00 00       	push   $0x6810
+    476e:	ff 35 04 90 00 00    	push   0x9004
+    4774:	e8 37 0b 00 00       	call   52b0 <printf>
+    exit();
+    4779:	e8 85 09 00 00       	call   5103 <exit>
+    printf(1, "pipe() failed\n");
+    477e:	52                   	push   %edx
+    477f:	52                   	push   %edx
+    4780:	68 63 5a 00 00       	push   $0x5a63
+    4785:	6a 01                	push   $0x1
+    4787:	e8 24 0b 00 00       	call   52b0 <printf>
+    exit();
+    478c:	e8 72 09 00 00       	call   5103 <exit>
+    exit();
+    4791:	e8 6d 09 00 00       	call   5103 <exit>
+    printf(stdout, "sbrk test failed post-fork\n");
+    4796:	57                   	push   %edi
+    4797:	57                   	push   %edi
+    4798:	68 c0 67 00 00       	push   $0x67c0
+    479d:	ff 35 04 90 00 00    	push   0x9004
+    47a3:	e8 08 0b 00 00       	call   52b0 <printf>
+    exit();
+    47a8:	e8 56 09 00 00       	call   5103 <exit>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    47ad:	56                   	push   %esi
+    47ae:	53                   	push   %ebx
+    47af:	68 a4 74 00 00       	push   $0x74a4
+    47b4:	ff 35 04 90 00 00    	push   0x9004
+    47ba:	e8 f1 0a 00 00       	call   52b0 <printf>
+    exit();
+    47bf:	e8 3f 09 00 00       	call   5103 <exit>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    47c4:	50                   	push   %eax
+    47c5:	53                   	push   %ebx
+    47c6:	68 6c 74 00 00       	push   $0x746c
+    47cb:	ff 35 04 90 00 00    	push   0x9004
+    47d1:	e8 da 0a 00 00       	call   52b0 <printf>
+    exit();
+    47d6:	e8 28 09 00 00       	call   5103 <exit>
+    printf(stdout, "sbrk could not deallocate\n");
+    47db:	53                   	push   %ebx
+    47dc:	53                   	push   %ebx
+    47dd:	68 dc 67 00 00       	push   $0x67dc
+    47e2:	ff 35 04 90 00 00    	push   0x9004
+    47e8:	e8 c3 0a 00 00       	call   52b0 <printf>
+    exit();
+    47ed:	e8 11 09 00 00       	call   5103 <exit>
+    47f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    47f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00004800 <lazysbrktest>:
+{
+    4800:	55                   	push   %ebp
+    4801:	89 e5                	mov    %esp,%ebp
+    4803:	57                   	push   %edi
+    4804:	56                   	push   %esi
+    4805:	53                   	push   %ebx
+    4806:	81 ec 24 01 00 00    	sub    $0x124,%esp
+  printf(stdout, "lazy sbrk test\n");
+    480c:	68 39 68 00 00       	push   $0x6839
+    4811:	ff 35 04 90 00 00    	push   0x9004
+    4817:	e8 94 0a 00 00       	call   52b0 <printf>
+  memstat(&before);
+    481c:	8d 85 e0 fe ff ff    	lea    -0x120(%ebp),%eax
+    4822:	89 04 24             	mov    %eax,(%esp)
+    4825:	e8 79 09 00 00       	call   51a3 <memstat>
+  a = sbrk(n);
+    482a:	c7 04 24 00 00 00 02 	movl   $0x2000000,(%esp)
+    4831:	e8 55 09 00 00       	call   518b <sbrk>
+  if(a == (char*)0xffffffff){
+    4836:	83 c4 10             	add    $0x10,%esp
+    4839:	83 f8 ff             	cmp    $0xffffffff,%eax
+    483c:	0f 84 16 01 00 00    	je     4958 <lazysbrktest+0x158>
+  memstat(&after);
+    4842:	83 ec 0c             	sub    $0xc,%esp
+    4845:	8d bd 64 ff ff ff    	lea    -0x9c(%ebp),%edi
+    484b:	89 c6                	mov    %eax,%esi
+    484d:	57                   	push   %edi
+    484e:	e8 50 09 00 00       	call   51a3 <memstat>
+  if(before.freepages - after.freepages > 16){
+    4853:	8b 85 e4 fe ff ff    	mov    -0x11c(%ebp),%eax
+    4859:	83 c4 10             	add    $0x10,%esp
+    485c:	2b 85 68 ff ff ff    	sub    -0x98(%ebp),%eax
+    4862:	83 f8 10             	cmp    $0x10,%eax
+    4865:	0f 87 d6 00 00 00    	ja     4941 <lazysbrktest+0x141>
+  for(p = a; p < a + n; p += 1024*1024){
+    486b:	8d 86 00 00 00 02    	lea    0x2000000(%esi),%eax
+    4871:	89 f3                	mov    %esi,%ebx
+    4873:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4877:	90                   	nop
+    if(*p != 0){
+    4878:	80 3b 00             	cmpb   $0x0,(%ebx)
+    487b:	0f 85 a7 00 00 00    	jne    4928 <lazysbrktest+0x128>
+    *p = 1;
+    4881:	c6 03 01             	movb   $0x1,(%ebx)
+  for(p = a; p < a + n; p += 1024*1024){
+    4884:	81 c3 00 00 10 00    	add    $0x100000,%ebx
+    488a:	39 c3                	cmp    %eax,%ebx
+    488c:	75 ea                	jne    4878 <lazysbrktest+0x78>
+  memstat(&after);
+    488e:	83 ec 0c             	sub    $0xc,%esp
+    4891:	57                   	push   %edi
+    4892:	e8 0c 09 00 00       	call   51a3 <memstat>
+  if(before.freepages - after.freepages > 32 + 16){
+    4897:	8b 85 e4 fe ff ff    	mov    -0x11c(%ebp),%eax
+    489d:	83 c4 10             	add    $0x10,%esp
+    48a0:	2b 85 68 ff ff ff    	sub    -0x98(%ebp),%eax
+    48a6:	83 f8 30             	cmp    $0x30,%eax
+    48a9:	0f 87 ee 00 00 00    	ja     499d <lazysbrktest+0x19d>
+  i = open("README", 0);
+    48af:	83 ec 08             	sub    $0x8,%esp
+    48b2:	6a 00                	push   $0x0
+    48b4:	68 b8 66 00 00       	push   $0x66b8
+    48b9:	e8 85 08 00 00       	call   5143 <open>
+  if(i < 0 || read(i, a + n - 8192 + 4000, 2000) != 2000){
+    48be:	83 c4 10             	add    $0x10,%esp
+  i = open("README", 0);
+    48c1:	89 c7                	mov    %eax,%edi
+  if(i < 0 || read(i, a + n - 8192 + 4000, 2000) != 2000){
+    48c3:	85 c0                	test   %eax,%eax
+    48c5:	0f 88 bb 00 00 00    	js     4986 <lazysbrktest+0x186>
+    48cb:	83 ec 04             	sub    $0x4,%esp
+    48ce:	81 c6 a0 ef ff 01    	add    $0x1ffefa0,%esi
+    48d4:	68 d0 07 00 00       	push   $0x7d0
+    48d9:	56                   	push   %esi
+    48da:	50                   	push   %eax
+    48db:	e8 3b 08 00 00       	call   511b <read>
+    48e0:	83 c4 10             	add    $0x10,%esp
+    48e3:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+    48e8:	0f 85 98 00 00 00    	jne    4986 <lazysbrktest+0x186>
+  close(i);
+    48ee:	83 ec 0c             	sub    $0xc,%esp
+    48f1:	57                   	push   %edi
+    48f2:	e8 34 08 00 00       	call   512b <close>
+  if(sbrk(-n) != a + n){
+    48f7:	c7 04 24 00 00 00 fe 	movl   $0xfe000000,(%esp)
+    48fe:	e8 88 08 00 00       	call   518b <sbrk>
+    4903:	83 c4 10             	add    $0x10,%esp
+    4906:	39 c3                	cmp    %eax,%ebx
+    4908:	75 65                	jne    496f <lazysbrktest+0x16f>
+  printf(stdout, "lazy sbrk test ok\n");
+    490a:	83 ec 08             	sub    $0x8,%esp
+    490d:	68 66 68 00 00       	push   $0x6866
+    4912:	ff 35 04 90 00 00    	push   0x9004
+    4918:	e8 93 09 00 00       	call   52b0 <printf>
+}
+    491d:	83 c4 10             	add    $0x10,%esp
+    4920:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4923:	5b                   	pop    %ebx
+    4924:	5e                   	pop    %esi
+    4925:	5f                   	pop    %edi
+    4926:	5d                   	pop    %ebp
+    4927:	c3                   	ret
+      printf(stdout, "lazy sbrk test: page at %x not zero\n", p);
+    4928:	83 ec 04             	sub    $0x4,%esp
+    492b:	53                   	push   %ebx
+    492c:	68 4c 75 00 00       	push   $0x754c
+    4931:	ff 35 04 90 00 00    	push   0x9004
+    4937:	e8 74 09 00 00       	call   52b0 <printf>
+      exit();
+    493c:	e8 c2 07 00 00       	call   5103 <exit>
+    printf(stdout, "lazy sbrk test: sbrk allocated %d pages\n",
+    4941:	53                   	push   %ebx
+    4942:	50                   	push   %eax
+    4943:	68 20 75 00 00       	push   $0x7520
+    4948:	ff 35 04 90 00 00    	push   0x9004
+    494e:	e8 5d 09 00 00       	call   52b0 <printf>
+    exit();
+    4953:	e8 ab 07 00 00       	call   5103 <exit>
+    printf(stdout, "lazy sbrk test: sbrk failed\n");
+    4958:	56                   	push   %esi
+    4959:	56                   	push   %esi
+    495a:	68 49 68 00 00       	push   $0x6849
+    495f:	ff 35 04 90 00 00    	push   0x9004
+    4965:	e8 46 09 00 00       	call   52b0 <printf>
+    exit();
+    496a:	e8 94 07 00 00       	call   5103 <exit>
+    printf(stdout, "lazy sbrk test: could not shrink\n");
+    496f:	50                   	push   %eax
+    4970:	50                   	push   %eax
+    4971:	68 d8 75 00 00       	push   $0x75d8
+    4976:	ff 35 04 90 00 00    	push   0x9004
+    497c:	e8 2f 09 00 00       	call   52b0 <printf>
+    exit();
+    4981:	e8 7d 07 00 00       	call   5103 <exit>
+    printf(stdout, "lazy sbrk test: read into untouched pages failed\n");
+    4986:	52                   	push   %edx
+    4987:	52                   	push   %edx
+    4988:	68 a4 75 00 00       	push   $0x75a4
+    498d:	ff 35 04 90 00 00    	push   0x9004
+    4993:	e8 18 09 00 00       	call   52b0 <printf>
+    exit();
+    4998:	e8 66 07 00 00       	call   5103 <exit>
+    printf(stdout, "lazy sbrk test: touched 32 pages, %d allocated\n",
+    499d:	51                   	push   %ecx
+    499e:	50                   	push   %eax
+    499f:	68 74 75 00 00       	push   $0x7574
+    49a4:	ff 35 04 90 00 00    	push   0x9004
+    49aa:	e8 01 09 00 00       	call   52b0 <printf>
+    exit();
+    49af:	e8 4f 07 00 00       	call   5103 <exit>
+    49b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    49bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    49bf:	90                   	nop
+
+000049c0 <validateint>:
+}
+    49c0:	c3                   	ret
+    49c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    49c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    49cf:	90                   	nop
+
+000049d0 <validatetest>:
+{
+    49d0:	55                   	push   %ebp
+    49d1:	89 e5                	mov    %esp,%ebp
+    49d3:	56                   	push   %esi
+  for(p = 0; p <= (uint)hi; p += 4096){
+    49d4:	31 f6                	xor    %esi,%esi
+{
+    49d6:	53                   	push   %ebx
+  printf(stdout, "validate test\n");
+    49d7:	83 ec 08             	sub    $0x8,%esp
+    49da:	68 79 68 00 00       	push   $0x6879
+    49df:	ff 35 04 90 00 00    	push   0x9004
+    49e5:	e8 c6 08 00 00       	call   52b0 <printf>
+    49ea:	83 c4 10             	add    $0x10,%esp
+    49ed:	8d 76 00             	lea    0x0(%esi),%esi
+    if((pid = fork()) == 0){
+    49f0:	e8 06 07 00 00       	call   50fb <fork>
+    49f5:	89 c3                	mov    %eax,%ebx
+    49f7:	85 c0                	test   %eax,%eax
+    49f9:	74 63                	je     4a5e <validatetest+0x8e>
+    sleep(0);
+    49fb:	83 ec 0c             	sub    $0xc,%esp
+    49fe:	6a 00                	push   $0x0
+    4a00:	e8 8e 07 00 00       	call   5193 <sleep>
+    sleep(0);
+    4a05:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    4a0c:	e8 82 07 00 00       	call   5193 <sleep>
+    kill(pid);
+    4a11:	89 1c 24             	mov    %ebx,(%esp)
+    4a14:	e8 1a 07 00 00       	call   5133 <kill>
+    wait();
+    4a19:	e8 ed 06 00 00       	call   510b <wait>
+    if(link("nosuchfile", (char*)p) != -1){
+    4a1e:	58                   	pop    %eax
+    4a1f:	5a                   	pop    %edx
+    4a20:	56                   	push   %esi
+    4a21:	68 88 68 00 00       	push   $0x6888
+    4a26:	e8 38 07 00 00       	call   5163 <link>
+    4a2b:	83 c4 10             	add    $0x10,%esp
+    4a2e:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4a31:	75 30                	jne    4a63 <validatetest+0x93>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    4a33:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    4a39:	81 fe 00 40 11 00    	cmp    $0x114000,%esi
+    4a3f:	75 af                	jne    49f0 <validatetest+0x20>
+  printf(stdout, "validate ok\n");
+    4a41:	83 ec 08             	sub    $0x8,%esp
+    4a44:	68 ac 68 00 00       	push   $0x68ac
+    4a49:	ff 35 04 90 00 00    	push   0x9004
+    4a4f:	e8 5c 08 00 00       	call   52b0 <printf>
+}
+    4a54:	83 c4 10             	add    $0x10,%esp
+    4a57:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    4a5a:	5b                   	pop    %ebx
+    4a5b:	5e                   	pop    %esi
+    4a5c:	5d                   	pop    %ebp
+    4a5d:	c3                   	ret
+      exit();
+    4a5e:	e8 a0 06 00 00       	call   5103 <exit>
+      printf(stdout, "link should not succeed\n");
+    4a63:	83 ec 08             	sub    $0x8,%esp
+    4a66:	68 93 68 00 00       	push   $0x6893
+    4a6b:	ff 35 04 90 00 00    	push   0x9004
+    4a71:	e8 3a 08 00 00       	call   52b0 <printf>
+      exit();
+    4a76:	e8 88 06 00 00       	call   5103 <exit>
+    4a7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4a7f:	90                   	nop
+
+00004a80 <bsstest>:
+{
+    4a80:	55                   	push   %ebp
+    4a81:	89 e5                	mov    %esp,%ebp
+    4a83:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "bss test\n");
+    4a86:	68 b9 68 00 00       	push   $0x68b9
+    4a8b:	ff 35 04 90 00 00    	push   0x9004
+    4a91:	e8 1a 08 00 00       	call   52b0 <printf>
+    4a96:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    4a99:	31 c0                	xor    %eax,%eax
+    4a9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4a9f:	90                   	nop
+    if(uninit[i] != '\0'){
+    4aa0:	80 b8 20 90 00 00 00 	cmpb   $0x0,0x9020(%eax)
+    4aa7:	75 22                	jne    4acb <bsstest+0x4b>
+  for(i = 0; i < sizeof(uninit); i++){
+    4aa9:	83 c0 01             	add    $0x1,%eax
+    4aac:	3d 10 27 00 00       	cmp    $0x2710,%eax
+    4ab1:	75 ed                	jne    4aa0 <bsstest+0x20>
+  printf(stdout, "bss test ok\n");
+    4ab3:	83 ec 08             	sub    $0x8,%esp
+    4ab6:	68 d4 68 00 00       	push   $0x68d4
+    4abb:	ff 35 04 90 00 00    	push   0x9004
+    4ac1:	e8 ea 07 00 00       	call   52b0 <printf>
+}
+    4ac6:	83 c4 10             	add    $0x10,%esp
+    4ac9:	c9                   	leave
+    4aca:	c3                   	ret
+      printf(stdout, "bss test failed\n");
+    4acb:	83 ec 08             	sub    $0x8,%esp
+    4ace:	68 c3 68 00 00       	push   $0x68c3
+    4ad3:	ff 35 04 90 00 00    	push   0x9004
+    4ad9:	e8 d2 07 00 00       	call   52b0 <printf>
+      exit();
+    4ade:	e8 20 06 00 00       	call   5103 <exit>
+    4ae3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4aea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00004af0 <bigargtest>:
+{
+    4af0:	55                   	push   %ebp
+    4af1:	89 e5                	mov    %esp,%ebp
+    4af3:	83 ec 14             	sub    $0x14,%esp
+  unlink("bigarg-ok");
+    4af6:	68 e1 68 00 00       	push   $0x68e1
+    4afb:	e8 53 06 00 00       	call   5153 <unlink>
+  pid = fork();
+    4b00:	e8 f6 05 00 00       	call   50fb <fork>
+  if(pid == 0){
+    4b05:	83 c4 10             	add    $0x10,%esp
+    4b08:	85 c0                	test   %eax,%eax
+    4b0a:	74 44                	je     4b50 <bigargtest+0x60>
+  } else if(pid < 0){
+    4b0c:	0f 88 c3 00 00 00    	js     4bd5 <bigargtest+0xe5>
+  wait();
+    4b12:	e8 f4 05 00 00       	call   510b <wait>
+  fd = open("bigarg-ok", 0);
+    4b17:	83 ec 08             	sub    $0x8,%esp
+    4b1a:	6a 00                	push   $0x0
+    4b1c:	68 e1 68 00 00       	push   $0x68e1
+    4b21:	e8 1d 06 00 00       	call   5143 <open>
+  if(fd < 0){
+    4b26:	83 c4 10             	add    $0x10,%esp
+    4b29:	85 c0                	test   %eax,%eax
+    4b2b:	0f 88 8d 00 00 00    	js     4bbe <bigargtest+0xce>
+  close(fd);
+    4b31:	83 ec 0c             	sub    $0xc,%esp
+    4b34:	50                   	push   %eax
+    4b35:	e8 f1 05 00 00       	call   512b <close>
+  unlink("bigarg-ok");
+    4b3a:	c7 04 24 e1 68 00 00 	movl   $0x68e1,(%esp)
+    4b41:	e8 0d 06 00 00       	call   5153 <unlink>
+}
+    4b46:	83 c4 10             	add    $0x10,%esp
+    4b49:	c9                   	leave
+    4b4a:	c3                   	ret
+    4b4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4b4f:	90                   	nop
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    4b50:	c7 04 85 40 d7 00 00 	movl   $0x75fc,0xd740(,%eax,4)
+    4b57:	fc 75 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    4b5b:	83 c0 01             	add    $0x1,%eax
+    4b5e:	83 f8 1f             	cmp    $0x1f,%eax
+    4b61:	75 ed                	jne    4b50 <bigargtest+0x60>
+    args[MAXARG-1] = 0;
+    4b63:	31 c9                	xor    %ecx,%ecx
+    4b65:	89 0d bc d7 00 00    	mov    %ecx,0xd7bc
+    printf(stdout, "bigarg test\n");
+    4b6b:	50                   	push   %eax
+    4b6c:	50                   	push   %eax
+    4b6d:	68 eb 68 00 00       	push   $0x68eb
+    4b72:	ff 35 04 90 00 00    	push   0x9004
+    4b78:	e8 33 07 00 00       	call   52b0 <printf>
+    exec("echo", args);
+    4b7d:	58                   	pop    %eax
+    4b7e:	5a                   	pop    %edx
+    4b7f:	68 40 d7 00 00       	push   $0xd740
+    4b84:	68 d8 55 00 00       	push   $0x55d8
+    4b89:	e8 ad 05 00 00       	call   513b <exec>
+    printf(stdout, "bigarg test ok\n");
+    4b8e:	59                   	pop    %ecx
+    4b8f:	58                   	pop    %eax
+    4b90:	68 f8 68 00 00       	push   $0x68f8
+    4b95:	ff 35 04 90 00 00    	push   0x9004
+    4b9b:	e8 10 07 00 00       	call   52b0 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    4ba0:	58                   	pop    %eax
+    4ba1:	5a                   	pop    %edx
+    4ba2:	68 00 02 00 00       	push   $0x200
+    4ba7:	68 e1 68 00 00       	push   $0x68e1
+    4bac:	e8 92 05 00 00       	call   5143 <open>
+    close(fd);
+    4bb1:	89 04 24             	mov    %eax,(%esp)
+    4bb4:	e8 72 05 00 00       	call   512b <close>
+    exit();
+    4bb9:	e8 45 05 00 00       	call   5103 <exit>
+    printf(stdout, "bigarg test failed!\n");
+    4bbe:	50                   	push   %eax
+    4bbf:	50                   	push   %eax
+    4bc0:	68 21 69 00 00       	push   $0x6921
+    4bc5:	ff 35 04 90 00 00    	push   0x9004
+    4bcb:	e8 e0 06 00 00       	call   52b0 <printf>
+    exit();
+    4bd0:	e8 2e 05 00 00       	call   5103 <exit>
+    printf(stdout, "bigargtest: fork failed\n");
+    4bd5:	52                   	push   %edx
+    4bd6:	52                   	push   %edx
+    4bd7:	68 08 69 00 00       	push   $0x6908
+    4bdc:	ff 35 04 90 00 00    	push   0x9004
+    4be2:	e8 c9 06 00 00       	call   52b0 <printf>
+    exit();
+    4be7:	e8 17 05 00 00       	call   5103 <exit>
+    4bec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004bf0 <fsfull>:
+{
+    4bf0:	55                   	push   %ebp
+    4bf1:	89 e5                	mov    %esp,%ebp
+    4bf3:	57                   	push   %edi
+    4bf4:	56                   	push   %esi
+  for(nfiles = 0; ; nfiles++){
+    4bf5:	31 f6                	xor    %esi,%esi
+{
+    4bf7:	53                   	push   %ebx
+    4bf8:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "fsfull test\n");
+    4bfb:	68 36 69 00 00       	push   $0x6936
+    4c00:	6a 01                	push   $0x1
+    4c02:	e8 a9 06 00 00       	call   52b0 <printf>
+    4c07:	83 c4 10             	add    $0x10,%esp
+    4c0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    4c10:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    4c15:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    printf(1, "writing %s\n", name);
+    4c1a:	83 ec 04             	sub    $0x4,%esp
+    name[0] = 'f';
+    4c1d:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4c21:	f7 e6                	mul    %esi
+    name[5] = '\0';
+    4c23:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4c27:	c1 ea 06             	shr    $0x6,%edx
+    4c2a:	8d 42 30             	lea    0x30(%edx),%eax
+    4c2d:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4c30:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    4c36:	89 f2                	mov    %esi,%edx
+    4c38:	29 c2                	sub    %eax,%edx
+    4c3a:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    4c3f:	f7 e2                	mul    %edx
+    name[3] = '0' + (nfiles % 100) / 10;
+    4c41:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4c46:	c1 ea 05             	shr    $0x5,%edx
+    4c49:	83 c2 30             	add    $0x30,%edx
+    4c4c:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    4c4f:	f7 e6                	mul    %esi
+    4c51:	c1 ea 05             	shr    $0x5,%edx
+    4c54:	6b c2 64             	imul   $0x64,%edx,%eax
+    4c57:	89 f2                	mov    %esi,%edx
+    4c59:	29 c2                	sub    %eax,%edx
+    4c5b:	89 d0                	mov    %edx,%eax
+    4c5d:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    4c5f:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    4c61:	c1 ea 03             	shr    $0x3,%edx
+    4c64:	83 c2 30             	add    $0x30,%edx
+    4c67:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    4c6a:	f7 e1                	mul    %ecx
+    4c6c:	89 f0                	mov    %esi,%eax
+    4c6e:	c1 ea 03             	shr    $0x3,%edx
+    4c71:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    4c74:	01 d2                	add    %edx,%edx
+    4c76:	29 d0                	sub    %edx,%eax
+    4c78:	83 c0 30             	add    $0x30,%eax
+    4c7b:	88 45 ac             	mov    %al,-0x54(%ebp)
+    printf(1, "writing %s\n", name);
+    4c7e:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    4c81:	50                   	push   %eax
+    4c82:	68 43 69 00 00       	push   $0x6943
+    4c87:	6a 01                	push   $0x1
+    4c89:	e8 22 06 00 00       	call   52b0 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    4c8e:	58                   	pop    %eax
+    4c8f:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    4c92:	5a                   	pop    %edx
+    4c93:	68 02 02 00 00       	push   $0x202
+    4c98:	50                   	push   %eax
+    4c99:	e8 a5 04 00 00       	call   5143 <open>
+    if(fd < 0){
+    4c9e:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    4ca1:	89 c7                	mov    %eax,%edi
+    if(fd < 0){
+    4ca3:	85 c0                	test   %eax,%eax
+    4ca5:	78 4f                	js     4cf6 <fsfull+0x106>
+    int total = 0;
+    4ca7:	31 db                	xor    %ebx,%ebx
+    4ca9:	eb 07                	jmp    4cb2 <fsfull+0xc2>
+    4cab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4caf:	90                   	nop
+      total += cc;
+    4cb0:	01 c3                	add    %eax,%ebx
+      int cc = write(fd, buf, 512);
+    4cb2:	83 ec 04             	sub    $0x4,%esp
+    4cb5:	68 00 02 00 00       	push   $0x200
+    4cba:	68 40 b7 00 00       	push   $0xb740
+    4cbf:	57                   	push   %edi
+    4cc0:	e8 5e 04 00 00       	call   5123 <write>
+      if(cc < 512)
+    4cc5:	83 c4 10             	add    $0x10,%esp
+    4cc8:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    4ccd:	7f e1                	jg     4cb0 <fsfull+0xc0>
+    printf(1, "wrote %d bytes\n", total);
+    4ccf:	83 ec 04             	sub    $0x4,%esp
+    4cd2:	53                   	push   %ebx
+    4cd3:	68 5f 69 00 00       	push   $0x695f
+    4cd8:	6a 01                	push   $0x1
+    4cda:	e8 d1 05 00 00       	call   52b0 <printf>
+    close(fd);
+    4cdf:	89 3c 24             	mov    %edi,(%esp)
+    4ce2:	e8 44 04 00 00       	call   512b <close>
+    if(total == 0)
+    4ce7:	83 c4 10             	add    $0x10,%esp
+    4cea:	85 db                	test   %ebx,%ebx
+    4cec:	74 1e                	je     4d0c <fsfull+0x11c>
+  for(nfiles = 0; ; nfiles++){
+    4cee:	83 c6 01             	add    $0x1,%esi
+    4cf1:	e9 1a ff ff ff       	jmp    4c10 <fsfull+0x20>
+      printf(1, "open %s failed\n", name);
+    4cf6:	83 ec 04             	sub    $0x4,%esp
+    4cf9:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    4cfc:	50                   	push   %eax
+    4cfd:	68 4f 69 00 00       	push   $0x694f
+    4d02:	6a 01                	push   $0x1
+    4d04:	e8 a7 05 00 00       	call   52b0 <printf>
+      break;
+    4d09:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + nfiles / 1000;
+    4d0c:	bf d3 4d 62 10       	mov    $0x10624dd3,%edi
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4d11:	bb 1f 85 eb 51       	mov    $0x51eb851f,%ebx
+    4d16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4d1d:	8d 76 00             	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    4d20:	89 f0                	mov    %esi,%eax
+    unlink(name);
+    4d22:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'f';
+    4d25:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4d29:	f7 e7                	mul    %edi
+    name[5] = '\0';
+    4d2b:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4d2f:	c1 ea 06             	shr    $0x6,%edx
+    4d32:	8d 42 30             	lea    0x30(%edx),%eax
+    4d35:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4d38:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    4d3e:	89 f2                	mov    %esi,%edx
+    4d40:	29 c2                	sub    %eax,%edx
+    4d42:	89 d0                	mov    %edx,%eax
+    4d44:	f7 e3                	mul    %ebx
+    name[3] = '0' + (nfiles % 100) / 10;
+    4d46:	89 f0                	mov    %esi,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4d48:	c1 ea 05             	shr    $0x5,%edx
+    4d4b:	83 c2 30             	add    $0x30,%edx
+    4d4e:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    4d51:	f7 e3                	mul    %ebx
+    4d53:	c1 ea 05             	shr    $0x5,%edx
+    4d56:	6b ca 64             	imul   $0x64,%edx,%ecx
+    4d59:	89 f2                	mov    %esi,%edx
+    4d5b:	29 ca                	sub    %ecx,%edx
+    4d5d:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    4d62:	89 d0                	mov    %edx,%eax
+    4d64:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    4d66:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    4d68:	c1 ea 03             	shr    $0x3,%edx
+    4d6b:	83 c2 30             	add    $0x30,%edx
+    4d6e:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    4d71:	f7 e1                	mul    %ecx
+    4d73:	89 f0                	mov    %esi,%eax
+    nfiles--;
+    4d75:	83 ee 01             	sub    $0x1,%esi
+    name[4] = '0' + (nfiles % 10);
+    4d78:	c1 ea 03             	shr    $0x3,%edx
+    4d7b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    4d7e:	01 d2                	add    %edx,%edx
+    4d80:	29 d0                	sub    %edx,%eax
+    4d82:	83 c0 30             	add    $0x30,%eax
+    4d85:	88 45 ac             	mov    %al,-0x54(%ebp)
+    unlink(name);
+    4d88:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    4d8b:	50                   	push   %eax
+    4d8c:	e8 c2 03 00 00       	call   5153 <unlink>
+  while(nfiles >= 0){
+    4d91:	83 c4 10             	add    $0x10,%esp
+    4d94:	83 fe ff             	cmp    $0xffffffff,%esi
+    4d97:	75 87                	jne    4d20 <fsfull+0x130>
+  printf(1, "fsfull test finished\n");
+    4d99:	83 ec 08             	sub    $0x8,%esp
+    4d9c:	68 6f 69 00 00       	push   $0x696f
+    4da1:	6a 01                	push   $0x1
+    4da3:	e8 08 05 00 00       	call   52b0 <printf>
+}
+    4da8:	83 c4 10             	add    $0x10,%esp
+    4dab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4dae:	5b                   	pop    %ebx
+    4daf:	5e                   	pop    %esi
+    4db0:	5f                   	pop    %edi
+    4db1:	5d                   	pop    %ebp
+    4db2:	c3                   	ret
+    4db3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4dba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00004dc0 <uio>:
+{
+    4dc0:	55                   	push   %ebp
+    4dc1:	89 e5                	mov    %esp,%ebp
+    4dc3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "uio test\n");
+    4dc6:	68 85 69 00 00       	push   $0x6985
+    4dcb:	6a 01                	push   $0x1
+    4dcd:	e8 de 04 00 00       	call   52b0 <printf>
+  pid = fork();
+    4dd2:	e8 24 03 00 00       	call   50fb <fork>
+  if(pid == 0){
+    4dd7:	83 c4 10             	add    $0x10,%esp
+    4dda:	85 c0                	test   %eax,%eax
+    4ddc:	74 1b                	je     4df9 <uio+0x39>
+  } else if(pid < 0){
+    4dde:	78 3d                	js     4e1d <uio+0x5d>
+  wait();
+    4de0:	e8 26 03 00 00       	call   510b <wait>
+  printf(1, "uio test done\n");
+    4de5:	83 ec 08             	sub    $0x8,%esp
+    4de8:	68 8f 69 00 00       	push   $0x698f
+    4ded:	6a 01                	push   $0x1
+    4def:	e8 bc 04 00 00       	call   52b0 <printf>
+}
+    4df4:	83 c4 10             	add    $0x10,%esp
+    4df7:	c9                   	leave
+    4df8:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    4df9:	b8 09 00 00 00       	mov    $0x9,%eax
+    4dfe:	ba 70 00 00 00       	mov    $0x70,%edx
+    4e03:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    4e04:	ba 71 00 00 00       	mov    $0x71,%edx
+    4e09:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    4e0a:	52                   	push   %edx
+    4e0b:	52                   	push   %edx
+    4e0c:	68 dc 76 00 00       	push   $0x76dc
+    4e11:	6a 01                	push   $0x1
+    4e13:	e8 98 04 00 00       	call   52b0 <printf>
+    exit();
+    4e18:	e8 e6 02 00 00       	call   5103 <exit>
+    printf (1, "fork failed\n");
+    4e1d:	50                   	push   %eax
+    4e1e:	50                   	push   %eax
+    4e1f:	68 c9 5c 00 00       	push   $0x5cc9
+    4e24:	6a 01                	push   $0x1
+    4e26:	e8 85 04 00 00       	call   52b0 <printf>
+    exit();
+    4e2b:	e8 d3 02 00 00       	call   5103 <exit>
+
+00004e30 <argptest>:
+{
+    4e30:	55                   	push   %ebp
+    4e31:	89 e5                	mov    %esp,%ebp
+    4e33:	53                   	push   %ebx
+    4e34:	83 ec 0c             	sub    $0xc,%esp
+  fd = open("init", O_RDONLY);
+    4e37:	6a 00                	push   $0x0
+    4e39:	68 9e 69 00 00       	push   $0x699e
+    4e3e:	e8 00 03 00 00       	call   5143 <open>
+  if (fd < 0) {
+    4e43:	83 c4 10             	add    $0x10,%esp
+    4e46:	85 c0                	test   %eax,%eax
+    4e48:	78 39                	js     4e83 <argptest+0x53>
+  read(fd, sbrk(0) - 1, -1);
+    4e4a:	83 ec 0c             	sub    $0xc,%esp
+    4e4d:	89 c3                	mov    %eax,%ebx
+    4e4f:	6a 00                	push   $0x0
+    4e51:	e8 35 03 00 00       	call   518b <sbrk>
+    4e56:	83 c4 0c             	add    $0xc,%esp
+    4e59:	83 e8 01             	sub    $0x1,%eax
+    4e5c:	6a ff                	push   $0xffffffff
+    4e5e:	50                   	push   %eax
+    4e5f:	53                   	push   %ebx
+    4e60:	e8 b6 02 00 00       	call   511b <read>
+  close(fd);
+    4e65:	89 1c 24             	mov    %ebx,(%esp)
+    4e68:	e8 be 02 00 00       	call   512b <close>
+  printf(1, "arg test passed\n");
+    4e6d:	58                   	pop    %eax
+    4e6e:	5a                   	pop    %edx
+    4e6f:	68 b0 69 00 00       	push   $0x69b0
+    4e74:	6a 01                	push   $0x1
+    4e76:	e8 35 04 00 00       	call   52b0 <printf>
+}
+    4e7b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4e7e:	83 c4 10             	add    $0x10,%esp
+    4e81:	c9                   	leave
+    4e82:	c3                   	ret
+    printf(2, "open failed\n");
+    4e83:	51                   	push   %ecx
+    4e84:	51                   	push   %ecx
+    4e85:	68 a3 69 00 00       	push   $0x69a3
+    4e8a:	6a 02                	push   $0x2
+    4e8c:	e8 1f 04 00 00       	call   52b0 <printf>
+    exit();
+    4e91:	e8 6d 02 00 00       	call   5103 <exit>
+    4e96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4e9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004ea0 <rand>:
+  randstate = randstate * 1664525 + 1013904223;
+    4ea0:	69 05 00 90 00 00 0d 	imul   $0x19660d,0x9000,%eax
+    4ea7:	66 19 00 
+    4eaa:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    4eaf:	a3 00 90 00 00       	mov    %eax,0x9000
+}
+    4eb4:	c3                   	ret
+    4eb5:	66 90                	xchg   %ax,%ax
+    4eb7:	66 90                	xchg   %ax,%ax
+    4eb9:	66 90                	xchg   %ax,%ax
+    4ebb:	66 90                	xchg   %ax,%ax
+    4ebd:	66 90                	xchg   %ax,%ax
+    4ebf:	90                   	nop
+
+00004ec0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    4ec0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    4ec1:	31 c0                	xor    %eax,%eax
+{
+    4ec3:	89 e5                	mov    %esp,%ebp
+    4ec5:	53                   	push   %ebx
+    4ec6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    4ec9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    4ecc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    4ed0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    4ed4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    4ed7:	83 c0 01             	add    $0x1,%eax
+    4eda:	84 d2                	test   %dl,%dl
+    4edc:	75 f2                	jne    4ed0 <strcpy+0x10>
+    ;
+  return os;
+}
+    4ede:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4ee1:	89 c8                	mov    %ecx,%eax
+    4ee3:	c9                   	leave
+    4ee4:	c3                   	ret
+    4ee5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4eec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004ef0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    4ef0:	55                   	push   %ebp
+    4ef1:	89 e5                	mov    %esp,%ebp
+    4ef3:	53                   	push   %ebx
+    4ef4:	8b 55 08             	mov    0x8(%ebp),%edx
+    4ef7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    4efa:	0f b6 02             	movzbl (%edx),%eax
+    4efd:	84 c0                	test   %al,%al
+    4eff:	75 17                	jne    4f18 <strcmp+0x28>
+    4f01:	eb 3a                	jmp    4f3d <strcmp+0x4d>
+    4f03:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4f07:	90                   	nop
+    4f08:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    4f0c:	83 c2 01             	add    $0x1,%edx
+    4f0f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    4f12:	84 c0                	test   %al,%al
+    4f14:	74 1a                	je     4f30 <strcmp+0x40>
+    p++, q++;
+    4f16:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    4f18:	0f b6 19             	movzbl (%ecx),%ebx
+    4f1b:	38 c3                	cmp    %al,%bl
+    4f1d:	74 e9                	je     4f08 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    4f1f:	29 d8                	sub    %ebx,%eax
+}
+    4f21:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4f24:	c9                   	leave
+    4f25:	c3                   	ret
+    4f26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4f2d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    4f30:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    4f34:	31 c0                	xor    %eax,%eax
+    4f36:	29 d8                	sub    %ebx,%eax
+}
+    4f38:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4f3b:	c9                   	leave
+    4f3c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    4f3d:	0f b6 19             	movzbl (%ecx),%ebx
+    4f40:	31 c0                	xor    %eax,%eax
+    4f42:	eb db                	jmp    4f1f <strcmp+0x2f>
+    4f44:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4f4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4f4f:	90                   	nop
+
+00004f50 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    4f50:	55                   	push   %ebp
+    4f51:	89 e5                	mov    %esp,%ebp
+    4f53:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    4f56:	80 3a 00             	cmpb   $0x0,(%edx)
+    4f59:	74 15                	je     4f70 <strlen+0x20>
+    4f5b:	31 c0                	xor    %eax,%eax
+    4f5d:	8d 76 00             	lea    0x0(%esi),%esi
+    4f60:	83 c0 01             	add    $0x1,%eax
+    4f63:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    4f67:	89 c1                	mov    %eax,%ecx
+    4f69:	75 f5                	jne    4f60 <strlen+0x10>
+    ;
+  return n;
+}
+    4f6b:	89 c8                	mov    %ecx,%eax
+    4f6d:	5d                   	pop    %ebp
+    4f6e:	c3                   	ret
+    4f6f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    4f70:	31 c9                	xor    %ecx,%ecx
+}
+    4f72:	5d                   	pop    %ebp
+    4f73:	89 c8                	mov    %ecx,%eax
+    4f75:	c3                   	ret
+    4f76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4f7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004f80 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    4f80:	55                   	push   %ebp
+    4f81:	89 e5                	mov    %esp,%ebp
+    4f83:	57                   	push   %edi
+    4f84:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    4f87:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    4f8a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    4f8d:	89 d7                	mov    %edx,%edi
+    4f8f:	fc                   	cld
+    4f90:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    4f92:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    4f95:	89 d0                	mov    %edx,%eax
+    4f97:	c9                   	leave
+    4f98:	c3                   	ret
+    4f99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00004fa0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    4fa0:	55                   	push   %ebp
+    4fa1:	89 e5                	mov    %esp,%ebp
+    4fa3:	8b 45 08             	mov    0x8(%ebp),%eax
+    4fa6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    4faa:	0f b6 10             	movzbl (%eax),%edx
+    4fad:	84 d2                	test   %dl,%dl
+    4faf:	75 12                	jne    4fc3 <strchr+0x23>
+    4fb1:	eb 1d                	jmp    4fd0 <strchr+0x30>
+    4fb3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4fb7:	90                   	nop
+    4fb8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    4fbc:	83 c0 01             	add    $0x1,%eax
+    4fbf:	84 d2                	test   %dl,%dl
+    4fc1:	74 0d                	je     4fd0 <strchr+0x30>
+    if(*s == c)
+    4fc3:	38 d1                	cmp    %dl,%cl
+    4fc5:	75 f1                	jne    4fb8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    4fc7:	5d                   	pop    %ebp
+    4fc8:	c3                   	ret
+    4fc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    4fd0:	31 c0                	xor    %eax,%eax
+}
+    4fd2:	5d                   	pop    %ebp
+    4fd3:	c3                   	ret
+    4fd4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4fdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4fdf:	90                   	nop
+
+00004fe0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    4fe0:	55                   	push   %ebp
+    4fe1:	89 e5                	mov    %esp,%ebp
+    4fe3:	57                   	push   %edi
+    4fe4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    4fe5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    4fe8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    4fe9:	31 db                	xor    %ebx,%ebx
+{
+    4feb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    4fee:	eb 27                	jmp    5017 <gets+0x37>
+    cc = read(0, &c, 1);
+    4ff0:	83 ec 04             	sub    $0x4,%esp
+    4ff3:	6a 01                	push   $0x1
+    4ff5:	56                   	push   %esi
+    4ff6:	6a 00                	push   $0x0
+    4ff8:	e8 1e 01 00 00       	call   511b <read>
+    if(cc < 1)
+    4ffd:	83 c4 10             	add    $0x10,%esp
+    5000:	85 c0                	test   %eax,%eax
+    5002:	7e 1d                	jle    5021 <gets+0x41>
+      break;
+    buf[i++] = c;
+    5004:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    5008:	8b 55 08             	mov    0x8(%ebp),%edx
+    500b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    500f:	3c 0a                	cmp    $0xa,%al
+    5011:	74 10                	je     5023 <gets+0x43>
+    5013:	3c 0d                	cmp    $0xd,%al
+    5015:	74 0c                	je     5023 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    5017:	89 df                	mov    %ebx,%edi
+    5019:	83 c3 01             	add    $0x1,%ebx
+    501c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    501f:	7c cf                	jl     4ff0 <gets+0x10>
+    5021:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    5023:	8b 45 08             	mov    0x8(%ebp),%eax
+    5026:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    502a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    502d:	5b                   	pop    %ebx
+    502e:	5e                   	pop    %esi
+    502f:	5f                   	pop    %edi
+    5030:	5d                   	pop    %ebp
+    5031:	c3                   	ret
+    5032:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5039:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00005040 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    5040:	55                   	push   %ebp
+    5041:	89 e5                	mov    %esp,%ebp
+    5043:	56                   	push   %esi
+    5044:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    5045:	83 ec 08             	sub    $0x8,%esp
+    5048:	6a 00                	push   $0x0
+    504a:	ff 75 08             	push   0x8(%ebp)
+    504d:	e8 f1 00 00 00       	call   5143 <open>
+  if(fd < 0)
+    5052:	83 c4 10             	add    $0x10,%esp
+    5055:	85 c0                	test   %eax,%eax
+    5057:	78 27                	js     5080 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    5059:	83 ec 08             	sub    $0x8,%esp
+    505c:	ff 75 0c             	push   0xc(%ebp)
+    505f:	89 c3                	mov    %eax,%ebx
+    5061:	50                   	push   %eax
+    5062:	e8 f4 00 00 00       	call   515b <fstat>
+  close(fd);
+    5067:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    506a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    506c:	e8 ba 00 00 00       	call   512b <close>
+  return r;
+    5071:	83 c4 10             	add    $0x10,%esp
+}
+    5074:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    5077:	89 f0                	mov    %esi,%eax
+    5079:	5b                   	pop    %ebx
+    507a:	5e                   	pop    %esi
+    507b:	5d                   	pop    %ebp
+    507c:	c3                   	ret
+    507d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    5080:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    5085:	eb ed                	jmp    5074 <stat+0x34>
+    5087:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    508e:	66 90                	xchg   %ax,%ax
+
+00005090 <atoi>:
+
+int
+atoi(const char *s)
+{
+    5090:	55                   	push   %ebp
+    5091:	89 e5                	mov    %esp,%ebp
+    5093:	53                   	push   %ebx
+    5094:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    5097:	0f be 02             	movsbl (%edx),%eax
+    509a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    509d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    50a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    50a5:	77 1e                	ja     50c5 <atoi+0x35>
+    50a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    50ae:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    50b0:	83 c2 01             	add    $0x1,%edx
+    50b3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    50b6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    50ba:	0f be 02             	movsbl (%edx),%eax
+    50bd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    50c0:	80 fb 09             	cmp    $0x9,%bl
+    50c3:	76 eb                	jbe    50b0 <atoi+0x20>
+  return n;
+}
+    50c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    50c8:	89 c8                	mov    %ecx,%eax
+    50ca:	c9                   	leave
+    50cb:	c3                   	ret
+    50cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000050d0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    50d0:	55                   	push   %ebp
+    50d1:	89 e5                	mov    %esp,%ebp
+    50d3:	57                   	push   %edi
+    50d4:	56                   	push   %esi
+    50d5:	8b 45 10             	mov    0x10(%ebp),%eax
+    50d8:	8b 55 08             	mov    0x8(%ebp),%edx
+    50db:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    50de:	85 c0                	test   %eax,%eax
+    50e0:	7e 13                	jle    50f5 <memmove+0x25>
+    50e2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    50e4:	89 d7                	mov    %edx,%edi
+    50e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    50ed:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    50f0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    50f1:	39 f8                	cmp    %edi,%eax
+    50f3:	75 fb                	jne    50f0 <memmove+0x20>
+  return vdst;
+}
+    50f5:	5e                   	pop    %esi
+    50f6:	89 d0                	mov    %edx,%eax
+    50f8:	5f                   	pop    %edi
+    50f9:	5d                   	pop    %ebp
+    50fa:	c3                   	ret
+
+000050fb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    50fb:	b8 01 00 00 00       	mov    $0x1,%eax
+    5100:	cd 40                	int    $0x40
+    5102:	c3                   	ret
+
+00005103 <exit>:
+SYSCALL(exit)
+    5103:	b8 02 00 00 00       	mov    $0x2,%eax
+    5108:	cd 40                	int    $0x40
+    510a:	c3                   	ret
+
+0000510b <wait>:
+SYSCALL(wait)
+    510b:	b8 03 00 00 00       	mov    $0x3,%eax
+    5110:	cd 40                	int    $0x40
+    5112:	c3                   	ret
+
+00005113 <pipe>:
+SYSCALL(pipe)
+    5113:	b8 04 00 00 00       	mov    $0x4,%eax
+    5118:	cd 40                	int    $0x40
+    511a:	c3                   	ret
+
+0000511b <read>:
+SYSCALL(read)
+    511b:	b8 05 00 00 00       	mov    $0x5,%eax
+    5120:	cd 40                	int    $0x40
+    5122:	c3                   	ret
+
+00005123 <write>:
+SYSCALL(write)
+    5123:	b8 10 00 00 00       	mov    $0x10,%eax
+    5128:	cd 40                	int    $0x40
+    512a:	c3                   	ret
+
+0000512b <close>:
+SYSCALL(close)
+    512b:	b8 15 00 00 00       	mov    $0x15,%eax
+    5130:	cd 40                	int    $0x40
+    5132:	c3                   	ret
+
+00005133 <kill>:
+SYSCALL(kill)
+    5133:	b8 06 00 00 00       	mov    $0x6,%eax
+    5138:	cd 40                	int    $0x40
+    513a:	c3                   	ret
+
+0000513b <exec>:
+SYSCALL(exec)
+    513b:	b8 07 00 00 00       	mov    $0x7,%eax
+    5140:	cd 40                	int    $0x40
+    5142:	c3                   	ret
+
+00005143 <open>:
+SYSCALL(open)
+    5143:	b8 0f 00 00 00       	mov    $0xf,%eax
+    5148:	cd 40                	int    $0x40
+    514a:	c3                   	ret
+
+0000514b <mknod>:
+SYSCALL(mknod)
+    514b:	b8 11 00 00 00       	mov    $0x11,%eax
+    5150:	cd 40                	int    $0x40
+    5152:	c3                   	ret
+
+00005153 <unlink>:
+SYSCALL(unlink)
+    5153:	b8 12 00 00 00       	mov    $0x12,%eax
+    5158:	cd 40                	int    $0x40
+    515a:	c3                   	ret
+
+0000515b <fstat>:
+SYSCALL(fstat)
+    515b:	b8 08 00 00 00       	mov    $0x8,%eax
+    5160:	cd 40                	int    $0x40
+    5162:	c3                   	ret
+
+00005163 <link>:
+SYSCALL(link)
+    5163:	b8 13 00 00 00       	mov    $0x13,%eax
+    5168:	cd 40                	int    $0x40
+    516a:	c3                   	ret
+
+0000516b <mkdir>:
+SYSCALL(mkdir)
+    516b:	b8 14 00 00 00       	mov    $0x14,%eax
+    5170:	cd 40                	int    $0x40
+    5172:	c3                   	ret
+
+00005173 <chdir>:
+SYSCALL(chdir)
+    5173:	b8 09 00 00 00       	mov    $0x9,%eax
+    5178:	cd 40                	int    $0x40
+    517a:	c3                   	ret
+
+0000517b <dup>:
+SYSCALL(dup)
+    517b:	b8 0a 00 00 00       	mov    $0xa,%eax
+    5180:	cd 40                	int    $0x40
+    5182:	c3                   	ret
+
+00005183 <getpid>:
+SYSCALL(getpid)
+    5183:	b8 0b 00 00 00       	mov    $0xb,%eax
+    5188:	cd 40                	int    $0x40
+    518a:	c3                   	ret
+
+0000518b <sbrk>:
+SYSCALL(sbrk)
+    518b:	b8 0c 00 00 00       	mov    $0xc,%eax
+    5190:	cd 40                	int    $0x40
+    5192:	c3                   	ret
+
+00005193 <sleep>:
+SYSCALL(sleep)
+    5193:	b8 0d 00 00 00       	mov    $0xd,%eax
+    5198:	cd 40                	int    $0x40
+    519a:	c3                   	ret
+
+0000519b <uptime>:
+SYSCALL(uptime)
+    519b:	b8 0e 00 00 00       	mov    $0xe,%eax
+    51a0:	cd 40                	int    $0x40
+    51a2:	c3                   	ret
+
+000051a3 <memstat>:
+SYSCALL(memstat)
+    51a3:	b8 16 00 00 00       	mov    $0x16,%eax
+    51a8:	cd 40                	int    $0x40
+    51aa:	c3                   	ret
+
+000051ab <mmap>:
+SYSCALL(mmap)
+    51ab:	b8 17 00 00 00       	mov    $0x17,%eax
+    51b0:	cd 40                	int    $0x40
+    51b2:	c3                   	ret
+
+000051b3 <munmap>:
+SYSCALL(munmap)
+    51b3:	b8 18 00 00 00       	mov    $0x18,%eax
+    51b8:	cd 40                	int    $0x40
+    51ba:	c3                   	ret
+
+000051bb <shmget>:
+SYSCALL(shmget)
+    51bb:	b8 19 00 00 00       	mov    $0x19,%eax
+    51c0:	cd 40                	int    $0x40
+    51c2:	c3                   	ret
+
+000051c3 <shmat>:
+SYSCALL(shmat)
+    51c3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    51c8:	cd 40                	int    $0x40
+    51ca:	c3                   	ret
+
+000051cb <shmdt>:
+SYSCALL(shmdt)
+    51cb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    51d0:	cd 40                	int    $0x40
+    51d2:	c3                   	ret
+
+000051d3 <spawn>:
+SYSCALL(spawn)
+    51d3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    51d8:	cd 40                	int    $0x40
+    51da:	c3                   	ret
+
+000051db <setpriority>:
+SYSCALL(setpriority)
+    51db:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    51e0:	cd 40                	int    $0x40
+    51e2:	c3                   	ret
+
+000051e3 <procinfo>:
+SYSCALL(procinfo)
+    51e3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    51e8:	cd 40                	int    $0x40
+    51ea:	c3                   	ret
+
+000051eb <setaffinity>:
+SYSCALL(setaffinity)
+    51eb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    51f0:	cd 40                	int    $0x40
+    51f2:	c3                   	ret
+
+000051f3 <getaffinity>:
+SYSCALL(getaffinity)
+    51f3:	b8 20 00 00 00       	mov    $0x20,%eax
+    51f8:	cd 40                	int    $0x40
+    51fa:	c3                   	ret
+
+000051fb <shmrm>:
+SYSCALL(shmrm)
+    51fb:	b8 21 00 00 00       	mov    $0x21,%eax
+    5200:	cd 40                	int    $0x40
+    5202:	c3                   	ret
+    5203:	66 90                	xchg   %ax,%ax
+    5205:	66 90                	xchg   %ax,%ax
+    5207:	66 90                	xchg   %ax,%ax
+    5209:	66 90                	xchg   %ax,%ax
+    520b:	66 90                	xchg   %ax,%ax
+    520d:	66 90                	xchg   %ax,%ax
+    520f:	90                   	nop
+
+00005210 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    5210:	55                   	push   %ebp
+    5211:	89 e5                	mov    %esp,%ebp
+    5213:	57                   	push   %edi
+    5214:	56                   	push   %esi
+    5215:	53                   	push   %ebx
+    5216:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    5218:	89 d1                	mov    %edx,%ecx
+{
+    521a:	83 ec 3c             	sub    $0x3c,%esp
+    521d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    5220:	85 d2                	test   %edx,%edx
+    5222:	0f 89 80 00 00 00    	jns    52a8 <printint+0x98>
+    5228:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    522c:	74 7a                	je     52a8 <printint+0x98>
+    x = -xx;
+    522e:	f7 d9                	neg    %ecx
+    neg = 1;
+    5230:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    5235:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    5238:	31 f6                	xor    %esi,%esi
+    523a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    5240:	89 c8                	mov    %ecx,%eax
+    5242:	31 d2                	xor    %edx,%edx
+    5244:	89 f7                	mov    %esi,%edi
+    5246:	f7 f3                	div    %ebx
+    5248:	8d 76 01             	lea    0x1(%esi),%esi
+    524b:	0f b6 92 8c 77 00 00 	movzbl 0x778c(%edx),%edx
+    5252:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    5256:	89 ca                	mov    %ecx,%edx
+    5258:	89 c1                	mov    %eax,%ecx
+    525a:	39 da                	cmp    %ebx,%edx
+    525c:	73 e2                	jae    5240 <printint+0x30>
+  if(neg)
+    525e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    5261:	85 c0                	test   %eax,%eax
+    5263:	74 07                	je     526c <printint+0x5c>
+    buf[i++] = '-';
+    5265:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    526a:	89 f7                	mov    %esi,%edi
+    526c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    526f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    5272:	01 df                	add    %ebx,%edi
+    5274:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    5278:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    527b:	83 ec 04             	sub    $0x4,%esp
+    527e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    5281:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    5284:	6a 01                	push   $0x1
+    5286:	50                   	push   %eax
+    5287:	56                   	push   %esi
+    5288:	e8 96 fe ff ff       	call   5123 <write>
+  while(--i >= 0)
+    528d:	89 f8                	mov    %edi,%eax
+    528f:	83 c4 10             	add    $0x10,%esp
+    5292:	83 ef 01             	sub    $0x1,%edi
+    5295:	39 d8                	cmp    %ebx,%eax
+    5297:	75 df                	jne    5278 <printint+0x68>
+}
+    5299:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    529c:	5b                   	pop    %ebx
+    529d:	5e                   	pop    %esi
+    529e:	5f                   	pop    %edi
+    529f:	5d                   	pop    %ebp
+    52a0:	c3                   	ret
+    52a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    52a8:	31 c0                	xor    %eax,%eax
+    52aa:	eb 89                	jmp    5235 <printint+0x25>
+    52ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000052b0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    52b0:	55                   	push   %ebp
+    52b1:	89 e5                	mov    %esp,%ebp
+    52b3:	57                   	push   %edi
+    52b4:	56                   	push   %esi
+    52b5:	53                   	push   %ebx
+    52b6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    52b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    52bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    52bf:	0f b6 1e             	movzbl (%esi),%ebx
+    52c2:	83 c6 01             	add    $0x1,%esi
+    52c5:	84 db                	test   %bl,%bl
+    52c7:	74 67                	je     5330 <printf+0x80>
+    52c9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    52cc:	31 d2                	xor    %edx,%edx
+    52ce:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    52d1:	eb 34                	jmp    5307 <printf+0x57>
+    52d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    52d7:	90                   	nop
+    52d8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    52db:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    52e0:	83 f8 25             	cmp    $0x25,%eax
+    52e3:	74 18                	je     52fd <printf+0x4d>
+  write(fd, &c, 1);
+    52e5:	83 ec 04             	sub    $0x4,%esp
+    52e8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    52eb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    52ee:	6a 01                	push   $0x1
+    52f0:	50                   	push   %eax
+    52f1:	57                   	push   %edi
+    52f2:	e8 2c fe ff ff       	call   5123 <write>
+    52f7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    52fa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    52fd:	0f b6 1e             	movzbl (%esi),%ebx
+    5300:	83 c6 01             	add    $0x1,%esi
+    5303:	84 db                	test   %bl,%bl
+    5305:	74 29                	je     5330 <printf+0x80>
+    c = fmt[i] & 0xff;
+    5307:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    530a:	85 d2                	test   %edx,%edx
+    530c:	74 ca                	je     52d8 <printf+0x28>
+      }
+    } else if(state == '%'){
+    530e:	83 fa 25             	cmp    $0x25,%edx
+    5311:	75 ea                	jne    52fd <printf+0x4d>
+      if(c == 'd'){
+    5313:	83 f8 25             	cmp    $0x25,%eax
+    5316:	0f 84 24 01 00 00    	je     5440 <printf+0x190>
+    531c:	83 e8 63             	sub    $0x63,%eax
+    531f:	83 f8 15             	cmp    $0x15,%eax
+    5322:	77 1c                	ja     5340 <printf+0x90>
+    5324:	ff 24 85 34 77 00 00 	jmp    *0x7734(,%eax,4)
+    532b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    532f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    5330:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    5333:	5b                   	pop    %ebx
+    5334:	5e                   	pop    %esi
+    5335:	5f                   	pop    %edi
+    5336:	5d                   	pop    %ebp
+    5337:	c3                   	ret
+    5338:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    533f:	90                   	nop
+  write(fd, &c, 1);
+    5340:	83 ec 04             	sub    $0x4,%esp
+    5343:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    5346:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    534a:	6a 01                	push   $0x1
+    534c:	52                   	push   %edx
+    534d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    5350:	57                   	push   %edi
+    5351:	e8 cd fd ff ff       	call   5123 <write>
+    5356:	83 c4 0c             	add    $0xc,%esp
+    5359:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    535c:	6a 01                	push   $0x1
+    535e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    5361:	52                   	push   %edx
+    5362:	57                   	push   %edi
+    5363:	e8 bb fd ff ff       	call   5123 <write>
+        putc(fd, c);
+    5368:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    536b:	31 d2                	xor    %edx,%edx
+    536d:	eb 8e                	jmp    52fd <printf+0x4d>
+    536f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    5370:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    5373:	83 ec 0c             	sub    $0xc,%esp
+    5376:	b9 10 00 00 00       	mov    $0x10,%ecx
+    537b:	8b 13                	mov    (%ebx),%edx
+    537d:	6a 00                	push   $0x0
+    537f:	89 f8                	mov    %edi,%eax
+        ap++;
+    5381:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    5384:	e8 87 fe ff ff       	call   5210 <printint>
+        ap++;
+    5389:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    538c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    538f:	31 d2                	xor    %edx,%edx
+    5391:	e9 67 ff ff ff       	jmp    52fd <printf+0x4d>
+    5396:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    539d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    53a0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    53a3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    53a5:	83 c0 04             	add    $0x4,%eax
+    53a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    53ab:	85 db                	test   %ebx,%ebx
+    53ad:	0f 84 9d 00 00 00    	je     5450 <printf+0x1a0>
+        while(*s != 0){
+    53b3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    53b6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    53b8:	84 c0                	test   %al,%al
+    53ba:	0f 84 3d ff ff ff    	je     52fd <printf+0x4d>
+    53c0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    53c3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    53c6:	89 de                	mov    %ebx,%esi
+    53c8:	89 d3                	mov    %edx,%ebx
+    53ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    53d0:	83 ec 04             	sub    $0x4,%esp
+    53d3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    53d6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    53d9:	6a 01                	push   $0x1
+    53db:	53                   	push   %ebx
+    53dc:	57                   	push   %edi
+    53dd:	e8 41 fd ff ff       	call   5123 <write>
+        while(*s != 0){
+    53e2:	0f b6 06             	movzbl (%esi),%eax
+    53e5:	83 c4 10             	add    $0x10,%esp
+    53e8:	84 c0                	test   %al,%al
+    53ea:	75 e4                	jne    53d0 <printf+0x120>
+      state = 0;
+    53ec:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    53ef:	31 d2                	xor    %edx,%edx
+    53f1:	e9 07 ff ff ff       	jmp    52fd <printf+0x4d>
+    53f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    53fd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    5400:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    5403:	83 ec 0c             	sub    $0xc,%esp
+    5406:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    540b:	8b 13                	mov    (%ebx),%edx
+    540d:	6a 01                	push   $0x1
+    540f:	e9 6b ff ff ff       	jmp    537f <printf+0xcf>
+    5414:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    5418:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    541b:	83 ec 04             	sub    $0x4,%esp
+    541e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    5421:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    5423:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    5426:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    5429:	6a 01                	push   $0x1
+    542b:	52                   	push   %edx
+    542c:	57                   	push   %edi
+    542d:	e8 f1 fc ff ff       	call   5123 <write>
+        ap++;
+    5432:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    5435:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    5438:	31 d2                	xor    %edx,%edx
+    543a:	e9 be fe ff ff       	jmp    52fd <printf+0x4d>
+    543f:	90                   	nop
+  write(fd, &c, 1);
+    5440:	83 ec 04             	sub    $0x4,%esp
+    5443:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    5446:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    5449:	6a 01                	push   $0x1
+    544b:	e9 11 ff ff ff       	jmp    5361 <printf+0xb1>
+    5450:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    5455:	bb 2a 77 00 00       	mov    $0x772a,%ebx
+    545a:	e9 61 ff ff ff       	jmp    53c0 <printf+0x110>
+    545f:	90                   	nop
+
+00005460 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    5460:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    5461:	a1 c0 f1 00 00       	mov    0xf1c0,%eax
+{
+    5466:	89 e5                	mov    %esp,%ebp
+    5468:	57                   	push   %edi
+    5469:	56                   	push   %esi
+    546a:	53                   	push   %ebx
+    546b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    546e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    5471:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5478:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    547a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    547c:	39 ca                	cmp    %ecx,%edx
+    547e:	73 30                	jae    54b0 <free+0x50>
+    5480:	39 c1                	cmp    %eax,%ecx
+    5482:	72 04                	jb     5488 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    5484:	39 c2                	cmp    %eax,%edx
+    5486:	72 f0                	jb     5478 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    5488:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    548b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    548e:	39 f8                	cmp    %edi,%eax
+    5490:	74 2e                	je     54c0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    5492:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    5495:	8b 42 04             	mov    0x4(%edx),%eax
+    5498:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    549b:	39 f1                	cmp    %esi,%ecx
+    549d:	74 38                	je     54d7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    549f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    54a1:	5b                   	pop    %ebx
+  freep = p;
+    54a2:	89 15 c0 f1 00 00    	mov    %edx,0xf1c0
+}
+    54a8:	5e                   	pop    %esi
+    54a9:	5f                   	pop    %edi
+    54aa:	5d                   	pop    %ebp
+    54ab:	c3                   	ret
+    54ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    54b0:	39 c1                	cmp    %eax,%ecx
+    54b2:	72 d0                	jb     5484 <free+0x24>
+    54b4:	eb c2                	jmp    5478 <free+0x18>
+    54b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    54bd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    54c0:	03 70 04             	add    0x4(%eax),%esi
+    54c3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    54c6:	8b 02                	mov    (%edx),%eax
+    54c8:	8b 00                	mov    (%eax),%eax
+    54ca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    54cd:	8b 42 04             	mov    0x4(%edx),%eax
+    54d0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    54d3:	39 f1                	cmp    %esi,%ecx
+    54d5:	75 c8                	jne    549f <free+0x3f>
+    p->s.size += bp->s.size;
+    54d7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    54da:	89 15 c0 f1 00 00    	mov    %edx,0xf1c0
+    p->s.size += bp->s.size;
+    54e0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    54e3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    54e6:	89 0a                	mov    %ecx,(%edx)
+}
+    54e8:	5b                   	pop    %ebx
+    54e9:	5e                   	pop    %esi
+    54ea:	5f                   	pop    %edi
+    54eb:	5d                   	pop    %ebp
+    54ec:	c3                   	ret
+    54ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000054f0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    54f0:	55                   	push   %ebp
+    54f1:	89 e5                	mov    %esp,%ebp
+    54f3:	57                   	push   %edi
+    54f4:	56                   	push   %esi
+    54f5:	53                   	push   %ebx
+    54f6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    54f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    54fc:	8b 15 c0 f1 00 00    	mov    0xf1c0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    5502:	8d 78 07             	lea    0x7(%eax),%edi
+    5505:	c1 ef 03             	shr    $0x3,%edi
+    5508:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    550b:	85 d2                	test   %edx,%edx
+    550d:	0f 84 8d 00 00 00    	je     55a0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    5513:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    5515:	8b 48 04             	mov    0x4(%eax),%ecx
+    5518:	39 f9                	cmp    %edi,%ecx
+    551a:	73 64                	jae    5580 <malloc+0x90>
+  if(nu < 4096)
+    551c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    5521:	39 df                	cmp    %ebx,%edi
+    5523:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    5526:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    552d:	eb 0a                	jmp    5539 <malloc+0x49>
+    552f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    5530:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    5532:	8b 48 04             	mov    0x4(%eax),%ecx
+    5535:	39 f9                	cmp    %edi,%ecx
+    5537:	73 47                	jae    5580 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    5539:	89 c2                	mov    %eax,%edx
+    553b:	39 05 c0 f1 00 00    	cmp    %eax,0xf1c0
+    5541:	75 ed                	jne    5530 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    5543:	83 ec 0c             	sub    $0xc,%esp
+    5546:	56                   	push   %esi
+    5547:	e8 3f fc ff ff       	call   518b <sbrk>
+  if(p == (char*)-1)
+    554c:	83 c4 10             	add    $0x10,%esp
+    554f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    5552:	74 1c                	je     5570 <malloc+0x80>
+  hp->s.size = nu;
+    5554:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    5557:	83 ec 0c             	sub    $0xc,%esp
+    555a:	83 c0 08             	add    $0x8,%eax
+    555d:	50                   	push   %eax
+    555e:	e8 fd fe ff ff       	call   5460 <free>
+  return freep;
+    5563:	8b 15 c0 f1 00 00    	mov    0xf1c0,%edx
+      if((p = morecore(nunits)) == 0)
+    5569:	83 c4 10             	add    $0x10,%esp
+    556c:	85 d2                	test   %edx,%edx
+    556e:	75 c0                	jne    5530 <malloc+0x40>
+        return 0;
+  }
+}
+    5570:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    5573:	31 c0                	xor    %eax,%eax
+}
+    5575:	5b                   	pop    %ebx
+    5576:	5e                   	pop    %esi
+    5577:	5f                   	pop    %edi
+    5578:	5d                   	pop    %ebp
+    5579:	c3                   	ret
+    557a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    5580:	39 cf                	cmp    %ecx,%edi
+    5582:	74 4c                	je     55d0 <malloc+0xe0>
+        p->s.size -= nunits;
+    5584:	29 f9                	sub    %edi,%ecx
+    5586:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    5589:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    558c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    558f:	89 15 c0 f1 00 00    	mov    %edx,0xf1c0
+}
+    5595:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    5598:	83 c0 08             	add    $0x8,%eax
+}
+    559b:	5b                   	pop    %ebx
+    559c:	5e                   	pop    %esi
+    559d:	5f                   	pop    %edi
+    559e:	5d                   	pop    %ebp
+    559f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    55a0:	c7 05 c0 f1 00 00 c4 	movl   $0xf1c4,0xf1c0
+    55a7:	f1 00 00 
+    base.s.size = 0;
+    55aa:	b8 c4 f1 00 00       	mov    $0xf1c4,%eax
+    base.s.ptr = freep = prevp = &base;
+    55af:	c7 05 c4 f1 00 00 c4 	movl   $0xf1c4,0xf1c4
+    55b6:	f1 00 00 
+    base.s.size = 0;
+    55b9:	c7 05 c8 f1 00 00 00 	movl   $0x0,0xf1c8
+    55c0:	00 00 00 
+    if(p->s.size >= nunits){
+    55c3:	e9 54 ff ff ff       	jmp    551c <malloc+0x2c>
+    55c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    55cf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    55d0:	8b 08                	mov    (%eax),%ecx
+    55d2:	89 0a                	mov    %ecx,(%edx)
+    55d4:	eb b9                	jmp    558f <malloc+0x9f>
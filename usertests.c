@@ -7,6 +7,9 @@
 #include "syscall.h"
 #include "traps.h"
 #include "memlayout.h"
+#include "memstat.h"
+#include "procinfo.h"
+#include "mman.h"
 
 char buf[8192];
 char name[3];
@@ -457,6 +460,606 @@ mem(void)
   }
 }
 
+// fork() shares memory copy-on-write. Do writes by the
+// parent and the child stay private to each of them?
+void
+cowtest(void)
+{
+  char *p;
+  int i, pid, fds[2];
+
+  printf(1, "cow test\n");
+  p = sbrk(4*4096);
+  for(i = 0; i < 4*4096; i++)
+    p[i] = 'p';
+  if(pipe(fds) != 0){
+    printf(1, "cow test: pipe() failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(1, "cow test: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    for(i = 0; i < 4*4096; i += 2)
+      p[i] = 'c';
+    // the kernel writing into a shared page must copy it too
+    read(fds[0], p + 4096 + 1, 1);
+    for(i = 0; i < 4*4096; i++){
+      if(p[i] != (i % 2 == 0 ? 'c' : (i == 4096 + 1 ? 'x' : 'p'))){
+        printf(1, "cow test: child sees wrong data at %d\n", i);
+        exit();
+      }
+    }
+    exit();
+  }
+  write(fds[1], "x", 1);
+  wait();
+  for(i = 0; i < 4*4096; i++){
+    if(p[i] != 'p'){
+      printf(1, "cow test: parent sees child's write at %d\n", i);
+      exit();
+    }
+  }
+  close(fds[0]);
+  close(fds[1]);
+  sbrk(-4*4096);
+  printf(1, "cow test ok\n");
+}
+
+// processes running the same program share its pages
+// through the page cache, and cannot write to its text
+void
+pcachetest(void)
+{
+  struct memstat ms1, ms2;
+  char *args[] = { "echo", "pcache", "echo", 0 };
+  int i, fd, pid, ppid;
+
+  printf(1, "pcache test\n");
+  for(i = 0; i < 2; i++){
+    memstat(&ms1);
+    pid = fork();
+    if(pid < 0){
+      printf(1, "pcache test: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      exec("echo", args);
+      printf(1, "pcache test: exec echo failed\n");
+      exit();
+    }
+    wait();
+    memstat(&ms2);
+  }
+  if(ms2.pcmisses != ms1.pcmisses || ms2.pchits == ms1.pchits){
+    printf(1, "pcache test: second echo did not use the cache\n");
+    exit();
+  }
+
+  // nor can the kernel on its behalf
+  fd = open("echo", O_RDONLY);
+  if(fd < 0 || read(fd, (char*)pcachetest, 16) != -1 ||
+     pipe((int*)pcachetest) != -1){
+    printf(1, "pcache test: kernel wrote to text\n");
+    exit();
+  }
+  close(fd);
+
+  ppid = getpid();
+  pid = fork();
+  if(pid < 0){
+    printf(1, "pcache test: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    *(char*)pcachetest = 0;
+    printf(1, "pcache test: wrote to text\n");
+    kill(ppid);
+    exit();
+  }
+  wait();
+  printf(1, "pcache test ok\n");
+}
+
+// file-backed and anonymous mappings, private and shared
+void
+mmaptest(void)
+{
+  enum { N = 4096 + 100 };
+  char *p, *q;
+  int fd, i, pid, ppid;
+
+  printf(1, "mmap test\n");
+  fd = open("mmapfile", O_CREATE|O_RDWR);
+  for(i = 0; i < N; i++)
+    buf[i] = 'a' + i % 23;
+  if(fd < 0 || write(fd, buf, N) != N){
+    printf(1, "mmap test: cannot write mmapfile\n");
+    exit();
+  }
+
+  // private: reads the file, writes stay in this process
+  p = mmap(0, N, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+  if(p == MAP_FAILED){
+    printf(1, "mmap test: mmap private failed\n");
+    exit();
+  }
+  for(i = 0; i < 2*4096; i++){
+    if(p[i] != (i < N ? 'a' + i % 23 : 0)){
+      printf(1, "mmap test: wrong data at %d\n", i);
+      exit();
+    }
+  }
+  p[0] = 'X';
+  if(munmap(p, N) < 0){
+    printf(1, "mmap test: munmap failed\n");
+    exit();
+  }
+  close(fd);
+  fd = open("mmapfile", O_RDWR);
+  if(read(fd, buf, 1) != 1 || buf[0] != 'a'){
+    printf(1, "mmap test: private write reached the file\n");
+    exit();
+  }
+
+  // shared: writes reach the file when unmapped
+  p = mmap(0, N, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+  if(p == MAP_FAILED){
+    printf(1, "mmap test: mmap shared failed\n");
+    exit();
+  }
+  p[0] = 'Y';
+  p[N-1] = 'Z';
+  munmap(p, N);
+  close(fd);
+  fd = open("mmapfile", O_RDWR);
+  if(read(fd, buf, N) != N || buf[0] != 'Y' || buf[N-1] != 'Z'){
+    printf(1, "mmap test: shared write did not reach the file\n");
+    exit();
+  }
+  close(fd);
+
+  // read-only: the kernel cannot write it on our behalf either
+  fd = open("mmapfile", O_RDWR);
+  p = mmap(0, N, PROT_READ, MAP_SHARED, fd, 0);
+  if(p == MAP_FAILED || read(fd, p, 10) != -1 || p[0] != 'Y'){
+    printf(1, "mmap test: read into a read-only mapping\n");
+    exit();
+  }
+  munmap(p, N);
+  close(fd);
+  unlink("mmapfile");
+
+  // anonymous: private pages are copied by fork, shared ones are not
+  p = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+  q = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+  if(p == MAP_FAILED || q == MAP_FAILED || p[0] != 0 || q[0] != 0){
+    printf(1, "mmap test: anonymous mmap failed\n");
+    exit();
+  }
+  p[0] = 'p';
+  pid = fork();
+  if(pid < 0){
+    printf(1, "mmap test: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    if(p[0] != 'p')
+      printf(1, "mmap test: child lost private data\n");
+    p[0] = 'c';
+    q[0] = 'c';
+    exit();
+  }
+  wait();
+  if(p[0] != 'p' || q[0] != 'c'){
+    printf(1, "mmap test: fork sharing wrong\n");
+    exit();
+  }
+  munmap(p, 4096);
+  munmap(q, 4096);
+
+  // unmapped memory is gone
+  ppid = getpid();
+  pid = fork();
+  if(pid == 0){
+    p[0] = 'x';
+    printf(1, "mmap test: wrote to unmapped memory\n");
+    kill(ppid);
+    exit();
+  }
+  wait();
+  printf(1, "mmap test ok\n");
+}
+
+// byte j of page i of the swap test: odd pages do not compress
+char
+swapbyte(int i, int j)
+{
+  if(i % 2 == 0)
+    return i;
+  return ((uint)(i*4096 + j) * 1103515245) >> 16;
+}
+
+// when memory runs out, pages are compressed or go to disk,
+// and come back intact
+void
+swaptest(void)
+{
+  enum { N = 64 };
+  struct memstat ms, ms1;
+  int i, j, pid, fds[2];
+  char *p, *q, c;
+
+  printf(1, "swap test\n");
+  memstat(&ms1);
+  if(ms1.swappages == 0){
+    printf(1, "swap test: no swap space\n");
+    exit();
+  }
+  if(pipe(fds) != 0){
+    printf(1, "swap test: pipe failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(1, "swap test: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    // use up memory until a few thousand pages are swapped out
+    read(fds[0], &c, 1);
+    for(i = 0; ; i++){
+      if((q = sbrk(4096)) == (char*)0xffffffff)
+        break;
+      *q = 1;
+      if(i % 256 == 0 && memstat(&ms) == 0 &&
+         ms.swapouts - ms1.swapouts >= 4096)
+        break;
+    }
+    exit();
+  }
+  p = sbrk(N*4096);
+  for(i = 0; i < N; i++)
+    for(j = 0; j < 4096; j++)
+      p[i*4096 + j] = swapbyte(i, j);
+  write(fds[1], "x", 1);
+  wait();
+  close(fds[0]);
+  close(fds[1]);
+
+  memstat(&ms);
+  if(ms.swapouts == ms1.swapouts){
+    printf(1, "swap test: nothing was swapped out\n");
+    exit();
+  }
+  for(i = 0; i < N; i++){
+    for(j = 0; j < 4096; j++){
+      if(p[i*4096 + j] != swapbyte(i, j)){
+        printf(1, "swap test: page %d corrupted\n", i);
+        exit();
+      }
+    }
+  }
+  sbrk(-N*4096);
+  printf(1, "swap test ok\n");
+}
+
+// processes that attach the same shared-memory segment see
+// each other's writes, and the segment goes away with the last
+void
+shmtest(void)
+{
+  int i, id, pid;
+  char *p, *q;
+
+  printf(1, "shm test\n");
+  if((id = shmget(4321, 8192)) < 0 || (p = shmat(id)) == (char*)-1){
+    printf(1, "shm test: cannot attach\n");
+    exit();
+  }
+  p[0] = 'a';
+  p[8191] = 'b';
+  pid = fork();
+  if(pid < 0){
+    printf(1, "shm test: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    // attach it again by key; the inherited mapping stays shared
+    if(shmget(4321, 0) != id || (q = shmat(id)) == (char*)-1 || q == p){
+      printf(1, "shm test: child cannot attach\n");
+      exit();
+    }
+    if(q[0] != 'a' || q[8191] != 'b'){
+      printf(1, "shm test: child sees wrong data\n");
+      exit();
+    }
+    q[1] = 'c';
+    shmdt(q);
+    p[2] = 'd';
+    exit();
+  }
+  wait();
+  if(p[1] != 'c' || p[2] != 'd'){
+    printf(1, "shm test: parent does not see child's writes\n");
+    exit();
+  }
+  if(shmdt(p) != 0 || shmdt(p) == 0){
+    printf(1, "shm test: shmdt failed\n");
+    exit();
+  }
+  if(shmget(4321, 0) >= 0){
+    printf(1, "shm test: segment outlived its last detach\n");
+    exit();
+  }
+
+  // segments never attached stay until removed
+  for(i = 0; i < 2*NSHM; i++){
+    if((id = shmget(0, 4096)) < 0 || shmrm(id) != 0 || shmrm(id) == 0 ||
+       shmat(id) != (char*)-1){
+      printf(1, "shm test: shmrm failed\n");
+      exit();
+    }
+  }
+  printf(1, "shm test ok\n");
+}
+
+// spawn() starts a program in a new process with the descriptors
+// it is given.
+void
+spawntest(void)
+{
+  char *args[] = { "echo", "spawned", 0 };
+  char buf[32];
+  int fds[3], p[2], pid, n, m;
+
+  printf(1, "spawn test\n");
+  if(pipe(p) != 0){
+    printf(1, "spawn test: pipe failed\n");
+    exit();
+  }
+  fds[0] = -1;
+  fds[1] = p[1];
+  fds[2] = 2;
+  pid = spawn("echo", args, fds);
+  close(p[1]);
+  if(pid < 0){
+    printf(1, "spawn test: spawn failed\n");
+    exit();
+  }
+  n = 0;
+  while((m = read(p[0], buf + n, sizeof(buf) - 1 - n)) > 0)
+    n += m;
+  close(p[0]);
+  buf[n] = 0;
+  if(wait() != pid || strcmp(buf, "spawned\n") != 0){
+    printf(1, "spawn test: wrong output %s\n", buf);
+    exit();
+  }
+  fds[1] = NOFILE;
+  if(spawn("nosuchprogram", args, 0) >= 0 || spawn("echo", args, fds) >= 0){
+    printf(1, "spawn test: bad spawn succeeded\n");
+    exit();
+  }
+  printf(1, "spawn test ok\n");
+}
+
+// mmap with MAP_LARGE gives 4MB pages, which fork shares
+// copy-on-write and munmap only removes whole.
+void
+lgpagetest(void)
+{
+  enum { LPG = 4*1024*1024 };
+  char *p;
+  int i, pid;
+
+  printf(1, "large page test\n");
+  if(mmap(0, LPG, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_LARGE, 0, 0) != MAP_FAILED){
+    printf(1, "large page test: file mapping succeeded\n");
+    exit();
+  }
+  p = mmap(0, 2*LPG, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS|MAP_LARGE, -1, 0);
+  if(p == MAP_FAILED || (uint)p % LPG != 0){
+    printf(1, "large page test: mmap failed\n");
+    exit();
+  }
+  for(i = 0; i < 2*LPG; i += 4096)
+    p[i] = i / 4096;
+  pid = fork();
+  if(pid < 0){
+    printf(1, "large page test: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    for(i = 0; i < 2*LPG; i += 4096){
+      if(p[i] != (char)(i / 4096)){
+        printf(1, "large page test: child sees wrong data\n");
+        exit();
+      }
+      p[i] = 0;
+    }
+    exit();
+  }
+  wait();
+  for(i = 0; i < 2*LPG; i += 4096){
+    if(p[i] != (char)(i / 4096)){
+      printf(1, "large page test: child's writes leaked\n");
+      exit();
+    }
+  }
+  if(munmap(p, 4096) == 0 || munmap(p + LPG, LPG) != 0){
+    printf(1, "large page test: munmap wrong\n");
+    exit();
+  }
+  if(p[LPG - 4096] != (char)(LPG/4096 - 1) || munmap(p, LPG) != 0){
+    printf(1, "large page test: munmap failed\n");
+    exit();
+  }
+  printf(1, "large page test ok\n");
+}
+
+// Use about n KB of stack.
+int
+stackdepth(int n)
+{
+  volatile char buf[1000];
+
+  buf[0] = n;
+  if(n == 0)
+    return 0;
+  return stackdepth(n - 1) + buf[0];
+}
+
+// The user stack grows on demand up to USTACKSIZE. Recursing
+// further runs into the guard page and kills the process.
+void
+stacktest(void)
+{
+  int pid, fd[2];
+  char c;
+
+  printf(1, "stack test\n");
+  if(pipe(fd) != 0){
+    printf(1, "stack test: pipe failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid == 0){
+    stackdepth(USTACKSIZE/1024/2);
+    write(fd[1], "x", 1);
+    exit();
+  }
+  if(pid < 0){
+    printf(1, "stack test: fork failed\n");
+    exit();
+  }
+  wait();
+  pid = fork();
+  if(pid == 0){
+    stackdepth(USTACKSIZE/1000 + 16);
+    write(fd[1], "y", 1);
+    exit();
+  }
+  if(pid < 0){
+    printf(1, "stack test: fork failed\n");
+    exit();
+  }
+  wait();
+  close(fd[1]);
+  if(read(fd[0], &c, 1) != 1 || c != 'x'){
+    printf(1, "stack test: deep recursion failed\n");
+    exit();
+  }
+  if(read(fd[0], &c, 1) != 0){
+    printf(1, "stack test: stack overflow not caught\n");
+    exit();
+  }
+  close(fd[0]);
+  printf(1, "stack test ok\n");
+}
+
+// setpriority() sets the nice level, which procinfo() shows and
+// fork() passes on.
+void
+priotest(void)
+{
+  static struct procinfo pi[NPROC];
+  int i, n, pid, me, seen;
+
+  printf(1, "priority test\n");
+  if(setpriority(0, -1) == 0 || setpriority(0, NPRIO) == 0 ||
+     setpriority(1 << 30, 0) == 0){
+    printf(1, "priority test: bad setpriority succeeded\n");
+    exit();
+  }
+  if(setpriority(0, NPRIO-1) != 0){
+    printf(1, "priority test: setpriority failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid == 0){
+    sleep(100);
+    exit();
+  }
+  if(pid < 0){
+    printf(1, "priority test: fork failed\n");
+    exit();
+  }
+  me = getpid();
+  n = procinfo(pi, NPROC);
+  seen = 0;
+  for(i = 0; i < n; i++){
+    if((pi[i].pid == me || pi[i].pid == pid) && pi[i].nice == NPRIO-1)
+      seen++;
+    if(pi[i].pid == pid && pi[i].ppid != me)
+      seen = -10;
+  }
+  kill(pid);
+  wait();
+  setpriority(0, 0);
+  if(seen != 2){
+    printf(1, "priority test: procinfo wrong\n");
+    exit();
+  }
+  printf(1, "priority test ok\n");
+}
+
+// The CPU that procinfo says the current process last ran on.
+int
+lastcpu(void)
+{
+  static struct procinfo pi[NPROC];
+  int i, n, me;
+
+  me = getpid();
+  n = procinfo(pi, NPROC);
+  for(i = 0; i < n; i++)
+    if(pi[i].pid == me)
+      return pi[i].cpu;
+  return -1;
+}
+
+// pin to one CPU, and the child inherits it.
+void
+affinitytest(void)
+{
+  uint all, one;
+  int cpu, pid;
+
+  printf(1, "affinity test\n");
+  all = getaffinity(0);
+  if(all == 0 || (int)all < 0 || setaffinity(0, 0) == 0 ||
+     getaffinity(1 << 30) != -1){
+    printf(1, "affinity test: bad mask\n");
+    exit();
+  }
+  one = all & -all;
+  for(cpu = 0; (one & (1 << cpu)) == 0; cpu++)
+    ;
+  if(setaffinity(0, one) != 0 || getaffinity(0) != one || lastcpu() != cpu){
+    printf(1, "affinity test: pinning failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid == 0){
+    sleep(1);
+    if(getaffinity(0) != one || lastcpu() != cpu){
+      printf(1, "affinity test: child not pinned\n");
+      exit();
+    }
+    exit();
+  }
+  if(pid < 0){
+    printf(1, "affinity test: fork failed\n");
+    exit();
+  }
+  wait();
+  setaffinity(0, all);
+  printf(1, "affinity test ok\n");
+}
+
 // More file system tests
 
 // two processes write to the same file descriptor
@@ -1546,6 +2149,56 @@ sbrktest(void)
   printf(stdout, "sbrk test OK\n");
 }
 
+// sbrk() only reserves address space; pages are allocated
+// and zeroed when first touched.
+void
+lazysbrktest(void)
+{
+  struct memstat before, after;
+  char *a, *p;
+  int i, n;
+
+  printf(stdout, "lazy sbrk test\n");
+  n = 32*1024*1024;
+  memstat(&before);
+  a = sbrk(n);
+  if(a == (char*)0xffffffff){
+    printf(stdout, "lazy sbrk test: sbrk failed\n");
+    exit();
+  }
+  memstat(&after);
+  if(before.freepages - after.freepages > 16){
+    printf(stdout, "lazy sbrk test: sbrk allocated %d pages\n",
+           before.freepages - after.freepages);
+    exit();
+  }
+  for(p = a; p < a + n; p += 1024*1024){
+    if(*p != 0){
+      printf(stdout, "lazy sbrk test: page at %x not zero\n", p);
+      exit();
+    }
+    *p = 1;
+  }
+  memstat(&after);
+  if(before.freepages - after.freepages > 32 + 16){
+    printf(stdout, "lazy sbrk test: touched 32 pages, %d allocated\n",
+           before.freepages - after.freepages);
+    exit();
+  }
+  // the kernel must fault in untouched pages it is asked to fill
+  i = open("README", 0);
+  if(i < 0 || read(i, a + n - 8192 + 4000, 2000) != 2000){
+    printf(stdout, "lazy sbrk test: read into untouched pages failed\n");
+    exit();
+  }
+  close(i);
+  if(sbrk(-n) != a + n){
+    printf(stdout, "lazy sbrk test: could not shrink\n");
+    exit();
+  }
+  printf(stdout, "lazy sbrk test ok\n");
+}
+
 void
 validateint(int *p)
 {
@@ -1768,6 +2421,7 @@ main(int argc, char *argv[])
   bigargtest();
   bsstest();
   sbrktest();
+  lazysbrktest();
   validatetest();
 
   opentest();
@@ -1780,6 +2434,16 @@ main(int argc, char *argv[])
   iputtest();
 
   mem();
+  cowtest();
+  pcachetest();
+  mmaptest();
+  swaptest();
+  shmtest();
+  spawntest();
+  lgpagetest();
+  stacktest();
+  priotest();
+  affinitytest();
   pipe1();
   preempt();
   exitwait();
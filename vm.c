@@ -6,8 +6,15 @@
 #include "mmu.h"
 #include "proc.h"
 #include "elf.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+#include "stat.h"
+#include "shm.h"
 
 extern char data[];  // defined by kernel.ld
+extern char end[];   // first address after kernel loaded from ELF file
 pde_t *kpgdir;  // for use in scheduler()
 
 // Set up CPU's kernel segment descriptors.
@@ -31,7 +38,9 @@ seginit(void)
 
 // Return the address of the PTE in page table pgdir
 // that corresponds to virtual address va.  If alloc!=0,
-// create any required page table pages.
+// create any required page table pages. If va lies in a
+// large page, return the address of its PDE instead, which
+// has PTE_PS set and otherwise reads like a PTE.
 static pte_t *
 walkpgdir(pde_t *pgdir, const void *va, int alloc)
 {
@@ -39,13 +48,14 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc)
   pte_t *pgtab;
 
   pde = &pgdir[PDX(va)];
+  if((*pde & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+    return pde;
   if(*pde & PTE_P){
     pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
   } else {
-    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
-      return 0;
     // Make sure all those PTE_P bits are zero.
-    memset(pgtab, 0, PGSIZE);
+    if(!alloc || (pgtab = (pte_t*)kalloc_zeroed()) == 0)
+      return 0;
     // The permissions here are overly generous, but they can
     // be further restricted by the permissions in the page table
     // entries, if necessary.
@@ -79,68 +89,116 @@ mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
   return 0;
 }
 
+// Create large-page directory entries for virtual addresses
+// starting at va that refer to physical addresses starting at pa.
+// va, pa and size must be multiples of LPGSIZE.
+static void
+maplgpages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
+{
+  char *a, *last;
+  pde_t *pde;
+
+  a = (char*)va;
+  last = (char*)va + size - LPGSIZE;
+  for(;;){
+    pde = &pgdir[PDX(a)];
+    if(*pde & PTE_P)
+      panic("remap");
+    *pde = pa | perm | PTE_PS | PTE_P;
+    if(a == last)
+      break;
+    a += LPGSIZE;
+    pa += LPGSIZE;
+  }
+}
+
 // There is one page table per process, plus one that's used when
 // a CPU is not running any process (kpgdir). The kernel uses the
 // current process's page table during system calls and interrupts;
 // page protection bits prevent user code from using the kernel's
-// mappings.
+// mappings. kvmalloc() builds the kernel's second-level page
+// tables once, and setupkvm() points every new page directory
+// at those same tables, so they are never copied or freed.
 //
-// setupkvm() and exec() set up every page table like this:
+// kvmalloc(), setupkvm() and exec() set up every page table like this:
 //
 //   0..KERNBASE: user memory (text+data+stack+heap), mapped to
 //                phys memory allocated by the kernel
 //   KERNBASE..KERNBASE+EXTMEM: mapped to 0..EXTMEM (for I/O space)
 //   KERNBASE+EXTMEM..data: mapped to EXTMEM..V2P(data)
 //                for the kernel's instructions and r/o data
-//   data..KERNBASE+PHYSTOP: mapped to V2P(data)..PHYSTOP,
+//   data..KERNBASE+LPGSIZE: mapped to V2P(data)..LPGSIZE,
 //                                  rw data + free physical memory
-//   0xfe000000..0: mapped direct (devices such as ioapic)
+//   KERNBASE+LPGSIZE..KERNBASE+physstop: mapped to LPGSIZE..physstop
+//                with 4 Mbyte pages, free physical memory
+//   0xfe000000..0: mapped direct with 4 Mbyte pages
+//                (devices such as ioapic)
 //
 // The kernel allocates physical memory for its heap and for user memory
-// between V2P(end) and the end of physical memory (PHYSTOP)
-// (directly addressable from end..P2V(PHYSTOP)).
+// between V2P(end) and the end of physical memory (physstop, found
+// by kinit1 from the BIOS memory map) (directly addressable from
+// end..P2V(physstop)).
+//
+// All kernel mappings are PTE_G, so the TLB keeps them when
+// switchuvm() and switchkvm() reload %cr3. That is only safe
+// because the kernel half is identical in every page table.
 
 // This table defines the kernel's mappings, which are present in
-// every process's page table.
+// every process's page table. The end of KM_MEM is physstop,
+// which kvmalloc() fills in.
+enum { KM_IO, KM_TEXT, KM_DATA, KM_MEM, KM_DEV };
+
 static struct kmap {
   void *virt;
   uint phys_start;
   uint phys_end;
   int perm;
 } kmap[] = {
- { (void*)KERNBASE, 0,             EXTMEM,    PTE_W}, // I/O space
- { (void*)KERNLINK, V2P(KERNLINK), V2P(data), 0},     // kern text+rodata
- { (void*)data,     V2P(data),     PHYSTOP,   PTE_W}, // kern data+memory
- { (void*)DEVSPACE, DEVSPACE,      0,         PTE_W}, // more devices
+ [KM_IO]   = { (void*)KERNBASE, 0,             EXTMEM,    PTE_W|PTE_G}, // I/O space
+ [KM_TEXT] = { (void*)KERNLINK, V2P(KERNLINK), V2P(data), PTE_G},      // kern text+rodata
+ [KM_DATA] = { (void*)data,     V2P(data),     LPGSIZE,   PTE_W|PTE_G}, // kern data+memory
+ [KM_MEM]  = { P2V(LPGSIZE),    LPGSIZE,       0,         PTE_W|PTE_G|PTE_PS}, // memory
+ [KM_DEV]  = { (void*)DEVSPACE, DEVSPACE,      0,         PTE_W|PTE_G|PTE_PS}, // devices
 };
 
-// Set up kernel part of a page table.
+// Set up kernel part of a page table by sharing
+// kpgdir's kernel page tables.
 pde_t*
 setupkvm(void)
 {
   pde_t *pgdir;
-  struct kmap *k;
 
-  if((pgdir = (pde_t*)kalloc()) == 0)
+  if((pgdir = (pde_t*)kalloc_zeroed()) == 0)
     return 0;
-  memset(pgdir, 0, PGSIZE);
-  if (P2V(PHYSTOP) > (void*)DEVSPACE)
-    panic("PHYSTOP too high");
-  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
-    if(mappages(pgdir, k->virt, k->phys_end - k->phys_start,
-                (uint)k->phys_start, k->perm) < 0) {
-      freevm(pgdir);
-      return 0;
-    }
+  memmove(&pgdir[PDX(KERNBASE)], &kpgdir[PDX(KERNBASE)],
+          (NPDENTRIES - PDX(KERNBASE)) * sizeof(pde_t));
   return pgdir;
 }
 
 // Allocate one page table for the machine for the kernel address
-// space for scheduler processes.
+// space for scheduler processes. Its kernel half is shared by
+// every page table that setupkvm() creates later.
 void
 kvmalloc(void)
 {
-  kpgdir = setupkvm();
+  struct kmap *k;
+
+  if((kpgdir = (pde_t*)kalloc()) == 0)
+    panic("kvmalloc: out of memory");
+  memset(kpgdir, 0, PGSIZE);
+  kmap[KM_MEM].phys_end = physstop;  // as found by kinit1()
+  if (P2V(physstop) > (void*)DEVSPACE)
+    panic("physstop too high");
+  if (physstop % LPGSIZE || V2P(end) > LPGSIZE)
+    panic("kvmalloc: memory layout");
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++){
+    if(k->perm & PTE_PS)
+      maplgpages(kpgdir, k->virt, k->phys_end - k->phys_start,
+                 (uint)k->phys_start, k->perm);
+    else if(mappages(kpgdir, k->virt, k->phys_end - k->phys_start,
+                     (uint)k->phys_start, k->perm) < 0)
+      panic("kvmalloc: out of memory");
+  }
   switchkvm();
 }
 
@@ -186,36 +244,11 @@ inituvm(pde_t *pgdir, char *init, uint sz)
 
   if(sz >= PGSIZE)
     panic("inituvm: more than a page");
-  mem = kalloc();
-  memset(mem, 0, PGSIZE);
+  mem = kalloc_zeroed();
   mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W|PTE_U);
   memmove(mem, init, sz);
 }
 
-// Load a program segment into pgdir.  addr must be page-aligned
-// and the pages from addr to addr+sz must already be mapped.
-int
-loaduvm(pde_t *pgdir, char *addr, struct inode *ip, uint offset, uint sz)
-{
-  uint i, pa, n;
-  pte_t *pte;
-
-  if((uint) addr % PGSIZE != 0)
-    panic("loaduvm: addr must be page aligned");
-  for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, addr+i, 0)) == 0)
-      panic("loaduvm: address should exist");
-    pa = PTE_ADDR(*pte);
-    if(sz - i < PGSIZE)
-      n = sz - i;
-    else
-      n = PGSIZE;
-    if(readi(ip, P2V(pa), offset+i, n) != n)
-      return -1;
-  }
-  return 0;
-}
-
 // Allocate page tables and physical memory to grow process from oldsz to
 // newsz, which need not be page aligned.  Returns new size or 0 on error.
 int
@@ -231,13 +264,12 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 
   a = PGROUNDUP(oldsz);
   for(; a < newsz; a += PGSIZE){
-    mem = kalloc();
+    mem = kalloc_zeroed();
     if(mem == 0){
       cprintf("allocuvm out of memory\n");
       deallocuvm(pgdir, newsz, oldsz);
       return 0;
     }
-    memset(mem, 0, PGSIZE);
     if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
       cprintf("allocuvm out of memory (2)\n");
       deallocuvm(pgdir, newsz, oldsz);
@@ -251,7 +283,8 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 // Deallocate user pages to bring the process size from oldsz to
 // newsz.  oldsz and newsz need not be page-aligned, nor does newsz
 // need to be less than oldsz.  oldsz can be larger than the actual
-// process size.  Returns the new process size.
+// process size.  Large pages in the range must lie wholly in it.
+// Returns the new process size.
 int
 deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 {
@@ -266,12 +299,22 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
     pte = walkpgdir(pgdir, (char*)a, 0);
     if(!pte)
       a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
-    else if((*pte & PTE_P) != 0){
+    else if(*pte & PTE_PS){
+      if(a % LPGSIZE || a + LPGSIZE > oldsz)
+        panic("deallocuvm: part of a large page");
+      pa = PTE_ADDR(*pte);
+      *pte = 0;
+      kfree_pages(P2V(pa), LPGORDER);
+      a += LPGSIZE - PGSIZE;
+    } else if((*pte & PTE_P) != 0){
       pa = PTE_ADDR(*pte);
       if(pa == 0)
         panic("kfree");
       char *v = P2V(pa);
+      *pte = 0;  // first, so swapout() cannot find the page
       kfree(v);
+    } else if(*pte & PTE_SWAP){
+      swapfree(PTESLOT(*pte));
       *pte = 0;
     }
   }
@@ -279,7 +322,8 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 }
 
 // Free a page table and all the physical memory pages
-// in the user part.
+// in the user part. The kernel part's page tables are
+// shared with kpgdir and stay.
 void
 freevm(pde_t *pgdir)
 {
@@ -288,7 +332,7 @@ freevm(pde_t *pgdir)
   if(pgdir == 0)
     panic("freevm: no pgdir");
   deallocuvm(pgdir, KERNBASE, 0);
-  for(i = 0; i < NPDENTRIES; i++){
+  for(i = 0; i < PDX(KERNBASE); i++){
     if(pgdir[i] & PTE_P){
       char * v = P2V(PTE_ADDR(pgdir[i]));
       kfree(v);
@@ -311,29 +355,59 @@ clearpteu(pde_t *pgdir, char *uva)
 }
 
 // Given a parent process's page table, create a copy
-// of it for a child.
+// of it for a child. Pages that were never touched stay
+// unmapped in the child as well. The others are shared:
+// pages of shared regions stay as they are, other
+// writable pages become read-only and copy-on-write in
+// both page tables, so the caller must flush the TLB
+// if pgdir is the current page table, and swapped-out
+// pages are read back by whichever process touches
+// them first. Large pages are shared the same way.
 pde_t*
-copyuvm(pde_t *pgdir, uint sz)
+copyuvm(pde_t *pgdir)
 {
   pde_t *d;
-  pte_t *pte;
+  pte_t *pte, *cpte;
   uint pa, i, flags;
-  char *mem;
 
   if((d = setupkvm()) == 0)
     return 0;
-  for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
-      panic("copyuvm: pte should exist");
-    if(!(*pte & PTE_P))
-      panic("copyuvm: page not present");
+  for(i = 0; i < KERNBASE; i += PGSIZE){
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0){
+      i = PGADDR(PDX(i) + 1, 0, 0) - PGSIZE;
+      continue;
+    }
+    if(*pte & PTE_PS){
+      // Never swapped out, so no need to hold off swapout().
+      if((*pte & PTE_W) && !(*pte & PTE_SHARED))
+        *pte = (*pte & ~PTE_W) | PTE_COW;
+      kdup(P2V(PTE_ADDR(*pte)));
+      d[PDX(i)] = *pte;
+      i += LPGSIZE - PGSIZE;
+      continue;
+    }
+    // With interrupts off, swapout() cannot take the page
+    // before the child's reference is added; after that it
+    // leaves the page alone, since it is shared.
+    pushcli();
+    if(!(*pte & PTE_P)){
+      popcli();
+      if(*pte & PTE_SWAP){
+        if((cpte = walkpgdir(d, (void*)i, 1)) == 0)
+          goto bad;
+        *cpte = *pte;
+        swapdup(PTESLOT(*pte));
+      }
+      continue;  // or not touched yet; the child fills it in too
+    }
+    if((*pte & PTE_W) && !(*pte & PTE_SHARED))
+      *pte = (*pte & ~PTE_W) | PTE_COW;
     pa = PTE_ADDR(*pte);
     flags = PTE_FLAGS(*pte);
-    if((mem = kalloc()) == 0)
-      goto bad;
-    memmove(mem, (char*)P2V(pa), PGSIZE);
-    if(mappages(d, (void*)i, PGSIZE, V2P(mem), flags) < 0) {
-      kfree(mem);
+    kdup(P2V(pa));
+    popcli();
+    if(mappages(d, (void*)i, PGSIZE, pa, flags) < 0){
+      kfree(P2V(pa));
       goto bad;
     }
   }
@@ -344,6 +418,367 @@ bad:
   return 0;
 }
 
+// Map a freshly zeroed page at user address va in pgdir
+// with permissions perm. Heap pages get their memory this
+// way on first touch.
+static int
+zeropage(pde_t *pgdir, uint va, uint perm)
+{
+  char *mem;
+
+  if((mem = kalloc_zeroed()) == 0)
+    return -1;
+  if(mappages(pgdir, (char*)PGROUNDDOWN(va), PGSIZE, V2P(mem), perm) < 0){
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+}
+
+// Map a freshly zeroed large page over the LPGSIZE-aligned range
+// holding user address va in pgdir, with permissions perm. Fails
+// if there is no free physically contiguous block that large or
+// if the range already has pages; the caller then falls back to
+// ordinary pages. A page table left empty by munmap is freed.
+static int
+zerolgpage(pde_t *pgdir, uint va, uint perm)
+{
+  pde_t *pde;
+  pte_t *pgtab;
+  char *mem;
+  int i;
+
+  pde = &pgdir[PDX(va)];
+  pgtab = 0;
+  if(*pde & PTE_P){
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+    for(i = 0; i < NPTENTRIES; i++)
+      if(pgtab[i])
+        return -1;
+  }
+  if((mem = kalloc_pages(LPGORDER)) == 0)
+    return -1;
+  memset(mem, 0, LPGSIZE);
+  *pde = V2P(mem) | perm | PTE_PS | PTE_P;
+  if(pgtab){
+    invlpg((void*)va);  // the TLB may cache the old PDE
+    kfree((char*)pgtab);
+  }
+  return 0;
+}
+
+// Return the region of p that contains va, or 0.
+static struct vma*
+findvma(struct proc *p, uint va)
+{
+  struct vma *v;
+
+  for(v = p->vma; v < &p->vma[NVMA]; v++)
+    if(v->end && va >= v->start && va < v->end)
+      return v;
+  return 0;
+}
+
+// Page table permissions for the pages of region v.
+// Private pages of a file belong to the page cache,
+// so writing one copies it first.
+static uint
+vmaperm(struct vma *v)
+{
+  uint perm;
+
+  perm = PTE_U;
+  if(v->flags & VMA_SHARED)
+    perm |= PTE_SHARED;
+  if(v->flags & VMA_WRITE){
+    if(v->ip && !(v->flags & VMA_SHARED))
+      perm |= PTE_COW;
+    else
+      perm |= PTE_W;
+  }
+  return perm;
+}
+
+// Map the page at user address va of region v in pgdir, holding
+// its contents from v's file; the part past filesz reads as zero.
+// The page comes from the page cache, so every process mapping
+// the same file shares it, except that a private writable page
+// whose part past filesz holds more of the file, like the page
+// where a program's data meets its bss, gets a copy with those
+// bytes cleared. Caller holds v->ip's lock.
+static int
+filepage(pde_t *pgdir, struct vma *v, uint va)
+{
+  char *mem, *copy;
+  uint off, n;
+
+  off = va - v->start;
+  if(off >= v->filesz)
+    return zeropage(pgdir, va, vmaperm(v));
+  n = v->filesz - off;
+  if(n > PGSIZE)
+    n = PGSIZE;
+  if((mem = pcget(v->ip, v->off + off, v->flags & VMA_SHARED)) == 0)
+    return -1;
+  if((v->flags & (VMA_SHARED|VMA_WRITE)) == VMA_WRITE && n < PGSIZE &&
+     v->ip->size > v->off + off + n){
+    if((copy = kalloc()) == 0){
+      kfree(mem);
+      return -1;
+    }
+    memmove(copy, mem, n);
+    memset(copy + n, 0, PGSIZE - n);
+    kfree(mem);
+    mem = copy;
+  }
+  if(mappages(pgdir, (char*)va, PGSIZE, V2P(mem), vmaperm(v)) < 0){
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+}
+
+// Give the not-present page at va of process p its memory. A page
+// of a file-backed region is read from the file together with the
+// missing pages around it in the same FAULTAROUND-page window,
+// so that running through a program's text takes one fault per
+// window rather than one per page. Only the page at va has to
+// succeed. Any other page is zero-filled.
+static int
+faultin(struct proc *p, uint va)
+{
+  struct vma *v;
+  uint a, start, end;
+  pte_t *pte;
+  int r;
+
+  va = PGROUNDDOWN(va);
+  pte = walkpgdir(p->pgdir, (char*)va, 0);
+  if(pte && (*pte & PTE_SWAP))
+    return swapin(pte);
+  if((v = findvma(p, va)) == 0)
+    return zeropage(p->pgdir, va, PTE_W|PTE_U);
+  if(v->ip == 0){
+    if((v->flags & VMA_LARGE) && zerolgpage(p->pgdir, va, vmaperm(v)) == 0)
+      return 0;
+    return zeropage(p->pgdir, va, vmaperm(v));
+  }
+
+  start = va - va % (FAULTAROUND*PGSIZE);
+  end = start + FAULTAROUND*PGSIZE;
+  if(start < v->start)
+    start = v->start;
+  if(end > v->end)
+    end = v->end;
+  r = 0;
+  ilock(v->ip);
+  for(a = start; a < end; a += PGSIZE){
+    pte = walkpgdir(p->pgdir, (char*)a, 0);
+    if(pte && (*pte & (PTE_P|PTE_SWAP)))
+      continue;
+    if(filepage(p->pgdir, v, a) < 0 && a == va)
+      r = -1;
+  }
+  iunlock(v->ip);
+  return r;
+}
+
+// Drop the inode references held by the regions in vma[NVMA]
+// and mark them unused. Must be called inside a transaction,
+// since the last iput() may free the file.
+void
+freevmas(struct vma *vma)
+{
+  struct vma *v;
+
+  for(v = vma; v < &vma[NVMA]; v++){
+    if(v->ip)
+      iput(v->ip);
+    memset(v, 0, sizeof(*v));
+  }
+}
+
+// Give the copy-on-write page mapped by pte a private,
+// writable frame. If no other page table shares the frame
+// any more, simply take it over instead of copying. pte may
+// be the PDE of a large page.
+static int
+cowcopy(pte_t *pte)
+{
+  uint pa;
+  char *mem;
+  int order;
+
+  // With interrupts off, swapout() cannot take the page
+  // between the reference count check and kdup().
+  pushcli();
+  if(!(*pte & PTE_P)){
+    popcli();
+    return 0;  // swapped out meanwhile; the retry reads it back
+  }
+  pa = PTE_ADDR(*pte);
+  order = (*pte & PTE_PS) ? LPGORDER : 0;
+  if(kref(P2V(pa)) == 1){
+    *pte = (*pte & ~PTE_COW) | PTE_W;
+    popcli();
+    return 0;
+  }
+  kdup(P2V(pa));  // keep it while kalloc() may swap pages out
+  popcli();
+  if((mem = kalloc_pages(order)) == 0){
+    kfree_pages(P2V(pa), order);
+    return -1;
+  }
+  memmove(mem, P2V(pa), PGSIZE << order);
+  *pte = V2P(mem) | (PTE_FLAGS(*pte) & ~PTE_COW) | PTE_W;
+  kfree_pages(P2V(pa), order);
+  kfree_pages(P2V(pa), order);
+  return 0;
+}
+
+// Handle a page fault at virtual address va in the current
+// process; err is the error code pushed by the processor.
+// Returns 0 if the faulting access can be retried, or -1
+// if the process had no business touching va.
+int
+pagefault(uint va, uint err)
+{
+  struct proc *curproc = myproc();
+  pte_t *pte;
+
+  if(va >= KERNBASE)
+    return -1;
+  pte = walkpgdir(curproc->pgdir, (char*)va, 0);
+  if(pte == 0 || (*pte & PTE_P) == 0){
+    if(va >= curproc->sz && findvma(curproc, va) == 0)
+      return -1;
+    if(faultin(curproc, va) < 0){
+      cprintf("pagefault: cannot fill page\n");
+      return -1;
+    }
+    return 0;
+  }
+  if((err & FEC_U) && (*pte & PTE_U) == 0)
+    return -1;
+  if((err & FEC_WR) == 0 || (*pte & PTE_COW) == 0)
+    return -1;
+  if(cowcopy(pte) < 0){
+    cprintf("pagefault: out of memory\n");
+    return -1;
+  }
+  invlpg((void*)PGROUNDDOWN(va));
+  return 0;
+}
+
+// Keep the pages in [start, end) of p in memory until p's
+// next system call. When pin[] is full, the last range grows.
+static void
+pin(struct proc *p, uint start, uint end)
+{
+  if(p->npin < NPIN){
+    p->pin[p->npin].start = start;
+    p->pin[p->npin].end = end;
+    p->npin++;
+    return;
+  }
+  if(start < p->pin[NPIN-1].start)
+    p->pin[NPIN-1].start = start;
+  if(end > p->pin[NPIN-1].end)
+    p->pin[NPIN-1].end = end;
+}
+
+// Make sure the current process's pages covering [va, va+len)
+// are present, so the kernel can read them without faulting,
+// for example while holding a spinlock, and keep them so for
+// the rest of the system call. If write is set, the kernel is
+// going to write them too, so copy-on-write pages get their
+// private copy now, where running out of memory fails the
+// system call instead of a fault in the kernel, and pages the
+// process may not write are refused. The caller has
+// checked that the range lies below sz and holds no locks,
+// since reading a page from a file may sleep. Returns -1 if a
+// page cannot be filled.
+int
+uvmprefault(uint va, uint len, int write)
+{
+  struct proc *curproc = myproc();
+  uint a, last;
+  pte_t *pte;
+
+  if(len == 0)
+    return 0;
+  a = PGROUNDDOWN(va);
+  last = PGROUNDDOWN(va + len - 1);
+  pin(curproc, a, last + PGSIZE);
+  for(;; a += PGSIZE){
+    pte = walkpgdir(curproc->pgdir, (char*)a, 0);
+    if(pte == 0 || (*pte & PTE_P) == 0){
+      if(faultin(curproc, a) < 0)
+        return -1;
+      pte = walkpgdir(curproc->pgdir, (char*)a, 0);
+    }
+    if(write && (*pte & PTE_COW)){
+      if(cowcopy(pte) < 0)
+        return -1;
+      invlpg((void*)a);
+    }
+    if(write && (*pte & PTE_W) == 0)
+      return -1;  // text, or mapped without PROT_WRITE
+    if(a == last)
+      break;
+  }
+  return 0;
+}
+
+// Sweep the clock hand over p's user pages, from where it
+// stopped last time, on behalf of swapout(). A page that was
+// used since the last sweep loses its accessed bit; one that
+// was not, that only p maps, and that is not pinned, is moved
+// to the swap slot slot[i] and stored in page[i] for writing.
+// Returns the number of pages taken, at most n. Caller holds
+// ptable.lock, and p is not running on another CPU. Large
+// pages are left alone.
+int
+uvmevict(struct proc *p, uint *slot, char **page, int n)
+{
+  uint va;
+  pte_t *pte;
+  char *mem;
+  int i, got;
+
+  got = 0;
+  for(va = p->clock; va < KERNBASE && got < n; va += PGSIZE){
+    if((p->pgdir[PDX(va)] & PTE_P) == 0 || (p->pgdir[PDX(va)] & PTE_PS)){
+      va = PGADDR(PDX(va) + 1, 0, 0) - PGSIZE;
+      continue;
+    }
+    pte = walkpgdir(p->pgdir, (char*)va, 0);
+    if((*pte & (PTE_P|PTE_U)) != (PTE_P|PTE_U) || (*pte & PTE_SHARED))
+      continue;
+    if(*pte & PTE_A){
+      *pte &= ~PTE_A;
+      if(p == myproc())
+        invlpg((void*)va);
+      continue;
+    }
+    mem = P2V(PTE_ADDR(*pte));
+    if(kref(mem) != 1)
+      continue;
+    for(i = 0; i < p->npin; i++)
+      if(va >= p->pin[i].start && va < p->pin[i].end)
+        break;
+    if(i < p->npin)
+      continue;
+    *pte = (slot[got] << PTXSHIFT) | (PTE_FLAGS(*pte) & (PTE_W|PTE_U|PTE_COW)) |
+           PTE_SWAP;
+    if(p == myproc())
+      invlpg((void*)va);
+    page[got++] = mem;
+  }
+  p->clock = va < KERNBASE ? va : 0;
+  return got;
+}
+
 //PAGEBREAK!
 // Map user virtual address to kernel address.
 char*
@@ -352,25 +787,40 @@ uva2ka(pde_t *pgdir, char *uva)
   pte_t *pte;
 
   pte = walkpgdir(pgdir, uva, 0);
-  if((*pte & PTE_P) == 0)
+  if(pte == 0 || (*pte & PTE_P) == 0)
     return 0;
   if((*pte & PTE_U) == 0)
     return 0;
+  if(*pte & PTE_PS)
+    return (char*)P2V(PTE_ADDR(*pte) + (PGROUNDDOWN((uint)uva) & (LPGSIZE-1)));
   return (char*)P2V(PTE_ADDR(*pte));
 }
 
 // Copy len bytes from p to user address va in page table pgdir.
 // Most useful when pgdir is not the current page table.
-// uva2ka ensures this only works for PTE_U pages.
+// uva2ka ensures this only works for PTE_U pages, and it fails
+// for pages the process may not write.
 int
 copyout(pde_t *pgdir, uint va, void *p, uint len)
 {
   char *buf, *pa0;
   uint n, va0;
+  pte_t *pte;
 
   buf = (char*)p;
   while(len > 0){
     va0 = (uint)PGROUNDDOWN(va);
+    pte = walkpgdir(pgdir, (char*)va0, 0);
+    if((pte == 0 || (*pte & PTE_P) == 0) && zeropage(pgdir, va0, PTE_W|PTE_U) < 0)
+      return -1;
+    pte = walkpgdir(pgdir, (char*)va0, 0);
+    if(*pte & PTE_COW){
+      if(cowcopy(pte) < 0)
+        return -1;
+      invlpg((void*)va0);
+    }
+    if((*pte & PTE_W) == 0)
+      return -1;
     pa0 = uva2ka(pgdir, (char*)va0);
     if(pa0 == 0)
       return -1;
@@ -385,6 +835,276 @@ copyout(pde_t *pgdir, uint va, void *p, uint len)
   return 0;
 }
 
+//PAGEBREAK!
+// Memory-mapped regions.
+
+// Return 1 if the n bytes at user address va all belong to the
+// current process: below sz or inside one of its regions.
+int
+uvmvalid(uint va, uint n)
+{
+  struct proc *curproc = myproc();
+  struct vma *v;
+  uint m;
+
+  if(va + n < va)
+    return 0;
+  do {
+    if(va < curproc->sz)
+      m = curproc->sz - va;
+    else if((v = findvma(curproc, va)) != 0)
+      m = v->end - va;
+    else
+      return 0;
+    if(m > n)
+      m = n;
+    va += m;
+    n -= m;
+  } while(n > 0);
+  return 1;
+}
+
+// Return the lowest address of p's mmap regions, or KERNBASE
+// if there are none. The heap must stay below it.
+uint
+mmapbase(struct proc *p)
+{
+  struct vma *v;
+  uint base;
+
+  base = KERNBASE;
+  for(v = p->vma; v < &p->vma[NVMA]; v++)
+    if(v->end && (v->flags & VMA_MMAP) && v->start < base)
+      base = v->start;
+  return base;
+}
+
+// Find the highest free len bytes between p's heap and KERNBASE,
+// starting at a multiple of align. Free space ends either at
+// KERNBASE or at the start of a region, so only those ends need
+// to be tried. Returns 0 if there is none.
+static uint
+mmapfind(struct proc *p, uint len, uint align)
+{
+  struct vma *v, *w;
+  uint start, end, best;
+
+  best = 0;
+  for(v = p->vma; v <= &p->vma[NVMA]; v++){
+    if(v == &p->vma[NVMA])
+      end = KERNBASE;
+    else if(v->end && (v->flags & VMA_MMAP))
+      end = v->start;
+    else
+      continue;
+    if(end < len || (start = (end - len) & ~(align - 1)) < PGROUNDUP(p->sz) ||
+       start <= best)
+      continue;
+    for(w = p->vma; w < &p->vma[NVMA]; w++)
+      if(w->end && (w->flags & VMA_MMAP) && start < w->end && w->start < start + len)
+        break;
+    if(w == &p->vma[NVMA])
+      best = start;
+  }
+  return best;
+}
+
+// Map len bytes at a new address of the current process.
+// flags holds VMA_WRITE and VMA_SHARED. If ip is not 0, the
+// region shows ip's contents from off on, as far as the file
+// went at the time of the call; the rest reads as zero.
+// If sh is not 0, the region maps the pages of shared-memory
+// segment sh, of at least len bytes. Otherwise the region is
+// zero-filled memory, which with VMA_LARGE in flags is given
+// large pages where it can: such a region starts and ends on a
+// large page boundary. The region holds its own reference to
+// ip or sh. Returns the address, or 0 on failure.
+uint
+mmap(uint len, int flags, struct inode *ip, uint off, struct shm *sh)
+{
+  struct proc *curproc = myproc();
+  struct vma *v;
+  uint a, start, filesz, align;
+  char *mem;
+
+  align = (flags & VMA_LARGE) ? LPGSIZE : PGSIZE;
+  len = (len + align - 1) & ~(align - 1);
+  if(len == 0 || len >= KERNBASE)
+    return 0;
+  for(v = curproc->vma; v < &curproc->vma[NVMA]; v++)
+    if(v->end == 0)
+      break;
+  if(v == &curproc->vma[NVMA] || (start = mmapfind(curproc, len, align)) == 0)
+    return 0;
+
+  filesz = 0;
+  if(ip){
+    ilock(ip);
+    if(ip->type != T_FILE){
+      iunlock(ip);
+      return 0;
+    }
+    if(off < ip->size)
+      filesz = ip->size - off;
+    iunlock(ip);
+    if(filesz > len)
+      filesz = len;
+    idup(ip);
+  }
+  v->start = start;
+  v->end = start + len;
+  v->flags = flags | VMA_MMAP;
+  v->ip = ip;
+  v->off = off;
+  v->filesz = filesz;
+  v->shm = sh;
+  if(sh){
+    shmdup(sh);
+    for(a = start; a < v->end; a += PGSIZE){
+      mem = sh->page[(a - start) / PGSIZE];
+      if(mappages(curproc->pgdir, (char*)a, PGSIZE, V2P(mem), vmaperm(v)) < 0){
+        munmap(start, len);
+        return 0;
+      }
+      kdup(mem);
+    }
+    return start;
+  }
+
+  // Processes sharing anonymous memory must all see the same
+  // pages, including children forked before a page was first
+  // touched, so such a region gets its memory now.
+  if(ip == 0 && (flags & VMA_SHARED)){
+    for(a = start; a < v->end; a += PGSIZE){
+      if((flags & VMA_LARGE) && a % LPGSIZE == 0 &&
+         zerolgpage(curproc->pgdir, a, vmaperm(v)) == 0){
+        a += LPGSIZE - PGSIZE;
+        continue;
+      }
+      if(zeropage(curproc->pgdir, a, vmaperm(v)) < 0){
+        munmap(start, len);
+        return 0;
+      }
+    }
+  }
+  return start;
+}
+
+// Write the dirty pages of region v between start and end back
+// to its file, a few blocks per transaction as in filewrite(),
+// and mark them clean. Only the bytes the region had of the
+// file are written.
+static void
+vmaflush(struct proc *p, struct vma *v, uint start, uint end)
+{
+  int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
+  uint a, i, n, n1;
+  pte_t *pte;
+  char *mem;
+  int ok;
+
+  for(a = start; a < end && a - v->start < v->filesz; a += PGSIZE){
+    pte = walkpgdir(p->pgdir, (char*)a, 0);
+    if(pte == 0 || (*pte & (PTE_P|PTE_D)) != (PTE_P|PTE_D))
+      continue;
+    mem = P2V(PTE_ADDR(*pte));
+    n = v->filesz - (a - v->start);
+    if(n > PGSIZE)
+      n = PGSIZE;
+    ok = 1;
+    for(i = 0; i < n; i += n1){
+      n1 = n - i;
+      if(n1 > max)
+        n1 = max;
+      begin_op();
+      ilock(v->ip);
+      if(writei(v->ip, mem + i, v->off + (a - v->start) + i, n1) != n1)
+        ok = 0;
+      iunlock(v->ip);
+      end_op();
+    }
+    // Clean now, so the next flush skips the page unless
+    // it is written again.
+    if(ok){
+      *pte &= ~PTE_D;
+      if(p == myproc())
+        invlpg((void*)a);
+    }
+  }
+}
+
+// Remove the current process's mmap regions between addr and
+// addr+len, which must be page aligned. Dirty pages of shared
+// file regions are first written back. Returns -1 if a region
+// would have to be split in two and there is no free slot, or
+// if a large-page region would be cut off its page boundaries.
+int
+munmap(uint addr, uint len)
+{
+  struct proc *curproc = myproc();
+  struct vma *v, *w;
+  uint start, end, d;
+
+  for(v = curproc->vma; v < &curproc->vma[NVMA]; v++){
+    if(v->end == 0 || !(v->flags & VMA_LARGE) ||
+       v->end <= addr || addr + len <= v->start)
+      continue;
+    if((addr > v->start && addr % LPGSIZE) ||
+       (addr + len < v->end && (addr + len) % LPGSIZE))
+      return -1;
+  }
+  for(v = curproc->vma; v < &curproc->vma[NVMA]; v++){
+    if(v->end == 0 || !(v->flags & VMA_MMAP) ||
+       v->end <= addr || addr + len <= v->start)
+      continue;
+    start = v->start > addr ? v->start : addr;
+    end = v->end < addr + len ? v->end : addr + len;
+    if(start > v->start && end < v->end){
+      for(w = curproc->vma; w < &curproc->vma[NVMA]; w++)
+        if(w->end == 0)
+          break;
+      if(w == &curproc->vma[NVMA])
+        return -1;
+      *w = *v;
+      d = end - v->start;
+      w->start = end;
+      w->off += d;
+      w->filesz = w->filesz > d ? w->filesz - d : 0;
+      if(w->ip)
+        idup(w->ip);
+      if(w->shm)
+        shmdup(w->shm);
+      v->end = end;
+    }
+
+    if(v->ip && (v->flags & VMA_SHARED) && (v->flags & VMA_WRITE))
+      vmaflush(curproc, v, start, end);
+    deallocuvm(curproc->pgdir, end, start);
+
+    if(start == v->start && end == v->end){
+      if(v->ip){
+        begin_op();
+        iput(v->ip);
+        end_op();
+      }
+      if(v->shm)
+        shmput(v->shm);
+      memset(v, 0, sizeof(*v));
+    } else if(start == v->start){
+      d = end - v->start;
+      v->start = end;
+      v->off += d;
+      v->filesz = v->filesz > d ? v->filesz - d : 0;
+    } else {
+      v->end = start;
+      if(v->filesz > start - v->start)
+        v->filesz = start - v->start;
+    }
+  }
+  lcr3(V2P(curproc->pgdir));
+  return 0;
+}
+
 //PAGEBREAK!
 // Blank page.
 //PAGEBREAK!
@@ -130,6 +130,17 @@ xchg(volatile uint *addr, uint newval)
   return result;
 }
 
+// Atomically add incr to *addr and return the old value.
+static inline int
+xadd(volatile int *addr, int incr)
+{
+  asm volatile("lock; xaddl %0, %1" :
+               "+r" (incr), "+m" (*addr) :
+               :
+               "cc", "memory");
+  return incr;
+}
+
 static inline uint
 rcr2(void)
 {
@@ -144,6 +155,22 @@ lcr3(uint val)
   asm volatile("movl %0,%%cr3" : : "r" (val));
 }
 
+static inline void
+invlpg(void *addr)
+{
+  asm volatile("invlpg (%0)" : : "r" (addr) : "memory");
+}
+
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  return ((uint64)hi << 32) | lo;
+}
+
 //PAGEBREAK: 36
 // Layout of the trap frame built on the stack by the
 // hardware and by trapasm.S, and passed to trap().